@@ -432,6 +432,7 @@ private:
   bool NewtonKrylov;           /*!< \brief Use a coupled Newton method to solve the flow equations. */
   array<unsigned short,3> NK_IntParam{{20, 3, 2}}; /*!< \brief Integer parameters for NK method. */
   array<su2double,4> NK_DblParam{{-2.0, 0.1, -3.0, 1e-4}}; /*!< \brief Floating-point parameters for NK method. */
+  bool NK_Refinement;          /*!< \brief Use mixed precision iterative refinement in the NK startup solves. */
 
   unsigned short nMGLevels;    /*!< \brief Number of multigrid levels (coarse levels). */
   unsigned short nCFL;         /*!< \brief Number of CFL, one for each multigrid level. */
@@ -634,7 +635,10 @@ private:
   unsigned long Linear_Solver_Iter;              /*!< \brief Max iterations of the linear solver for the implicit formulation. */
   unsigned long Deform_Linear_Solver_Iter;       /*!< \brief Max iterations of the linear solver for the implicit formulation. */
   unsigned long Linear_Solver_Restart_Frequency; /*!< \brief Restart frequency of the linear solver for the implicit formulation. */
+  unsigned long Linear_Solver_Recycle_Size;      /*!< \brief Size of the subspace recycled by GCRO-DR between linear systems. */
   unsigned long Linear_Solver_Prec_Threads;      /*!< \brief Number of threads per rank for ILU and LU_SGS preconditioners. */
+  bool Linear_Solver_ILU_Level_Scheduling;       /*!< \brief Use level scheduling instead of partitions for threaded ILU. */
+  LINEAR_SOLVER_MATRIX_FORMAT Kind_Linear_Solver_Matrix_Format; /*!< \brief Storage format of the matrices in the products of the linear solvers. */
   unsigned short Linear_Solver_ILU_n;            /*!< \brief ILU fill=in level. */
   su2double SemiSpan;                   /*!< \brief Wing Semi span. */
   su2double Roe_Kappa;                  /*!< \brief Relaxation of the Roe scheme. */
@@ -1071,6 +1075,8 @@ private:
   su2double ParMETIS_tolerance;     /*!< \brief Load balancing tolerance for ParMETIS. */
   long ParMETIS_pointWgt;           /*!< \brief Load balancing weight given to points. */
   long ParMETIS_edgeWgt;            /*!< \brief Load balancing weight given to edges. */
+  bool Partition_Cache;             /*!< \brief Read/write the ParMETIS partitioning from/to a cache file. */
+  string Partition_Cache_FileName;  /*!< \brief Name of the partition cache file. */
   unsigned short DirectDiff;        /*!< \brief Direct Differentation mode. */
   bool DiscreteAdjoint,                /*!< \brief AD-based discrete adjoint mode. */
   DiscreteAdjointDebug;                /*!< \brief Discrete adjoint debug mode using tags. */
@@ -4264,6 +4270,12 @@ public:
    */
   unsigned long GetLinear_Solver_Restart_Frequency(void) const { return Linear_Solver_Restart_Frequency; }
 
+  /*!
+   * \brief Get the number of directions recycled by GCRO-DR between linear systems.
+   * \return Size of the recycled subspace.
+   */
+  unsigned long GetLinear_Solver_Recycle_Size(void) const { return Linear_Solver_Recycle_Size; }
+
   /*!
    * \brief Get the relaxation factor for iterative linear smoothers.
    * \return Relaxation factor.
@@ -4324,6 +4336,11 @@ public:
    */
   array<su2double,4> GetNewtonKrylovDblParam(void) const { return NK_DblParam; }
 
+  /*!
+   * \brief Get whether to use mixed precision iterative refinement in the Newton-Krylov startup solves.
+   */
+  bool GetNewtonKrylovRefinement(void) const { return NK_Refinement; }
+
   /*!
    * \brief Returns the Roe kappa (multipler of the dissipation term).
    */
@@ -5559,8 +5576,9 @@ public:
     /*--- we keep the original Mesh_FileName  ---*/
     string meshFilename = Mesh_FileName;
 
-    /*--- strip the extension, only if it is .su2 or .cgns ---*/
+    /*--- strip the extension, only if it is .su2, .su2b or .cgns ---*/
     PrintingToolbox::TrimExtension(".su2",meshFilename);
+    PrintingToolbox::TrimExtension(".su2b",meshFilename);
     PrintingToolbox::TrimExtension(".cgns",meshFilename);
 
     switch (GetMesh_FileFormat()) {
@@ -5569,6 +5587,9 @@ public:
       case BOX:
         meshFilename += ".su2";
         break;
+      case SU2_BINARY:
+        meshFilename += ".su2b";
+        break;
       case CGNS_GRID:
         meshFilename += ".cgns";
         break;
@@ -5590,8 +5611,9 @@ public:
     /*--- we keep the original Mesh_Out_FileName  ---*/
     string meshFilename = Mesh_Out_FileName;
 
-    /*--- strip the extension, only if it is .su2 or .cgns ---*/
+    /*--- strip the extension, only if it is .su2, .su2b or .cgns ---*/
     PrintingToolbox::TrimExtension(".su2",meshFilename);
+    PrintingToolbox::TrimExtension(".su2b",meshFilename);
     PrintingToolbox::TrimExtension(".cgns",meshFilename);
 
     return meshFilename;
@@ -9925,6 +9947,16 @@ public:
    */
   unsigned long GetLinear_Solver_Prec_Threads(void) const { return Linear_Solver_Prec_Threads; }
 
+  /*!
+   * \brief Get the storage format of the sparse matrices used in the products of the linear solvers.
+   */
+  LINEAR_SOLVER_MATRIX_FORMAT GetKind_Linear_Solver_Matrix_Format(void) const { return Kind_Linear_Solver_Matrix_Format; }
+
+  /*!
+   * \brief Get whether the threaded ILU preconditioner uses level scheduling (exact ILU of each rank).
+   */
+  bool GetLinear_Solver_ILU_Level_Scheduling(void) const { return Linear_Solver_ILU_Level_Scheduling; }
+
   /*!
    * \brief Get the size of the edge groups colored for OpenMP parallelization of edge loops.
    */
@@ -9950,6 +9982,20 @@ public:
    */
   long GetParMETIS_EdgeWeight() const { return ParMETIS_edgeWgt; }
 
+  /*!
+   * \brief Check if the partitioning is read from (or written to) a cache file to skip ParMETIS on restarts.
+   */
+  bool GetPartition_Cache() const { return Partition_Cache; }
+
+  /*!
+   * \brief Get the name of the partition cache file (with the zone number for multizone problems).
+   */
+  string GetPartition_Cache_FileName() const {
+    string filename = Partition_Cache_FileName;
+    PrintingToolbox::TrimExtension(".dat", filename);
+    return GetMultizone_FileName(filename, GetiZone(), ".dat");
+  }
+
   /*!
    * \brief Find the marker index (if any) that is part of a given interface pair.
    * \param[in] iInterface - Number of the interface pair being tested, starting at 0.
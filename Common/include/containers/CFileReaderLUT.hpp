@@ -26,8 +26,11 @@
  */
 #pragma once
 
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "../../Common/include/parallelization/mpi_structure.hpp"
@@ -150,3 +153,103 @@ class CFileReaderLUT {
    */
   void ReadRawLUT(const std::string& file_name);
 };
+
+/*!
+ * \brief Reader and writer of the binary (preprocessed) look-up table format.
+ * \details The file is a sequence of 64-bit integers and doubles (in native byte order), strings are stored as their
+ * length followed by the characters padded to 8 bytes. For reading the file is memory-mapped (where supported),
+ * therefore only the parts of the file that are actually read are loaded from disk.
+ * \ingroup LookUpInterp
+ */
+class CBinaryFileLUT {
+ private:
+  const char* data = nullptr; /*!< \brief Start of the file contents. */
+  std::size_t size = 0;       /*!< \brief Size of the file. */
+  std::size_t pos = 0;        /*!< \brief Current read position. */
+  std::vector<char> buffer;   /*!< \brief File contents when memory mapping is not available. */
+  bool mapped = false;        /*!< \brief Whether data is memory-mapped. */
+
+  /*! \brief Check that n bytes can be read from the current position. */
+  inline const char* Advance(std::size_t n) {
+    if (pos + n > size) SU2_MPI::Error("Unexpected end of binary look-up table file.", CURRENT_FUNCTION);
+    const char* ptr = data + pos;
+    pos += n;
+    return ptr;
+  }
+
+  /*! \brief Convert and copy n values of type Stored to dst. */
+  template <class Stored, class T>
+  void ReadArray(T* dst, std::size_t n) {
+    const char* src = Advance(n * sizeof(Stored));
+    if (std::is_same<Stored, T>::value) {
+      memcpy(static_cast<void*>(dst), src, n * sizeof(Stored));
+    } else {
+      for (std::size_t i = 0; i < n; ++i) {
+        Stored val;
+        memcpy(&val, src + i * sizeof(Stored), sizeof(Stored));
+        dst[i] = val;
+      }
+    }
+  }
+
+ public:
+  static constexpr char magic[] = "SU2LUTB1"; /*!< \brief Identifier at the start of binary table files. */
+
+  /*!
+   * \brief Check whether a file is a binary table (by its first bytes).
+   * \param[in] file_name - Table file name.
+   */
+  static bool IsBinary(const std::string& file_name);
+
+  /*!
+   * \brief Map the file to memory and check its identifier.
+   * \param[in] file_name - Table file name.
+   */
+  explicit CBinaryFileLUT(const std::string& file_name);
+
+  ~CBinaryFileLUT();
+
+  CBinaryFileLUT(const CBinaryFileLUT&) = delete;
+  CBinaryFileLUT& operator=(const CBinaryFileLUT&) = delete;
+
+  /*! \brief Read one integer. */
+  inline unsigned long ReadInteger() {
+    std::uint64_t val;
+    ReadArray<std::uint64_t>(&val, 1);
+    return val;
+  }
+
+  /*! \brief Read n integers into dst. */
+  inline void ReadIntegers(unsigned long* dst, std::size_t n) { ReadArray<std::uint64_t>(dst, n); }
+
+  /*! \brief Read n reals into dst. */
+  inline void ReadReals(su2double* dst, std::size_t n) { ReadArray<double>(dst, n); }
+
+  /*! \brief Skip n reals (e.g. when another rank reads them). */
+  inline void SkipReals(std::size_t n) { Advance(n * sizeof(double)); }
+
+  /*! \brief Read a string. */
+  std::string ReadString();
+
+  /*! \brief Write one integer. */
+  static inline void WriteInteger(std::ostream& file, unsigned long val) {
+    const std::uint64_t tmp = val;
+    file.write(reinterpret_cast<const char*>(&tmp), sizeof(tmp));
+  }
+
+  /*! \brief Write n integers. */
+  static inline void WriteIntegers(std::ostream& file, const unsigned long* src, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) WriteInteger(file, src[i]);
+  }
+
+  /*! \brief Write n reals. */
+  static inline void WriteReals(std::ostream& file, const su2double* src, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+      const double tmp = SU2_TYPE::GetValue(src[i]);
+      file.write(reinterpret_cast<const char*>(&tmp), sizeof(tmp));
+    }
+  }
+
+  /*! \brief Write a string. */
+  static void WriteString(std::ostream& file, const std::string& str);
+};
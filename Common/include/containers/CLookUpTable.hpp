@@ -80,6 +80,11 @@ class CLookUpTable {
    */
   su2vector<su2activematrix> table_data;
 
+  /*! \brief
+   * Start of the data of each table level, i.e. of table_data or of the node-shared copy of a binary table.
+   */
+  su2vector<su2double*> data_levels;
+
   double memory_footprint_data = 0; /*!< \brief Memory footprint of the loaded table data. */
 
   /*! \brief
@@ -94,6 +99,25 @@ class CLookUpTable {
   su2vector<std::vector<std::array<unsigned long, 2>>> edges;
   su2vector<su2vector<std::vector<unsigned long>>> edge_to_triangle;
 
+  /*! \brief
+   * Triangles adjacent to each triangle of each table level, the i-th neighbor shares the edge opposite
+   * to the i-th vertex. Triangles on the hull have n_triangles as neighbor index.
+   */
+  su2vector<su2matrix<unsigned long>> triangle_neighbors;
+
+  /*! \brief
+   * Inclusion triangle of the last query on each table level, successive queries (e.g. several look-ups
+   * for the same point) start the search from this triangle.
+   * \note This makes look-ups non-reentrant, each thread must use its own table (i.e. its own fluid model).
+   */
+  su2vector<unsigned long> last_triangle;
+
+  /*! \brief Maximum number of triangles visited when walking from the last inclusion triangle. */
+  static constexpr unsigned long max_walk_steps = 32;
+
+  /*! \brief Work arrays for the upper and lower level results of quasi-3D look-ups. */
+  std::vector<su2double> val_vars_lower, val_vars_upper;
+
   /*! \brief
    * The hull contains the boundary of the lookup table.
    */
@@ -105,9 +129,19 @@ class CLookUpTable {
   su2vector<CTrapezoidalMap> trap_map_x_y;
 
   /*! \brief
-   * Vector of all the weight factors for the interpolation.
+   * Vector of all the weight factors for the interpolation, one row-major 3x3 matrix per triangle.
+   */
+  su2vector<su2activematrix> interp_mat_inv_x_y;
+
+  /*! \brief
+   * Start of the interpolation matrices of each table level (see data_levels).
    */
-  su2vector<su2vector<su2activematrix>> interp_mat_inv_x_y;
+  su2vector<su2double*> interp_levels;
+
+#if defined(HAVE_MPI) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+  MPI_Comm node_comm = MPI_COMM_NULL; /*!< \brief Ranks sharing the memory of a binary table. */
+  MPI_Win node_window = MPI_WIN_NULL; /*!< \brief Shared window holding the data and interpolation matrices. */
+#endif
 
   /*! \brief
    * Returns true if the string is null or zero (ignores case).
@@ -126,7 +160,25 @@ class CLookUpTable {
    * \returns Pointer to the column data.
    */
   inline const su2double* GetDataP(const std::string& name_var, unsigned long i_level = 0) const {
-    return table_data[i_level][GetIndexOfVar(name_var)];
+    return LevelData(i_level, GetIndexOfVar(name_var));
+  }
+
+  /*!
+   * \brief Get the pointer to the data of a variable on a table level.
+   * \param[in] i_level - Table level index.
+   * \param[in] i_var - Table data column index.
+   */
+  inline su2double* LevelData(unsigned long i_level, unsigned long i_var) const {
+    return data_levels[i_level] + i_var * n_points[i_level];
+  }
+
+  /*!
+   * \brief Get the pointer to the (row-major) inverse interpolation matrix of a triangle.
+   * \param[in] i_level - Table level index.
+   * \param[in] i_triangle - Triangle index.
+   */
+  inline const su2double* InterpMatInv(unsigned long i_level, unsigned long i_triangle) const {
+    return interp_levels[i_level] + i_triangle * N_POINTS_TRIANGLE * N_POINTS_TRIANGLE;
   }
 
   /*!
@@ -143,12 +195,36 @@ class CLookUpTable {
    */
   void IdentifyUniqueEdges();
 
+  /*!
+   * \brief Construct the triangle to triangle connectivity (from the edges) used to walk the table.
+   */
+  void IdentifyTriangleNeighbors();
+
   /*!
    * \brief Read the lookup table from file and store the data.
    * \param[in] file_name_lut - the filename of the lookup table.
    */
   void LoadTableRaw(const std::string& file_name_lut);
 
+  /*!
+   * \brief Read a binary lookup table (see WriteBinaryTable), including the search structures.
+   * \note In MPI builds the data and interpolation matrices are read once per node, into shared memory.
+   * \param[in] file_name_lut - the filename of the lookup table.
+   */
+  void LoadTableBinary(const std::string& file_name_lut);
+
+  /*!
+   * \brief Allocate the storage of the data and interpolation matrices of all levels.
+   * \param[in] shared - Allocate a node-shared window if possible, otherwise owned storage.
+   * \returns Whether this rank must fill the storage.
+   */
+  bool AllocateTableStorage(bool shared);
+
+  /*!
+   * \brief Build the trapezoidal maps of all table levels.
+   */
+  void BuildTrapezoidalMaps();
+
   /*!
    * \brief Compute vector of all (inverse) interpolation coefficients "interp_mat_inv_x_y" of all triangles.
    */
@@ -159,19 +235,19 @@ class CLookUpTable {
    * \param[in] vec_CV1 - Pointer to first coordinate (progress variable).
    * \param[in] vec_CV2 - Pointer to second coordinate (enthalpy).
    * \param[in] point_ids - Single triangle data.
-   * \param[out] interp_mat_inv - Inverse matrix for interpolation.
+   * \param[out] interp_mat_inv - Inverse matrix for interpolation (row-major).
    */
   void GetInterpMatInv(const su2double* vec_CV1, const su2double* vec_CV2, std::array<unsigned long, 3>& point_ids,
-                       su2activematrix& interp_mat_inv);
+                       su2double* interp_mat_inv);
 
   /*!
    * \brief Compute the interpolation coefficients for the triangular interpolation.
    * \param[in] val_CV1 - Value of first coordinate (progress variable).
    * \param[in] val_CV2 - Value of second coordinate (enthalpy).
-   * \param[in] interp_mat_inv - Inverse matrix for interpolation.
+   * \param[in] interp_mat_inv - Inverse matrix for interpolation (row-major).
    * \param[out] interp_coeffs - Interpolation coefficients.
    */
-  void GetInterpCoeffs(su2double val_CV1, su2double val_CV2, const su2activematrix& interp_mat_inv,
+  void GetInterpCoeffs(su2double val_CV1, su2double val_CV2, const su2double* interp_mat_inv,
                        std::array<su2double, 3>& interp_coeffs) const;
 
   /*!
@@ -306,6 +382,48 @@ class CLookUpTable {
   bool FindInclusionTriangle(const su2double val_CV1, const su2double val_CV2, unsigned long& id_triangle,
                              const unsigned long iLevel = 0);
 
+  /*!
+   * \brief Walk from the last inclusion triangle towards the query point (val_CV1, val_CV2), crossing the edge
+   * opposite to the most negative barycentric coordinate at each step.
+   * \param[in] val_CV1 - First controlling variable value.
+   * \param[in] val_CV2 - Second controlling variable value.
+   * \param[out] id_triangle - Inclusion triangle index, if found.
+   * \param[in] iLevel - Table level index.
+   * \returns whether the inclusion triangle was found within max_walk_steps (without leaving the table).
+   */
+  bool WalkToTriangle(const su2double val_CV1, const su2double val_CV2, unsigned long& id_triangle,
+                      const unsigned long iLevel);
+
+  /*!
+   * \brief Interpolate several variables in the same triangle, i.e. sharing the search and the coefficients.
+   * \param[in] val_CV1 - First controlling variable value.
+   * \param[in] val_CV2 - Second controlling variable value.
+   * \param[in] id_triangle - Inclusion triangle index.
+   * \param[in] idx_var - Table data column indices of the variables.
+   * \param[in] n_vars - Number of variables.
+   * \param[out] get_output - Function returning a reference to the output of the i-th variable.
+   * \param[in] i_level - Table level index.
+   */
+  template <class OutputFunc>
+  void InterpolateInTriangle(const su2double val_CV1, const su2double val_CV2, const unsigned long id_triangle,
+                             const unsigned long* idx_var, const size_t n_vars, const OutputFunc& get_output,
+                             const unsigned long i_level) {
+    std::array<su2double, N_POINTS_TRIANGLE> interp_coeffs{0};
+    std::array<unsigned long, N_POINTS_TRIANGLE> triangle{0};
+    for (auto iVertex = 0u; iVertex < N_POINTS_TRIANGLE; iVertex++)
+      triangle[iVertex] = triangles[i_level][id_triangle][iVertex];
+
+    GetInterpCoeffs(val_CV1, val_CV2, InterpMatInv(i_level, id_triangle), interp_coeffs);
+
+    for (auto iVar = 0ul; iVar < n_vars; iVar++) {
+      if (idx_var[iVar] == idx_null) {
+        get_output(iVar) = 0;
+      } else {
+        get_output(iVar) = Interpolate(LevelData(i_level, idx_var[iVar]), triangle, interp_coeffs);
+      }
+    }
+  }
+
   /*!
    * \brief Identify the nearest second nearest hull nodes w.r.t. the query point (val_CV1, val_CV2).
    * \param[in] val_CV1 - First controlling variable value.
@@ -317,8 +435,28 @@ class CLookUpTable {
                                                                const unsigned long iLevel = 0);
 
  public:
+  /*!
+   * \brief Load a table in the ASCII (.drg) or binary format, the format is detected from the file contents.
+   * \note Collective, all ranks of SU2_MPI::GetComm() must construct the table.
+   * \param[in] file_name_lut - Table file name.
+   * \param[in] name_CV1_in - Name of controlling variable 1.
+   * \param[in] name_CV2_in - Name of controlling variable 2.
+   */
   CLookUpTable(const std::string& file_name_lut, std::string name_CV1_in, std::string name_CV2_in);
 
+  ~CLookUpTable();
+
+  CLookUpTable(const CLookUpTable&) = delete;
+  CLookUpTable& operator=(const CLookUpTable&) = delete;
+
+  /*!
+   * \brief Write the table and its search structures (connectivity, trapezoidal maps, interpolation
+   * matrices) in binary format, for a faster start-up. The controlling variables cannot be changed
+   * when the binary table is loaded.
+   * \param[in] file_name - Output file name.
+   */
+  void WriteBinaryTable(const std::string& file_name) const;
+
   /*!
    * \brief Print information to screen.
    */
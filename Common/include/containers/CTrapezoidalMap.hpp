@@ -31,6 +31,7 @@
 #include <vector>
 
 #include "../../Common/include/linear_algebra/blas_structure.hpp"
+#include "CFileReaderLUT.hpp"
 #include "../../Common/include/toolboxes/CSquareMatrixCM.hpp"
 
 /*!
@@ -63,6 +64,19 @@ class CTrapezoidalMap {
                   const std::vector<std::array<unsigned long, 2> >& edges,
                   const su2vector<std::vector<unsigned long> >& edge_to_triangle, bool display = false);
 
+  /*!
+   * \brief Write the map to a binary look-up table file.
+   * \param[in] file - Output stream of the binary file.
+   */
+  void WriteBinary(std::ostream& file) const;
+
+  /*!
+   * \brief Read a map written by WriteBinary, i.e. without building it.
+   * \param[in] file - Binary file positioned at the start of the map.
+   * \param[in] val_edge_to_triangle - Elements left and right of each edge (not stored in the file).
+   */
+  void ReadBinary(CBinaryFileLUT& file, const su2vector<std::vector<unsigned long> >& val_edge_to_triangle);
+
   /*!
    * \brief return the index to the triangle that contains the coordinates (val_x,val_y)
    * \param[in]  val_x  - x-coordinate or first independent variable
@@ -36,6 +36,8 @@
 
 using namespace std;
 
+class CBlasStructure;
+
 /*!
  * \class CFEMStandardElementBase
  * \brief Base class for a FEM standard element.
@@ -732,6 +734,33 @@ class CFEMStandardElement : public CFEMStandardElementBase {
                                                  element. Used for plotting. */
   vector<unsigned short> subConn2ForPlotting; /*!< \brief Local subconnectivity of element type 2 of the high order
                                                  element. Used for plotting. */
+
+  unsigned short nInt1D = 0;         /*!< \brief Number of integration points in one direction, only used for the
+                                                sum factorization of quadrilaterals and hexahedra. */
+  vector<su2double> lagBasisInt1D;   /*!< \brief 1D Lagrangian basis functions in the 1D integration points, used for
+                                                the sum factorization of quadrilaterals and hexahedra. */
+  vector<su2double> drLagBasisInt1D; /*!< \brief Derivatives of the 1D Lagrangian basis functions in the 1D
+                                                integration points, used for the sum factorization. */
+
+  /*!
+   * \brief Function pointer type for the tensor product kernels, which interpolate
+   *        the data in the DOFs to the integration points.
+   */
+  using TensorProductIntPointsFunc = void (*)(const unsigned short, const unsigned short, const su2double*,
+                                              const su2double*, const bool, const bool, const su2double*,
+                                              su2double*);
+  /*!
+   * \brief Function pointer type for the tensor product kernels, which integrate
+   *        the data in the integration points to the DOFs.
+   */
+  using TensorProductDOFsFunc = void (*)(const unsigned short, const unsigned short, const su2double*,
+                                         const su2double*, const bool, const su2double*, su2double*);
+
+  TensorProductIntPointsFunc tensorProductIntPoints = nullptr; /*!< \brief Kernel to interpolate to the integration
+                                                                           points, if sum factorization is used. */
+  TensorProductDOFsFunc tensorProductDOFs = nullptr;           /*!< \brief Kernel to integrate to the DOFs, if sum
+                                                                           factorization is used. */
+
  public:
   /*!
   * \brief Alternative constructor.
@@ -861,6 +890,46 @@ class CFEMStandardElement : public CFEMStandardElementBase {
   */
   inline const su2double* GetMat2ndDerBasisFunctionsInt(void) const { return mat2ndDerBasisInt.data(); }
 
+  /*!
+  * \brief Function, which interpolates the data in the DOFs to the integration points. This is
+           the same matrix product as carried out with the rows of matBasisIntegration, but for
+           quadrilaterals and hexahedra of polynomial degree 1 to 6 the tensor product structure
+           of the element is exploited (sum factorization).
+  * \param[in]  values        - Whether or not the values in the integration points must be computed.
+  * \param[in]  derivatives   - Whether or not the parametric derivatives in the integration points
+                                must be computed. They are stored after the values, if present.
+  * \param[in]  N             - Number of columns of dataDOFs and dataInt (row major storage).
+  * \param[in]  dataDOFs      - Data in the DOFs of the element.
+  * \param[out] dataInt       - Data in the integration points of the element.
+  * \param[in]  blasFunctions - Object to carry out the matrix product when no sum factorization is used.
+  * \param[in]  config        - Object, which contains the input parameters. Only used for profiling.
+  */
+  void InterpolateDOFsToIntPoints(const bool values, const bool derivatives, const unsigned short N,
+                                  const su2double* dataDOFs, su2double* dataInt, CBlasStructure* blasFunctions,
+                                  const CConfig* config) const;
+
+  /*!
+  * \brief Function, which integrates the data in the integration points to the DOFs, i.e. the
+           multiplication with either lagBasisIntegrationTrans or matDerBasisIntTrans. Similar to
+           InterpolateDOFsToIntPoints the sum factorization is used, when possible.
+  * \param[in]  derivatives   - Whether the data is multiplied by the derivatives of the basis functions,
+                                in which case dataInt is stored as matDerBasisIntTrans expects it, or by
+                                the basis functions themselves.
+  * \param[in]  N             - Number of columns of dataInt and dataDOFs (row major storage).
+  * \param[in]  dataInt       - Data in the integration points of the element.
+  * \param[out] dataDOFs      - Data in the DOFs of the element.
+  * \param[in]  blasFunctions - Object to carry out the matrix product when no sum factorization is used.
+  * \param[in]  config        - Object, which contains the input parameters. Only used for profiling.
+  */
+  void IntegrateIntPointsToDOFs(const bool derivatives, const unsigned short N, const su2double* dataInt,
+                                su2double* dataDOFs, CBlasStructure* blasFunctions, const CConfig* config) const;
+
+  /*!
+   * \brief Function, which indicates whether or not sum factorization is used for this standard element.
+   * \return  True if the tensor product kernels are used and false otherwise.
+   */
+  inline bool GetSumFactorization(void) const { return tensorProductIntPoints != nullptr; }
+
   /*!
    * \brief Function, which makes available the connectivity of face 0.
    * \return  The pointer to data, which stores the connectivity of face 0.
@@ -1037,6 +1106,14 @@ class CFEMStandardElement : public CFEMStandardElementBase {
   void CreateBasisFunctionsAndMatrixDerivatives(const vector<su2double>& rLoc, const vector<su2double>& sLoc,
                                                 const vector<su2double>& tLoc, vector<su2double>& matVandermondeInv,
                                                 vector<su2double>& lagBasis, vector<su2double>& matDerBasis);
+
+  /*!
+  * \brief Function, which creates the 1D data for the sum factorization of quadrilaterals and
+           hexahedra and selects the tensor product kernels for the polynomial degree. The
+           sum factorization is only used if it reproduces the data of the full matrices.
+  */
+  void SetUpSumFactorization(void);
+
   /*!
    * \brief Function, which creates all the data for a line element.
    */
@@ -50,6 +50,7 @@ extern "C" {
 #include <cstdlib>
 #include <climits>
 #include <memory>
+#include <functional>
 #include <unordered_map>
 
 #include "primal_grid/CPrimalGrid.hpp"
@@ -90,6 +91,7 @@ class CGeometry {
       Global_nElemDomain{
           0},        /*!< \brief Total number of elements in a simulation across all processors (excluding halos). */
       nEdge{0},      /*!< \brief Number of edges of the mesh. */
+      nEdgeDomain{0}, /*!< \brief Number of edges between domain points, they are numbered first (see SetEdges). */
       nFace{0},      /*!< \brief Number of faces of the mesh. */
       nelem_edge{0}, /*!< \brief Number of edges in the mesh. */
       Global_nelem_edge{0},       /*!< \brief Total number of edges in the mesh across all processors. */
@@ -202,6 +204,12 @@ class CGeometry {
 
   ColMajorMatrix<uint8_t> CoarseGridColor_; /*!< \brief Coarse grid levels, colorized. */
 
+  /*--- Geometric operators. ---*/
+
+  su2activematrix leastSquaresCoeffs[2]; /*!< \brief Unweighted and weighted least-squares gradient coefficients. */
+
+  mutable std::function<void()> pendingComms; /*!< \brief Completes the point-to-point comms left in flight. */
+
  public:
   /*!< \brief Linelets (mesh lines perpendicular to stretching direction). */
   struct CLineletInfo {
@@ -288,6 +296,15 @@ class CGeometry {
   SU2_MPI::Request* req_P2PSend{nullptr}; /*!< \brief Data structure for point-to-point send requests. */
   SU2_MPI::Request* req_P2PRecv{nullptr}; /*!< \brief Data structure for point-to-point recv requests. */
 
+  /*!
+   * \brief Persistent requests of the point-to-point comms for one data type, count per point, and direction.
+   */
+  struct PersistentP2PRequests {
+    vector<SU2_MPI::Request> send, recv;
+  };
+  mutable map<unsigned long, PersistentP2PRequests> persistentP2P; /*!< \brief Persistent requests of each kind of
+                                                                      point-to-point comm, see PostP2PRecvs. */
+
   /*--- Data structures for periodic communications. ---*/
 
   int maxCountPerPeriodicPoint{0}; /*!< \brief Maximum number of pieces of data sent per vertex in periodic comms. */
@@ -360,6 +377,20 @@ class CGeometry {
    */
   void AllocateP2PComms(unsigned short val_countPerPoint);
 
+  /*!
+   * \brief Leave point-to-point comms in flight, to overlap them with computations that do not need halo data.
+   * \note Must be called by all threads.
+   * \param[in] complete - Function that completes the comms (by all threads), see CompletePendingComms.
+   */
+  void SetPendingComms(std::function<void()> complete);
+
+  /*!
+   * \brief Complete the comms left in flight by SetPendingComms, if any. This must be done before the halo data is
+   * used, and it is done automatically before other comms are started since they use the same buffers.
+   * \note Must be called by all threads.
+   */
+  void CompletePendingComms() const;
+
   /*!
    * \brief Routine to launch non-blocking recvs only for all point-to-point communication with neighboring partitions.
    * \note This routine is called by any class that has loaded data into the generic communication buffers.
@@ -385,6 +416,49 @@ class CGeometry {
   void PostP2PSends(CGeometry* geometry, const CConfig* config, unsigned short commType, unsigned short countPerPoint,
                     int val_iMessage, bool val_reverse) const;
 
+ private:
+  /*!
+   * \brief Initialize the recv request of one neighbor for point-to-point comms (see PostP2PRecvs).
+   * \param[in] commType - Enumerated type for the quantity to be communicated.
+   * \param[in] countPerPoint - Number of variables per point.
+   * \param[in] iRecv - Index of the neighbor.
+   * \param[in] reverse - Boolean controlling forward or reverse communication between neighbors.
+   * \param[in] persistent - Create a persistent request (MPI_Recv_init) instead of posting the recv.
+   * \param[out] request - The request.
+   */
+  void InitP2PRecv(unsigned short commType, unsigned short countPerPoint, int iRecv, bool reverse, bool persistent,
+                   SU2_MPI::Request* request) const;
+
+  /*!
+   * \brief Initialize the send request of one neighbor for point-to-point comms (see PostP2PSends).
+   * \param[in] commType - Enumerated type for the quantity to be communicated.
+   * \param[in] countPerPoint - Number of variables per point.
+   * \param[in] iSend - Index of the neighbor.
+   * \param[in] reverse - Boolean controlling forward or reverse communication between neighbors.
+   * \param[in] persistent - Create a persistent request (MPI_Send_init) instead of posting the send.
+   * \param[out] request - The request.
+   */
+  void InitP2PSend(unsigned short commType, unsigned short countPerPoint, int iSend, bool reverse, bool persistent,
+                   SU2_MPI::Request* request) const;
+
+  /*!
+   * \brief Get the persistent requests for a kind of point-to-point comm, creating them on the first call.
+   * \note The requests are bound to the buffers, they are freed when the buffers are reallocated.
+   * \param[in] commType - Enumerated type for the quantity to be communicated.
+   * \param[in] countPerPoint - Number of variables per point.
+   * \param[in] reverse - Boolean controlling forward or reverse communication between neighbors.
+   * \return Send and recv requests for each neighbor.
+   */
+  const PersistentP2PRequests& GetPersistentP2PRequests(unsigned short commType, unsigned short countPerPoint,
+                                                        bool reverse) const;
+
+  /*!
+   * \brief Free the persistent requests of the point-to-point comms.
+   */
+  void FreePersistentP2PRequests();
+
+ public:
+
   /*!
    * \brief Routine to set up persistent data structures for periodic communications.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -496,6 +570,13 @@ class CGeometry {
    */
   inline unsigned long GetnEdge() const { return nEdge; }
 
+  /*!
+   * \brief Get number of edges between domain points, these are the first edges.
+   * \note Rounded down to a multiple of the SIMD length, the few domain edges after it are handled with the halo edges.
+   * \return Number of edges that do not touch halo points.
+   */
+  inline unsigned long GetnEdgeDomain() const { return nEdgeDomain; }
+
   /*!
    * \brief Get number of markers.
    * \return Number of markers.
@@ -711,6 +792,7 @@ class CGeometry {
 
   /*!
    * \brief Sets the edges of an elemment.
+   * \note The edges between domain points are numbered first, followed by those that touch halo points.
    */
   void SetEdges();
 
@@ -1785,6 +1867,23 @@ class CGeometry {
    */
   const su2vector<unsigned long>& GetTransposeSparsePatternMap(ConnectivityType type);
 
+  /*!
+   * \brief Get the coefficients of the least-squares gradient operator, for each point and neighbor.
+   * \note The gradient of U at iPoint is sum_k C(k,:) * (U(jPoint_k) - U(iPoint)), where k spans the
+   * positions of the neighbors of iPoint in CPoint::GetPoints(). The matrix is empty if the coefficients
+   * need to be (re)computed, this is done by computeGradientsLeastSquares.
+   * \param[in] weighted - Inverse-distance-weighted or unweighted least-squares.
+   * \return Reference to the coefficients (neighbors of all points by nDim).
+   */
+  inline su2activematrix& GetLeastSquaresCoefficients(bool weighted) { return leastSquaresCoeffs[weighted]; }
+
+  /*!
+   * \brief Discard the least-squares coefficients (e.g. due to grid motion), they are recomputed when needed.
+   */
+  inline void ResetLeastSquaresCoefficients() {
+    for (auto& coeffs : leastSquaresCoeffs) coeffs.resize(0, 0);
+  }
+
   /*!
    * \brief Get the edge coloring.
    * \note This method computes the coloring if that has not been done yet.
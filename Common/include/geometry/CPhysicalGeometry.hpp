@@ -493,6 +493,32 @@ class CPhysicalGeometry final : public CGeometry {
    */
   void SetColorGrid_Parallel(const CConfig* config) override;
 
+#if defined(HAVE_MPI) && defined(HAVE_PARMETIS)
+  /*!
+   * \brief Values that identify a partitioning problem: number of ranks, ParMETIS options, number of points,
+   *        and a hash of the adjacency graph (which is independent of the coordinates, i.e. of mesh deformation).
+   * \param[in] config - Definition of the particular problem.
+   * \return The key stored in the header of the partition cache.
+   */
+  vector<int64_t> GetPartitionCacheKey(const CConfig* config) const;
+
+  /*!
+   * \brief Read the colors of the linear partition of points of this rank from a partition cache.
+   * \param[in] filename - Name of the cache file.
+   * \param[in] key - Key of the current problem, the cache is only used if its key matches.
+   * \return True if the colors were set, false if the cache was missing, invalid, or for a different problem.
+   */
+  bool ReadPartitionCache(const string& filename, const vector<int64_t>& key);
+
+  /*!
+   * \brief Write the colors of the linear partition of points of all ranks to a partition cache.
+   * \param[in] filename - Name of the cache file.
+   * \param[in] key - Key of the current problem.
+   * \param[in] part - Colors of the points of this rank.
+   */
+  void WritePartitionCache(const string& filename, const vector<int64_t>& key, const vector<idx_t>& part) const;
+#endif
+
   /*!
    * \brief Set the domains for FEM grid partitioning using ParMETIS.
    * \param[in] config - Definition of the particular problem.
@@ -0,0 +1,109 @@
+/*!
+ * \file CSU2BinaryMeshReaderFVM.hpp
+ * \brief Header file for the class CSU2BinaryMeshReaderFVM.
+ *        The implementations are in the <i>CSU2BinaryMeshReaderFVM.cpp</i> file.
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "CMeshReaderBase.hpp"
+
+/*!
+ * \class CSU2BinaryMeshReaderFVM
+ * \brief Reads a native SU2 binary grid into linear partitions for the finite volume solver (FVM).
+ * \details The file contains a single zone, all integers are 64-bit and all blocks are 8-byte aligned:
+ *   - Header: the 8 characters of "magic", followed by the dimension, the number of volume elements,
+ *     the number of points, and the number of markers.
+ *   - Volume elements: fixed-size records of "elemRecordSize" integers, the VTK type followed by the
+ *     connectivity padded with zeros. The global index of an element is its position in the block.
+ *   - Points: "dimension" coordinates (double) per point.
+ *   - Markers: for each marker, the length of the name and the number of elements, the name padded
+ *     with zeros to a multiple of 8 characters, and the elements as records of "boundRecordSize" integers.
+ *   Since the volume blocks have fixed-size records, each rank reads only its linear partition of points
+ *   and elements (with MPI-IO), the elements are then sent to the ranks that own their points.
+ */
+class CSU2BinaryMeshReaderFVM : public CMeshReaderBase {
+ public:
+  using FileInt = int64_t; /*!< \brief Type of the integers in the file. */
+
+  static constexpr char magic[] = "SU2MSHB1";                                 /*!< \brief Identifies the format. */
+  static constexpr unsigned long magicSize = 8;                               /*!< \brief Length of the magic string. */
+  static constexpr unsigned long headerSize = magicSize + 4 * sizeof(FileInt); /*!< \brief Bytes in the header. */
+  static constexpr unsigned short elemRecordSize = 1 + N_POINTS_HEXAHEDRON;      /*!< \brief Integers per element. */
+  static constexpr unsigned short boundRecordSize = 1 + N_POINTS_QUADRILATERAL;  /*!< \brief Integers per marker element. */
+
+ private:
+  const string meshFilename; /*!< \brief Name of the SU2 binary mesh file being read. */
+
+#ifdef HAVE_MPI
+  MPI_File fhr; /*!< \brief File handle for reading. */
+#else
+  FILE* fhr = nullptr; /*!< \brief File handle for reading. */
+#endif
+
+  unsigned long elementOffset = 0; /*!< \brief Position (bytes) of the volume elements in the file. */
+  unsigned long pointOffset = 0;   /*!< \brief Position (bytes) of the point coordinates in the file. */
+  unsigned long markerOffset = 0;  /*!< \brief Position (bytes) of the markers in the file. */
+
+  /*!
+   * \brief Read a contiguous block of the file, independently of other ranks.
+   * \param[out] data - Where to store the block.
+   * \param[in] offset - Position (bytes) of the block in the file.
+   * \param[in] sizeInBytes - Size of the block.
+   */
+  void ReadBytes(void* data, unsigned long offset, unsigned long sizeInBytes);
+
+  /*!
+   * \brief Reads the header (on the master) and checks for errors.
+   */
+  void ReadMetadata();
+
+  /*!
+   * \brief Reads the linear partition of grid points of this rank.
+   */
+  void ReadPointCoordinates();
+
+  /*!
+   * \brief Reads a linear partition of the volume elements and sends them to all the ranks that own their points.
+   */
+  void ReadVolumeElementConnectivity();
+
+  /*!
+   * \brief Reads the surface (boundary) elements on the master and broadcasts them.
+   */
+  void ReadSurfaceElementConnectivity();
+
+ public:
+  /*!
+   * \brief Constructor of the CSU2BinaryMeshReaderFVM class.
+   */
+  CSU2BinaryMeshReaderFVM(CConfig* val_config, unsigned short val_iZone, unsigned short val_nZone);
+
+  /*!
+   * \brief Destructor of the CSU2BinaryMeshReaderFVM class.
+   */
+  ~CSU2BinaryMeshReaderFVM(void) override;
+};
@@ -0,0 +1,164 @@
+/*!
+ * \file CAlgebraicMultigrid.hpp
+ * \brief Smoothed aggregation algebraic multigrid for block sparse matrices.
+ *        The implementation is in <i>CAlgebraicMultigrid.cpp</i>.
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CSysVector.hpp"
+
+#include <vector>
+
+/*!
+ * \class CAlgebraicMultigrid
+ * \ingroup SpLinSys
+ * \brief Smoothed aggregation AMG hierarchy built from the block-CSR storage of CSysMatrix.
+ *
+ * The hierarchy is local to each rank (couplings with halo points are not included), as for the
+ * ILU and LU_SGS preconditioners. Aggregates are formed from the strong connections of the block
+ * graph, the tentative prolongation is piecewise constant (one identity block per aggregate), and
+ * it is smoothed with one damped block-Jacobi iteration. The coarse operators are computed with
+ * the Galerkin product R A P, with R = P^T. The hierarchy is applied as a symmetric V-cycle with
+ * damped block-Jacobi smoothing, and a dense LU solve on the coarsest level.
+ * The setup is serial, the application is thread-parallel (it must be called by all threads).
+ */
+template <class ScalarType>
+class CAlgebraicMultigrid {
+ private:
+  enum : unsigned long { MAX_LEVELS = 12 };    /*!< \brief Maximum number of levels. */
+  enum : unsigned long { COARSEST_SIZE = 256 }; /*!< \brief Levels with fewer rows are solved directly. */
+  enum : unsigned long { NUM_SMOOTH = 1 };      /*!< \brief Number of pre and post smoothing iterations. */
+  enum : unsigned long { OMP_MAX_SIZE = 512 };  /*!< \brief Max. chunk size used in the parallel loops. */
+
+  static constexpr passivedouble STRENGTH_THRESHOLD = 0.08; /*!< \brief Threshold for strong connections. */
+  static constexpr passivedouble MAX_COARSENING = 0.8;      /*!< \brief Stop if the size does not decrease enough. */
+
+  /*!
+   * \brief Rank-local block sparse matrix with sorted column indices.
+   */
+  struct BlockCSR {
+    unsigned long nRow = 0, nCol = 0;
+    std::vector<unsigned long> rowPtr, colInd;
+    std::vector<ScalarType> values;
+
+    unsigned long nnz() const { return colInd.size(); }
+  };
+
+  /*!
+   * \brief Operators, smoother data, and working vectors of a level.
+   */
+  struct Level {
+    BlockCSR A;                        /*!< \brief Operator of the level. */
+    BlockCSR P;                        /*!< \brief Prolongation from the next (coarser) level. */
+    BlockCSR R;                        /*!< \brief Restriction to the next level. */
+    std::vector<ScalarType> invDiag;   /*!< \brief Inverse of the diagonal blocks of A. */
+    ScalarType omega = 0.0;            /*!< \brief Damping of the Jacobi iterations, 4 / (3 rho(D^-1 A)). */
+    unsigned long chunk = 0;           /*!< \brief Chunk size of the parallel loops over rows. */
+    mutable std::vector<ScalarType> x; /*!< \brief Solution of the level. */
+    mutable std::vector<ScalarType> b; /*!< \brief Right hand side of the level. */
+    mutable std::vector<ScalarType> r; /*!< \brief Residual of the level. */
+  };
+
+  unsigned long nVar = 0;                  /*!< \brief Size of the (square) blocks. */
+  std::vector<Level> levels;               /*!< \brief The hierarchy, from fine to coarse. */
+  std::vector<ScalarType> coarseLU;        /*!< \brief Dense LU factors of the coarsest operator. */
+  std::vector<unsigned long> coarsePivots; /*!< \brief Row pivots of the dense LU factorization. */
+  bool coarseDirect = false;               /*!< \brief If the coarsest level is solved directly. */
+
+  /*!
+   * \brief Computes the aggregate of each row of A from the strong connections, or "nRow" for isolated rows.
+   * \param[in] A - Operator of the level.
+   * \param[out] aggregate - Aggregate of each row.
+   * \return Number of aggregates.
+   */
+  unsigned long Aggregate(const BlockCSR& A, std::vector<unsigned long>& aggregate) const;
+
+  /*!
+   * \brief Inverts the diagonal blocks and computes the Jacobi damping of a level.
+   */
+  void SetupSmoother(Level& level) const;
+
+  /*!
+   * \brief Computes the smoothed prolongation P = (I - omega D^-1 A) P_tent.
+   */
+  void SetupProlongation(const std::vector<unsigned long>& aggregate, unsigned long nAggregates, Level& level) const;
+
+  /*!
+   * \brief Sparse product of block matrices, C = X Y.
+   */
+  void Multiply(const BlockCSR& X, const BlockCSR& Y, BlockCSR& C) const;
+
+  /*!
+   * \brief Transpose of a block matrix (the blocks are transposed too).
+   */
+  void Transpose(const BlockCSR& X, BlockCSR& Xt) const;
+
+  /*!
+   * \brief Computes r = b - A x for a level (thread-parallel).
+   */
+  void Residual(const Level& level) const;
+
+  /*!
+   * \brief Damped block-Jacobi iterations for a level (thread-parallel).
+   * \param[in] level - The level.
+   * \param[in] zeroGuess - If x is zero on entry, which saves one product.
+   */
+  void Smooth(const Level& level, bool zeroGuess) const;
+
+  /*!
+   * \brief Recursive V-cycle from level iLevel, solves for level.x given level.b.
+   */
+  void Cycle(unsigned long iLevel) const;
+
+ public:
+  /*!
+   * \brief Builds the hierarchy from the domain part of a block-CSR matrix, this is not thread-safe.
+   * \param[in] nvar - Size of the square blocks.
+   * \param[in] nPointDomain - Number of rows, columns larger or equal to this are halos and are ignored.
+   * \param[in] row_ptr - Pointers to the first element in each row.
+   * \param[in] col_ind - Column index of each element (sorted within each row).
+   * \param[in] matrix - Values of the blocks.
+   */
+  void Build(unsigned long nvar, unsigned long nPointDomain, const unsigned long* row_ptr,
+             const unsigned long* col_ind, const ScalarType* matrix);
+
+  /*!
+   * \brief Applies one V-cycle to approximate the solution of A prod = vec, on the domain points.
+   * \note This method must be called by all threads of a parallel region.
+   * \param[in] vec - Right hand side.
+   * \param[out] prod - Approximate solution.
+   */
+  void Apply(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod) const;
+
+  /*!
+   * \brief Get the number of levels of the hierarchy.
+   */
+  unsigned long GetNumLevels() const { return levels.size(); }
+
+  /*!
+   * \brief Get the number of rows of a level.
+   */
+  unsigned long GetLevelSize(unsigned long iLevel) const { return levels[iLevel].A.nRow; }
+};
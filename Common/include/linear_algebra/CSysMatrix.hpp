@@ -31,10 +31,12 @@
 #include "../../include/CConfig.hpp"
 #include "CSysVector.hpp"
 #include "CPastixWrapper.hpp"
+#include "CAlgebraicMultigrid.hpp"
 
 #include <cstdlib>
 #include <vector>
 #include <cassert>
+#include <atomic>
 
 /*--- In forward mode the matrix is not of a built-in type. ---*/
 #if defined(HAVE_MKL) && !defined(CODI_FORWARD_TYPE)
@@ -125,6 +127,10 @@ class CSysMatrix {
   }; /*!< \brief Maximum number of variables the matrix can handle. The static
                  size is needed for fast, per-thread, static memory allocation. */
 
+  enum : size_t {
+    MAXNVAR_KERNEL = 7
+  }; /*!< \brief Maximum block size for which kernels are specialized at compile time. */
+
   enum { OMP_MAX_SIZE_L = 8192 }; /*!< \brief Max. chunk size used in light parallel for loops. */
   enum { OMP_MAX_SIZE_H = 512 };  /*!< \brief Max. chunk size used in heavy parallel for loops. */
   enum { OMP_MIN_SIZE = 32 };     /*!< \brief Chunk size for finer grain operations. */
@@ -138,6 +144,8 @@ class CSysMatrix {
   unsigned long nVar;         /*!< \brief Number of variables (and rows of the blocks). */
   unsigned long nEqn;         /*!< \brief Number of equations (and columns of the blocks). */
 
+  unsigned long blockSizeKernel; /*!< \brief Block size of the specialized kernels, 0 for the generic ones. */
+
   ScalarType* matrix;           /*!< \brief Entries of the sparse matrix. */
   unsigned long nnz;            /*!< \brief Number of possible nonzero entries in the matrix. */
   const unsigned long* row_ptr; /*!< \brief Pointers to the first element in each row. */
@@ -158,8 +166,37 @@ class CSysMatrix {
   const unsigned long* col_ind_ilu; /*!< \brief Column index for each of the elements in val() (ILU). */
   unsigned short ilu_fill_in;       /*!< \brief Fill in level for the ILU preconditioner. */
 
+  /*!
+   * \brief Rows grouped by level, the rows of a level only depend on rows of previous levels.
+   */
+  struct RowLevels {
+    vector<unsigned long> ptr;  /*!< \brief Start of each level in "rows". */
+    vector<unsigned long> rows; /*!< \brief Rows sorted by level, in the original order within each level. */
+
+    unsigned long nLevels() const { return ptr.empty() ? 0 : ptr.size() - 1; }
+  };
+  bool ilu_level_scheduling;  /*!< \brief Whether the ILU is computed and applied by levels instead of partitions. */
+  RowLevels ilu_levels_lower; /*!< \brief Levels of the lower factor (factorization and forward substitution). */
+  RowLevels ilu_levels_upper; /*!< \brief Levels of the upper factor (backward substitution). */
+
   ScalarType* invM; /*!< \brief Inverse of (Jacobi) preconditioner, or diagonal of ILU. */
 
+  /*--- Sliced ELLPACK (SELL-C-sigma) copy of the matrix, only used for matrix-vector products. The rows are grouped
+   *    in slices of C rows, padded to the longest row of the slice, and sorted by length within windows of sigma
+   *    rows to reduce padding. The entries of a slice are stored column-major (one entry of each of the C rows,
+   *    then the next), and the blocks are interleaved across rows, so that the product vectorizes over rows. ---*/
+  enum : unsigned long { SELL_C = 8 };      /*!< \brief Number of rows per slice. */
+  enum : unsigned long { SELL_SIGMA = 64 }; /*!< \brief Number of rows in the windows sorted by length. */
+  bool useSlicedEll;                        /*!< \brief Whether products use the SELL-C-sigma copy. */
+  std::atomic<bool> validSlicedEll;         /*!< \brief Whether the SELL-C-sigma copy is up to date. */
+  unsigned long nSlices;                    /*!< \brief Number of slices. */
+  unsigned long omp_slice_size;             /*!< \brief Chunk size used in loops over slices. */
+  vector<unsigned long> sell_ptr;           /*!< \brief Pointers to the first entry of each slice. */
+  vector<unsigned long> sell_row;           /*!< \brief Row of each slot of the slices, nPointDomain if padding. */
+  vector<unsigned long> sell_col;           /*!< \brief Column index of each entry. */
+  vector<unsigned long> sell_map;           /*!< \brief Block of "matrix" copied to each entry, nnz if padding. */
+  ScalarType* sell_matrix;                  /*!< \brief Entries of the SELL-C-sigma matrix. */
+
   /*--- Temporary (hence mutable) working memory used in the Linelet preconditioner, outer vector is for threads ---*/
   mutable vector<vector<const ScalarType*> >
       LineletUpper; /*!< \brief Pointers to the upper blocks of the tri-diag system (working memory). */
@@ -185,6 +222,8 @@ class CSysMatrix {
   mutable CPastixWrapper<ScalarType> pastix_wrapper;
 #endif
 
+  CAlgebraicMultigrid<ScalarType> amg; /*!< \brief Smoothed aggregation AMG hierarchy. */
+
   /*!
    * \brief Auxilary object to wrap the edge map pointer used in fast block updates, i.e. without linear searches.
    */
@@ -222,6 +261,34 @@ class CSysMatrix {
     return SU2_TYPE::GetValue(val);
   }
 
+  /*!
+   * \brief Calls "kernel" with the block size as a compile time constant (std::integral_constant),
+   *        or with 0 if the matrix was initialized with a size that does not have specialized kernels.
+   * \param[in] kernel - Generic lambda that receives the block size.
+   */
+  template <class F>
+  inline void DispatchBlockSize(const F& kernel) const;
+
+  /*!
+   * \brief Builds the SELL-C-sigma structure from the sparse pattern of the matrix (see sell_ptr, etc.).
+   */
+  void InitializeSlicedEll();
+
+  /*!
+   * \brief Marks the SELL-C-sigma copy as outdated, called by all the methods that modify entries of the matrix.
+   * \note Any thread can call this, the flag is only written when set to avoid contention in the block updates.
+   */
+  FORCEINLINE void InvalidateSlicedEll() {
+    if (validSlicedEll.load(std::memory_order_relaxed)) validSlicedEll.store(false, std::memory_order_relaxed);
+  }
+
+  /*!
+   * \brief Product of the SELL-C-sigma copy of the matrix by a CSysVector, without communication.
+   * \param[in] vec - CSysVector to be multiplied by the sparse matrix A.
+   * \param[out] prod - Result of the product.
+   */
+  void SlicedEllProduct(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod) const;
+
   /*!
    * \brief Calculates the matrix-vector product: product = matrix*vector
    * \param[in] matrix
@@ -325,6 +392,39 @@ class CSysMatrix {
    */
   inline void SetBlock_ILUMatrix(unsigned long block_i, unsigned long block_j, ScalarType* val_block);
 
+  /*!
+   * \brief Computes the levels of the rows of the ILU factors for level scheduling (see ilu_levels_lower/upper).
+   */
+  void InitializeILULevels();
+
+  /*!
+   * \brief Factorizes a row of the ILU matrix and inverts its diagonal block, the previous rows it depends on
+   *        must have been factorized. Only the columns in the range [begin, end[ are considered.
+   * \param[in] iPoint - Row to factorize.
+   * \param[in] begin - First column considered.
+   * \param[in] end - Column after the last considered.
+   */
+  inline void FactorizeRow_ILUMatrix(unsigned long iPoint, unsigned long begin, unsigned long end);
+
+  /*!
+   * \brief Forward substitution step of the ILU for one row, prod_i -= L_ij * prod_j for columns j >= begin.
+   * \param[in] iPoint - Row of the step.
+   * \param[in] begin - First column considered.
+   * \param[in,out] prod - Vector being solved in place.
+   */
+  inline void ForwardSubstitutionRow_ILUMatrix(unsigned long iPoint, unsigned long begin,
+                                               CSysVector<ScalarType>& prod) const;
+
+  /*!
+   * \brief Backward substitution step of the ILU for one row, prod_i = D_i^-1 (prod_i - U_ij * prod_j)
+   *        for columns j < end.
+   * \param[in] iPoint - Row of the step.
+   * \param[in] end - Column after the last considered.
+   * \param[in,out] prod - Vector being solved in place.
+   */
+  inline void BackwardSubstitutionRow_ILUMatrix(unsigned long iPoint, unsigned long end,
+                                                CSysVector<ScalarType>& prod) const;
+
   /*!
    * \brief Performs the product of i-th row of the upper part of a sparse matrix by a vector.
    * \param[in] vec - Vector to be multiplied by the upper part of the sparse matrix A.
@@ -419,8 +519,10 @@ class CSysMatrix {
 
   /*!
    * \brief Get a pointer to the start of block "ij", non-const version
+   * \note This marks the SELL-C-sigma copy as outdated since the block may be modified.
    */
   FORCEINLINE ScalarType* GetBlock(unsigned long block_i, unsigned long block_j) {
+    InvalidateSlicedEll();
     const CSysMatrix& const_this = *this;
     return const_cast<ScalarType*>(const_this.GetBlock(block_i, block_j));
   }
@@ -563,6 +665,7 @@ class CSysMatrix {
    */
   inline void GetBlocks(unsigned long iEdge, unsigned long iPoint, unsigned long jPoint, ScalarType*& bii,
                         ScalarType*& bij, ScalarType*& bji, ScalarType*& bjj) {
+    InvalidateSlicedEll();
     bii = &matrix[dia_ptr[iPoint] * nVar * nEqn];
     bjj = &matrix[dia_ptr[jPoint] * nVar * nEqn];
     bij = &matrix[edge_ptr(iEdge, 0) * nVar * nEqn];
@@ -618,6 +721,7 @@ class CSysMatrix {
     static_assert(MatTypeSIMD::IsRowMajor, "Block storage is not compatible with matrix.");
     constexpr size_t blkSz = MatTypeSIMD::StaticSize;
     assert(blkSz == nVar * nEqn);
+    InvalidateSlicedEll();
 
     /*--- "Transpose" the blocks, scale, and possibly convert types,
      * giving the compiler the chance to vectorize all of these. ---*/
@@ -666,6 +770,7 @@ class CSysMatrix {
   template <class MatrixType, class OtherType = ScalarType, bool Overwrite = true>
   inline void SetBlocks(unsigned long iEdge, const MatrixType& block_i, const MatrixType& block_j,
                         OtherType scale = 1) {
+    InvalidateSlicedEll();
     ScalarType* bij = &matrix[edge_ptr(iEdge, 0) * nVar * nEqn];
     ScalarType* bji = &matrix[edge_ptr(iEdge, 1) * nVar * nEqn];
 
@@ -708,6 +813,7 @@ class CSysMatrix {
     static_assert(MatTypeSIMD::IsRowMajor, "Block storage is not compatible with matrix.");
     constexpr size_t blkSz = MatTypeSIMD::StaticSize;
     assert(blkSz == nVar * nEqn);
+    InvalidateSlicedEll();
 
     /*--- "Transpose" the blocks, scale, and possibly convert types,
      * giving the compiler the chance to vectorize all of these. ---*/
@@ -749,6 +855,7 @@ class CSysMatrix {
    */
   template <class OtherType, bool Overwrite = true, class T = ScalarType>
   inline void SetBlock2Diag(unsigned long block_i, const OtherType& val_block, T alpha = 1.0) {
+    InvalidateSlicedEll();
     auto mat_ii = &matrix[dia_ptr[block_i] * nVar * nEqn];
 
     for (auto iVar = 0ul; iVar < nVar; iVar++)
@@ -782,6 +889,7 @@ class CSysMatrix {
    */
   template <class OtherType>
   inline void AddVal2Diag(unsigned long block_i, OtherType val_matrix) {
+    InvalidateSlicedEll();
     for (auto iVar = 0ul; iVar < nVar; iVar++)
       matrix[dia_ptr[block_i] * nVar * nVar + iVar * (nVar + 1)] += PassiveAssign(val_matrix);
   }
@@ -795,6 +903,7 @@ class CSysMatrix {
    */
   template <class OtherType>
   inline void AddVal2Diag(unsigned long block_i, unsigned long iVar, OtherType val) {
+    InvalidateSlicedEll();
     matrix[dia_ptr[block_i] * nVar * nVar + iVar * (nVar + 1)] += PassiveAssign(val);
   }
 
@@ -806,6 +915,7 @@ class CSysMatrix {
    */
   template <class OtherType>
   inline void SetVal2Diag(unsigned long block_i, OtherType val_matrix) {
+    InvalidateSlicedEll();
     unsigned long iVar, index = dia_ptr[block_i] * nVar * nVar;
 
     /*--- Clear entire block before setting its diagonal. ---*/
@@ -854,8 +964,18 @@ class CSysMatrix {
    */
   void MatrixMatrixAddition(ScalarType alpha, const CSysMatrix& B);
 
+  /*!
+   * \brief Copies the values of the matrix to the sliced ELLPACK (SELL-C-sigma) layout, which is then used by
+   *        MatrixVectorProduct until the matrix is modified (by any of the methods that write to its entries,
+   *        including the non-const GetBlock). Nothing is done if that layout was not selected for this matrix.
+   */
+  void BuildSlicedEllMatrix();
+
   /*!
    * \brief Performs the product of a sparse matrix by a CSysVector.
+   * \note The SELL-C-sigma copy of the matrix is used if it is up to date (see BuildSlicedEllMatrix).
+   *       The vectors can be multi-vectors (see CSysVector::SetColumn), in which case the matrix is streamed
+   *       once for all the vectors. The same applies to the Jacobi and ILU preconditioners.
    * \param[in] vec - CSysVector to be multiplied by the sparse matrix A.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
@@ -864,6 +984,19 @@ class CSysMatrix {
   void MatrixVectorProduct(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod, CGeometry* geometry,
                            const CConfig* config) const;
 
+  /*!
+   * \brief Performs the product of the sparse matrix by a CSysVector of another (usually higher precision) type.
+   * \note The blocks are converted to OtherType and the products are accumulated in that type, this is used to
+   *       compute accurate residuals with single precision matrices (see CNewtonIntegration).
+   * \param[in] vec - CSysVector to be multiplied by the sparse matrix A.
+   * \param[out] prod - Result of the product.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  template <class OtherType>
+  void MatrixVectorProduct(const CSysVector<OtherType>& vec, CSysVector<OtherType>& prod, CGeometry* geometry,
+                           const CConfig* config) const;
+
   /*!
    * \brief Performs the product of a sparse matrix by a CSysVector.
    * \param[in] vec - CSysVector to be multiplied by the sparse matrix A.
@@ -960,6 +1093,26 @@ class CSysMatrix {
   void ComputeLineletPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
                                     CGeometry* geometry, const CConfig* config) const;
 
+  /*!
+   * \brief Build the smoothed aggregation AMG preconditioner.
+   */
+  void BuildAMGPreconditioner();
+
+  /*!
+   * \brief Multiply CSysVector by the preconditioner (one V-cycle of the AMG hierarchy).
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product M*vec.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeAMGPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod, CGeometry* geometry,
+                                const CConfig* config) const;
+
+  /*!
+   * \brief Get the number of levels of the AMG hierarchy (0 if it was not built).
+   */
+  unsigned long GetAMGNumLevels() const { return amg.GetNumLevels(); }
+
   /*!
    * \brief Compute the linear residual.
    * \param[in] sol - Solution (x).
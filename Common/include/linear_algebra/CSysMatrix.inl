@@ -51,13 +51,21 @@ FORCEINLINE void CSysMatrix<ScalarType>::SetBlock_ILUMatrix(unsigned long block_
 
 namespace {
 
-template <class T, bool alpha, bool beta, bool transp>
-FORCEINLINE void gemv_impl(unsigned long n, unsigned long m, const T* a, const T* b, T* c) {
+/*---
+ The kernels below take the block size as the template parameter N, when N > 0 the
+ runtime sizes are ignored and the loop bounds become compile time constants, which
+ allows the compiler to fully unroll and vectorize them. N = 0 gives generic kernels.
+---*/
+
+template <class T, size_t N, bool alpha, bool beta, bool transp>
+FORCEINLINE void gemv_impl(unsigned long n_, unsigned long m_, const T* a, const T* b, T* c) {
   /*---
    This is a templated version of GEMV with the constants as boolean
    template parameters so that they can be optimized away at compilation.
    This is still the traditional "row dot vector" method.
   ---*/
+  const unsigned long n = N ? N : n_;
+  const unsigned long m = N ? N : m_;
   if (!transp) {
     for (auto i = 0ul; i < n; i++) {
       if (!beta) c[i] = 0.0;
@@ -71,9 +79,10 @@ FORCEINLINE void gemv_impl(unsigned long n, unsigned long m, const T* a, const T
   }
 }
 
-template <class T>
-FORCEINLINE void gemm_impl(unsigned long n, const T* a, const T* b, T* c) {
+template <class T, size_t N>
+FORCEINLINE void gemm_impl(unsigned long n_, const T* a, const T* b, T* c) {
   /*--- Same deal as for GEMV but here only the type is templated. ---*/
+  const unsigned long n = N ? N : n_;
   unsigned long i, j, k;
   for (i = 0; i < n; i++) {
     for (j = 0; j < n; j++) {
@@ -82,8 +91,89 @@ FORCEINLINE void gemm_impl(unsigned long n, const T* a, const T* b, T* c) {
     }
   }
 }
+
+template <class T, size_t N>
+FORCEINLINE void gauss_elimination_impl(unsigned long n_, T* matrix, T* vec) {
+  const unsigned long n = N ? N : n_;
+#define A(I, J) matrix[(I)*n + (J)]
+
+  /*--- Transform system in Upper Matrix ---*/
+  for (auto iVar = 1ul; iVar < n; iVar++) {
+    for (auto jVar = 0ul; jVar < iVar; jVar++) {
+      T weight = A(iVar, jVar) / A(jVar, jVar);
+      for (auto kVar = jVar; kVar < n; kVar++) A(iVar, kVar) -= weight * A(jVar, kVar);
+      vec[iVar] -= weight * vec[jVar];
+    }
+  }
+
+  /*--- Backwards substitution ---*/
+  for (auto iVar = n; iVar > 0ul;) {
+    iVar--;  // unsigned type
+    for (auto jVar = iVar + 1; jVar < n; jVar++) vec[iVar] -= A(iVar, jVar) * vec[jVar];
+    vec[iVar] /= A(iVar, iVar);
+  }
+#undef A
+}
+
+template <class T, size_t N>
+FORCEINLINE void matrix_inverse_impl(unsigned long n_, T* matrix, T* inverse) {
+  /*--- This is a generalization of Gaussian elimination for multiple rhs' (the basis vectors).
+   We could call "Gauss_Elimination" multiple times or fully generalize it for multiple rhs,
+   the performance of both routines would suffer in both cases without the use of exotic templating.
+   And so it feels reasonable to have some duplication here. ---*/
+  const unsigned long n = N ? N : n_;
+#define A(I, J) matrix[(I)*n + (J)]
+#define M(I, J) inverse[(I)*n + (J)]
+
+  /*--- Initialize the inverse with the identity. ---*/
+  for (auto iVar = 0ul; iVar < n; iVar++)
+    for (auto jVar = 0ul; jVar < n; jVar++) M(iVar, jVar) = T(iVar == jVar);
+
+  /*--- Transform system in Upper Matrix ---*/
+  for (auto iVar = 1ul; iVar < n; iVar++) {
+    for (auto jVar = 0ul; jVar < iVar; jVar++) {
+      T weight = A(iVar, jVar) / A(jVar, jVar);
+
+      for (auto kVar = jVar; kVar < n; kVar++) A(iVar, kVar) -= weight * A(jVar, kVar);
+
+      /*--- at this stage M is lower triangular so not all cols need updating ---*/
+      for (auto kVar = 0ul; kVar <= jVar; kVar++) M(iVar, kVar) -= weight * M(jVar, kVar);
+    }
+  }
+
+  /*--- Backwards substitution ---*/
+  for (auto iVar = n; iVar > 0ul;) {
+    iVar--;  // unsigned type
+    for (auto jVar = iVar + 1; jVar < n; jVar++)
+      for (auto kVar = 0ul; kVar < n; kVar++) M(iVar, kVar) -= A(iVar, jVar) * M(jVar, kVar);
+
+    for (auto kVar = 0ul; kVar < n; kVar++) M(iVar, kVar) /= A(iVar, iVar);
+  }
+#undef M
+#undef A
+}
+
+template <size_t N>
+using BlockSize = std::integral_constant<size_t, N>;
+
 }  // namespace
 
+template <class ScalarType>
+template <class F>
+FORCEINLINE void CSysMatrix<ScalarType>::DispatchBlockSize(const F& kernel) const {
+  /*--- The branch is always the same for a given matrix, which makes it trivial to predict. ---*/
+  switch (blockSizeKernel) {
+    case 1: kernel(BlockSize<1>()); break;
+    case 2: kernel(BlockSize<2>()); break;
+    case 3: kernel(BlockSize<3>()); break;
+    case 4: kernel(BlockSize<4>()); break;
+    case 5: kernel(BlockSize<5>()); break;
+    case 6: kernel(BlockSize<6>()); break;
+    case 7: kernel(BlockSize<7>()); break;
+    default: kernel(BlockSize<0>()); break;
+  }
+}
+
 #define __MATVECPROD_SIGNATURE__(TYPE, NAME) \
   FORCEINLINE void CSysMatrix<TYPE>::NAME(const TYPE* matrix, const TYPE* vector, TYPE* product) const
 
@@ -95,23 +185,30 @@ FORCEINLINE void gemm_impl(unsigned long n, const T* a, const T* b, T* c) {
 MATVECPROD_SIGNATURE(MatrixVectorProduct) {
   /*---
    Without MKL (default) picture copying the body of gemv_impl
-   here and resolving the conditionals at compilation.
+   here and resolving the conditionals at compilation. The size
+   of the block is also resolved at compilation for common sizes.
   ---*/
-  gemv_impl<ScalarType, true, false, false>(nVar, nEqn, matrix, vector, product);
+  DispatchBlockSize([&](auto N) {
+    gemv_impl<ScalarType, decltype(N)::value, true, false, false>(nVar, nEqn, matrix, vector, product);
+  });
 }
 
 MATVECPROD_SIGNATURE(MatrixVectorProductAdd) {
-  gemv_impl<ScalarType, true, true, false>(nVar, nEqn, matrix, vector, product);
+  DispatchBlockSize([&](auto N) {
+    gemv_impl<ScalarType, decltype(N)::value, true, true, false>(nVar, nEqn, matrix, vector, product);
+  });
 }
 
 MATVECPROD_SIGNATURE(MatrixVectorProductSub) {
-  gemv_impl<ScalarType, false, true, false>(nVar, nEqn, matrix, vector, product);
+  DispatchBlockSize([&](auto N) {
+    gemv_impl<ScalarType, decltype(N)::value, false, true, false>(nVar, nEqn, matrix, vector, product);
+  });
 }
 
 template <class ScalarType>
 FORCEINLINE void CSysMatrix<ScalarType>::MatrixMatrixProduct(const ScalarType* matrix_a, const ScalarType* matrix_b,
                                                              ScalarType* product) const {
-  gemm_impl<ScalarType>(nVar, matrix_a, matrix_b, product);
+  DispatchBlockSize([&](auto N) { gemm_impl<ScalarType, decltype(N)::value>(nVar, matrix_a, matrix_b, product); });
 }
 #else
 MATVECPROD_SIGNATURE(MatrixVectorProduct) {
@@ -169,6 +266,92 @@ FORCEINLINE void CSysMatrix<ScalarType>::InverseDiagonalBlock_ILUMatrix(unsigned
   MatrixInverse(block, invBlock);
 }
 
+template <class ScalarType>
+FORCEINLINE void CSysMatrix<ScalarType>::FactorizeRow_ILUMatrix(unsigned long iPoint, unsigned long begin,
+                                                                unsigned long end) {
+  ScalarType weight[MAXNVAR * MAXNVAR], aux_block[MAXNVAR * MAXNVAR];
+
+  /*--- For this row (unknown), loop over its lower diagonal entries. ---*/
+
+  for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
+    /*--- jPoint is the column index (jPoint < iPoint). ---*/
+
+    const auto jPoint = col_ind_ilu[index];
+
+    /*--- We only care about the sub matrix within "begin" and "end-1". ---*/
+
+    if (jPoint < begin) continue;
+
+    /*--- Multiply the block by the inverse of the corresponding diagonal block. ---*/
+
+    auto Block_ij = &ILU_matrix[index * nVar * nVar];
+    MatrixMatrixProduct(Block_ij, &invM[jPoint * nVar * nVar], weight);
+
+    /*--- "weight" holds Aij*inv(Ajj). Jump to the upper part of the jPoint row. ---*/
+
+    for (auto index_ = dia_ptr_ilu[jPoint] + 1; index_ < row_ptr_ilu[jPoint + 1]; index_++) {
+      /*--- Get the column index (kPoint > jPoint). ---*/
+
+      const auto kPoint = col_ind_ilu[index_];
+
+      if (kPoint >= end) break;
+
+      /*--- If Aik exists, update it: Aik -= Aij*inv(Ajj)*Ajk ---*/
+
+      auto Block_ik = GetBlock_ILUMatrix(iPoint, kPoint);
+
+      if (Block_ik != nullptr) {
+        auto Block_jk = &ILU_matrix[index_ * nVar * nVar];
+        MatrixMatrixProduct(weight, Block_jk, aux_block);
+        MatrixSubtraction(Block_ik, aux_block, Block_ik);
+      }
+    }
+
+    /*--- Lastly, store "weight" in the lower triangular part, which
+     will be reused during the forward solve in the precon/smoother. ---*/
+
+    for (auto iVar = 0ul; iVar < nVar * nVar; ++iVar) Block_ij[iVar] = weight[iVar];
+  }
+
+  /*--- The row is complete, invert its diagonal block for the next rows. ---*/
+
+  InverseDiagonalBlock_ILUMatrix(iPoint, &invM[iPoint * nVar * nVar]);
+}
+
+template <class ScalarType>
+FORCEINLINE void CSysMatrix<ScalarType>::ForwardSubstitutionRow_ILUMatrix(unsigned long iPoint, unsigned long begin,
+                                                                          CSysVector<ScalarType>& prod) const {
+  const auto nVec = prod.GetNVar() / nVar;
+  for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
+    const auto jPoint = col_ind_ilu[index];
+    if (jPoint < begin) continue;
+    auto Block_ij = &ILU_matrix[index * nVar * nVar];
+    for (auto iVec = 0ul; iVec < nVec; iVec++)
+      MatrixVectorProductSub(Block_ij, &prod[(jPoint * nVec + iVec) * nVar], &prod[(iPoint * nVec + iVec) * nVar]);
+  }
+}
+
+template <class ScalarType>
+FORCEINLINE void CSysMatrix<ScalarType>::BackwardSubstitutionRow_ILUMatrix(unsigned long iPoint, unsigned long end,
+                                                                           CSysVector<ScalarType>& prod) const {
+  /*--- The blocks of the row are reused from cache by the vectors of a multi-vector. ---*/
+  const auto nVec = prod.GetNVar() / nVar;
+  for (auto iVec = 0ul; iVec < nVec; iVec++) {
+    const auto idx_i = (iPoint * nVec + iVec) * nVar;
+    ScalarType aux_vec[MAXNVAR];
+    for (auto iVar = 0ul; iVar < nVar; iVar++) aux_vec[iVar] = prod[idx_i + iVar];
+
+    for (auto index = dia_ptr_ilu[iPoint] + 1; index < row_ptr_ilu[iPoint + 1]; index++) {
+      const auto jPoint = col_ind_ilu[index];
+      if (jPoint >= end) break;
+      auto Block_ij = &ILU_matrix[index * nVar * nVar];
+      MatrixVectorProductSub(Block_ij, &prod[(jPoint * nVec + iVec) * nVar], aux_vec);
+    }
+
+    MatrixVectorProduct(&invM[iPoint * nVar * nVar], aux_vec, &prod[idx_i]);
+  }
+}
+
 template <class ScalarType>
 FORCEINLINE void CSysMatrix<ScalarType>::RowProduct(const CSysVector<ScalarType>& vec, unsigned long row_i,
                                                     ScalarType* prod) const {
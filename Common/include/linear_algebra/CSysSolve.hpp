@@ -100,6 +100,24 @@ class CSysSolve {
   mutable std::vector<VectorType> W; /*!< \brief Large matrix used by FGMRES, w^i+1 = A * z^i. */
   mutable std::vector<VectorType> Z; /*!< \brief Large matrix used by FGMRES, preconditioned W. */
 
+  mutable std::vector<VectorType> AZ;  /*!< \brief Products A * z^i of the pipelined FGMRES. */
+  mutable std::vector<VectorType> PCG; /*!< \brief Auxiliary vectors of the pipelined CG (u, w, m, n, q, s). */
+
+  mutable std::vector<ScalarType> dotLocal;    /*!< \brief Rank-local sums of the fused dot products. */
+  mutable std::vector<ScalarType> dotGlobal;   /*!< \brief Fused dot products reduced across ranks. */
+  mutable CBaseMPIWrapper::Request dotRequest; /*!< \brief Request of the non-blocking reduction. */
+
+  /*!
+   * \brief Recycled subspace of GCRO-DR, the columns of C = A U are orthonormal.
+   */
+  struct RecycleSpace {
+    std::vector<VectorType> U; /*!< \brief Recycled directions in the solution space. */
+    std::vector<VectorType> C; /*!< \brief Products of the matrix and the recycled directions. */
+    unsigned long size = 0;    /*!< \brief Number of directions in use. */
+  };
+  RecycleSpace recycled[2];           /*!< \brief Recycled subspaces of Solve (0) and Solve_b (1). */
+  std::vector<VectorType> recycleTmp; /*!< \brief Work vectors used to update the recycled subspace. */
+
   VectorType
       LinSysSol_tmp; /*!< \brief Temporary used when it is necessary to interface between active and passive types. */
   VectorType
@@ -184,6 +202,30 @@ class CSysSolve {
    */
   void ModGramSchmidt(bool shared_hsbg, int i, su2matrix<ScalarType>& Hsbg, std::vector<VectorType>& w) const;
 
+  /*!
+   * \brief Starts a single reduction for several dot products, (a[k], b[k]) for k < n.
+   * \note The reduction is non-blocking (when possible), other work can be done before calling
+   *       FinishDotProducts. All threads must call both methods, only one reduction can be in flight.
+   * \param[in] n - Number of dot products.
+   * \param[in] a - Left vectors.
+   * \param[in] b - Right vectors.
+   * \param[in] nCol - Number of columns of multi-vectors, the products are per column, in position k * nCol + iCol.
+   */
+  void StartDotProducts(unsigned long n, const VectorType* const* a, const VectorType* const* b,
+                        unsigned long nCol = 1) const;
+
+  /*!
+   * \brief Completes the reduction started by StartDotProducts.
+   * \param[out] result - The n * nCol dot products.
+   */
+  void FinishDotProducts(ScalarType* result) const;
+
+  /*!
+   * \brief Get the solver settings from config, they depend on the mode of the linear solver.
+   */
+  void GetSettings(const CConfig* config, unsigned short& KindSolver, unsigned short& KindPrecond,
+                   unsigned long& MaxIter, ScalarType& SolverTol, bool& ScreenOutput) const;
+
   /*!
    * \brief writes header information for a CSysSolve residual history
    * \param[in] solver - string describing the solver
@@ -333,6 +375,86 @@ class CSysSolve {
                                   const PrecondType& precond, ScalarType tol, unsigned long m, ScalarType& residual,
                                   bool monitoring, const CConfig* config);
 
+  /*!
+   * \brief Flexible GMRES with deflated restarting and subspace recycling (GCRO-DR, Parks et al. 2006).
+   * \note The restart frequency and the size of the recycled subspace come from config. The subspace is kept
+   *       between calls, it is updated at the end of each cycle with the directions of the augmented Krylov
+   *       space that are least amplified by the matrix, and it is used to deflate the next systems.
+   * \param[in] b - the right hand size vector
+   * \param[in,out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] MaxIter - maximum number of iterations
+   * \param[out] residual - final normalized residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iSpace - Recycled subspace to use, 0 for the primal systems (Solve), 1 for the adjoint (Solve_b).
+   */
+  unsigned long GCRODR_LinSolver(const VectorType& b, VectorType& x, const ProductType& mat_vec,
+                                 const PrecondType& precond, ScalarType tol, unsigned long MaxIter,
+                                 ScalarType& residual, bool monitoring, const CConfig* config,
+                                 unsigned short iSpace = 0);
+
+  /*!
+   * \brief FGMRES for several right hand sides, stored as multi-vectors (see CSysVector::SetColumn).
+   * \note Each right hand side has its own Krylov subspace, but the products and the preconditioner are applied
+   *       to all of them at once (streaming the matrix once), and the dot products of all the right hand sides
+   *       are reduced together. Converged systems stop contributing to the subspaces of the others.
+   * \param[in] b - the right hand side multi-vector
+   * \param[in,out] x - on entry the intial guess, on exit the solution
+   * \param[in] nRhs - number of right hand sides (columns of the multi-vectors)
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the systems
+   * \param[in] m - maximum size of the search subspace
+   * \param[out] residual - largest final normalized residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] config - Definition of the particular problem.
+   */
+  unsigned long BatchedFGMRES_LinSolver(const VectorType& b, VectorType& x, unsigned long nRhs,
+                                        const ProductType& mat_vec, const PrecondType& precond, ScalarType tol,
+                                        unsigned long m, ScalarType& residual, bool monitoring,
+                                        const CConfig* config) const;
+
+  /*!
+   * \brief Pipelined Conjugate Gradient method (Ghysels and Vanroose, 2014)
+   * \note The dot products of each iteration are fused in one non-blocking reduction, which is overlapped with
+   *       the preconditioner and matrix-vector product. This requires more vectors and updates than CG.
+   * \param[in] b - the right hand size vector
+   * \param[in,out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum size of the search subspace
+   * \param[out] residual - final normalized residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] config - Definition of the particular problem.
+   */
+  unsigned long PipelinedCG_LinSolver(const VectorType& b, VectorType& x, const ProductType& mat_vec,
+                                      const PrecondType& precond, ScalarType tol, unsigned long m,
+                                      ScalarType& residual, bool monitoring, const CConfig* config) const;
+
+  /*!
+   * \brief Pipelined Generalized Minimal Residual method with right preconditioning
+   * \note Classical Gram-Schmidt with one non-blocking reduction per iteration, overlapped with the preconditioner
+   *       and matrix-vector product. These are applied to the vector before orthogonalization and the results are
+   *       orthogonalized by linearity, therefore the preconditioner cannot change between iterations. The second
+   *       Gram-Schmidt pass of each basis vector is lagged by one iteration and uses the same reduction.
+   * \param[in] b - the right hand size vector
+   * \param[in,out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum size of the search subspace
+   * \param[out] residual - final normalized residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] config - Definition of the particular problem.
+   */
+  unsigned long PipelinedGMRES_LinSolver(const VectorType& b, VectorType& x, const ProductType& mat_vec,
+                                         const PrecondType& precond, ScalarType tol, unsigned long m,
+                                         ScalarType& residual, bool monitoring, const CConfig* config) const;
+
   /*!
    * \brief Biconjugate Gradient Stabilized Method (BCGSTAB)
    * \param[in] b - the right hand size vector
@@ -388,6 +510,23 @@ class CSysSolve {
   unsigned long Solve_b(MatrixType& Jacobian, const CSysVector<su2double>& LinSysRes, CSysVector<su2double>& LinSysSol,
                         CGeometry* geometry, const CConfig* config, const bool directCall = true);
 
+  /*!
+   * \brief Solve several adjoint (transposed) linear systems with the same matrix, e.g. for different objectives.
+   * \note The right hand sides and solutions are multi-vectors (see CSysVector::SetColumn), the systems are solved
+   *       with BatchedFGMRES_LinSolver and the JACOBI or ILU preconditioners. The matrix is transposed in place for
+   *       the solution and restored at the end.
+   * \param[in] Jacobian - Jacobian Matrix for the linear system
+   * \param[in] LinSysRes - Linear system residuals (right hand sides)
+   * \param[in,out] LinSysSol - Linear system solutions
+   * \param[in] nRhs - Number of right hand sides
+   * \param[in] geometry -  Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \return The number of iterations of the slowest system.
+   */
+  unsigned long SolveMultiRHS_b(MatrixType& Jacobian, const CSysVector<su2double>& LinSysRes,
+                                CSysVector<su2double>& LinSysSol, unsigned long nRhs, CGeometry* geometry,
+                                const CConfig* config);
+
   /*!
    * \brief Get the number of iterations.
    * \return The number of iterations done by Solve or Solve_b
@@ -419,4 +558,20 @@ class CSysSolve {
    * \brief Set the screen output frequency during monitoring.
    */
   inline void SetMonitoringFrequency(bool frequency) { monitorFreq = frequency; }
+
+  /*!
+   * \brief Get the number of directions in a recycled subspace of GCRO-DR.
+   * \param[in] iSpace - 0 for the primal systems, 1 for the adjoint.
+   */
+  inline unsigned long GetRecycledSize(unsigned short iSpace = 0) const { return recycled[iSpace].size; }
+
+  /*!
+   * \brief Discard the recycled subspaces of GCRO-DR, e.g. when the systems become unrelated.
+   */
+  inline void ResetRecycledSubspace() {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      for (auto& space : recycled) space.size = 0;
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
 };
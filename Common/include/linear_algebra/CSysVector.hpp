@@ -198,6 +198,35 @@ class CSysVector : public VecExpr::CVecExpr<CSysVector<ScalarType>, ScalarType>
     END_CSYSVEC_PARFOR
   }
 
+  /*!
+   * \brief Copy a vector into a column of this multi-vector. A multi-vector stores nCol vectors with the same
+   *        number of blocks, interleaved block by block, i.e. block iBlk of column iCol starts at index
+   *        (iBlk * nCol + iCol) * nVarCol, where nVarCol is the block size of the columns.
+   * \note This is meant for use in parallel, the multi-vector must already be sized (nVar = nCol * nVarCol).
+   * \param[in] iCol - Index of the column.
+   * \param[in] nCol - Number of columns of the multi-vector.
+   * \param[in] col - Vector copied into the column.
+   */
+  void SetColumn(unsigned long iCol, unsigned long nCol, const CSysVector& col) {
+    const auto nVarCol = col.nVar;
+    CSYSVEC_PARFOR
+    for (auto i = 0ul; i < col.nElm; i++) vec_val[((i / nVarCol) * nCol + iCol) * nVarCol + i % nVarCol] = col[i];
+    END_CSYSVEC_PARFOR
+  }
+
+  /*!
+   * \brief Copy a column of this multi-vector into a vector (see SetColumn).
+   * \param[in] iCol - Index of the column.
+   * \param[in] nCol - Number of columns of the multi-vector.
+   * \param[out] col - Vector that receives the column, it must already be sized.
+   */
+  void GetColumn(unsigned long iCol, unsigned long nCol, CSysVector& col) const {
+    const auto nVarCol = col.nVar;
+    CSYSVEC_PARFOR
+    for (auto i = 0ul; i < col.nElm; i++) col[i] = vec_val[((i / nVarCol) * nCol + iCol) * nVarCol + i % nVarCol];
+    END_CSYSVEC_PARFOR
+  }
+
   /*!
    * \brief Performs the memory copy from host to device.
    * \param[in] trigger - boolean value that decides whether to conduct the transfer or not. True by default.
@@ -2118,13 +2118,15 @@ enum ENUM_INPUT {
   SU2       = 1,  /*!< \brief SU2 input format. */
   CGNS_GRID = 2,  /*!< \brief CGNS input format for the computational grid. */
   RECTANGLE = 3,  /*!< \brief 2D rectangular mesh with N x M points of size Lx x Ly. */
-  BOX       = 4   /*!< \brief 3D box mesh with N x M x L points of size Lx x Ly x Lz. */
+  BOX       = 4,  /*!< \brief 3D box mesh with N x M x L points of size Lx x Ly x Lz. */
+  SU2_BINARY = 5  /*!< \brief SU2 binary input format. */
 };
 static const MapType<std::string, ENUM_INPUT> Input_Map = {
   MakePair("SU2", SU2)
   MakePair("CGNS", CGNS_GRID)
   MakePair("RECTANGLE", RECTANGLE)
   MakePair("BOX", BOX)
+  MakePair("SU2_BINARY", SU2_BINARY)
 };
 
 
@@ -2143,6 +2145,7 @@ enum class OUTPUT_TYPE {
   SURFACE_PARAVIEW_ASCII,  /*!< \brief Paraview ASCII format for the solution output. */
   SURFACE_PARAVIEW_LEGACY_BINARY, /*!< \brief Paraview binary format for the solution output. */
   MESH,                    /*!< \brief SU2 mesh format. */
+  MESH_BINARY,             /*!< \brief SU2 binary mesh format. */
   RESTART_BINARY,          /*!< \brief SU2 binary restart format. */
   RESTART_ASCII,           /*!< \brief SU2 ASCII restart format. */
   PARAVIEW_XML,            /*!< \brief Paraview XML with binary data format */
@@ -2168,6 +2171,7 @@ static const MapType<std::string, OUTPUT_TYPE> Output_Map = {
   MakePair("SURFACE_PARAVIEW", OUTPUT_TYPE::SURFACE_PARAVIEW_XML)
   MakePair("PARAVIEW_MULTIBLOCK", OUTPUT_TYPE::PARAVIEW_MULTIBLOCK)
   MakePair("MESH", OUTPUT_TYPE::MESH)
+  MakePair("MESH_BINARY", OUTPUT_TYPE::MESH_BINARY)
   MakePair("RESTART_ASCII", OUTPUT_TYPE::RESTART_ASCII)
   MakePair("RESTART", OUTPUT_TYPE::RESTART_BINARY)
   MakePair("CGNS", OUTPUT_TYPE::CGNS)
@@ -2358,6 +2362,9 @@ enum ENUM_LINEAR_SOLVER {
   SMOOTHER,             /*!< \brief Iterative smoother. */
   PASTIX_LDLT,          /*!< \brief PaStiX LDLT (complete) factorization. */
   PASTIX_LU,            /*!< \brief PaStiX LU (complete) factorization. */
+  PIPELINED_CG,         /*!< \brief Conjugate gradient with one non-blocking reduction per iteration. */
+  PIPELINED_GMRES,      /*!< \brief GMRES with one non-blocking reduction per iteration (fixed preconditioner). */
+  GCRODR,               /*!< \brief Restarted FGMRES with a recycled subspace kept between linear systems. */
 };
 static const MapType<std::string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = {
   MakePair("CONJUGATE_GRADIENT", CONJUGATE_GRADIENT)
@@ -2367,6 +2374,23 @@ static const MapType<std::string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = {
   MakePair("SMOOTHER", SMOOTHER)
   MakePair("PASTIX_LDLT", PASTIX_LDLT)
   MakePair("PASTIX_LU", PASTIX_LU)
+  MakePair("PIPELINED_CG", PIPELINED_CG)
+  MakePair("PIPELINED_GMRES", PIPELINED_GMRES)
+  MakePair("GCRODR", GCRODR)
+};
+
+/*!
+ * \brief Storage formats of the sparse matrices used in the products of the Krylov solvers.
+ */
+enum class LINEAR_SOLVER_MATRIX_FORMAT {
+  BCSR,                 /*!< \brief Block compressed row storage. */
+  SELL_C_SIGMA,         /*!< \brief Sliced ELLPACK (SELL-C-sigma) copy for all matrices with square blocks. */
+  SELL_C_SIGMA_SCALAR,  /*!< \brief Sliced ELLPACK only for small blocks (nVar <= 2, e.g. turbulence and species). */
+};
+static const MapType<std::string, LINEAR_SOLVER_MATRIX_FORMAT> Linear_Solver_Matrix_Format_Map = {
+  MakePair("BCSR", LINEAR_SOLVER_MATRIX_FORMAT::BCSR)
+  MakePair("SELL_C_SIGMA", LINEAR_SOLVER_MATRIX_FORMAT::SELL_C_SIGMA)
+  MakePair("SELL_C_SIGMA_SCALAR", LINEAR_SOLVER_MATRIX_FORMAT::SELL_C_SIGMA_SCALAR)
 };
 
 /*!
@@ -2423,6 +2447,7 @@ enum ENUM_LINEAR_SOLVER_PREC {
   LU_SGS,         /*!< \brief LU SGS preconditioner. */
   LINELET,        /*!< \brief Line implicit preconditioner. */
   ILU,            /*!< \brief ILU(k) preconditioner. */
+  AMG,            /*!< \brief Smoothed aggregation algebraic multigrid preconditioner (rank-local aggregation). */
   PASTIX_ILU=10,  /*!< \brief PaStiX ILU(k) preconditioner. */
   PASTIX_LU_P,    /*!< \brief PaStiX LU as preconditioner. */
   PASTIX_LDLT_P,  /*!< \brief PaStiX LDLT as preconditioner. */
@@ -2432,6 +2457,7 @@ static const MapType<std::string, ENUM_LINEAR_SOLVER_PREC> Linear_Solver_Prec_Ma
   MakePair("LU_SGS", LU_SGS)
   MakePair("LINELET", LINELET)
   MakePair("ILU", ILU)
+  MakePair("AMG", AMG)
   MakePair("PASTIX_ILU", PASTIX_ILU)
   MakePair("PASTIX_LU", PASTIX_LU_P)
   MakePair("PASTIX_LDLT", PASTIX_LDLT_P)
@@ -173,6 +173,18 @@ class CBaseMPIWrapper {
     MPI_Irecv(buf, count, datatype, dest, tag, comm, request);
   }
 
+  static inline void Send_init(const void* buf, int count, Datatype datatype, int dest, int tag, Comm comm,
+                               Request* request) {
+    MPI_Send_init(buf, count, datatype, dest, tag, comm, request);
+  }
+
+  static inline void Recv_init(void* buf, int count, Datatype datatype, int source, int tag, Comm comm,
+                               Request* request) {
+    MPI_Recv_init(buf, count, datatype, source, tag, comm, request);
+  }
+
+  static inline void Start(Request* request) { MPI_Start(request); }
+
   static inline void Wait(Request* request, Status* status) { MPI_Wait(request, status); }
 
   static inline int Request_free(Request* request) { return MPI_Request_free(request); }
@@ -208,6 +220,11 @@ class CBaseMPIWrapper {
     MPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm);
   }
 
+  static inline void Iallreduce(const void* sendbuf, void* recvbuf, int count, Datatype datatype, Op op, Comm comm,
+                                Request* request) {
+    MPI_Iallreduce(sendbuf, recvbuf, count, datatype, op, comm, request);
+  }
+
   static inline void Gather(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, int recvcnt,
                             Datatype recvtype, int root, Comm comm) {
     MPI_Gather(sendbuf, sendcnt, sendtype, recvbuf, recvcnt, recvtype, root, comm);
@@ -539,6 +556,14 @@ class CBaseMPIWrapper {
 
   static inline void Irecv(void* buf, int count, Datatype datatype, int source, int tag, Comm comm, Request* request) {}
 
+  static inline void Send_init(const void* buf, int count, Datatype datatype, int dest, int tag, Comm comm,
+                               Request* request) {}
+
+  static inline void Recv_init(void* buf, int count, Datatype datatype, int source, int tag, Comm comm,
+                               Request* request) {}
+
+  static inline void Start(Request* request) {}
+
   static inline void Wait(Request* request, Status* status) {}
 
   static inline int Request_free(Request* request) { return 0; }
@@ -612,7 +612,7 @@ struct GridColor {
 };
 
 /*!
- * \brief A way to represent natural coloring {0,1,2,...,size-1} with zero
+ * \brief A way to represent natural coloring {first,first+1,...,first+size-1} with zero
  * overhead (behaves like looping with an integer index, after optimization...).
  */
 template <typename T = unsigned long>
@@ -621,10 +621,11 @@ struct DummyGridColor {
 
   T size;
   struct {
-    inline T operator[](T i) const { return i; }
+    T first;
+    inline T operator[](T i) const { return first + i; }
   } indices;
 
-  DummyGridColor(T sz = 0) : size(sz) {}
+  DummyGridColor(T sz = 0, T first = 0) : size(sz) { indices.first = first; }
 
   struct IteratorLikeInt {
     T i;
@@ -642,10 +643,45 @@ struct DummyGridColor {
     inline bool operator==(const IteratorLikeInt& other) const { return i == other.i; }
     inline bool operator!=(const IteratorLikeInt& other) const { return i != other.i; }
   };
-  inline IteratorLikeInt begin() const { return IteratorLikeInt(0); }
-  inline IteratorLikeInt end() const { return IteratorLikeInt(size); }
+  inline IteratorLikeInt begin() const { return IteratorLikeInt(indices.first); }
+  inline IteratorLikeInt end() const { return IteratorLikeInt(indices.first + size); }
 };
 
+/*!
+ * \brief Split the colors of a coloring into the indices lower than "splitIdx" and the others, e.g. to
+ * first process the edges that do not touch halo points while their data is being communicated.
+ * \note The indices of each color must be sorted (as done by colorSparsePattern), the split is done at
+ * a multiple of the group size (rounding down "splitIdx") to keep the groups of each color intact.
+ * \param[in] coloring - Coloring to split.
+ * \param[in] groupSize - Size of the groups of the coloring.
+ * \param[in] splitIdx - First index of the second part of the colors.
+ * \param[out] colors - The first parts of the colors followed by the second parts (empty parts are omitted).
+ * \return Number of colors in the first part.
+ */
+template <class T, class Index_t = typename T::IndexType>
+size_t splitColoring(const T& coloring, Index_t groupSize, Index_t splitIdx, std::vector<GridColor<Index_t> >& colors) {
+  splitIdx = (splitIdx / groupSize) * groupSize;
+
+  const Index_t nColor = coloring.getOuterSize();
+  std::vector<GridColor<Index_t> > upper;
+  colors.clear();
+  colors.reserve(2 * nColor);
+
+  for (Index_t color = 0; color < nColor; ++color) {
+    const Index_t* begin = coloring.innerIdx(color);
+    const Index_t size = coloring.getNumNonZeros(color);
+    const Index_t nLower = std::lower_bound(begin, begin + size, splitIdx) - begin;
+
+    if (nLower > 0) colors.emplace_back(begin, nLower, groupSize);
+    if (nLower < size) upper.emplace_back(begin + nLower, size - nLower, groupSize);
+  }
+  const auto nFirst = colors.size();
+
+  for (const auto& color : upper) colors.push_back(color);
+
+  return nFirst;
+}
+
 /*!
  * \brief Computes the efficiency of a grid coloring for given number of threads and chunk size.
  */
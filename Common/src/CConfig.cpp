@@ -696,6 +696,11 @@ unsigned short CConfig::GetnZone(const string& val_mesh_filename, unsigned short
 
       break;
     }
+    case SU2_BINARY: {
+      /*--- SU2 binary mesh files contain a single zone. ---*/
+      nZone = 1;
+      break;
+    }
     case RECTANGLE: {
       nZone = 1;
       break;
@@ -806,6 +811,26 @@ unsigned short CConfig::GetnDim(const string& val_mesh_filename, unsigned short
 
       break;
     }
+    case SU2_BINARY: {
+
+      /*--- The dimension is the first integer after the 8 character identifier
+            of the file (see CSU2BinaryMeshReaderFVM). ---*/
+      ifstream mesh_file(val_mesh_filename, ios::binary);
+      if (mesh_file.fail()) {
+        SU2_MPI::Error(string("The SU2 binary mesh file named ") + val_mesh_filename + string(" was not found."), CURRENT_FUNCTION);
+      }
+
+      char magic[8] = {};
+      int64_t dim = -1;
+      mesh_file.read(magic, sizeof(magic));
+      mesh_file.read(reinterpret_cast<char*>(&dim), sizeof(dim));
+
+      if (!mesh_file || strncmp(magic, "SU2MSHB1", sizeof(magic)) != 0) {
+        SU2_MPI::Error(val_mesh_filename + string(" is not an SU2 binary mesh file."), CURRENT_FUNCTION);
+      }
+      nDim = dim;
+      break;
+    }
     case RECTANGLE: {
       nDim = 2;
       break;
@@ -1779,6 +1804,8 @@ void CConfig::SetConfig_Options() {
   addUShortArrayOption("NEWTON_KRYLOV_IPARAM", NK_IntParam.size(), NK_IntParam.data());
   /* DESCRIPTION: Double parameters {startup residual drop, precond tolerance, full tolerance residual drop, findiff step}. */
   addDoubleArrayOption("NEWTON_KRYLOV_DPARAM", NK_DblParam.size(), NK_DblParam.data());
+  /* DESCRIPTION: Solve the startup (quasi-Newton) systems by iterative refinement of single precision solves. */
+  addBoolOption("NEWTON_KRYLOV_REFINEMENT", NK_Refinement, false);
 
   /* DESCRIPTION: Number of samples for quasi-Newton methods. */
   addUnsignedShortOption("QUASI_NEWTON_NUM_SAMPLES", nQuasiNewtonSamples, 0);
@@ -1867,7 +1894,8 @@ void CConfig::SetConfig_Options() {
    *  \n DESCRIPTION: Linear solver for the implicit, mesh deformation, or discrete adjoint systems \n OPTIONS: see \link Linear_Solver_Map \endlink \n DEFAULT: FGMRES \ingroup Config*/
   addEnumOption("LINEAR_SOLVER", Kind_Linear_Solver, Linear_Solver_Map, FGMRES);
   /*!\brief LINEAR_SOLVER_PREC
-   *  \n DESCRIPTION: Preconditioner for the Krylov linear solvers \n OPTIONS: see \link Linear_Solver_Prec_Map \endlink \n DEFAULT: LU_SGS \ingroup Config*/
+   *  \n DESCRIPTION: Preconditioner for the Krylov linear solvers, the AMG aggregation is local to each rank
+   *  (couplings between ranks are ignored) \n OPTIONS: see \link Linear_Solver_Prec_Map \endlink \n DEFAULT: LU_SGS \ingroup Config*/
   addEnumOption("LINEAR_SOLVER_PREC", Kind_Linear_Solver_Prec, Linear_Solver_Prec_Map, ILU);
   /* DESCRIPTION: Minimum error threshold for the linear solver for the implicit formulation */
   addDoubleOption("LINEAR_SOLVER_ERROR", Linear_Solver_Error, 1E-6);
@@ -1877,10 +1905,16 @@ void CConfig::SetConfig_Options() {
   addUnsignedShortOption("LINEAR_SOLVER_ILU_FILL_IN", Linear_Solver_ILU_n, 0);
   /* DESCRIPTION: Maximum number of iterations of the linear solver for the implicit formulation */
   addUnsignedLongOption("LINEAR_SOLVER_RESTART_FREQUENCY", Linear_Solver_Restart_Frequency, 10);
+  /* DESCRIPTION: Number of directions recycled between linear systems by GCRO-DR */
+  addUnsignedLongOption("LINEAR_SOLVER_RECYCLE_SIZE", Linear_Solver_Recycle_Size, 8);
   /* DESCRIPTION: Relaxation factor for iterative linear smoothers (SMOOTHER_ILU/JACOBI/LU-SGS/LINELET) */
   addDoubleOption("LINEAR_SOLVER_SMOOTHER_RELAXATION", Linear_Solver_Smoother_Relaxation, 1.0);
   /* DESCRIPTION: Custom number of threads used for additive domain decomposition for ILU and LU_SGS (0 is "auto"). */
   addUnsignedLongOption("LINEAR_SOLVER_PREC_THREADS", Linear_Solver_Prec_Threads, 0);
+  /* DESCRIPTION: Use level scheduling instead of additive domain decomposition to parallelize ILU with threads. */
+  addBoolOption("LINEAR_SOLVER_ILU_LEVEL_SCHEDULING", Linear_Solver_ILU_Level_Scheduling, false);
+  /* DESCRIPTION: Storage format of the sparse matrices used in the products of the Krylov linear solvers. */
+  addEnumOption("LINEAR_SOLVER_MATRIX_FORMAT", Kind_Linear_Solver_Matrix_Format, Linear_Solver_Matrix_Format_Map, LINEAR_SOLVER_MATRIX_FORMAT::BCSR);
   /* DESCRIPTION: Relaxation factor for updates of adjoint variables. */
   addDoubleOption("RELAXATION_FACTOR_ADJOINT", Relaxation_Factor_Adjoint, 1.0);
   /* DESCRIPTION: Relaxation of the CHT coupling */
@@ -2896,6 +2930,12 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: ParMETIS load balancing weight for edges (equiv. to neighbors) */
   addLongOption("PARMETIS_EDGE_WEIGHT", ParMETIS_edgeWgt, 1);
 
+  /* DESCRIPTION: Reuse the partitioning of a previous run with the same mesh, number of ranks, and ParMETIS options */
+  addBoolOption("PARTITION_CACHE", Partition_Cache, false);
+
+  /* DESCRIPTION: Partition cache file */
+  addStringOption("PARTITION_CACHE_FILENAME", Partition_Cache_FileName, string("partition_cache.dat"));
+
   /*--- options that are used in the Hybrid RANS/LES Simulations  ---*/
   /*!\par CONFIG_CATEGORY:Hybrid_RANSLES Options\ingroup Config*/
 
@@ -2997,7 +3037,8 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Level of fill for PaStiX incomplete LU factorization. */
   addUnsignedShortOption("PASTIX_FILL_LEVEL", pastix_fill_lvl, 1);
 
-  /* DESCRIPTION: Size of the edge groups colored for thread parallel edge loops (0 forces the reducer strategy). */
+  /* DESCRIPTION: Size of the edge groups colored for thread parallel edge loops (0 forces the reducer strategy).
+   * Edges between owned points are numbered first to overlap the MPI comms, this changes the summation order. */
   addUnsignedLongOption("EDGE_COLORING_GROUP_SIZE", edgeColorGroupSize, 512);
 
   /* DESCRIPTION: Allow fallback to smaller edge color group sizes for the discrete adjoint and allow more colors. */
@@ -5545,13 +5586,15 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
   if (ReconstructionGradientRequired && GetFluidProblem() && Kind_ConvNumScheme_Flow == SPACE_CENTERED)
     SU2_MPI::Error("For centered schemes the option NUM_METHOD_GRAD_RECON should not be set.", CURRENT_FUNCTION);
 
-  /* Simpler boolean to control allocation of least-squares memory. */
+  /* Simpler boolean to control allocation of least-squares memory. The per-variable R matrices
+   * are only needed for periodic communications, otherwise the geometric coefficients are
+   * cached in CGeometry (see computeGradientsLeastSquares). */
 
   LeastSquaresRequired = false;
-  if ((Kind_Gradient_Method_Recon == LEAST_SQUARES) ||
-      (Kind_Gradient_Method_Recon == WEIGHTED_LEAST_SQUARES) ||
-      (Kind_Gradient_Method       == LEAST_SQUARES) ||
-      (Kind_Gradient_Method       == WEIGHTED_LEAST_SQUARES)) {
+  if (((Kind_Gradient_Method_Recon == LEAST_SQUARES) ||
+       (Kind_Gradient_Method_Recon == WEIGHTED_LEAST_SQUARES) ||
+       (Kind_Gradient_Method       == LEAST_SQUARES) ||
+       (Kind_Gradient_Method       == WEIGHTED_LEAST_SQUARES)) && (nMarker_PerBound > 0)) {
     LeastSquaresRequired = true;
   }
 
@@ -7230,8 +7273,15 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
             case BCGSTAB:
             case FGMRES:
             case RESTARTED_FGMRES:
+            case PIPELINED_GMRES:
+            case GCRODR:
               if (Kind_Linear_Solver == BCGSTAB)
                 cout << "BCGSTAB is used for solving the linear system." << endl;
+              else if (Kind_Linear_Solver == PIPELINED_GMRES)
+                cout << "Pipelined GMRES is used for solving the linear system." << endl;
+              else if (Kind_Linear_Solver == GCRODR)
+                cout << "GCRO-DR (FGMRES with a recycled subspace of size " << Linear_Solver_Recycle_Size
+                     << ") is used for solving the linear system." << endl;
               else
                 cout << "FGMRES is used for solving the linear system." << endl;
               switch (Kind_Linear_Solver_Prec) {
@@ -7239,6 +7289,7 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
                 case LINELET: cout << "Using a linelet preconditioning."<< endl; break;
                 case LU_SGS:  cout << "Using a LU-SGS preconditioning."<< endl; break;
                 case JACOBI:  cout << "Using a Jacobi preconditioning."<< endl; break;
+                case AMG:     cout << "Using an algebraic multigrid preconditioning."<< endl; break;
               }
               break;
             case SMOOTHER:
@@ -7247,6 +7298,7 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
                 case LINELET: cout << "A Linelet"; break;
                 case LU_SGS:  cout << "A LU-SGS"; break;
                 case JACOBI:  cout << "A Jacobi"; break;
+                case AMG:     cout << "An algebraic multigrid"; break;
               }
               cout << " method is used for smoothing the linear system." << endl;
               break;
@@ -7276,12 +7328,12 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
               break;
-            case FGMRES: case RESTARTED_FGMRES:
+            case FGMRES: case RESTARTED_FGMRES: case PIPELINED_GMRES: case GCRODR:
               cout << "FGMRES is used for solving the linear system." << endl;
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
               break;
-            case CONJUGATE_GRADIENT:
+            case CONJUGATE_GRADIENT: case PIPELINED_CG:
               cout << "A Conjugate Gradient method is used for solving the linear system." << endl;
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
@@ -10130,31 +10182,37 @@ void CConfig::GEMM_Tock(double val_start_time, int M, int N, int K) const {
   const double val_elapsed_time = val_stop_time - val_start_time;
 
   /* Create the CLong3T from the M-N-K values and check if it is already
-     stored in the map GEMM_Profile_MNK. */
+     stored in the map GEMM_Profile_MNK. The gemm calls can be made by
+     several threads simultaneously, hence the update is a critical section. */
   CLong3T MNK(M, N, K);
-  map<CLong3T, int>::iterator MI = GEMM_Profile_MNK.find(MNK);
 
-  if(MI == GEMM_Profile_MNK.end()) {
+  SU2_OMP_CRITICAL
+  {
+    map<CLong3T, int>::iterator MI = GEMM_Profile_MNK.find(MNK);
 
-    /* Entry is not present yet. Create it. */
-    const int ind = GEMM_Profile_MNK.size();
-    GEMM_Profile_MNK[MNK] = ind;
+    if(MI == GEMM_Profile_MNK.end()) {
 
-    GEMM_Profile_NCalls.push_back(1);
-    GEMM_Profile_TotTime.push_back(val_elapsed_time);
-    GEMM_Profile_MinTime.push_back(val_elapsed_time);
-    GEMM_Profile_MaxTime.push_back(val_elapsed_time);
-  }
-  else {
+      /* Entry is not present yet. Create it. */
+      const int ind = GEMM_Profile_MNK.size();
+      GEMM_Profile_MNK[MNK] = ind;
 
-    /* Entry is already present. Determine its index in the
-       map and update the corresponding vectors. */
-    const int ind = MI->second;
-    ++GEMM_Profile_NCalls[ind];
-    GEMM_Profile_TotTime[ind] += val_elapsed_time;
-    GEMM_Profile_MinTime[ind]  = min(GEMM_Profile_MinTime[ind], val_elapsed_time);
-    GEMM_Profile_MaxTime[ind]  = max(GEMM_Profile_MaxTime[ind], val_elapsed_time);
+      GEMM_Profile_NCalls.push_back(1);
+      GEMM_Profile_TotTime.push_back(val_elapsed_time);
+      GEMM_Profile_MinTime.push_back(val_elapsed_time);
+      GEMM_Profile_MaxTime.push_back(val_elapsed_time);
+    }
+    else {
+
+      /* Entry is already present. Determine its index in the
+         map and update the corresponding vectors. */
+      const int ind = MI->second;
+      ++GEMM_Profile_NCalls[ind];
+      GEMM_Profile_TotTime[ind] += val_elapsed_time;
+      GEMM_Profile_MinTime[ind]  = min(GEMM_Profile_MinTime[ind], val_elapsed_time);
+      GEMM_Profile_MaxTime[ind]  = max(GEMM_Profile_MaxTime[ind], val_elapsed_time);
+    }
   }
+  END_SU2_OMP_CRITICAL
 
 #endif
 
@@ -32,6 +32,13 @@
 #include "../../Common/include/option_structure.hpp"
 #include "../../Common/include/parallelization/mpi_structure.hpp"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 using namespace std;
 
 void CFileReaderLUT::ReadRawLUT(const string& file_name) {
@@ -365,3 +372,65 @@ bool CFileReaderLUT::GetStrippedLine(ifstream& file_stream, string& line) const
   /*--- return true if line is not empty, else return false ---*/
   return !line.empty();
 }
+
+constexpr char CBinaryFileLUT::magic[];
+
+bool CBinaryFileLUT::IsBinary(const string& file_name) {
+  ifstream file_stream(file_name, ios::binary);
+  char header[sizeof(magic)] = {0};
+  file_stream.read(header, sizeof(magic) - 1);
+  return file_stream.good() && (strncmp(header, magic, sizeof(magic) - 1) == 0);
+}
+
+CBinaryFileLUT::CBinaryFileLUT(const string& file_name) {
+#ifndef _WIN32
+  /*--- Map the file read-only, pages are shared with other processes reading the same file. ---*/
+  const int fd = open(file_name.c_str(), O_RDONLY);
+  struct stat file_stat;
+  if (fd >= 0 && fstat(fd, &file_stat) == 0 && file_stat.st_size > 0) {
+    void* ptr = mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (ptr != MAP_FAILED) {
+      data = static_cast<const char*>(ptr);
+      size = file_stat.st_size;
+      mapped = true;
+    }
+  }
+  if (fd >= 0) close(fd);
+#endif
+  if (!mapped) {
+    ifstream file_stream(file_name, ios::binary | ios::ate);
+    if (!file_stream.is_open()) {
+      SU2_MPI::Error(string("There is no look-up-table file called ") + file_name, CURRENT_FUNCTION);
+    }
+    buffer.resize(file_stream.tellg());
+    file_stream.seekg(0);
+    file_stream.read(buffer.data(), buffer.size());
+    data = buffer.data();
+    size = buffer.size();
+  }
+
+  if (size < sizeof(magic) - 1 || strncmp(data, magic, sizeof(magic) - 1) != 0) {
+    SU2_MPI::Error(file_name + " is not a binary look-up table file.", CURRENT_FUNCTION);
+  }
+  pos = sizeof(magic) - 1;
+}
+
+CBinaryFileLUT::~CBinaryFileLUT() {
+#ifndef _WIN32
+  if (mapped) munmap(const_cast<char*>(data), size);
+#endif
+}
+
+string CBinaryFileLUT::ReadString() {
+  const auto length = ReadInteger();
+  const auto padded = ((length + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t)) * sizeof(std::uint64_t);
+  const char* str = Advance(padded);
+  return string(str, length);
+}
+
+void CBinaryFileLUT::WriteString(ostream& file, const string& str) {
+  WriteInteger(file, str.size());
+  file.write(str.data(), str.size());
+  const auto padding = (sizeof(std::uint64_t) - str.size() % sizeof(std::uint64_t)) % sizeof(std::uint64_t);
+  for (auto i = 0ul; i < padding; ++i) file.put('\0');
+}
@@ -38,7 +38,13 @@ CLookUpTable::CLookUpTable(const string& var_file_name_lut, string name_CV1_in,
     : file_name_lut{var_file_name_lut}, name_CV1{std::move(name_CV1_in)}, name_CV2{std::move(name_CV2_in)} {
   rank = SU2_MPI::GetRank();
 
-  LoadTableRaw(var_file_name_lut);
+  /* Binary tables already contain the search structures. */
+  const bool binary = CBinaryFileLUT::IsBinary(var_file_name_lut);
+
+  if (binary)
+    LoadTableBinary(var_file_name_lut);
+  else
+    LoadTableRaw(var_file_name_lut);
 
   /* Store indices of controlling variables. */
   idx_CV1 = GetIndexOfVar(name_CV1);
@@ -46,20 +52,41 @@ CLookUpTable::CLookUpTable(const string& var_file_name_lut, string name_CV1_in,
 
   FindTableLimits(name_CV1, name_CV2);
 
-  if (rank == MASTER_NODE)
-    cout << "Detecting all unique edges and setting edge to triangle connectivity "
-            "..."
-         << endl;
+  if (!binary) {
+    if (rank == MASTER_NODE)
+      cout << "Detecting all unique edges and setting edge to triangle connectivity "
+              "..."
+           << endl;
+
+    IdentifyUniqueEdges();
+  }
 
-  IdentifyUniqueEdges();
+  IdentifyTriangleNeighbors();
 
-  if (rank == MASTER_NODE) cout << " done." << endl;
+  if (!binary && rank == MASTER_NODE) cout << " done." << endl;
 
   PrintTableInfo();
 
   /* Add additional variable index which will always result in zero when looked up. */
   idx_null = names_var.size();
 
+  if (!binary) {
+    BuildTrapezoidalMaps();
+
+    ComputeInterpCoeffs();
+  }
+
+  if (rank == MASTER_NODE) cout << "LUT fluid model ready for use" << endl;
+}
+
+CLookUpTable::~CLookUpTable() {
+#if defined(HAVE_MPI) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+  if (node_window != MPI_WIN_NULL) MPI_Win_free(&node_window);
+  if (node_comm != MPI_COMM_NULL) MPI_Comm_free(&node_comm);
+#endif
+}
+
+void CLookUpTable::BuildTrapezoidalMaps() {
   if (rank == MASTER_NODE) switch (table_dim) {
       case 2:
         cout << "Building a trapezoidal map for the (" + name_CV1 + ", " + name_CV2 +
@@ -84,7 +111,7 @@ CLookUpTable::CLookUpTable(const string& var_file_name_lut, string name_CV1_in,
   double tmap_memory_footprint = 0;
   for (auto i_level = 0ul; i_level < n_table_levels; i_level++) {
     trap_map_x_y[i_level] =
-        CTrapezoidalMap(GetDataP(name_CV1, i_level), GetDataP(name_CV2, i_level), table_data[i_level].cols(),
+        CTrapezoidalMap(GetDataP(name_CV1, i_level), GetDataP(name_CV2, i_level), n_points[i_level],
                         edges[i_level], edge_to_triangle[i_level], display_map_info);
     tmap_memory_footprint += trap_map_x_y[i_level].GetMemoryFootprint();
     /* Display a progress bar to monitor table generation process */
@@ -114,10 +141,6 @@ CLookUpTable::CLookUpTable(const string& var_file_name_lut, string name_CV1_in,
     cout << "Trapezoidal map memory footprint: " << tmap_memory_footprint << " MB\n";
     cout << "Table data memory footprint: " << memory_footprint_data << " MB\n" << endl;
   }
-
-  ComputeInterpCoeffs();
-
-  if (rank == MASTER_NODE) cout << "LUT fluid model ready for use" << endl;
 }
 
 void CLookUpTable::LoadTableRaw(const string& var_file_name_lut) {
@@ -133,17 +156,22 @@ void CLookUpTable::LoadTableRaw(const string& var_file_name_lut) {
   n_triangles.resize(n_table_levels);
   n_hull_points.resize(n_table_levels);
   table_data.resize(n_table_levels);
+  data_levels.resize(n_table_levels);
   hull.resize(n_table_levels);
   triangles.resize(n_table_levels);
   interp_mat_inv_x_y.resize(n_table_levels);
+  interp_levels.resize(n_table_levels);
   edges.resize(n_table_levels);
   edge_to_triangle.resize(n_table_levels);
+  triangle_neighbors.resize(n_table_levels);
+  last_triangle.resize(n_table_levels);
 
   for (unsigned long i_level = 0; i_level < n_table_levels; i_level++) {
     n_points[i_level] = file_reader.GetNPoints(i_level);
     n_triangles[i_level] = file_reader.GetNTriangles(i_level);
     n_hull_points[i_level] = file_reader.GetNHullPoints(i_level);
     table_data[i_level] = file_reader.GetTableData(i_level);
+    data_levels[i_level] = table_data[i_level].data();
     triangles[i_level] = file_reader.GetTriangles(i_level);
     hull[i_level] = file_reader.GetHull(i_level);
     memory_footprint_data += n_points[i_level] * sizeof(su2double);
@@ -164,6 +192,199 @@ void CLookUpTable::LoadTableRaw(const string& var_file_name_lut) {
   if (rank == MASTER_NODE) cout << " done." << endl;
 }
 
+void CLookUpTable::LoadTableBinary(const string& var_file_name_lut) {
+  if (rank == MASTER_NODE) cout << "Loading binary lookup table, filename = " << var_file_name_lut << " ..." << endl;
+
+  CBinaryFileLUT file(var_file_name_lut);
+
+  version_lut = file.ReadString();
+  version_reader = file.ReadString();
+
+  /* The search structures depend on the controlling variables. */
+  const auto file_CV1 = file.ReadString();
+  const auto file_CV2 = file.ReadString();
+  if (file_CV1 != name_CV1 || file_CV2 != name_CV2) {
+    SU2_MPI::Error("The binary table " + var_file_name_lut + " was written for the controlling variables (" +
+                       file_CV1 + ", " + file_CV2 + "), convert the ASCII table for (" + name_CV1 + ", " + name_CV2 +
+                       ").",
+                   CURRENT_FUNCTION);
+  }
+
+  table_dim = file.ReadInteger();
+  n_table_levels = file.ReadInteger();
+  n_variables = file.ReadInteger();
+  names_var.resize(n_variables);
+  for (auto i_var = 0ul; i_var < n_variables; i_var++) names_var[i_var] = file.ReadString();
+
+  n_points.resize(n_table_levels);
+  n_triangles.resize(n_table_levels);
+  n_hull_points.resize(n_table_levels);
+  table_data.resize(n_table_levels);
+  data_levels.resize(n_table_levels);
+  hull.resize(n_table_levels);
+  triangles.resize(n_table_levels);
+  interp_mat_inv_x_y.resize(n_table_levels);
+  interp_levels.resize(n_table_levels);
+  edges.resize(n_table_levels);
+  edge_to_triangle.resize(n_table_levels);
+  triangle_neighbors.resize(n_table_levels);
+  last_triangle.resize(n_table_levels);
+  trap_map_x_y.resize(n_table_levels);
+
+  if (table_dim == 3) {
+    z_values_levels.resize(n_table_levels);
+    file.ReadReals(z_values_levels.data(), n_table_levels);
+  }
+
+  vector<unsigned long> n_edges(n_table_levels);
+  for (auto i_level = 0ul; i_level < n_table_levels; i_level++) {
+    n_points[i_level] = file.ReadInteger();
+    n_triangles[i_level] = file.ReadInteger();
+    n_hull_points[i_level] = file.ReadInteger();
+    n_edges[i_level] = file.ReadInteger();
+    memory_footprint_data += n_points[i_level] * sizeof(su2double);
+  }
+  memory_footprint_data /= 1e6;
+
+  /* The data and interpolation matrices of all levels are contiguous in the file, so that they
+   * can be read by one rank of each node directly into shared memory. */
+  const bool fill = AllocateTableStorage(true);
+  for (auto i_level = 0ul; i_level < n_table_levels; i_level++) {
+    const auto size = n_variables * n_points[i_level];
+    if (fill)
+      file.ReadReals(data_levels[i_level], size);
+    else
+      file.SkipReals(size);
+  }
+  for (auto i_level = 0ul; i_level < n_table_levels; i_level++) {
+    const auto size = N_POINTS_TRIANGLE * N_POINTS_TRIANGLE * n_triangles[i_level];
+    if (fill)
+      file.ReadReals(interp_levels[i_level], size);
+    else
+      file.SkipReals(size);
+  }
+#if defined(HAVE_MPI) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+  if (node_window != MPI_WIN_NULL) MPI_Win_fence(0, node_window);
+#endif
+
+  /* The connectivity and trapezoidal maps are read by all ranks. */
+  double tmap_memory_footprint = 0;
+  for (auto i_level = 0ul; i_level < n_table_levels; i_level++) {
+    triangles[i_level].resize(n_triangles[i_level], N_POINTS_TRIANGLE);
+    file.ReadIntegers(triangles[i_level].data(), N_POINTS_TRIANGLE * n_triangles[i_level]);
+
+    hull[i_level].resize(n_hull_points[i_level]);
+    file.ReadIntegers(hull[i_level].data(), n_hull_points[i_level]);
+
+    edges[i_level].resize(n_edges[i_level]);
+    for (auto& edge : edges[i_level]) file.ReadIntegers(edge.data(), 2);
+
+    edge_to_triangle[i_level].resize(n_edges[i_level]);
+    for (auto iEdge = 0ul; iEdge < n_edges[i_level]; iEdge++)
+      edge_to_triangle[i_level][iEdge].resize(file.ReadInteger());
+    for (auto iEdge = 0ul; iEdge < n_edges[i_level]; iEdge++)
+      file.ReadIntegers(edge_to_triangle[i_level][iEdge].data(), edge_to_triangle[i_level][iEdge].size());
+
+    trap_map_x_y[i_level].ReadBinary(file, edge_to_triangle[i_level]);
+    tmap_memory_footprint += trap_map_x_y[i_level].GetMemoryFootprint();
+  }
+
+  if (rank == MASTER_NODE) {
+    cout << " done." << endl;
+    cout << "Trapezoidal map memory footprint: " << tmap_memory_footprint << " MB\n";
+    cout << "Table data memory footprint: " << memory_footprint_data << " MB\n" << endl;
+  }
+}
+
+bool CLookUpTable::AllocateTableStorage(bool shared) {
+  constexpr auto mat_size = N_POINTS_TRIANGLE * N_POINTS_TRIANGLE;
+
+#if defined(HAVE_MPI) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+  if (shared) {
+    unsigned long total_size = 0;
+    for (auto i_level = 0ul; i_level < n_table_levels; i_level++)
+      total_size += n_variables * n_points[i_level] + mat_size * n_triangles[i_level];
+
+    /* The first rank of each node allocates the window, the others get a pointer to it. */
+    int node_rank;
+    MPI_Comm_split_type(SU2_MPI::GetComm(), MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &node_comm);
+    MPI_Comm_rank(node_comm, &node_rank);
+
+    const MPI_Aint window_size = (node_rank == 0) ? total_size * sizeof(su2double) : 0;
+    su2double* base = nullptr;
+    MPI_Win_allocate_shared(window_size, sizeof(su2double), MPI_INFO_NULL, node_comm, &base, &node_window);
+    if (node_rank != 0) {
+      MPI_Aint root_size;
+      int disp_unit;
+      MPI_Win_shared_query(node_window, 0, &root_size, &disp_unit, &base);
+    }
+    MPI_Win_fence(0, node_window);
+
+    for (auto i_level = 0ul; i_level < n_table_levels; i_level++) {
+      data_levels[i_level] = base;
+      base += n_variables * n_points[i_level];
+    }
+    for (auto i_level = 0ul; i_level < n_table_levels; i_level++) {
+      interp_levels[i_level] = base;
+      base += mat_size * n_triangles[i_level];
+    }
+    return node_rank == 0;
+  }
+#endif
+
+  for (auto i_level = 0ul; i_level < n_table_levels; i_level++) {
+    table_data[i_level].resize(n_variables, n_points[i_level]);
+    data_levels[i_level] = table_data[i_level].data();
+    interp_mat_inv_x_y[i_level].resize(n_triangles[i_level], mat_size);
+    interp_levels[i_level] = interp_mat_inv_x_y[i_level].data();
+  }
+  return true;
+}
+
+void CLookUpTable::WriteBinaryTable(const string& file_name) const {
+  ofstream file(file_name, ios::binary);
+  if (!file.is_open()) SU2_MPI::Error("Unable to open binary look-up table file " + file_name, CURRENT_FUNCTION);
+
+  file.write(CBinaryFileLUT::magic, sizeof(CBinaryFileLUT::magic) - 1);
+
+  CBinaryFileLUT::WriteString(file, version_lut);
+  CBinaryFileLUT::WriteString(file, version_reader);
+  CBinaryFileLUT::WriteString(file, name_CV1);
+  CBinaryFileLUT::WriteString(file, name_CV2);
+
+  CBinaryFileLUT::WriteInteger(file, table_dim);
+  CBinaryFileLUT::WriteInteger(file, n_table_levels);
+  CBinaryFileLUT::WriteInteger(file, n_variables);
+  for (auto i_var = 0ul; i_var < n_variables; i_var++) CBinaryFileLUT::WriteString(file, names_var[i_var]);
+
+  if (table_dim == 3) CBinaryFileLUT::WriteReals(file, z_values_levels.data(), n_table_levels);
+
+  for (auto i_level = 0ul; i_level < n_table_levels; i_level++) {
+    CBinaryFileLUT::WriteInteger(file, n_points[i_level]);
+    CBinaryFileLUT::WriteInteger(file, n_triangles[i_level]);
+    CBinaryFileLUT::WriteInteger(file, n_hull_points[i_level]);
+    CBinaryFileLUT::WriteInteger(file, edges[i_level].size());
+  }
+
+  /* Same layout as the node-shared storage (see AllocateTableStorage). */
+  for (auto i_level = 0ul; i_level < n_table_levels; i_level++)
+    CBinaryFileLUT::WriteReals(file, data_levels[i_level], n_variables * n_points[i_level]);
+  for (auto i_level = 0ul; i_level < n_table_levels; i_level++)
+    CBinaryFileLUT::WriteReals(file, interp_levels[i_level], N_POINTS_TRIANGLE * N_POINTS_TRIANGLE * n_triangles[i_level]);
+
+  for (auto i_level = 0ul; i_level < n_table_levels; i_level++) {
+    CBinaryFileLUT::WriteIntegers(file, triangles[i_level].data(), N_POINTS_TRIANGLE * n_triangles[i_level]);
+    CBinaryFileLUT::WriteIntegers(file, hull[i_level].data(), n_hull_points[i_level]);
+    for (const auto& edge : edges[i_level]) CBinaryFileLUT::WriteIntegers(file, edge.data(), 2);
+    for (const auto& tri_of_edge : edge_to_triangle[i_level]) CBinaryFileLUT::WriteInteger(file, tri_of_edge.size());
+    for (const auto& tri_of_edge : edge_to_triangle[i_level])
+      CBinaryFileLUT::WriteIntegers(file, tri_of_edge.data(), tri_of_edge.size());
+    trap_map_x_y[i_level].WriteBinary(file);
+  }
+
+  if (!file.good()) SU2_MPI::Error("Error writing binary look-up table file " + file_name, CURRENT_FUNCTION);
+}
+
 void CLookUpTable::FindTableLimits(const string& name_cv1, const string& name_cv2) {
   limits_table_x.resize(n_table_levels);
   limits_table_y.resize(n_table_levels);
@@ -171,9 +392,9 @@ void CLookUpTable::FindTableLimits(const string& name_cv1, const string& name_cv
   /* we find the lowest and highest value of y and x in the table */
   for (auto i_level = 0u; i_level < n_table_levels; i_level++) {
     limits_table_y[i_level] =
-        minmax_element(table_data[i_level][idx_CV2], table_data[i_level][idx_CV2] + table_data[i_level].cols());
+        minmax_element(LevelData(i_level, idx_CV2), LevelData(i_level, idx_CV2) + n_points[i_level]);
     limits_table_x[i_level] =
-        minmax_element(table_data[i_level][idx_CV1], table_data[i_level][idx_CV1] + table_data[i_level].cols());
+        minmax_element(LevelData(i_level, idx_CV1), LevelData(i_level, idx_CV1) + n_points[i_level]);
   }
 
   if (table_dim == 3) {
@@ -359,32 +580,58 @@ void CLookUpTable::IdentifyUniqueEdges() {
   }
 }
 
+void CLookUpTable::IdentifyTriangleNeighbors() {
+  for (auto i_level = 0ul; i_level < n_table_levels; i_level++) {
+    /* Triangles on the hull have no neighbor across (some of) their edges. */
+    const auto null_triangle = n_triangles[i_level];
+    triangle_neighbors[i_level].resize(n_triangles[i_level], N_POINTS_TRIANGLE) = null_triangle;
+
+    for (auto iEdge = 0ul; iEdge < edges[i_level].size(); iEdge++) {
+      const auto& tri_of_edge = edge_to_triangle[i_level][iEdge];
+      if (tri_of_edge.size() != 2) continue;
+
+      for (auto iSide = 0u; iSide < 2; iSide++) {
+        const auto i_triangle = tri_of_edge[iSide];
+
+        /* The neighbor is stored in the position of the vertex that is not on the edge. */
+        for (auto iVertex = 0u; iVertex < N_POINTS_TRIANGLE; iVertex++) {
+          const auto iPoint = triangles[i_level][i_triangle][iVertex];
+          if (iPoint != edges[i_level][iEdge][0] && iPoint != edges[i_level][iEdge][1]) {
+            triangle_neighbors[i_level][i_triangle][iVertex] = tri_of_edge[1 - iSide];
+          }
+        }
+      }
+    }
+    /* No previous query. */
+    last_triangle[i_level] = null_triangle;
+  }
+}
+
 void CLookUpTable::ComputeInterpCoeffs() {
   for (auto i_level = 0ul; i_level < n_table_levels; i_level++) {
     /* build KD tree for y, x space */
 
     std::array<unsigned long, 3> next_triangle;
 
-    const su2double* val_CV1 = table_data[i_level][idx_CV1];
-    const su2double* val_CV2 = table_data[i_level][idx_CV2];
+    const su2double* val_CV1 = LevelData(i_level, idx_CV1);
+    const su2double* val_CV2 = LevelData(i_level, idx_CV2);
 
     /* calculate weights for each triangle (basically a distance function) and
      * build inverse interpolation matrices */
-    interp_mat_inv_x_y[i_level].resize(n_triangles[i_level]);
+    interp_mat_inv_x_y[i_level].resize(n_triangles[i_level], N_POINTS_TRIANGLE * N_POINTS_TRIANGLE);
+    interp_levels[i_level] = interp_mat_inv_x_y[i_level].data();
     for (auto i_triangle = 0u; i_triangle < n_triangles[i_level]; i_triangle++) {
       for (auto p = 0u; p < N_POINTS_TRIANGLE; p++) {
         next_triangle[p] = triangles[i_level][i_triangle][p];
       }
 
-      su2activematrix x_interp_mat_inv(N_POINTS_TRIANGLE, N_POINTS_TRIANGLE);
-      GetInterpMatInv(val_CV1, val_CV2, next_triangle, x_interp_mat_inv);
-      interp_mat_inv_x_y[i_level][i_triangle] = x_interp_mat_inv;
+      GetInterpMatInv(val_CV1, val_CV2, next_triangle, interp_mat_inv_x_y[i_level][i_triangle]);
     }
   }
 }
 
 void CLookUpTable::GetInterpMatInv(const su2double* vec_x, const su2double* vec_y,
-                                   std::array<unsigned long, 3>& point_ids, su2activematrix& interp_mat_inv) {
+                                   std::array<unsigned long, 3>& point_ids, su2double* interp_mat_inv) {
   CSquareMatrixCM global_M(N_POINTS_TRIANGLE);
 
   /* setup LHM matrix for the interpolation */
@@ -402,7 +649,7 @@ void CLookUpTable::GetInterpMatInv(const su2double* vec_x, const su2double* vec_
 
   for (auto i = 0u; i < N_POINTS_TRIANGLE; i++) {
     for (auto j = 0u; j < N_POINTS_TRIANGLE; j++) {
-      interp_mat_inv[i][j] = global_M(i, j);
+      interp_mat_inv[i * N_POINTS_TRIANGLE + j] = global_M(i, j);
     }
   }
 }
@@ -469,7 +716,6 @@ bool CLookUpTable::LookUp_XYZ(const std::vector<unsigned long>& idx_var, std::ve
     unsigned long lower_level = inclusion_levels.first;
     unsigned long upper_level = inclusion_levels.second;
 
-    std::vector<su2double> val_vars_lower, val_vars_upper;
     val_vars_lower.resize(val_vars.size());
     val_vars_upper.resize(val_vars.size());
     auto inside_lower = LookUp_XY(idx_var, val_vars_lower, val_CV1_lower, val_CV2_lower, lower_level);
@@ -576,21 +822,8 @@ bool CLookUpTable::LookUp_XY(const vector<unsigned long>& idx_var, vector<su2dou
 
   /* loop over variable names and interpolate / get values */
   if (inside) {
-    std::array<su2double, 3> interp_coeffs{0};
-    std::array<unsigned long, 3> triangle{0};
-    for (auto iVertex = 0u; iVertex < N_POINTS_TRIANGLE; iVertex++)
-      triangle[iVertex] = triangles[i_level][id_triangle][iVertex];
-
-    GetInterpCoeffs(val_CV1, val_CV2, interp_mat_inv_x_y[i_level][id_triangle], interp_coeffs);
-
-    for (auto iVar = 0u; iVar < idx_var.size(); iVar++) {
-      if (idx_var[iVar] == idx_null) {
-        val_vars[iVar] = 0;
-      } else {
-        su2double interp_var = Interpolate(table_data[i_level][idx_var[iVar]], triangle, interp_coeffs);
-        val_vars[iVar] = interp_var;
-      }
-    }
+    InterpolateInTriangle(val_CV1, val_CV2, id_triangle, idx_var.data(), idx_var.size(),
+                          [&](unsigned long iVar) -> su2double& { return val_vars[iVar]; }, i_level);
   } else
     InterpolateToNearestNeighbors(val_CV1, val_CV2, idx_var, val_vars, i_level);
 
@@ -599,18 +832,31 @@ bool CLookUpTable::LookUp_XY(const vector<unsigned long>& idx_var, vector<su2dou
 
 bool CLookUpTable::LookUp_XY(const unsigned long idx_var, su2double* val_var, const su2double val_CV1,
                              const su2double val_CV2, const unsigned long i_level) {
-  vector<unsigned long> vec_idx_var = {idx_var};
-  vector<su2double*> val_vars = {val_var};
-  return LookUp_XY(vec_idx_var, val_vars, val_CV1, val_CV2, i_level);
+  unsigned long id_triangle;
+  bool inside = FindInclusionTriangle(val_CV1, val_CV2, id_triangle, i_level);
+
+  if (inside) {
+    InterpolateInTriangle(val_CV1, val_CV2, id_triangle, &idx_var, 1,
+                          [&](unsigned long) -> su2double& { return *val_var; }, i_level);
+  } else {
+    vector<unsigned long> vec_idx_var = {idx_var};
+    vector<su2double*> val_vars = {val_var};
+    InterpolateToNearestNeighbors(val_CV1, val_CV2, vec_idx_var, val_vars, i_level);
+  }
+  return inside;
 }
 
 bool CLookUpTable::LookUp_XY(const vector<unsigned long>& idx_var, vector<su2double*>& val_vars,
                              const su2double val_CV1, const su2double val_CV2, const unsigned long i_level) {
-  vector<su2double> output_var_vals;
-  output_var_vals.resize(val_vars.size());
-  bool inside = LookUp_XY(idx_var, output_var_vals, val_CV1, val_CV2, i_level);
+  unsigned long id_triangle;
+  bool inside = FindInclusionTriangle(val_CV1, val_CV2, id_triangle, i_level);
 
-  for (auto iVar = 0u; iVar < val_vars.size(); iVar++) *val_vars[iVar] = output_var_vals[iVar];
+  /* The outputs are written directly, without intermediate storage. */
+  if (inside) {
+    InterpolateInTriangle(val_CV1, val_CV2, id_triangle, idx_var.data(), idx_var.size(),
+                          [&](unsigned long iVar) -> su2double& { return *val_vars[iVar]; }, i_level);
+  } else
+    InterpolateToNearestNeighbors(val_CV1, val_CV2, idx_var, val_vars, i_level);
 
   return inside;
 }
@@ -621,17 +867,48 @@ bool CLookUpTable::FindInclusionTriangle(const su2double val_CV1, const su2doubl
    * and if y is in table y-dimension table range */
   if ((val_CV1 >= *limits_table_x[iLevel].first && val_CV1 <= *limits_table_x[iLevel].second) &&
       (val_CV2 >= *limits_table_y[iLevel].first && val_CV2 <= *limits_table_y[iLevel].second)) {
-    /* if so, try to find the triangle that holds the (prog, enth) point */
+    /* queries change little between calls, walk from the previous inclusion triangle before
+     * resorting to the trapezoidal map */
+    if (WalkToTriangle(val_CV1, val_CV2, id_triangle, iLevel)) return true;
+
+    /* if not found, try to find the triangle that holds the (prog, enth) point */
     id_triangle = trap_map_x_y[iLevel].GetTriangle(val_CV1, val_CV2);
 
     /* check if point is inside a triangle (if table domain is non-rectangular,
      * the previous range check might be true but the point could still be outside of the domain) */
-    return IsInTriangle(val_CV1, val_CV2, id_triangle, iLevel);
+    const bool inside = IsInTriangle(val_CV1, val_CV2, id_triangle, iLevel);
+    if (inside) last_triangle[iLevel] = id_triangle;
+    return inside;
+  }
+  return false;
+}
+
+bool CLookUpTable::WalkToTriangle(const su2double val_CV1, const su2double val_CV2, unsigned long& id_triangle,
+                                  const unsigned long iLevel) {
+  const auto null_triangle = n_triangles[iLevel];
+  auto i_triangle = last_triangle[iLevel];
+  std::array<su2double, N_POINTS_TRIANGLE> interp_coeffs{0};
+
+  for (auto iStep = 0ul; iStep < max_walk_steps && i_triangle != null_triangle; iStep++) {
+    /* the interpolation coefficients are the barycentric coordinates of the query point */
+    GetInterpCoeffs(val_CV1, val_CV2, InterpMatInv(iLevel, i_triangle), interp_coeffs);
+
+    auto i_min = 0u;
+    for (auto iVertex = 1u; iVertex < N_POINTS_TRIANGLE; iVertex++) {
+      if (interp_coeffs[iVertex] < interp_coeffs[i_min]) i_min = iVertex;
+    }
+    if (interp_coeffs[i_min] >= 0) {
+      id_triangle = i_triangle;
+      last_triangle[iLevel] = i_triangle;
+      return true;
+    }
+    /* the point is on the other side of the edge opposite to the vertex with the most negative coordinate */
+    i_triangle = triangle_neighbors[iLevel][i_triangle][i_min];
   }
   return false;
 }
 
-void CLookUpTable::GetInterpCoeffs(su2double val_CV1, su2double val_CV2, const su2activematrix& interp_mat_inv,
+void CLookUpTable::GetInterpCoeffs(su2double val_CV1, su2double val_CV2, const su2double* interp_mat_inv,
                                    std::array<su2double, N_POINTS_TRIANGLE>& interp_coeffs) const {
   std::array<su2double, N_POINTS_TRIANGLE> query_vector = {1, val_CV1, val_CV2};
 
@@ -639,7 +916,7 @@ void CLookUpTable::GetInterpCoeffs(su2double val_CV1, su2double val_CV2, const s
   for (auto i = 0u; i < N_POINTS_TRIANGLE; i++) {
     d = 0;
     for (auto j = 0u; j < N_POINTS_TRIANGLE; j++) {
-      d = d + interp_mat_inv[i][j] * query_vector[j];
+      d = d + interp_mat_inv[i * N_POINTS_TRIANGLE + j] * query_vector[j];
     }
     interp_coeffs[i] = d;
   }
@@ -667,8 +944,8 @@ std::pair<unsigned long, unsigned long> CLookUpTable::FindNearestNeighbors(const
   su2double val_CV1_norm = val_CV1 / (*limits_table_x[i_level].second - *limits_table_x[i_level].first);
   su2double val_CV2_norm = val_CV2 / (*limits_table_y[i_level].second - *limits_table_y[i_level].first);
 
-  const su2double* x_table = table_data[i_level][idx_CV1];
-  const su2double* y_table = table_data[i_level][idx_CV2];
+  const su2double* x_table = LevelData(i_level, idx_CV1);
+  const su2double* y_table = LevelData(i_level, idx_CV2);
   unsigned long i_nearest = 0, i_second_nearest = 0;
 
   for (unsigned long i_point = 0; i_point < n_hull_points[i_level]; ++i_point) {
@@ -698,8 +975,8 @@ unsigned long CLookUpTable::FindNearestNeighborOnHull(su2double val_CV1, su2doub
   su2double next_distance = 1.e99;
   unsigned long neighbor_id = 0;
 
-  const su2double* x_table = table_data[i_level][idx_CV1];
-  const su2double* y_table = table_data[i_level][idx_CV2];
+  const su2double* x_table = LevelData(i_level, idx_CV1);
+  const su2double* y_table = LevelData(i_level, idx_CV2);
 
   su2double norm_coeff_x = 1. / (limits_table_x[i_level].second - limits_table_x[i_level].first);
   su2double norm_coeff_y = 1. / (limits_table_y[i_level].second - limits_table_y[i_level].first);
@@ -732,10 +1009,10 @@ void CLookUpTable::InterpolateToNearestNeighbors(const su2double val_CV1, const
 
   std::pair<unsigned long, unsigned long> nearest_IDs = FindNearestNeighbors(val_CV1, val_CV2, i_level);
   unsigned long i_nearest = nearest_IDs.first, i_second_nearest = nearest_IDs.second;
-  su2double x_nearest = table_data[i_level][idx_CV1][nearest_IDs.first],
-            x_second_nearest = table_data[i_level][idx_CV1][nearest_IDs.second],
-            y_nearest = table_data[i_level][idx_CV2][nearest_IDs.first],
-            y_second_nearest = table_data[i_level][idx_CV2][nearest_IDs.second];
+  su2double x_nearest = LevelData(i_level, idx_CV1)[nearest_IDs.first],
+            x_second_nearest = LevelData(i_level, idx_CV1)[nearest_IDs.second],
+            y_nearest = LevelData(i_level, idx_CV2)[nearest_IDs.first],
+            y_second_nearest = LevelData(i_level, idx_CV2)[nearest_IDs.second];
   su2double min_distance =
       pow(val_CV1_norm - x_nearest * norm_coeff_x, 2) + pow(val_CV2_norm - y_nearest * norm_coeff_y, 2);
   su2double second_distance =
@@ -750,8 +1027,8 @@ void CLookUpTable::InterpolateToNearestNeighbors(const su2double val_CV1, const
     if (idx_var[iVar] == idx_null) {
       var_vals[iVar] = 0;
     } else {
-      su2double data_nearest = table_data[i_level][idx_var[iVar]][i_nearest],
-                data_second_nearest = table_data[i_level][idx_var[iVar]][i_second_nearest];
+      su2double data_nearest = LevelData(i_level, idx_var[iVar])[i_nearest],
+                data_second_nearest = LevelData(i_level, idx_var[iVar])[i_second_nearest];
       var_vals[iVar] =
           (data_nearest * (1.0 / min_distance) + data_second_nearest * (1.0 / second_distance)) / delimiter;
     }
@@ -785,14 +1062,14 @@ void CLookUpTable::InterpolateToNearestNeighbors(const su2double val_CV1, const
 
 bool CLookUpTable::IsInTriangle(su2double val_CV1, su2double val_CV2, unsigned long val_id_triangle,
                                 unsigned long i_level) {
-  su2double tri_x_0 = table_data[i_level][idx_CV1][triangles[i_level][val_id_triangle][0]];
-  su2double tri_y_0 = table_data[i_level][idx_CV2][triangles[i_level][val_id_triangle][0]];
+  su2double tri_x_0 = LevelData(i_level, idx_CV1)[triangles[i_level][val_id_triangle][0]];
+  su2double tri_y_0 = LevelData(i_level, idx_CV2)[triangles[i_level][val_id_triangle][0]];
 
-  su2double tri_x_1 = table_data[i_level][idx_CV1][triangles[i_level][val_id_triangle][1]];
-  su2double tri_y_1 = table_data[i_level][idx_CV2][triangles[i_level][val_id_triangle][1]];
+  su2double tri_x_1 = LevelData(i_level, idx_CV1)[triangles[i_level][val_id_triangle][1]];
+  su2double tri_y_1 = LevelData(i_level, idx_CV2)[triangles[i_level][val_id_triangle][1]];
 
-  su2double tri_x_2 = table_data[i_level][idx_CV1][triangles[i_level][val_id_triangle][2]];
-  su2double tri_y_2 = table_data[i_level][idx_CV2][triangles[i_level][val_id_triangle][2]];
+  su2double tri_x_2 = LevelData(i_level, idx_CV1)[triangles[i_level][val_id_triangle][2]];
+  su2double tri_y_2 = LevelData(i_level, idx_CV2)[triangles[i_level][val_id_triangle][2]];
 
   su2double area_tri = TriArea(tri_x_0, tri_y_0, tri_x_1, tri_y_1, tri_x_2, tri_y_2);
 
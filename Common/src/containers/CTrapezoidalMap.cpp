@@ -178,6 +178,59 @@ CTrapezoidalMap::CTrapezoidalMap(const su2double* samples_x, const su2double* sa
   }
 }
 
+void CTrapezoidalMap::WriteBinary(std::ostream& file) const {
+  const unsigned long n_edges = edge_limits_x.rows();
+
+  CBinaryFileLUT::WriteInteger(file, unique_bands_x.size());
+  CBinaryFileLUT::WriteReals(file, unique_bands_x.data(), unique_bands_x.size());
+
+  CBinaryFileLUT::WriteInteger(file, n_edges);
+  CBinaryFileLUT::WriteReals(file, edge_limits_x.data(), 2 * n_edges);
+  CBinaryFileLUT::WriteReals(file, edge_limits_y.data(), 2 * n_edges);
+
+  /* number of edges in each band, followed by their y values and indices */
+  for (unsigned long i_band = 0; i_band < y_edge_at_band_mid.size(); i_band++) {
+    CBinaryFileLUT::WriteInteger(file, y_edge_at_band_mid[i_band].size());
+  }
+  for (unsigned long i_band = 0; i_band < y_edge_at_band_mid.size(); i_band++) {
+    for (const auto& y_edge : y_edge_at_band_mid[i_band]) {
+      CBinaryFileLUT::WriteReals(file, &y_edge.first, 1);
+      CBinaryFileLUT::WriteInteger(file, y_edge.second);
+    }
+  }
+}
+
+void CTrapezoidalMap::ReadBinary(CBinaryFileLUT& file, const su2vector<vector<unsigned long> >& val_edge_to_triangle) {
+  edge_to_triangle = su2vector<vector<unsigned long> >(val_edge_to_triangle);
+
+  unique_bands_x.resize(file.ReadInteger());
+  file.ReadReals(unique_bands_x.data(), unique_bands_x.size());
+
+  const unsigned long n_edges = file.ReadInteger();
+  edge_limits_x.resize(n_edges, 2);
+  edge_limits_y.resize(n_edges, 2);
+  file.ReadReals(edge_limits_x.data(), 2 * n_edges);
+  file.ReadReals(edge_limits_y.data(), 2 * n_edges);
+
+  y_edge_at_band_mid.resize(unique_bands_x.size() - 1);
+  for (unsigned long i_band = 0; i_band < y_edge_at_band_mid.size(); i_band++) {
+    y_edge_at_band_mid[i_band].resize(file.ReadInteger());
+  }
+  for (unsigned long i_band = 0; i_band < y_edge_at_band_mid.size(); i_band++) {
+    for (auto& y_edge : y_edge_at_band_mid[i_band]) {
+      file.ReadReals(&y_edge.first, 1);
+      y_edge.second = file.ReadInteger();
+    }
+  }
+
+  /* same accounting as in the constructor */
+  memory_footprint = sizeof(su2double) * (unique_bands_x.size() + 4 * n_edges) / 1e6;
+  for (unsigned long i_edge = 0; i_edge < edge_to_triangle.size(); i_edge++)
+    memory_footprint += sizeof(unsigned long) * edge_to_triangle[i_edge].size() / 1e6;
+  for (unsigned long i_band = 0; i_band < y_edge_at_band_mid.size(); i_band++)
+    memory_footprint += (sizeof(su2double) + sizeof(unsigned long)) * y_edge_at_band_mid[i_band].size() / 1e6;
+}
+
 unsigned long CTrapezoidalMap::GetTriangle(const su2double val_x, const su2double val_y) {
   /* find x band in which val_x sits */
   pair<unsigned long, unsigned long> band = GetBand(val_x);
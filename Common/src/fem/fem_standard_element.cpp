@@ -29,6 +29,210 @@
 #include "../../include/fem/fem_gauss_jacobi_quadrature.hpp"
 #include "../../include/linear_algebra/blas_structure.hpp"
 
+/*----------------------------------------------------------------------------------*/
+/*   Tensor product kernels, which are used for the sum factorization of the        */
+/*   quadrilateral and hexahedral standard elements. The data is stored in rows     */
+/*   of N entries, which correspond to the columns of the matrix products.          */
+/*----------------------------------------------------------------------------------*/
+
+namespace {
+
+/*!
+ * \brief Apply the 1D matrix mat (M x K, row major) to the middle index of the data in
+ *        (nOuter x K x nInner rows) and store the result in out (nOuter x M x nInner rows).
+ */
+template <unsigned short K>
+void ContractDirection(const unsigned short M, const unsigned short nOuter, const unsigned short nInner,
+                       const unsigned short N, const su2double* mat, const su2double* in, su2double* out) {
+  const unsigned int strideIn = nInner * N;
+
+  for (unsigned short o = 0; o < nOuter; ++o) {
+    for (unsigned short m = 0; m < M; ++m) {
+      const su2double* row = mat + m * K;
+
+      for (unsigned short n = 0; n < nInner; ++n) {
+        const su2double* inP = in + (o * K * nInner + n) * N;
+        su2double* outP = out + ((o * M + m) * nInner + n) * N;
+
+        for (unsigned short c = 0; c < N; ++c) {
+          su2double tmp = 0.0;
+          for (unsigned short k = 0; k < K; ++k) tmp += row[k] * inP[k * strideIn + c];
+          outP[c] = tmp;
+        }
+      }
+    }
+  }
+}
+
+/*!
+ * \brief Apply the transpose of the 1D matrix mat (M x K, row major) to the middle index of the data
+ *        in (nOuter x M x nInner rows, leading dimension ldIn) and store or add the result in out
+ *        (nOuter x K x nInner rows).
+ */
+template <unsigned short K>
+void ContractDirectionTrans(const unsigned short M, const unsigned short nOuter, const unsigned short nInner,
+                            const unsigned short N, const unsigned short ldIn, const su2double* mat,
+                            const su2double* in, su2double* out, const bool addToOut) {
+  const unsigned int strideIn = nInner * ldIn;
+
+  for (unsigned short o = 0; o < nOuter; ++o) {
+    for (unsigned short k = 0; k < K; ++k) {
+      for (unsigned short n = 0; n < nInner; ++n) {
+        const su2double* inP = in + (o * M * nInner + n) * ldIn;
+        su2double* outP = out + ((o * K + k) * nInner + n) * N;
+
+        if (!addToOut)
+          for (unsigned short c = 0; c < N; ++c) outP[c] = 0.0;
+
+        for (unsigned short m = 0; m < M; ++m) {
+          const su2double a = mat[m * K + k];
+          const su2double* inM = inP + m * strideIn;
+          for (unsigned short c = 0; c < N; ++c) outP[c] += a * inM[c];
+        }
+      }
+    }
+  }
+}
+
+/*!
+ * \brief Interpolation of the data in the DOFs of a quadrilateral to the integration points
+ *        by means of sum factorization. K is the number of DOFs in 1D.
+ */
+template <unsigned short K>
+void TensorProductIntPoints2D(const unsigned short M, const unsigned short N, const su2double* A,
+                              const su2double* D, const bool values, const bool derivatives,
+                              const su2double* dataDOFs, su2double* dataInt) {
+  const unsigned int nInt = M * M;
+  vector<su2double> work(2 * K * M * N);
+  su2double* ur = work.data();
+  su2double* dr = ur + K * M * N;
+
+  /* Contraction in r-direction, followed by the contraction in s-direction. */
+  ContractDirection<K>(M, K, 1, N, A, dataDOFs, ur);
+  if (values) {
+    ContractDirection<K>(M, 1, M, N, A, ur, dataInt);
+    dataInt += nInt * N;
+  }
+
+  if (derivatives) {
+    ContractDirection<K>(M, K, 1, N, D, dataDOFs, dr);
+    ContractDirection<K>(M, 1, M, N, A, dr, dataInt);
+    ContractDirection<K>(M, 1, M, N, D, ur, dataInt + nInt * N);
+  }
+}
+
+/*!
+ * \brief Interpolation of the data in the DOFs of a hexahedron to the integration points
+ *        by means of sum factorization. K is the number of DOFs in 1D.
+ */
+template <unsigned short K>
+void TensorProductIntPoints3D(const unsigned short M, const unsigned short N, const su2double* A,
+                              const su2double* D, const bool values, const bool derivatives,
+                              const su2double* dataDOFs, su2double* dataInt) {
+  const unsigned int nInt = M * M * M;
+  vector<su2double> work((2 * K * K * M + 3 * K * M * M) * N);
+  su2double* ur = work.data();
+  su2double* dr = ur + K * K * M * N;
+  su2double* urs = dr + K * K * M * N;
+  su2double* uds = urs + K * M * M * N;
+  su2double* drs = uds + K * M * M * N;
+
+  /* Contractions in r-, s- and t-direction. The intermediate results
+     are reused for the values and the derivatives. */
+  ContractDirection<K>(M, K * K, 1, N, A, dataDOFs, ur);
+  ContractDirection<K>(M, K, M, N, A, ur, urs);
+  if (values) {
+    ContractDirection<K>(M, 1, M * M, N, A, urs, dataInt);
+    dataInt += nInt * N;
+  }
+
+  if (derivatives) {
+    ContractDirection<K>(M, K * K, 1, N, D, dataDOFs, dr);
+    ContractDirection<K>(M, K, M, N, A, dr, drs);
+    ContractDirection<K>(M, K, M, N, D, ur, uds);
+
+    ContractDirection<K>(M, 1, M * M, N, A, drs, dataInt);
+    ContractDirection<K>(M, 1, M * M, N, A, uds, dataInt + nInt * N);
+    ContractDirection<K>(M, 1, M * M, N, D, urs, dataInt + 2 * nInt * N);
+  }
+}
+
+/*!
+ * \brief Integration of the data in the integration points of a quadrilateral to the DOFs
+ *        by means of sum factorization. K is the number of DOFs in 1D. If derivatives is
+ *        true, the fluxes in r- and s-direction are stored interleaved per integration point.
+ */
+template <unsigned short K>
+void TensorProductDOFs2D(const unsigned short M, const unsigned short N, const su2double* A, const su2double* D,
+                         const bool derivatives, const su2double* dataInt, su2double* dataDOFs) {
+  vector<su2double> work(2 * K * M * N);
+  su2double* Y = work.data();
+  su2double* Z = Y + K * M * N;
+
+  if (derivatives) {
+    ContractDirectionTrans<K>(M, 1, M, N, 2 * N, A, dataInt, Y, false);
+    ContractDirectionTrans<K>(M, 1, M, N, 2 * N, D, dataInt + N, Z, false);
+
+    ContractDirectionTrans<K>(M, K, 1, N, N, D, Y, dataDOFs, false);
+    ContractDirectionTrans<K>(M, K, 1, N, N, A, Z, dataDOFs, true);
+  } else {
+    ContractDirectionTrans<K>(M, 1, M, N, N, A, dataInt, Y, false);
+    ContractDirectionTrans<K>(M, K, 1, N, N, A, Y, dataDOFs, false);
+  }
+}
+
+/*!
+ * \brief Integration of the data in the integration points of a hexahedron to the DOFs
+ *        by means of sum factorization. K is the number of DOFs in 1D. If derivatives is
+ *        true, the fluxes in r-, s- and t-direction are stored interleaved per integration point.
+ */
+template <unsigned short K>
+void TensorProductDOFs3D(const unsigned short M, const unsigned short N, const su2double* A, const su2double* D,
+                         const bool derivatives, const su2double* dataInt, su2double* dataDOFs) {
+  vector<su2double> work((3 * K * M * M + 2 * K * K * M) * N);
+  su2double* Y = work.data();
+  su2double* Z = Y + K * M * M * N;
+  su2double* W = Z + K * M * M * N;
+  su2double* P = W + K * M * M * N;
+  su2double* Q = P + K * K * M * N;
+
+  if (derivatives) {
+    /* Contraction in t-direction. */
+    ContractDirectionTrans<K>(M, 1, M * M, N, 3 * N, A, dataInt, Y, false);
+    ContractDirectionTrans<K>(M, 1, M * M, N, 3 * N, A, dataInt + N, Z, false);
+    ContractDirectionTrans<K>(M, 1, M * M, N, 3 * N, D, dataInt + 2 * N, W, false);
+
+    /* Contraction in s-direction. */
+    ContractDirectionTrans<K>(M, K, M, N, N, A, Y, P, false);
+    ContractDirectionTrans<K>(M, K, M, N, N, D, Z, Q, false);
+    ContractDirectionTrans<K>(M, K, M, N, N, A, W, Q, true);
+
+    /* Contraction in r-direction. */
+    ContractDirectionTrans<K>(M, K * K, 1, N, N, D, P, dataDOFs, false);
+    ContractDirectionTrans<K>(M, K * K, 1, N, N, A, Q, dataDOFs, true);
+  } else {
+    ContractDirectionTrans<K>(M, 1, M * M, N, N, A, dataInt, Y, false);
+    ContractDirectionTrans<K>(M, K, M, N, N, A, Y, P, false);
+    ContractDirectionTrans<K>(M, K * K, 1, N, N, A, P, dataDOFs, false);
+  }
+}
+
+/* Tensor product kernels for the polynomial degrees 1 to 6, i.e. 2 to 7 DOFs in 1D. */
+const decltype(&TensorProductIntPoints2D<2>) tensorProductIntPoints2D[] = {
+    TensorProductIntPoints2D<2>, TensorProductIntPoints2D<3>, TensorProductIntPoints2D<4>,
+    TensorProductIntPoints2D<5>, TensorProductIntPoints2D<6>, TensorProductIntPoints2D<7>};
+const decltype(&TensorProductIntPoints3D<2>) tensorProductIntPoints3D[] = {
+    TensorProductIntPoints3D<2>, TensorProductIntPoints3D<3>, TensorProductIntPoints3D<4>,
+    TensorProductIntPoints3D<5>, TensorProductIntPoints3D<6>, TensorProductIntPoints3D<7>};
+const decltype(&TensorProductDOFs2D<2>) tensorProductDOFs2D[] = {TensorProductDOFs2D<2>, TensorProductDOFs2D<3>,
+                                                                 TensorProductDOFs2D<4>, TensorProductDOFs2D<5>,
+                                                                 TensorProductDOFs2D<6>, TensorProductDOFs2D<7>};
+const decltype(&TensorProductDOFs3D<2>) tensorProductDOFs3D[] = {TensorProductDOFs3D<2>, TensorProductDOFs3D<3>,
+                                                                 TensorProductDOFs3D<4>, TensorProductDOFs3D<5>,
+                                                                 TensorProductDOFs3D<6>, TensorProductDOFs3D<7>};
+
+}  // namespace
+
 /*----------------------------------------------------------------------------------*/
 /*          Public member functions of CFEMStandardElementBase.                     */
 /*----------------------------------------------------------------------------------*/
@@ -1812,6 +2016,9 @@ CFEMStandardElement::CFEMStandardElement(unsigned short val_VTK_Type, unsigned s
     }
   }
 
+  /* Set up the data for the sum factorization, if possible. */
+  SetUpSumFactorization();
+
   /*--------------------------------------------------------------------------*/
   /*--- Create the data of the derivatives of the basis functions in the   ---*/
   /*--- solution DOFs of the element.                                      ---*/
@@ -2021,6 +2228,68 @@ bool CFEMStandardElement::SameStandardElement(unsigned short val_VTK_Type, unsig
   return true;
 }
 
+void CFEMStandardElement::InterpolateDOFsToIntPoints(const bool values, const bool derivatives, const unsigned short N,
+                                                     const su2double* dataDOFs, su2double* dataInt,
+                                                     CBlasStructure* blasFunctions, const CConfig* config) const {
+  /* Determine the number of parametric dimensions and the number of
+     integration point blocks that must be computed. */
+  const unsigned short nDim = matDerBasisIntTrans.size() / (nDOFs * nIntegration);
+  const unsigned short nBlocks = (values ? 1 : 0) + (derivatives ? nDim : 0);
+
+  /* Use a matrix multiplication with the appropriate part of matBasisIntegration
+     if no sum factorization is used for this standard element. */
+  if (!tensorProductIntPoints) {
+    const su2double* mat = matBasisIntegration.data() + (values ? 0 : nDOFs * nIntegration);
+    blasFunctions->gemm(nBlocks * nIntegration, N, nDOFs, mat, dataDOFs, dataInt, config);
+    return;
+  }
+
+  /* Initialize the variable for the timing, if profiling is active. */
+#ifdef PROFILE
+  double timeGemm;
+  if (config) config->GEMM_Tick(&timeGemm);
+#endif
+
+  /* Carry out the sum factorization. */
+  tensorProductIntPoints(nInt1D, N, lagBasisInt1D.data(), drLagBasisInt1D.data(), values, derivatives, dataDOFs,
+                         dataInt);
+
+  /* Store the profiling information, if needed. */
+#ifdef PROFILE
+  if (config) config->GEMM_Tock(timeGemm, nBlocks * nIntegration, N, nDOFs);
+#endif
+}
+
+void CFEMStandardElement::IntegrateIntPointsToDOFs(const bool derivatives, const unsigned short N,
+                                                   const su2double* dataInt, su2double* dataDOFs,
+                                                   CBlasStructure* blasFunctions, const CConfig* config) const {
+  /* Determine the number of parametric dimensions. */
+  const unsigned short nDim = matDerBasisIntTrans.size() / (nDOFs * nIntegration);
+  const unsigned short K = derivatives ? nIntegration * nDim : nIntegration;
+
+  /* Use a matrix multiplication with the transpose of the basis functions
+     or its derivatives if no sum factorization is used. */
+  if (!tensorProductDOFs) {
+    const su2double* mat = derivatives ? matDerBasisIntTrans.data() : lagBasisIntegrationTrans.data();
+    blasFunctions->gemm(nDOFs, N, K, mat, dataInt, dataDOFs, config);
+    return;
+  }
+
+  /* Initialize the variable for the timing, if profiling is active. */
+#ifdef PROFILE
+  double timeGemm;
+  if (config) config->GEMM_Tick(&timeGemm);
+#endif
+
+  /* Carry out the sum factorization. */
+  tensorProductDOFs(nInt1D, N, lagBasisInt1D.data(), drLagBasisInt1D.data(), derivatives, dataInt, dataDOFs);
+
+  /* Store the profiling information, if needed. */
+#ifdef PROFILE
+  if (config) config->GEMM_Tock(timeGemm, nDOFs, N, K);
+#endif
+}
+
 /*----------------------------------------------------------------------------------*/
 /*           Private member functions of CFEMStandardElement.                       */
 /*----------------------------------------------------------------------------------*/
@@ -2062,6 +2331,12 @@ void CFEMStandardElement::Copy(const CFEMStandardElement& other) {
   matDerBasisSolDOFs = other.matDerBasisSolDOFs;
   matDerBasisOwnDOFs = other.matDerBasisOwnDOFs;
   mat2ndDerBasisInt = other.mat2ndDerBasisInt;
+
+  nInt1D = other.nInt1D;
+  lagBasisInt1D = other.lagBasisInt1D;
+  drLagBasisInt1D = other.drLagBasisInt1D;
+  tensorProductIntPoints = other.tensorProductIntPoints;
+  tensorProductDOFs = other.tensorProductDOFs;
 }
 
 void CFEMStandardElement::CreateBasisFunctionsAndMatrixDerivatives(
@@ -2141,6 +2416,70 @@ void CFEMStandardElement::CreateBasisFunctionsAndMatrixDerivatives(
   for (unsigned long i = 0; i < dtLagBasisLoc.size(); ++i, ++ii) matDerBasis[ii] = dtLagBasisLoc[i];
 }
 
+void CFEMStandardElement::SetUpSumFactorization() {
+  /*--- The sum factorization is only used for quadrilaterals and hexahedra. The
+        kernels are instantiated for the polynomial degrees 1 to 6. ---*/
+  if ((VTK_Type != QUADRILATERAL) && (VTK_Type != HEXAHEDRON)) return;
+  if ((nPoly < 1) || (nPoly > 6)) return;
+
+  /*--- The integration points are the tensor product of the 1D Gauss-Legendre
+        points, see IntegrationPointsQuadrilateral and IntegrationPointsHexahedron,
+        and the DOFs are the tensor product of the 1D equidistant points. In both
+        cases the r-index runs fastest. Determine the 1D data. ---*/
+  const unsigned short nDim = (VTK_Type == QUADRILATERAL) ? 2 : 3;
+  const unsigned short M = orderExact / 2 + 1;
+  const unsigned short K = nPoly + 1;
+
+  unsigned long nIntTensor = 1;
+  for (unsigned short iDim = 0; iDim < nDim; ++iDim) nIntTensor *= M;
+  if (nIntTensor != nIntegration) return;
+
+  vector<su2double> rInt1D(rIntegration.begin(), rIntegration.begin() + M);
+  vector<su2double> lagBasis1D, drLagBasis1D, rDOFs1D, matVandermondeInv1D;
+  unsigned short nDOFs1D;
+
+  LagrangianBasisFunctionAndDerivativesLine(nPoly, rInt1D, nDOFs1D, rDOFs1D, matVandermondeInv1D, lagBasis1D,
+                                            drLagBasis1D);
+  CheckSumLagrangianBasisFunctions(M, nDOFs1D, lagBasis1D);
+
+  /*--- Check whether the tensor product of the 1D data reproduces the basis
+        functions and its derivatives in the integration points. If not, the
+        matrix multiplications with the full matrices are used. ---*/
+  for (unsigned short i = 0; i < nIntegration; ++i) {
+    const unsigned short iR = i % M, iS = (i / M) % M, iT = i / (M * M);
+
+    for (unsigned short j = 0; j < nDOFs; ++j) {
+      const unsigned short jR = j % K, jS = (j / K) % K, jT = j / (K * K);
+
+      const su2double ar = lagBasis1D[iR * K + jR], dr = drLagBasis1D[iR * K + jR];
+      const su2double as = lagBasis1D[iS * K + jS], ds = drLagBasis1D[iS * K + jS];
+      const su2double at = (nDim == 3) ? lagBasis1D[iT * K + jT] : su2double(1.0);
+      const su2double dt = (nDim == 3) ? drLagBasis1D[iT * K + jT] : su2double(0.0);
+
+      const unsigned int ind = i * nDOFs + j;
+      su2double diff = fabs(ar * as * at - lagBasisIntegration[ind]);
+      diff = max(diff, fabs(dr * as * at - drLagBasisIntegration[ind]));
+      diff = max(diff, fabs(ar * ds * at - dsLagBasisIntegration[ind]));
+      if (nDim == 3) diff = max(diff, fabs(ar * as * dt - dtLagBasisIntegration[ind]));
+
+      if (diff > 1.e-8) return;
+    }
+  }
+
+  /*--- Store the 1D data and select the kernels for this polynomial degree. ---*/
+  nInt1D = M;
+  lagBasisInt1D = lagBasis1D;
+  drLagBasisInt1D = drLagBasis1D;
+
+  if (nDim == 2) {
+    tensorProductIntPoints = tensorProductIntPoints2D[nPoly - 1];
+    tensorProductDOFs = tensorProductDOFs2D[nPoly - 1];
+  } else {
+    tensorProductIntPoints = tensorProductIntPoints3D[nPoly - 1];
+    tensorProductDOFs = tensorProductDOFs3D[nPoly - 1];
+  }
+}
+
 void CFEMStandardElement::DataStandardLine() {
   /*--- Determine the Lagrangian basis functions and its derivatives
         in the integration points. ---*/
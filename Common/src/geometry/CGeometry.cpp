@@ -33,6 +33,11 @@
 #include "../../include/toolboxes/geometry_toolbox.hpp"
 #include "../../include/toolboxes/ndflattener.hpp"
 
+/*--- Persistent requests are not supported by the AD wrappers of MPI. ---*/
+#if defined(HAVE_MPI) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+#define HAVE_PERSISTENT_P2P_COMMS
+#endif
+
 CGeometry::CGeometry() : size(SU2_MPI::GetSize()), rank(SU2_MPI::GetRank()) {}
 
 CGeometry::~CGeometry() {
@@ -100,6 +105,8 @@ CGeometry::~CGeometry() {
   delete[] bufS_P2PRecv;
   delete[] bufS_P2PSend;
 
+  FreePersistentP2PRequests();
+
   delete[] req_P2PSend;
   delete[] req_P2PRecv;
 
@@ -339,6 +346,10 @@ void CGeometry::AllocateP2PComms(unsigned short countPerPoint) {
    reallocate a large enough array. Note that after the first set
    communications, this routine will not need to be called again. ---*/
 
+  /*--- The buffers are about to be reused. ---*/
+
+  CompletePendingComms();
+
   if (countPerPoint <= maxCountPerPoint) return;
 
   BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
@@ -346,6 +357,10 @@ void CGeometry::AllocateP2PComms(unsigned short countPerPoint) {
 
     maxCountPerPoint = countPerPoint;
 
+    /*--- The persistent requests refer to the old buffers. ---*/
+
+    FreePersistentP2PRequests();
+
     /*-- Deallocate and reallocate our su2double cummunication memory. ---*/
 
     delete[] bufD_P2PSend;
@@ -363,184 +378,205 @@ void CGeometry::AllocateP2PComms(unsigned short countPerPoint) {
   END_SU2_OMP_SAFE_GLOBAL_ACCESS
 }
 
-void CGeometry::PostP2PRecvs(CGeometry* geometry, const CConfig* config, unsigned short commType,
-                             unsigned short countPerPoint, bool val_reverse) const {
-  /*--- Launch the non-blocking recv's first. Note that we have stored
-   the counts and sources, so we can launch these before we even load
-   the data and send from the neighbor ranks. ---*/
+void CGeometry::SetPendingComms(std::function<void()> complete) {
+  /*--- Complete comms that might be pending, only one set can be in flight since the buffers are shared. ---*/
 
-  SU2_OMP_MASTER
-  for (int iRecv = 0; iRecv < nP2PRecv; iRecv++) {
-    const auto iMessage = iRecv;
+  CompletePendingComms();
 
-    /*--- In some instances related to the adjoint solver, we need
-     to reverse the direction of communications such that the normal
-     send nodes become the recv nodes and vice-versa. ---*/
+  SU2_OMP_SAFE_GLOBAL_ACCESS(pendingComms = std::move(complete);)
+}
 
-    if (val_reverse) {
-      /*--- Compute our location in the buffer using the send data
-       structure since we are reversing the comms. ---*/
+void CGeometry::CompletePendingComms() const {
+  /*--- All threads see the same state since it is only modified in "safe global access" regions. ---*/
 
-      auto offset = countPerPoint * nPoint_P2PSend[iRecv];
+  if (!pendingComms) return;
 
-      /*--- Take advantage of cumulative storage format to get the number
-       of elems that we need to recv. Note again that we select the send
-       points here as the recv points. ---*/
+  /*--- Each thread keeps a copy of the function before it is reset. ---*/
 
-      auto nPointP2P = nPoint_P2PSend[iRecv + 1] - nPoint_P2PSend[iRecv];
+  const auto complete = pendingComms;
+  SU2_OMP_SAFE_GLOBAL_ACCESS(pendingComms = nullptr;)
 
-      /*--- Total count can include multiple pieces of data per element. ---*/
+  complete();
+}
 
-      auto count = countPerPoint * nPointP2P;
+void CGeometry::PostP2PRecvs(CGeometry* geometry, const CConfig* config, unsigned short commType,
+                             unsigned short countPerPoint, bool val_reverse) const {
+  /*--- Launch the non-blocking recv's first. Note that we have stored
+   the counts and sources, so we can launch these before we even load
+   the data and send from the neighbor ranks. ---*/
 
-      /*--- Get the rank from which we receive the message. Note again
-       that we use the send rank as the source instead of the recv rank. ---*/
+  SU2_OMP_MASTER {
+#ifdef HAVE_PERSISTENT_P2P_COMMS
+    /*--- Start the persistent requests of this kind of comm, this avoids the overhead of creating
+     new requests for each message. The handles are copied to the arrays used by the "Complete"
+     routines, waiting for them makes the persistent requests inactive but does not free them. ---*/
 
-      auto source = Neighbors_P2PSend[iRecv];
-      auto tag = source + 1;
+    const auto& requests = GetPersistentP2PRequests(commType, countPerPoint, val_reverse);
 
-      /*--- Post non-blocking recv for this proc. Note that we use the
-       send buffer here too. This is important to make sure the arrays
-       are the correct size. ---*/
+    for (int iRecv = 0; iRecv < nP2PRecv; iRecv++) {
+      req_P2PRecv[iRecv] = requests.recv[iRecv];
+      SU2_MPI::Start(&(req_P2PRecv[iRecv]));
+    }
+#else
+    for (int iRecv = 0; iRecv < nP2PRecv; iRecv++) {
+      InitP2PRecv(commType, countPerPoint, iRecv, val_reverse, false, &(req_P2PRecv[iRecv]));
+    }
+#endif
+  }
+  END_SU2_OMP_MASTER
+}
 
-      switch (commType) {
-        case COMM_TYPE_DOUBLE:
-          SU2_MPI::Irecv(&(bufD_P2PSend[offset]), count, MPI_DOUBLE, source, tag, SU2_MPI::GetComm(),
-                         &(req_P2PRecv[iRecv]));
-          break;
-        case COMM_TYPE_UNSIGNED_SHORT:
-          SU2_MPI::Irecv(&(bufS_P2PSend[offset]), count, MPI_UNSIGNED_SHORT, source, tag, SU2_MPI::GetComm(),
-                         &(req_P2PRecv[iRecv]));
-          break;
-        default:
-          SU2_MPI::Error("Unrecognized data type for point-to-point MPI comms.", CURRENT_FUNCTION);
-          break;
-      }
+void CGeometry::PostP2PSends(CGeometry* geometry, const CConfig* config, unsigned short commType,
+                             unsigned short countPerPoint, int val_iSend, bool val_reverse) const {
+  /*--- Post the non-blocking send as soon as the buffer is loaded. ---*/
 
-    } else {
-      /*--- Compute our location in the recv buffer. ---*/
+  SU2_OMP_MASTER {
+#ifdef HAVE_PERSISTENT_P2P_COMMS
+    /*--- The persistent requests were created when the recvs were posted. ---*/
 
-      auto offset = countPerPoint * nPoint_P2PRecv[iRecv];
+    const auto& requests = GetPersistentP2PRequests(commType, countPerPoint, val_reverse);
 
-      /*--- Take advantage of cumulative storage format to get the number
-       of elems that we need to recv. ---*/
+    req_P2PSend[val_iSend] = requests.send[val_iSend];
+    SU2_MPI::Start(&(req_P2PSend[val_iSend]));
+#else
+    InitP2PSend(commType, countPerPoint, val_iSend, val_reverse, false, &(req_P2PSend[val_iSend]));
+#endif
+  }
+  END_SU2_OMP_MASTER
+}
 
-      auto nPointP2P = nPoint_P2PRecv[iRecv + 1] - nPoint_P2PRecv[iRecv];
+void CGeometry::InitP2PRecv(unsigned short commType, unsigned short countPerPoint, int iRecv, bool reverse,
+                            bool persistent, SU2_MPI::Request* request) const {
+  /*--- In some instances related to the adjoint solver, we need
+   to reverse the direction of communications such that the normal
+   send nodes become the recv nodes and vice-versa. In that case we
+   use the send data structures and the send buffer. This is important
+   to make sure the arrays are the correct size. ---*/
 
-      /*--- Total count can include multiple pieces of data per element. ---*/
+  const int* nPoint_P2P = reverse ? nPoint_P2PSend : nPoint_P2PRecv;
 
-      auto count = countPerPoint * nPointP2P;
+  /*--- Compute our location in the buffer. ---*/
 
-      /*--- Get the rank from which we receive the message. ---*/
+  const auto offset = countPerPoint * nPoint_P2P[iRecv];
 
-      auto source = Neighbors_P2PRecv[iRecv];
-      auto tag = source + 1;
+  /*--- Take advantage of cumulative storage format to get the number
+   of elems that we need to recv, which can include multiple pieces
+   of data per element. ---*/
 
-      /*--- Post non-blocking recv for this proc. ---*/
+  const auto count = countPerPoint * (nPoint_P2P[iRecv + 1] - nPoint_P2P[iRecv]);
 
-      switch (commType) {
-        case COMM_TYPE_DOUBLE:
-          SU2_MPI::Irecv(&(bufD_P2PRecv[offset]), count, MPI_DOUBLE, source, tag, SU2_MPI::GetComm(),
-                         &(req_P2PRecv[iMessage]));
-          break;
-        case COMM_TYPE_UNSIGNED_SHORT:
-          SU2_MPI::Irecv(&(bufS_P2PRecv[offset]), count, MPI_UNSIGNED_SHORT, source, tag, SU2_MPI::GetComm(),
-                         &(req_P2PRecv[iMessage]));
-          break;
-        default:
-          SU2_MPI::Error("Unrecognized data type for point-to-point MPI comms.", CURRENT_FUNCTION);
-          break;
-      }
-    }
-  }
-  END_SU2_OMP_MASTER
-}
+  /*--- Get the rank from which we receive the message. ---*/
 
-void CGeometry::PostP2PSends(CGeometry* geometry, const CConfig* config, unsigned short commType,
-                             unsigned short countPerPoint, int val_iSend, bool val_reverse) const {
-  /*--- Post the non-blocking send as soon as the buffer is loaded. ---*/
+  const auto source = reverse ? Neighbors_P2PSend[iRecv] : Neighbors_P2PRecv[iRecv];
+  const auto tag = source + 1;
 
-  /*--- In some instances related to the adjoint solver, we need
-   to reverse the direction of communications such that the normal
-   send nodes become the recv nodes and vice-versa. ---*/
+  void* buf = nullptr;
+  SU2_MPI::Datatype type = MPI_DOUBLE;
 
-  SU2_OMP_MASTER
-  if (val_reverse) {
-    /*--- Compute our location in the buffer using the recv data
-     structure since we are reversing the comms. ---*/
+  switch (commType) {
+    case COMM_TYPE_DOUBLE:
+      buf = reverse ? &(bufD_P2PSend[offset]) : &(bufD_P2PRecv[offset]);
+      type = MPI_DOUBLE;
+      break;
+    case COMM_TYPE_UNSIGNED_SHORT:
+      buf = reverse ? &(bufS_P2PSend[offset]) : &(bufS_P2PRecv[offset]);
+      type = MPI_UNSIGNED_SHORT;
+      break;
+    default:
+      SU2_MPI::Error("Unrecognized data type for point-to-point MPI comms.", CURRENT_FUNCTION);
+      return;
+  }
 
-    auto offset = countPerPoint * nPoint_P2PRecv[val_iSend];
+  /*--- Create the persistent request, or post the non-blocking recv for this proc. ---*/
 
-    /*--- Take advantage of cumulative storage format to get the number
-     of points that we need to send. Note again that we select the recv
-     points here as the send points. ---*/
+#ifdef HAVE_PERSISTENT_P2P_COMMS
+  if (persistent) {
+    SU2_MPI::Recv_init(buf, count, type, source, tag, SU2_MPI::GetComm(), request);
+    return;
+  }
+#endif
+  SU2_MPI::Irecv(buf, count, type, source, tag, SU2_MPI::GetComm(), request);
+}
 
-    auto nPointP2P = nPoint_P2PRecv[val_iSend + 1] - nPoint_P2PRecv[val_iSend];
+void CGeometry::InitP2PSend(unsigned short commType, unsigned short countPerPoint, int iSend, bool reverse,
+                            bool persistent, SU2_MPI::Request* request) const {
+  /*--- When reversing the comms the recv data structures and buffer are used for the send. ---*/
 
-    /*--- Total count can include multiple pieces of data per element. ---*/
+  const int* nPoint_P2P = reverse ? nPoint_P2PRecv : nPoint_P2PSend;
 
-    auto count = countPerPoint * nPointP2P;
+  /*--- Compute our location in the buffer. ---*/
 
-    /*--- Get the rank to which we send the message. Note again
-     that we use the recv rank as the dest instead of the send rank. ---*/
+  const auto offset = countPerPoint * nPoint_P2P[iSend];
 
-    auto dest = Neighbors_P2PRecv[val_iSend];
-    auto tag = rank + 1;
+  /*--- Take advantage of cumulative storage format to get the number
+   of points that we need to send, which can include multiple pieces
+   of data per element. ---*/
 
-    /*--- Post non-blocking send for this proc. Note that we use the
-     send buffer here too. This is important to make sure the arrays
-     are the correct size. ---*/
+  const auto count = countPerPoint * (nPoint_P2P[iSend + 1] - nPoint_P2P[iSend]);
 
-    switch (commType) {
-      case COMM_TYPE_DOUBLE:
-        SU2_MPI::Isend(&(bufD_P2PRecv[offset]), count, MPI_DOUBLE, dest, tag, SU2_MPI::GetComm(),
-                       &(req_P2PSend[val_iSend]));
-        break;
-      case COMM_TYPE_UNSIGNED_SHORT:
-        SU2_MPI::Isend(&(bufS_P2PRecv[offset]), count, MPI_UNSIGNED_SHORT, dest, tag, SU2_MPI::GetComm(),
-                       &(req_P2PSend[val_iSend]));
-        break;
-      default:
-        SU2_MPI::Error("Unrecognized data type for point-to-point MPI comms.", CURRENT_FUNCTION);
-        break;
-    }
+  /*--- Get the rank to which we send the message. ---*/
 
-  } else {
-    /*--- Compute our location in the send buffer. ---*/
+  const auto dest = reverse ? Neighbors_P2PRecv[iSend] : Neighbors_P2PSend[iSend];
+  const auto tag = rank + 1;
 
-    auto offset = countPerPoint * nPoint_P2PSend[val_iSend];
+  const void* buf = nullptr;
+  SU2_MPI::Datatype type = MPI_DOUBLE;
 
-    /*--- Take advantage of cumulative storage format to get the number
-     of points that we need to send. ---*/
+  switch (commType) {
+    case COMM_TYPE_DOUBLE:
+      buf = reverse ? &(bufD_P2PRecv[offset]) : &(bufD_P2PSend[offset]);
+      type = MPI_DOUBLE;
+      break;
+    case COMM_TYPE_UNSIGNED_SHORT:
+      buf = reverse ? &(bufS_P2PRecv[offset]) : &(bufS_P2PSend[offset]);
+      type = MPI_UNSIGNED_SHORT;
+      break;
+    default:
+      SU2_MPI::Error("Unrecognized data type for point-to-point MPI comms.", CURRENT_FUNCTION);
+      return;
+  }
 
-    auto nPointP2P = nPoint_P2PSend[val_iSend + 1] - nPoint_P2PSend[val_iSend];
+  /*--- Create the persistent request, or post the non-blocking send for this proc. ---*/
 
-    /*--- Total count can include multiple pieces of data per element. ---*/
+#ifdef HAVE_PERSISTENT_P2P_COMMS
+  if (persistent) {
+    SU2_MPI::Send_init(buf, count, type, dest, tag, SU2_MPI::GetComm(), request);
+    return;
+  }
+#endif
+  SU2_MPI::Isend(buf, count, type, dest, tag, SU2_MPI::GetComm(), request);
+}
 
-    auto count = countPerPoint * nPointP2P;
+const CGeometry::PersistentP2PRequests& CGeometry::GetPersistentP2PRequests(unsigned short commType,
+                                                                             unsigned short countPerPoint,
+                                                                             bool reverse) const {
+  /*--- The requests depend on the data type, on the size of the messages, and on the direction. ---*/
 
-    /*--- Get the rank to which we send the message. ---*/
+  const auto key = (static_cast<unsigned long>(commType) << 17) | (static_cast<unsigned long>(countPerPoint) << 1) |
+                   static_cast<unsigned long>(reverse);
 
-    auto dest = Neighbors_P2PSend[val_iSend];
-    auto tag = rank + 1;
+  auto it = persistentP2P.find(key);
+  if (it != persistentP2P.end()) return it->second;
 
-    /*--- Post non-blocking send for this proc. ---*/
+  auto& requests = persistentP2P[key];
+  requests.recv.resize(nP2PRecv);
+  requests.send.resize(nP2PSend);
 
-    switch (commType) {
-      case COMM_TYPE_DOUBLE:
-        SU2_MPI::Isend(&(bufD_P2PSend[offset]), count, MPI_DOUBLE, dest, tag, SU2_MPI::GetComm(),
-                       &(req_P2PSend[val_iSend]));
-        break;
-      case COMM_TYPE_UNSIGNED_SHORT:
-        SU2_MPI::Isend(&(bufS_P2PSend[offset]), count, MPI_UNSIGNED_SHORT, dest, tag, SU2_MPI::GetComm(),
-                       &(req_P2PSend[val_iSend]));
-        break;
-      default:
-        SU2_MPI::Error("Unrecognized data type for point-to-point MPI comms.", CURRENT_FUNCTION);
-        break;
-    }
+  for (int iRecv = 0; iRecv < nP2PRecv; iRecv++) {
+    InitP2PRecv(commType, countPerPoint, iRecv, reverse, true, &(requests.recv[iRecv]));
   }
-  END_SU2_OMP_MASTER
+  for (int iSend = 0; iSend < nP2PSend; iSend++) {
+    InitP2PSend(commType, countPerPoint, iSend, reverse, true, &(requests.send[iSend]));
+  }
+  return requests;
+}
+
+void CGeometry::FreePersistentP2PRequests() {
+  for (auto& kindRequests : persistentP2P) {
+    for (auto& request : kindRequests.second.recv) SU2_MPI::Request_free(&request);
+    for (auto& request : kindRequests.second.send) SU2_MPI::Request_free(&request);
+  }
+  persistentP2P.clear();
 }
 
 void CGeometry::GetCommCountAndType(const CConfig* config, MPI_QUANTITIES commType, unsigned short& COUNT_PER_POINT,
@@ -1261,24 +1297,35 @@ void CGeometry::PostPeriodicSends(CGeometry* geometry, const CConfig* config, un
 }
 
 void CGeometry::SetEdges() {
+  /*--- The edges between domain points are numbered first, such that the edge loops can process them
+   *    while the halo data is being communicated, the second pass numbers the edges of halo points. ---*/
   nEdge = 0;
-  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
-    for (auto iNode = 0u; iNode < nodes->GetnPoint(iPoint); iNode++) {
-      auto jPoint = nodes->GetPoint(iPoint, iNode);
-      for (auto jNode = 0u; jNode < nodes->GetnPoint(jPoint); jNode++) {
-        if (nodes->GetPoint(jPoint, jNode) == iPoint) {
-          auto TestEdge = nodes->GetEdge(jPoint, jNode);
-          if (TestEdge == -1) {
-            nodes->SetEdge(iPoint, nEdge, iNode);
-            nodes->SetEdge(jPoint, nEdge, jNode);
-            nEdge++;
+  for (const bool domainPass : {true, false}) {
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+      for (auto iNode = 0u; iNode < nodes->GetnPoint(iPoint); iNode++) {
+        auto jPoint = nodes->GetPoint(iPoint, iNode);
+        if (((iPoint < nPointDomain) && (jPoint < nPointDomain)) != domainPass) continue;
+        for (auto jNode = 0u; jNode < nodes->GetnPoint(jPoint); jNode++) {
+          if (nodes->GetPoint(jPoint, jNode) == iPoint) {
+            auto TestEdge = nodes->GetEdge(jPoint, jNode);
+            if (TestEdge == -1) {
+              nodes->SetEdge(iPoint, nEdge, iNode);
+              nodes->SetEdge(jPoint, nEdge, jNode);
+              nEdge++;
+            }
+            break;
           }
-          break;
         }
       }
     }
+    if (domainPass) nEdgeDomain = nEdge;
   }
 
+  /*--- The SIMD edge loops process groups of contiguous edges (see CEdge::GetNode), the split must be at the start
+   *    of a group, otherwise the last group of the halo edges reads past the end of the (padded) edges. ---*/
+  const auto simdLen = simd::preferredLen<su2double>();
+  nEdgeDomain = (nEdgeDomain / simdLen) * simdLen;
+
   edges = new CEdge(nEdge, nDim);
 
   for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
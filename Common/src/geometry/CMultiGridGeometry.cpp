@@ -863,6 +863,8 @@ void CMultiGridGeometry::MatchPeriodic(const CConfig* config, unsigned short val
 
 void CMultiGridGeometry::SetControlVolume(const CGeometry* fine_grid, unsigned short action) {
   BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    ResetLeastSquaresCoefficients();
+
     unsigned long iFinePoint, iCoarsePoint, iEdge, iParent;
     long FineEdge, CoarseEdge;
     unsigned short iChildren;
@@ -33,6 +33,7 @@
 #include "../../include/toolboxes/geometry_toolbox.hpp"
 #include "../../include/geometry/meshreader/CSU2ASCIIMeshReaderFEM.hpp"
 #include "../../include/geometry/meshreader/CSU2ASCIIMeshReaderFVM.hpp"
+#include "../../include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
 #include "../../include/geometry/meshreader/CCGNSMeshReaderFVM.hpp"
 #include "../../include/geometry/meshreader/CCGNSMeshReaderFEM.hpp"
 #include "../../include/geometry/meshreader/CRectangularMeshReaderFEM.hpp"
@@ -80,6 +81,7 @@ CPhysicalGeometry::CPhysicalGeometry(CConfig* config, unsigned short val_iZone,
 
   switch (val_format) {
     case SU2:
+    case SU2_BINARY:
     case CGNS_GRID:
     case RECTANGLE:
     case BOX:
@@ -3460,6 +3462,12 @@ void CPhysicalGeometry::Read_Mesh(CConfig* config, const string& val_mesh_filena
       else
         Mesh = new CSU2ASCIIMeshReaderFVM(config, val_iZone, val_nZone);
       break;
+    case SU2_BINARY:
+      if (fem_solver)
+        SU2_MPI::Error("The SU2 binary mesh format is not available for the FEM solver.", CURRENT_FUNCTION);
+      else
+        Mesh = new CSU2BinaryMeshReaderFVM(config, val_iZone, val_nZone);
+      break;
     case CGNS_GRID:
       if (fem_solver)
         Mesh = new CCGNSMeshReaderFEM(config, val_iZone, val_nZone);
@@ -7074,6 +7082,9 @@ void CPhysicalGeometry::SetControlVolume(CConfig* config, unsigned short action)
 
   BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS { /*--- The following is difficult to parallelize with threads. ---*/
 
+    /*--- Operators that depend on the coordinates need to be recomputed. ---*/
+    ResetLeastSquaresCoefficients();
+
     su2double my_DomainVolume = 0.0;
     for (auto iElem = 0ul; iElem < nElem; iElem++) {
       const auto nNodes = elem[iElem]->GetnNodes();
@@ -7690,6 +7701,22 @@ void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig* config) {
 
   CLinearPartitioner pointPartitioner(Global_nPointDomain, 0);
 
+  /*--- Reuse the partitioning of a previous run if possible. ---*/
+
+  const bool partitionCache = config->GetPartition_Cache();
+  const auto cacheFilename = config->GetPartition_Cache_FileName();
+  vector<int64_t> cacheKey;
+
+  if (partitionCache) {
+    cacheKey = GetPartitionCacheKey(config);
+    if (ReadPartitionCache(cacheFilename, cacheKey)) {
+      if (rank == MASTER_NODE) cout << "Read the partitioning from " << cacheFilename << "." << endl;
+      decltype(xadj)().swap(xadj);
+      decltype(adjacency)().swap(adjacency);
+      return;
+    }
+  }
+
   /*--- Some recommended defaults for the various ParMETIS options. ---*/
 
   idx_t wgtflag = 2;
@@ -7749,6 +7776,8 @@ void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig* config) {
     nodes->SetColor(iPoint, part[iPoint]);
   }
 
+  if (partitionCache) WritePartitionCache(cacheFilename, cacheKey, part);
+
   /*--- Force free the connectivity. ---*/
 
   decltype(xadj)().swap(xadj);
@@ -7757,6 +7786,137 @@ void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig* config) {
 #endif
 }
 
+#if defined(HAVE_MPI) && defined(HAVE_PARMETIS)
+namespace {
+/*--- Layout of the partition cache: the magic string, the key (64-bit integers), and the
+ * color of each point (32-bit integers) in the order of the global point indices. ---*/
+constexpr char partitionCacheMagic[] = "SU2PART1";
+constexpr unsigned long partitionCacheMagicSize = 8;
+
+uint64_t MixHash(uint64_t x) {
+  /*--- splitmix64 finalizer. ---*/
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+  return x ^ (x >> 31);
+}
+}  // namespace
+
+vector<int64_t> CPhysicalGeometry::GetPartitionCacheKey(const CConfig* config) const {
+  CLinearPartitioner pointPartitioner(Global_nPointDomain, 0);
+  const unsigned long firstIndex = pointPartitioner.GetFirstIndexOnRank(rank);
+
+  /*--- Hash of the local graph, the hashes of the points are added so the result does
+   * not depend on how the points are distributed over the ranks. ---*/
+
+  unsigned long localHash = 0;
+  for (unsigned long iPoint = 0; iPoint + 1 < xadj.size(); ++iPoint) {
+    uint64_t hash = MixHash(firstIndex + iPoint);
+    for (auto iNeigh = xadj[iPoint]; iNeigh < xadj[iPoint + 1]; ++iNeigh) {
+      hash = MixHash(hash ^ static_cast<uint64_t>(adjacency[iNeigh]));
+    }
+    localHash += hash;
+  }
+  unsigned long graphHash = 0;
+  SU2_MPI::Allreduce(&localHash, &graphHash, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+
+  const passivedouble tolerance = config->GetParMETIS_Tolerance();
+  int64_t toleranceBits;
+  memcpy(&toleranceBits, &tolerance, sizeof(int64_t));
+
+  return {size,
+          static_cast<int64_t>(Global_nPointDomain),
+          config->GetParMETIS_PointWeight(),
+          config->GetParMETIS_EdgeWeight(),
+          toleranceBits,
+          static_cast<int64_t>(graphHash)};
+}
+
+bool CPhysicalGeometry::ReadPartitionCache(const string& filename, const vector<int64_t>& key) {
+  const unsigned long headerSize = partitionCacheMagicSize + key.size() * sizeof(int64_t);
+
+  CLinearPartitioner pointPartitioner(Global_nPointDomain, 0);
+  const unsigned long firstIndex = pointPartitioner.GetFirstIndexOnRank(rank);
+
+  MPI_File fhr;
+  if (MPI_File_open(SU2_MPI::GetComm(), filename.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &fhr) != MPI_SUCCESS) {
+    return false;
+  }
+
+  /*--- The master checks that the cache belongs to this problem. ---*/
+
+  int valid = 0;
+  if (rank == MASTER_NODE) {
+    vector<char> header(headerSize);
+    MPI_Offset fileSize = 0;
+    MPI_File_get_size(fhr, &fileSize);
+    MPI_Status status;
+    if ((static_cast<unsigned long>(fileSize) == headerSize + Global_nPointDomain * sizeof(int32_t)) &&
+        (MPI_File_read_at(fhr, 0, header.data(), headerSize, MPI_BYTE, &status) == MPI_SUCCESS)) {
+      valid = (memcmp(header.data(), partitionCacheMagic, partitionCacheMagicSize) == 0) &&
+              (memcmp(header.data() + partitionCacheMagicSize, key.data(), key.size() * sizeof(int64_t)) == 0);
+    }
+  }
+  SU2_MPI::Bcast(&valid, 1, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
+
+  /*--- Each rank reads the colors of its points. ---*/
+
+  vector<int32_t> part(nPoint);
+  if (valid) {
+    MPI_Status status;
+    const MPI_Offset offset = headerSize + firstIndex * sizeof(int32_t);
+    if (MPI_File_read_at_all(fhr, offset, part.data(), nPoint, MPI_INT32_T, &status) != MPI_SUCCESS) valid = 0;
+    for (const auto color : part) valid = valid && (color >= 0) && (color < size);
+  }
+  MPI_File_close(&fhr);
+
+  int allValid = 0;
+  SU2_MPI::Allreduce(&valid, &allValid, 1, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+  if (!allValid) {
+    if (rank == MASTER_NODE) cout << "The partition cache " << filename << " does not match this problem." << endl;
+    return false;
+  }
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    nodes->SetColor(iPoint, part[iPoint]);
+  }
+  return true;
+}
+
+void CPhysicalGeometry::WritePartitionCache(const string& filename, const vector<int64_t>& key,
+                                            const vector<idx_t>& part) const {
+  const unsigned long headerSize = partitionCacheMagicSize + key.size() * sizeof(int64_t);
+
+  CLinearPartitioner pointPartitioner(Global_nPointDomain, 0);
+  const unsigned long firstIndex = pointPartitioner.GetFirstIndexOnRank(rank);
+
+  /*--- Always write a fresh file. ---*/
+
+  if (rank == MASTER_NODE) MPI_File_delete(filename.c_str(), MPI_INFO_NULL);
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
+
+  MPI_File fhw;
+  if (MPI_File_open(SU2_MPI::GetComm(), filename.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &fhw) !=
+      MPI_SUCCESS) {
+    if (rank == MASTER_NODE) cout << "WARNING: Unable to write the partition cache " << filename << "." << endl;
+    return;
+  }
+
+  MPI_Status status;
+  if (rank == MASTER_NODE) {
+    vector<char> header(headerSize);
+    memcpy(header.data(), partitionCacheMagic, partitionCacheMagicSize);
+    memcpy(header.data() + partitionCacheMagicSize, key.data(), key.size() * sizeof(int64_t));
+    MPI_File_write_at(fhw, 0, header.data(), headerSize, MPI_BYTE, &status);
+  }
+
+  const vector<int32_t> colors(part.begin(), part.end());
+  const MPI_Offset offset = headerSize + firstIndex * sizeof(int32_t);
+  MPI_File_write_at_all(fhw, offset, colors.data(), colors.size(), MPI_INT32_T, &status);
+
+  MPI_File_close(&fhw);
+}
+#endif
+
 void CPhysicalGeometry::ComputeMeshQualityStatistics(const CConfig* config) {
   /*--- Resize our vectors for the 3 metrics: orthogonality, aspect
    ratio, and volume ratio. All are vertex-based for the dual CV. ---*/
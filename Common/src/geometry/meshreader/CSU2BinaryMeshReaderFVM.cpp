@@ -0,0 +1,332 @@
+/*!
+ * \file CSU2BinaryMeshReaderFVM.cpp
+ * \brief Reads a native SU2 binary grid into linear partitions for the
+ *        finite volume solver (FVM).
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+
+#include "../../../include/toolboxes/CLinearPartitioner.hpp"
+#include "../../../include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
+
+namespace {
+/*--- Element types that can be stored in the volume and marker blocks. ---*/
+bool IsVolumeElement(CSU2BinaryMeshReaderFVM::FileInt type) {
+  return type == TRIANGLE || type == QUADRILATERAL || type == TETRAHEDRON || type == HEXAHEDRON || type == PRISM ||
+         type == PYRAMID;
+}
+bool IsSurfaceElement(CSU2BinaryMeshReaderFVM::FileInt type) {
+  return type == LINE || type == TRIANGLE || type == QUADRILATERAL;
+}
+}  // namespace
+
+CSU2BinaryMeshReaderFVM::CSU2BinaryMeshReaderFVM(CConfig* val_config, unsigned short val_iZone,
+                                                 unsigned short val_nZone)
+    : CMeshReaderBase(val_config, val_iZone, val_nZone), meshFilename(config->GetMesh_FileName()) {
+  /*--- Features of the ASCII format that require pre-processing of the entire file are not supported. ---*/
+
+  const bool actuator_disk =
+      ((config->GetnMarker_ActDiskInlet() != 0) || (config->GetnMarker_ActDiskOutlet() != 0)) &&
+      ((config->GetKind_SU2() == SU2_COMPONENT::SU2_CFD) ||
+       ((config->GetKind_SU2() == SU2_COMPONENT::SU2_DEF) && config->GetActDisk_SU2_DEF())) &&
+      !config->GetActDisk_DoubleSurface();
+  if (actuator_disk) {
+    SU2_MPI::Error(
+        "The SU2 binary mesh reader cannot split a single surface actuator disk.\n"
+        "Use ACTDISK_DOUBLE_SURFACE= YES with a mesh that has repeated points, or the SU2 ASCII format.",
+        CURRENT_FUNCTION);
+  }
+  if (val_nZone > 1 && config->GetMultizone_Mesh()) {
+    SU2_MPI::Error(
+        "SU2 binary mesh files contain a single zone.\n"
+        "Use MULTIZONE_MESH= NO and one mesh file per zone.",
+        CURRENT_FUNCTION);
+  }
+
+  /*--- All ranks open the file, each reads only its linear partition of the volume data. ---*/
+
+#ifdef HAVE_MPI
+  if (MPI_File_open(SU2_MPI::GetComm(), meshFilename.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &fhr) != MPI_SUCCESS) {
+    SU2_MPI::Error(string("Unable to open SU2 binary mesh file ") + meshFilename, CURRENT_FUNCTION);
+  }
+#else
+  fhr = fopen(meshFilename.c_str(), "rb");
+  if (!fhr) {
+    SU2_MPI::Error(string("Unable to open SU2 binary mesh file ") + meshFilename, CURRENT_FUNCTION);
+  }
+#endif
+
+  ReadMetadata();
+  ReadPointCoordinates();
+  ReadVolumeElementConnectivity();
+  ReadSurfaceElementConnectivity();
+
+#ifdef HAVE_MPI
+  MPI_File_close(&fhr);
+#else
+  fclose(fhr);
+#endif
+}
+
+CSU2BinaryMeshReaderFVM::~CSU2BinaryMeshReaderFVM(void) = default;
+
+void CSU2BinaryMeshReaderFVM::ReadBytes(void* data, unsigned long offset, unsigned long sizeInBytes) {
+  bool success = true;
+
+#ifdef HAVE_MPI
+  /*--- MPI counts are int, large blocks are read in chunks. ---*/
+  constexpr unsigned long maxChunk = 1ul << 30;
+  auto* ptr = static_cast<char*>(data);
+  for (unsigned long done = 0; done < sizeInBytes && success;) {
+    const int chunk = static_cast<int>(min(maxChunk, sizeInBytes - done));
+    MPI_Status status;
+    int count = 0;
+    success = MPI_File_read_at(fhr, offset + done, ptr + done, chunk, MPI_BYTE, &status) == MPI_SUCCESS;
+    MPI_Get_count(&status, MPI_BYTE, &count);
+    success &= (count == chunk);
+    done += chunk;
+  }
+#else
+  success = fseek(fhr, offset, SEEK_SET) == 0;
+  success = success && fread(data, 1, sizeInBytes, fhr) == sizeInBytes;
+#endif
+
+  if (!success) {
+    SU2_MPI::Error(string("Failed to read from SU2 binary mesh file ") + meshFilename +
+                       string(".\nThe file is corrupt or truncated."),
+                   CURRENT_FUNCTION);
+  }
+}
+
+void CSU2BinaryMeshReaderFVM::ReadMetadata() {
+  /*--- The master reads the header and broadcasts it. ---*/
+
+  char header[headerSize] = {};
+  if (rank == MASTER_NODE) ReadBytes(header, 0, headerSize);
+  SU2_MPI::Bcast(header, headerSize, MPI_CHAR, MASTER_NODE, SU2_MPI::GetComm());
+
+  if (memcmp(header, magic, magicSize) != 0) {
+    SU2_MPI::Error(meshFilename + string(" is not an SU2 binary mesh file."), CURRENT_FUNCTION);
+  }
+
+  FileInt counts[4];
+  memcpy(counts, header + magicSize, sizeof(counts));
+
+  if ((counts[0] != 2 && counts[0] != 3) || counts[1] < 0 || counts[2] < 0 || counts[3] < 0) {
+    SU2_MPI::Error(string("Invalid header in SU2 binary mesh file ") + meshFilename, CURRENT_FUNCTION);
+  }
+
+  dimension = counts[0];
+  numberOfGlobalElements = counts[1];
+  numberOfGlobalPoints = counts[2];
+  numberOfMarkers = counts[3];
+
+  /*--- Position of each block. ---*/
+
+  elementOffset = headerSize;
+  pointOffset = elementOffset + numberOfGlobalElements * elemRecordSize * sizeof(FileInt);
+  markerOffset = pointOffset + numberOfGlobalPoints * dimension * sizeof(passivedouble);
+}
+
+void CSU2BinaryMeshReaderFVM::ReadPointCoordinates() {
+  /* Get a partitioner to help with linear partitioning. */
+  CLinearPartitioner pointPartitioner(numberOfGlobalPoints, 0);
+
+  numberOfLocalPoints = pointPartitioner.GetSizeOnRank(rank);
+  const auto firstPoint = pointPartitioner.GetFirstIndexOnRank(rank);
+
+  /*--- The coordinates of our partition are contiguous in the file. ---*/
+
+  vector<passivedouble> coords(numberOfLocalPoints * dimension);
+  ReadBytes(coords.data(), pointOffset + firstPoint * dimension * sizeof(passivedouble),
+            coords.size() * sizeof(passivedouble));
+
+  localPointCoordinates.resize(dimension);
+  for (unsigned short iDim = 0; iDim < dimension; iDim++) {
+    localPointCoordinates[iDim].resize(numberOfLocalPoints);
+    for (unsigned long iPoint = 0; iPoint < numberOfLocalPoints; iPoint++) {
+      localPointCoordinates[iDim][iPoint] = coords[iPoint * dimension + iDim];
+    }
+  }
+}
+
+void CSU2BinaryMeshReaderFVM::ReadVolumeElementConnectivity() {
+  /* Get partitioners to help with linear partitioning. */
+  CLinearPartitioner pointPartitioner(numberOfGlobalPoints, 0);
+  CLinearPartitioner elementPartitioner(numberOfGlobalElements, 0);
+
+  /*--- Read our linear partition of the elements. ---*/
+
+  const auto nElemSlice = elementPartitioner.GetSizeOnRank(rank);
+  const auto firstElem = elementPartitioner.GetFirstIndexOnRank(rank);
+
+  vector<FileInt> records(nElemSlice * elemRecordSize);
+  ReadBytes(records.data(), elementOffset + firstElem * elemRecordSize * sizeof(FileInt),
+            records.size() * sizeof(FileInt));
+
+  /*--- Each element is needed by every rank that owns at least one of its points (there will be
+   element redundancy at the boundaries of the linear partitions of points), as in the ASCII reader. ---*/
+
+  vector<vector<unsigned long> > sendBuf(size);
+
+  for (unsigned long iElem = 0; iElem < nElemSlice; ++iElem) {
+    const FileInt* record = &records[iElem * elemRecordSize];
+
+    const auto VTK_Type = record[0];
+    if (!IsVolumeElement(VTK_Type)) {
+      SU2_MPI::Error(string("Invalid element type in SU2 binary mesh file ") + meshFilename, CURRENT_FUNCTION);
+    }
+    const auto nPointsElem = nPointsOfElementType(VTK_Type);
+
+    int destRanks[N_POINTS_HEXAHEDRON];
+    unsigned short nDest = 0;
+
+    for (unsigned short i = 0; i < nPointsElem; ++i) {
+      const auto iPoint = record[1 + i];
+      if (iPoint < 0 || static_cast<unsigned long>(iPoint) >= numberOfGlobalPoints) {
+        SU2_MPI::Error(string("Invalid element connectivity in SU2 binary mesh file ") + meshFilename,
+                       CURRENT_FUNCTION);
+      }
+      const int iRank = pointPartitioner.GetRankContainingIndex(iPoint);
+      if (find(destRanks, destRanks + nDest, iRank) == destRanks + nDest) destRanks[nDest++] = iRank;
+    }
+
+    for (unsigned short iDest = 0; iDest < nDest; ++iDest) {
+      auto& buf = sendBuf[destRanks[iDest]];
+      buf.push_back(firstElem + iElem);
+      buf.push_back(VTK_Type);
+      for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; ++i) buf.push_back(record[1 + i]);
+    }
+  }
+  records.clear();
+  records.shrink_to_fit();
+
+  /*--- Exchange the number of elements and then the elements. Since the partitions of elements are
+   in rank order, the elements are received sorted by global index. ---*/
+
+  vector<int> sendCounts(size), recvCounts(size), sendDispl(size + 1, 0), recvDispl(size + 1, 0);
+  for (int iRank = 0; iRank < size; ++iRank) sendCounts[iRank] = sendBuf[iRank].size();
+
+  SU2_MPI::Alltoall(sendCounts.data(), 1, MPI_INT, recvCounts.data(), 1, MPI_INT, SU2_MPI::GetComm());
+
+  for (int iRank = 0; iRank < size; ++iRank) {
+    sendDispl[iRank + 1] = sendDispl[iRank] + sendCounts[iRank];
+    recvDispl[iRank + 1] = recvDispl[iRank] + recvCounts[iRank];
+  }
+
+  vector<unsigned long> sendData(max(sendDispl[size], 1));
+  for (int iRank = 0; iRank < size; ++iRank) {
+    copy(sendBuf[iRank].begin(), sendBuf[iRank].end(), sendData.begin() + sendDispl[iRank]);
+    vector<unsigned long>().swap(sendBuf[iRank]);
+  }
+
+  localVolumeElementConnectivity.resize(max(recvDispl[size], 1));
+
+  SU2_MPI::Alltoallv(sendData.data(), sendCounts.data(), sendDispl.data(), MPI_UNSIGNED_LONG,
+                     localVolumeElementConnectivity.data(), recvCounts.data(), recvDispl.data(), MPI_UNSIGNED_LONG,
+                     SU2_MPI::GetComm());
+
+  localVolumeElementConnectivity.resize(recvDispl[size]);
+  numberOfLocalElements = localVolumeElementConnectivity.size() / SU2_CONN_SIZE;
+}
+
+void CSU2BinaryMeshReaderFVM::ReadSurfaceElementConnectivity() {
+  /*--- The marker block is small compared with the volume data, the master
+   reads it and broadcasts it, then all ranks store all the markers. ---*/
+
+  unsigned long sizeInBytes = 0;
+  if (rank == MASTER_NODE) {
+#ifdef HAVE_MPI
+    MPI_Offset fileSize = 0;
+    MPI_File_get_size(fhr, &fileSize);
+#else
+    fseek(fhr, 0, SEEK_END);
+    const auto fileSize = ftell(fhr);
+#endif
+    if (static_cast<unsigned long>(fileSize) < markerOffset) {
+      SU2_MPI::Error(string("SU2 binary mesh file ") + meshFilename + string(" is truncated."), CURRENT_FUNCTION);
+    }
+    sizeInBytes = fileSize - markerOffset;
+  }
+  SU2_MPI::Bcast(&sizeInBytes, 1, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
+
+  vector<FileInt> markerData(sizeInBytes / sizeof(FileInt));
+  if (rank == MASTER_NODE) ReadBytes(markerData.data(), markerOffset, markerData.size() * sizeof(FileInt));
+  SU2_MPI::Bcast(markerData.data(), markerData.size() * sizeof(FileInt), MPI_CHAR, MASTER_NODE,
+                 SU2_MPI::GetComm());
+
+  surfaceElementConnectivity.resize(numberOfMarkers);
+  markerNames.resize(numberOfMarkers);
+
+  const auto corrupt = [&]() {
+    SU2_MPI::Error(string("Invalid marker data in SU2 binary mesh file ") + meshFilename, CURRENT_FUNCTION);
+  };
+
+  unsigned long pos = 0;
+  for (unsigned long iMarker = 0; iMarker < numberOfMarkers; ++iMarker) {
+    if (pos + 2 > markerData.size()) corrupt();
+    const auto nameLength = markerData[pos];
+    const auto nElem_Bound = markerData[pos + 1];
+    pos += 2;
+
+    const auto nameWords = (nameLength + sizeof(FileInt) - 1) / sizeof(FileInt);
+    if (nameLength <= 0 || nElem_Bound < 0 ||
+        pos + nameWords + nElem_Bound * boundRecordSize > markerData.size()) {
+      corrupt();
+    }
+    markerNames[iMarker].assign(reinterpret_cast<const char*>(&markerData[pos]), nameLength);
+    pos += nameWords;
+
+    if (markerNames[iMarker] == "SEND_RECEIVE") {
+      SU2_MPI::Error(
+          "Mesh file contains deprecated SEND_RECEIVE marker!\n"
+          "Please remove any SEND_RECEIVE markers from the SU2 mesh.",
+          CURRENT_FUNCTION);
+    }
+
+    auto& connectivity = surfaceElementConnectivity[iMarker];
+    connectivity.reserve(nElem_Bound * SU2_CONN_SIZE);
+
+    for (FileInt iElem_Bound = 0; iElem_Bound < nElem_Bound; ++iElem_Bound) {
+      const FileInt* record = &markerData[pos];
+      pos += boundRecordSize;
+
+      const auto VTK_Type = record[0];
+      if (!IsSurfaceElement(VTK_Type)) corrupt();
+
+      if (dimension == 3 && VTK_Type == LINE) {
+        SU2_MPI::Error(
+            "Line boundary conditions are not possible for 3D calculations.\n"
+            "Please check the SU2 binary mesh file.",
+            CURRENT_FUNCTION);
+      }
+
+      connectivity.push_back(0);
+      connectivity.push_back(VTK_Type);
+      for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; ++i) {
+        connectivity.push_back(i < N_POINTS_QUADRILATERAL ? record[1 + i] : 0);
+      }
+    }
+  }
+}
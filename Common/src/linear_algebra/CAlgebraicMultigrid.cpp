@@ -0,0 +1,534 @@
+/*!
+ * \file CAlgebraicMultigrid.cpp
+ * \brief Implementation of the smoothed aggregation algebraic multigrid.
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/linear_algebra/CAlgebraicMultigrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+/*--- Small dense kernels for the n x n blocks, row-major. ---*/
+
+/*! \brief y += alpha * A * x */
+template <class T>
+inline void blockGemv(unsigned long n, T alpha, const T* A, const T* x, T* y) {
+  for (auto i = 0ul; i < n; ++i) {
+    T sum = 0.0;
+    for (auto j = 0ul; j < n; ++j) sum += A[i * n + j] * x[j];
+    y[i] += alpha * sum;
+  }
+}
+
+/*! \brief C += alpha * A * B */
+template <class T>
+inline void blockGemm(unsigned long n, T alpha, const T* A, const T* B, T* C) {
+  for (auto i = 0ul; i < n; ++i)
+    for (auto k = 0ul; k < n; ++k) {
+      const T aik = alpha * A[i * n + k];
+      for (auto j = 0ul; j < n; ++j) C[i * n + j] += aik * B[k * n + j];
+    }
+}
+
+/*! \brief Frobenius norm of a block. */
+template <class T>
+inline passivedouble blockNorm(unsigned long n, const T* A) {
+  passivedouble sum = 0.0;
+  for (auto k = 0ul; k < n * n; ++k) sum += pow(SU2_TYPE::GetValue(A[k]), 2);
+  return sqrt(sum);
+}
+
+/*!
+ * \brief LU factorization with partial pivoting of a dense n x n matrix, in place.
+ * \note Zero pivots (singular matrices, e.g. pure Neumann problems) are replaced by 1.
+ */
+template <class T>
+void denseLU(unsigned long n, T* A, unsigned long* pivots) {
+  for (auto k = 0ul; k < n; ++k) {
+    auto p = k;
+    for (auto i = k + 1; i < n; ++i)
+      if (fabs(SU2_TYPE::GetValue(A[i * n + k])) > fabs(SU2_TYPE::GetValue(A[p * n + k]))) p = i;
+    pivots[k] = p;
+    if (p != k)
+      for (auto j = 0ul; j < n; ++j) std::swap(A[k * n + j], A[p * n + j]);
+
+    if (A[k * n + k] == 0.0) A[k * n + k] = 1.0;
+    const T inv = 1.0 / A[k * n + k];
+
+    for (auto i = k + 1; i < n; ++i) {
+      const T w = A[i * n + k] * inv;
+      A[i * n + k] = w;
+      for (auto j = k + 1; j < n; ++j) A[i * n + j] -= w * A[k * n + j];
+    }
+  }
+}
+
+/*! \brief Solves in place with the factors of denseLU. */
+template <class T>
+void denseLUSolve(unsigned long n, const T* LU, const unsigned long* pivots, T* x) {
+  for (auto k = 0ul; k < n; ++k) {
+    std::swap(x[k], x[pivots[k]]);
+    for (auto i = k + 1; i < n; ++i) x[i] -= LU[i * n + k] * x[k];
+  }
+  for (auto k = n; k > 0;) {
+    --k;
+    for (auto j = k + 1; j < n; ++j) x[k] -= LU[k * n + j] * x[j];
+    x[k] /= LU[k * n + k];
+  }
+}
+
+/*! \brief Inverse of a block via its LU factorization. */
+template <class T>
+void blockInverse(unsigned long n, const T* A, T* invA) {
+  std::vector<T> LU(A, A + n * n);
+  std::vector<unsigned long> pivots(n);
+  denseLU(n, LU.data(), pivots.data());
+
+  std::vector<T> col(n);
+  for (auto j = 0ul; j < n; ++j) {
+    for (auto i = 0ul; i < n; ++i) col[i] = T(i == j);
+    denseLUSolve(n, LU.data(), pivots.data(), col.data());
+    for (auto i = 0ul; i < n; ++i) invA[i * n + j] = col[i];
+  }
+}
+
+}  // namespace
+
+template <class ScalarType>
+unsigned long CAlgebraicMultigrid<ScalarType>::Aggregate(const BlockCSR& A,
+                                                         std::vector<unsigned long>& aggregate) const {
+  const auto n = A.nRow;
+  const auto blkSize = nVar * nVar;
+  const auto NONE = n + 1;
+
+  /*--- Strength of connection, |Aij| > theta * sqrt(|Aii| |Ajj|). ---*/
+
+  std::vector<passivedouble> diagNorm(n, 0.0);
+  for (auto i = 0ul; i < n; ++i)
+    for (auto k = A.rowPtr[i]; k < A.rowPtr[i + 1]; ++k)
+      if (A.colInd[k] == i) diagNorm[i] = blockNorm(nVar, &A.values[k * blkSize]);
+
+  std::vector<bool> strong(A.nnz(), false);
+  std::vector<bool> isolated(n, true);
+  for (auto i = 0ul; i < n; ++i) {
+    for (auto k = A.rowPtr[i]; k < A.rowPtr[i + 1]; ++k) {
+      const auto j = A.colInd[k];
+      if (j == i) continue;
+      const auto norm = blockNorm(nVar, &A.values[k * blkSize]);
+      strong[k] = norm > STRENGTH_THRESHOLD * sqrt(diagNorm[i] * diagNorm[j]);
+      if (strong[k]) isolated[i] = false;
+    }
+  }
+
+  /*--- Isolated rows (e.g. with Dirichlet conditions) are not aggregated, the smoother handles them. ---*/
+
+  aggregate.assign(n, NONE);
+  for (auto i = 0ul; i < n; ++i)
+    if (isolated[i]) aggregate[i] = n;
+
+  unsigned long nAggregates = 0;
+
+  /*--- Pass 1, rows whose strong neighbors are all free form an aggregate with them. ---*/
+
+  for (auto i = 0ul; i < n; ++i) {
+    if (aggregate[i] != NONE) continue;
+    bool free = true;
+    for (auto k = A.rowPtr[i]; k < A.rowPtr[i + 1] && free; ++k)
+      if (strong[k] && aggregate[A.colInd[k]] != NONE) free = false;
+    if (!free) continue;
+
+    aggregate[i] = nAggregates;
+    for (auto k = A.rowPtr[i]; k < A.rowPtr[i + 1]; ++k)
+      if (strong[k]) aggregate[A.colInd[k]] = nAggregates;
+    ++nAggregates;
+  }
+
+  /*--- Pass 2, remaining rows join the aggregate of their strongest aggregated neighbor. ---*/
+
+  const auto pass1 = aggregate;
+
+  for (auto i = 0ul; i < n; ++i) {
+    if (aggregate[i] != NONE) continue;
+    passivedouble maxNorm = 0.0;
+    for (auto k = A.rowPtr[i]; k < A.rowPtr[i + 1]; ++k) {
+      const auto j = A.colInd[k];
+      if (!strong[k] || pass1[j] >= nAggregates) continue;
+      const auto norm = blockNorm(nVar, &A.values[k * blkSize]);
+      if (norm > maxNorm) {
+        maxNorm = norm;
+        aggregate[i] = pass1[j];
+      }
+    }
+  }
+
+  /*--- Pass 3, what is left forms new aggregates with its free strong neighbors. ---*/
+
+  for (auto i = 0ul; i < n; ++i) {
+    if (aggregate[i] != NONE) continue;
+    aggregate[i] = nAggregates;
+    for (auto k = A.rowPtr[i]; k < A.rowPtr[i + 1]; ++k)
+      if (strong[k] && aggregate[A.colInd[k]] == NONE) aggregate[A.colInd[k]] = nAggregates;
+    ++nAggregates;
+  }
+
+  return nAggregates;
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::SetupSmoother(Level& level) const {
+  const auto& A = level.A;
+  const auto blkSize = nVar * nVar;
+
+  level.invDiag.assign(A.nRow * blkSize, 0.0);
+  for (auto i = 0ul; i < A.nRow; ++i)
+    for (auto k = A.rowPtr[i]; k < A.rowPtr[i + 1]; ++k)
+      if (A.colInd[k] == i) blockInverse(nVar, &A.values[k * blkSize], &level.invDiag[i * blkSize]);
+
+  /*--- Upper bound of the spectral radius of D^-1 A (Gershgorin, with the infinity norm of the blocks). ---*/
+
+  passivedouble rho = 0.0;
+  std::vector<ScalarType> block(blkSize);
+
+  for (auto i = 0ul; i < A.nRow; ++i) {
+    std::vector<passivedouble> rowSum(nVar, 0.0);
+    for (auto k = A.rowPtr[i]; k < A.rowPtr[i + 1]; ++k) {
+      for (auto& b : block) b = 0.0;
+      blockGemm<ScalarType>(nVar, 1.0, &level.invDiag[i * blkSize], &A.values[k * blkSize], block.data());
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        for (auto jVar = 0ul; jVar < nVar; ++jVar) rowSum[iVar] += fabs(SU2_TYPE::GetValue(block[iVar * nVar + jVar]));
+    }
+    rho = std::max(rho, *std::max_element(rowSum.begin(), rowSum.end()));
+  }
+  level.omega = 4.0 / (3.0 * std::max(rho, 1.0));
+
+  level.chunk = computeStaticChunkSize(A.nRow, omp_get_max_threads(), OMP_MAX_SIZE);
+  level.x.assign(A.nRow * nVar, 0.0);
+  level.b.assign(A.nRow * nVar, 0.0);
+  level.r.assign(A.nRow * nVar, 0.0);
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::SetupProlongation(const std::vector<unsigned long>& aggregate,
+                                                        unsigned long nAggregates, Level& level) const {
+  const auto& A = level.A;
+  auto& P = level.P;
+  const auto blkSize = nVar * nVar;
+
+  P.nRow = A.nRow;
+  P.nCol = nAggregates;
+  P.rowPtr.assign(A.nRow + 1, 0);
+  P.colInd.clear();
+  P.values.clear();
+
+  /*--- Row i of P is P_tent(i,:) - omega D_i^-1 sum_j A_ij P_tent(j,:), where P_tent has an identity
+   *    block in the column of the aggregate of each row. A dense accumulator gathers the columns. ---*/
+
+  std::vector<ScalarType> acc(nAggregates * blkSize, 0.0), block(blkSize);
+  std::vector<unsigned long> cols;
+  std::vector<bool> used(nAggregates, false);
+
+  for (auto i = 0ul; i < A.nRow; ++i) {
+    cols.clear();
+    for (auto k = A.rowPtr[i]; k < A.rowPtr[i + 1]; ++k) {
+      const auto c = aggregate[A.colInd[k]];
+      if (c >= nAggregates) continue;
+      if (!used[c]) {
+        used[c] = true;
+        cols.push_back(c);
+      }
+      for (auto q = 0ul; q < blkSize; ++q) acc[c * blkSize + q] += A.values[k * blkSize + q];
+    }
+    std::sort(cols.begin(), cols.end());
+
+    for (const auto c : cols) {
+      for (auto& b : block) b = 0.0;
+      blockGemm(nVar, -level.omega, &level.invDiag[i * blkSize], &acc[c * blkSize], block.data());
+      if (c == aggregate[i])
+        for (auto iVar = 0ul; iVar < nVar; ++iVar) block[iVar * nVar + iVar] += 1.0;
+
+      P.colInd.push_back(c);
+      P.values.insert(P.values.end(), block.begin(), block.end());
+
+      for (auto q = 0ul; q < blkSize; ++q) acc[c * blkSize + q] = 0.0;
+      used[c] = false;
+    }
+    P.rowPtr[i + 1] = P.colInd.size();
+  }
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Multiply(const BlockCSR& X, const BlockCSR& Y, BlockCSR& C) const {
+  const auto blkSize = nVar * nVar;
+
+  C.nRow = X.nRow;
+  C.nCol = Y.nCol;
+  C.rowPtr.assign(X.nRow + 1, 0);
+  C.colInd.clear();
+  C.values.clear();
+
+  /*--- Row by row (Gustavson) with a dense accumulator. ---*/
+
+  std::vector<ScalarType> acc(Y.nCol * blkSize, 0.0);
+  std::vector<unsigned long> cols;
+  std::vector<bool> used(Y.nCol, false);
+
+  for (auto i = 0ul; i < X.nRow; ++i) {
+    cols.clear();
+    for (auto k = X.rowPtr[i]; k < X.rowPtr[i + 1]; ++k) {
+      const auto j = X.colInd[k];
+      for (auto l = Y.rowPtr[j]; l < Y.rowPtr[j + 1]; ++l) {
+        const auto c = Y.colInd[l];
+        if (!used[c]) {
+          used[c] = true;
+          cols.push_back(c);
+        }
+        blockGemm<ScalarType>(nVar, 1.0, &X.values[k * blkSize], &Y.values[l * blkSize], &acc[c * blkSize]);
+      }
+    }
+    std::sort(cols.begin(), cols.end());
+
+    for (const auto c : cols) {
+      C.colInd.push_back(c);
+      C.values.insert(C.values.end(), acc.begin() + c * blkSize, acc.begin() + (c + 1) * blkSize);
+      for (auto q = 0ul; q < blkSize; ++q) acc[c * blkSize + q] = 0.0;
+      used[c] = false;
+    }
+    C.rowPtr[i + 1] = C.colInd.size();
+  }
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Transpose(const BlockCSR& X, BlockCSR& Xt) const {
+  const auto blkSize = nVar * nVar;
+
+  Xt.nRow = X.nCol;
+  Xt.nCol = X.nRow;
+  Xt.rowPtr.assign(X.nCol + 1, 0);
+  Xt.colInd.resize(X.nnz());
+  Xt.values.resize(X.nnz() * blkSize);
+
+  for (const auto j : X.colInd) ++Xt.rowPtr[j + 1];
+  for (auto j = 0ul; j < X.nCol; ++j) Xt.rowPtr[j + 1] += Xt.rowPtr[j];
+
+  /*--- Rows of X are visited in order, hence the columns of Xt are sorted. ---*/
+  auto pos = Xt.rowPtr;
+  for (auto i = 0ul; i < X.nRow; ++i) {
+    for (auto k = X.rowPtr[i]; k < X.rowPtr[i + 1]; ++k) {
+      const auto dst = pos[X.colInd[k]]++;
+      Xt.colInd[dst] = i;
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        for (auto jVar = 0ul; jVar < nVar; ++jVar)
+          Xt.values[dst * blkSize + jVar * nVar + iVar] = X.values[k * blkSize + iVar * nVar + jVar];
+    }
+  }
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Build(unsigned long nvar, unsigned long nPointDomain,
+                                            const unsigned long* row_ptr, const unsigned long* col_ind,
+                                            const ScalarType* matrix) {
+  nVar = nvar;
+  const auto blkSize = nVar * nVar;
+
+  levels.clear();
+  levels.reserve(MAX_LEVELS);
+  levels.emplace_back();
+
+  /*--- Finest level, copy of the domain part of the matrix. ---*/
+
+  auto& A0 = levels[0].A;
+  A0.nRow = A0.nCol = nPointDomain;
+  A0.rowPtr.assign(nPointDomain + 1, 0);
+  A0.colInd.clear();
+  A0.values.clear();
+
+  for (auto i = 0ul; i < nPointDomain; ++i) {
+    for (auto k = row_ptr[i]; k < row_ptr[i + 1]; ++k) {
+      if (col_ind[k] >= nPointDomain) continue;
+      A0.colInd.push_back(col_ind[k]);
+      A0.values.insert(A0.values.end(), matrix + k * blkSize, matrix + (k + 1) * blkSize);
+    }
+    A0.rowPtr[i + 1] = A0.colInd.size();
+  }
+
+  /*--- Coarsen until the level is small enough, or coarsening stagnates. ---*/
+
+  std::vector<unsigned long> aggregate;
+
+  while (true) {
+    auto& level = levels.back();
+    SetupSmoother(level);
+
+    const auto n = level.A.nRow;
+    if (n <= COARSEST_SIZE || levels.size() == MAX_LEVELS) break;
+
+    const auto nAggregates = Aggregate(level.A, aggregate);
+    if (nAggregates == 0 || nAggregates > MAX_COARSENING * n) break;
+
+    SetupProlongation(aggregate, nAggregates, level);
+    Transpose(level.P, level.R);
+
+    BlockCSR AP;
+    Multiply(level.A, level.P, AP);
+
+    Level coarse;
+    Multiply(level.R, AP, coarse.A);
+    levels.push_back(std::move(coarse));
+  }
+
+  /*--- Dense LU of the coarsest level if it is small, otherwise it is only smoothed. ---*/
+
+  const auto& coarsest = levels.back().A;
+  coarseDirect = coarsest.nRow <= COARSEST_SIZE;
+  coarseLU.clear();
+  coarsePivots.clear();
+
+  if (coarseDirect) {
+    const auto size = coarsest.nRow * nVar;
+    coarseLU.assign(size * size, 0.0);
+    coarsePivots.resize(size);
+
+    for (auto i = 0ul; i < coarsest.nRow; ++i)
+      for (auto k = coarsest.rowPtr[i]; k < coarsest.rowPtr[i + 1]; ++k)
+        for (auto iVar = 0ul; iVar < nVar; ++iVar)
+          for (auto jVar = 0ul; jVar < nVar; ++jVar)
+            coarseLU[(i * nVar + iVar) * size + coarsest.colInd[k] * nVar + jVar] =
+                coarsest.values[k * blkSize + iVar * nVar + jVar];
+
+    denseLU(size, coarseLU.data(), coarsePivots.data());
+  }
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Residual(const Level& level) const {
+  const auto& A = level.A;
+  const auto blkSize = nVar * nVar;
+
+  SU2_OMP_FOR_STAT(level.chunk)
+  for (auto i = 0ul; i < A.nRow; ++i) {
+    auto* r = &level.r[i * nVar];
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) r[iVar] = level.b[i * nVar + iVar];
+    for (auto k = A.rowPtr[i]; k < A.rowPtr[i + 1]; ++k)
+      blockGemv<ScalarType>(nVar, -1.0, &A.values[k * blkSize], &level.x[A.colInd[k] * nVar], r);
+  }
+  END_SU2_OMP_FOR
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Smooth(const Level& level, bool zeroGuess) const {
+  const auto blkSize = nVar * nVar;
+
+  for (auto iSweep = 0ul; iSweep < NUM_SMOOTH; ++iSweep) {
+    /*--- x += omega D^-1 (b - A x), with a zero guess the residual is b. ---*/
+    const auto& r = (zeroGuess && iSweep == 0) ? level.b : level.r;
+    if (!zeroGuess || iSweep > 0) Residual(level);
+
+    SU2_OMP_FOR_STAT(level.chunk)
+    for (auto i = 0ul; i < level.A.nRow; ++i)
+      blockGemv(nVar, level.omega, &level.invDiag[i * blkSize], &r[i * nVar], &level.x[i * nVar]);
+    END_SU2_OMP_FOR
+  }
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Cycle(unsigned long iLevel) const {
+  const auto& level = levels[iLevel];
+  const auto blkSize = nVar * nVar;
+
+  SU2_OMP_FOR_STAT(level.chunk)
+  for (auto i = 0ul; i < level.A.nRow * nVar; ++i) level.x[i] = 0.0;
+  END_SU2_OMP_FOR
+
+  if (iLevel + 1 == levels.size()) {
+    if (coarseDirect) {
+      SU2_OMP_MASTER {
+        level.x = level.b;
+        denseLUSolve(level.A.nRow * nVar, coarseLU.data(), coarsePivots.data(), level.x.data());
+      }
+      END_SU2_OMP_MASTER
+      SU2_OMP_BARRIER
+    } else {
+      Smooth(level, true);
+      Smooth(level, false);
+    }
+    return;
+  }
+
+  const auto& coarse = levels[iLevel + 1];
+
+  /*--- Pre-smoothing and restriction of the residual. ---*/
+
+  Smooth(level, true);
+  Residual(level);
+
+  SU2_OMP_FOR_STAT(coarse.chunk)
+  for (auto i = 0ul; i < level.R.nRow; ++i) {
+    auto* b = &coarse.b[i * nVar];
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) b[iVar] = 0.0;
+    for (auto k = level.R.rowPtr[i]; k < level.R.rowPtr[i + 1]; ++k)
+      blockGemv<ScalarType>(nVar, 1.0, &level.R.values[k * blkSize], &level.r[level.R.colInd[k] * nVar], b);
+  }
+  END_SU2_OMP_FOR
+
+  Cycle(iLevel + 1);
+
+  /*--- Prolongation of the correction and post-smoothing. ---*/
+
+  SU2_OMP_FOR_STAT(level.chunk)
+  for (auto i = 0ul; i < level.P.nRow; ++i) {
+    for (auto k = level.P.rowPtr[i]; k < level.P.rowPtr[i + 1]; ++k)
+      blockGemv<ScalarType>(nVar, 1.0, &level.P.values[k * blkSize], &coarse.x[level.P.colInd[k] * nVar],
+                            &level.x[i * nVar]);
+  }
+  END_SU2_OMP_FOR
+
+  Smooth(level, false);
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Apply(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod) const {
+  const auto& fine = levels[0];
+  const auto size = fine.A.nRow * nVar;
+
+  SU2_OMP_FOR_STAT(fine.chunk)
+  for (auto i = 0ul; i < size; ++i) fine.b[i] = vec[i];
+  END_SU2_OMP_FOR
+
+  Cycle(0);
+
+  SU2_OMP_FOR_STAT(fine.chunk)
+  for (auto i = 0ul; i < size; ++i) prod[i] = fine.x[i];
+  END_SU2_OMP_FOR
+}
+
+#ifdef CODI_FORWARD_TYPE
+template class CAlgebraicMultigrid<su2double>;
+#else
+template class CAlgebraicMultigrid<su2mixedfloat>;
+#ifdef USE_MIXED_PRECISION
+template class CAlgebraicMultigrid<passivedouble>;
+#endif
+#endif
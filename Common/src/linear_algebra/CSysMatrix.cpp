@@ -30,13 +30,17 @@
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/toolboxes/allocation_toolbox.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <numeric>
 
 template <class ScalarType>
 CSysMatrix<ScalarType>::CSysMatrix() : rank(SU2_MPI::GetRank()), size(SU2_MPI::GetSize()) {
   nPoint = nPointDomain = nVar = nEqn = 0;
+  blockSizeKernel = 0;
   nnz = nnz_ilu = 0;
   ilu_fill_in = 0;
+  ilu_level_scheduling = false;
 
   omp_partitions = nullptr;
 
@@ -53,6 +57,10 @@ CSysMatrix<ScalarType>::CSysMatrix() : rank(SU2_MPI::GetRank()), size(SU2_MPI::G
 
   invM = nullptr;
 
+  useSlicedEll = validSlicedEll = false;
+  nSlices = omp_slice_size = 0;
+  sell_matrix = nullptr;
+
 #ifdef USE_MKL
   MatrixMatrixProductJitter = nullptr;
   MatrixVectorProductJitterBetaOne = nullptr;
@@ -67,6 +75,7 @@ CSysMatrix<ScalarType>::~CSysMatrix() {
   MemoryAllocation::aligned_free(ILU_matrix);
   MemoryAllocation::aligned_free(matrix);
   MemoryAllocation::aligned_free(invM);
+  MemoryAllocation::aligned_free(sell_matrix);
 
   if (useCuda) {
     GPUMemoryAllocation::gpu_free(d_matrix);
@@ -127,6 +136,14 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
   nPoint = npoint;
   nPointDomain = npointdomain;
 
+  /*--- Select the block kernels specialized at compile time, if there is one for this size. ---*/
+  blockSizeKernel = (nVar == nEqn && nVar <= MAXNVAR_KERNEL) ? nVar : 0;
+
+  /*--- Sliced ELLPACK copy for the products, if requested (all square blocks, or only the small ones). ---*/
+  const auto format = config->GetKind_Linear_Solver_Matrix_Format();
+  useSlicedEll = (nVar == nEqn) && ((format == LINEAR_SOLVER_MATRIX_FORMAT::SELL_C_SIGMA) ||
+                                    (format == LINEAR_SOLVER_MATRIX_FORMAT::SELL_C_SIGMA_SCALAR && nVar <= 2));
+
   /*--- Get sparse structure pointers from geometry,
    *    the data is managed by CGeometry to allow re-use. ---*/
 
@@ -163,6 +180,8 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
 
   if (needTranspPtr) col_ptr = geometry->GetTransposeSparsePatternMap(type).data();
 
+  if (useSlicedEll) InitializeSlicedEll();
+
   if (type == ConnectivityType::FiniteVolume) {
     edge_ptr.ptr = geometry->GetEdgeToSparsePatternMap().data();
     edge_ptr.nEdge = geometry->GetnEdge();
@@ -179,6 +198,9 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
     col_ind_ilu = csr_ilu.innerIdx();
     dia_ptr_ilu = csr_ilu.diagPtr();
     nnz_ilu = csr_ilu.getNumNonZeros();
+
+    ilu_level_scheduling = config->GetLinear_Solver_ILU_Level_Scheduling();
+    if (ilu_level_scheduling) InitializeILULevels();
   }
 
   /*--- Preconditioners. ---*/
@@ -247,6 +269,164 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
 #endif
 }
 
+template <class ScalarType>
+void CSysMatrix<ScalarType>::InitializeILULevels() {
+  /*--- The level of a row is one more than the highest level of the rows it depends on, via the lower
+   *    factor for the factorization and forward substitution, or via the upper factor (excluding halos)
+   *    for the backward substitution. The rows of a level can then be processed in parallel. ---*/
+  vector<unsigned long> level(nPointDomain);
+
+  auto groupByLevel = [&](RowLevels& levels) {
+    const auto nLevels = nPointDomain ? *max_element(level.begin(), level.end()) + 1 : 0;
+    levels.ptr.assign(nLevels + 1, 0);
+    for (const auto lvl : level) ++levels.ptr[lvl + 1];
+    partial_sum(levels.ptr.begin(), levels.ptr.end(), levels.ptr.begin());
+
+    auto pos = levels.ptr;
+    levels.rows.resize(nPointDomain);
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) levels.rows[pos[level[iPoint]]++] = iPoint;
+  };
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    level[iPoint] = 0;
+    for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; ++index)
+      level[iPoint] = max(level[iPoint], level[col_ind_ilu[index]] + 1);
+  }
+  groupByLevel(ilu_levels_lower);
+
+  for (auto iPoint = nPointDomain; iPoint > 0;) {
+    iPoint--;  // unsigned type
+    level[iPoint] = 0;
+    for (auto index = dia_ptr_ilu[iPoint] + 1; index < row_ptr_ilu[iPoint + 1]; ++index) {
+      const auto jPoint = col_ind_ilu[index];
+      if (jPoint >= nPointDomain) break;
+      level[iPoint] = max(level[iPoint], level[jPoint] + 1);
+    }
+  }
+  groupByLevel(ilu_levels_upper);
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::InitializeSlicedEll() {
+  auto rowLength = [&](unsigned long iPoint) { return row_ptr[iPoint + 1] - row_ptr[iPoint]; };
+
+  /*--- Sort the rows by decreasing length within windows of sigma rows. The windows are small enough
+   *    to keep the order (and so the locality of the accesses to the vector) close to the original. ---*/
+  vector<unsigned long> perm(nPointDomain);
+  iota(perm.begin(), perm.end(), 0ul);
+
+  for (auto begin = 0ul; begin < nPointDomain; begin += SELL_SIGMA) {
+    const auto end = min<unsigned long>(begin + SELL_SIGMA, nPointDomain);
+    stable_sort(perm.begin() + begin, perm.begin() + end,
+                [&](unsigned long a, unsigned long b) { return rowLength(a) > rowLength(b); });
+  }
+
+  /*--- Group the rows in slices of C rows, each one padded to the length of its longest row. ---*/
+  nSlices = roundUpDiv(nPointDomain, SELL_C);
+  sell_row.assign(nSlices * SELL_C, nPointDomain);
+  sell_ptr.resize(nSlices + 1);
+  sell_ptr[0] = 0;
+
+  for (auto iSlice = 0ul; iSlice < nSlices; ++iSlice) {
+    unsigned long width = 0;
+    for (auto i = iSlice * SELL_C; i < min<unsigned long>((iSlice + 1) * SELL_C, nPointDomain); ++i) {
+      sell_row[i] = perm[i];
+      width = max(width, rowLength(perm[i]));
+    }
+    sell_ptr[iSlice + 1] = sell_ptr[iSlice] + width * SELL_C;
+  }
+
+  /*--- Column-major entries of each slice, padding points to the first row of the slice (which is
+   *    always valid and already in cache) and has no corresponding block in the matrix. ---*/
+  const auto nEntries = sell_ptr[nSlices];
+  sell_col.resize(nEntries);
+  sell_map.resize(nEntries);
+
+  for (auto iSlice = 0ul; iSlice < nSlices; ++iSlice) {
+    for (auto k = sell_ptr[iSlice]; k < sell_ptr[iSlice + 1]; ++k) {
+      const auto iPoint = sell_row[iSlice * SELL_C + k % SELL_C];
+      const auto j = (k - sell_ptr[iSlice]) / SELL_C;
+
+      if (iPoint < nPointDomain && j < rowLength(iPoint)) {
+        sell_map[k] = row_ptr[iPoint] + j;
+        sell_col[k] = col_ind[sell_map[k]];
+      } else {
+        sell_map[k] = nnz;
+        sell_col[k] = sell_row[iSlice * SELL_C];
+      }
+    }
+  }
+
+  /*--- The padding entries are zero-initialized and never written. ---*/
+  sell_matrix = MemoryAllocation::aligned_alloc<ScalarType, true>(64, nEntries * nVar * nEqn * sizeof(ScalarType));
+
+  omp_slice_size = computeStaticChunkSize(nSlices, omp_get_max_threads(), OMP_MAX_SIZE_H / SELL_C);
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::BuildSlicedEllMatrix() {
+  if (!useSlicedEll) return;
+
+  const auto blkSize = nVar * nEqn;
+
+  SU2_OMP_FOR_STAT(omp_slice_size)
+  for (auto iSlice = 0ul; iSlice < nSlices; ++iSlice) {
+    for (auto k = sell_ptr[iSlice]; k < sell_ptr[iSlice + 1]; ++k) {
+      const auto index = sell_map[k];
+      if (index == nnz) continue;
+
+      /*--- Entry q of the block of row r is at q * C + r, after the entries of the previous columns. ---*/
+      const auto r = k % SELL_C;
+      auto* val = &sell_matrix[(k - r) * blkSize + r];
+      for (auto q = 0ul; q < blkSize; ++q) val[q * SELL_C] = matrix[index * blkSize + q];
+    }
+  }
+  END_SU2_OMP_FOR
+
+  SU2_OMP_MASTER
+  validSlicedEll = true;
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::SlicedEllProduct(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod) const {
+  DispatchBlockSize([&](auto N) {
+    constexpr unsigned long M = decltype(N)::value;
+    const unsigned long n = M ? M : nVar;
+
+    SU2_OMP_FOR_DYN(omp_slice_size)
+    for (auto iSlice = 0ul; iSlice < nSlices; ++iSlice) {
+      /*--- Accumulate the product of the C rows of the slice at once, the loops over rows are vectorized. ---*/
+      ScalarType acc[MAXNVAR * SELL_C];
+      for (auto i = 0ul; i < n * SELL_C; ++i) acc[i] = 0.0;
+
+      for (auto k = sell_ptr[iSlice]; k < sell_ptr[iSlice + 1]; k += SELL_C) {
+        const auto* val = &sell_matrix[k * n * n];
+        const auto* col = &sell_col[k];
+
+        for (auto jVar = 0ul; jVar < n; ++jVar) {
+          ScalarType x[SELL_C];
+          SU2_OMP_SIMD
+          for (auto r = 0ul; r < SELL_C; ++r) x[r] = vec[col[r] * n + jVar];
+
+          for (auto iVar = 0ul; iVar < n; ++iVar) {
+            SU2_OMP_SIMD
+            for (auto r = 0ul; r < SELL_C; ++r) acc[iVar * SELL_C + r] += val[(iVar * n + jVar) * SELL_C + r] * x[r];
+          }
+        }
+      }
+
+      for (auto r = 0ul; r < SELL_C; ++r) {
+        const auto iPoint = sell_row[iSlice * SELL_C + r];
+        if (iPoint == nPointDomain) continue;
+        for (auto iVar = 0ul; iVar < n; ++iVar) prod[iPoint * n + iVar] = acc[iVar * SELL_C + r];
+      }
+    }
+    END_SU2_OMP_FOR
+  });
+}
+
 template <class T>
 void CSysMatrixComms::Initiate(const CSysVector<T>& x, CGeometry* geometry, const CConfig* config,
                                MPI_QUANTITIES commType) {
@@ -483,6 +663,7 @@ void CSysMatrix<ScalarType>::SetValZero() {
   const auto begin = chunk * omp_get_thread_num();
   const auto mySize = min(chunk, size - begin) * sizeof(ScalarType);
   memset(&matrix[begin], 0, mySize);
+  InvalidateSlicedEll();
   SU2_OMP_BARRIER
 }
 
@@ -492,6 +673,7 @@ void CSysMatrix<ScalarType>::SetValDiagonalZero() {
   for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
     for (auto index = 0ul; index < nVar * nEqn; ++index) matrix[dia_ptr[iPoint] * nVar * nEqn + index] = 0.0;
   END_SU2_OMP_FOR
+  InvalidateSlicedEll();
 }
 
 template <class ScalarType>
@@ -502,74 +684,25 @@ void CSysMatrix<ScalarType>::Gauss_Elimination(ScalarType* matrix, ScalarType* v
   LAPACKE_dgetrf(LAPACK_ROW_MAJOR, nVar, nVar, matrix, nVar, ipiv);
   LAPACKE_dgetrs(LAPACK_ROW_MAJOR, 'N', nVar, 1, matrix, nVar, ipiv, vec, 1);
 #else
-#define A(I, J) matrix[(I)*nVar + (J)]
-
-  /*--- Transform system in Upper Matrix ---*/
-  for (auto iVar = 1ul; iVar < nVar; iVar++) {
-    for (auto jVar = 0ul; jVar < iVar; jVar++) {
-      ScalarType weight = A(iVar, jVar) / A(jVar, jVar);
-      for (auto kVar = jVar; kVar < nVar; kVar++) A(iVar, kVar) -= weight * A(jVar, kVar);
-      vec[iVar] -= weight * vec[jVar];
-    }
-  }
-
-  /*--- Backwards substitution ---*/
-  for (auto iVar = nVar; iVar > 0ul;) {
-    iVar--;  // unsigned type
-    for (auto jVar = iVar + 1; jVar < nVar; jVar++) vec[iVar] -= A(iVar, jVar) * vec[jVar];
-    vec[iVar] /= A(iVar, iVar);
-  }
-#undef A
+  DispatchBlockSize([&](auto N) { gauss_elimination_impl<ScalarType, decltype(N)::value>(nVar, matrix, vec); });
 #endif
 }
 
 template <class ScalarType>
 void CSysMatrix<ScalarType>::MatrixInverse(ScalarType* matrix, ScalarType* inverse) const {
-  /*--- This is a generalization of Gaussian elimination for multiple rhs' (the basis vectors).
-   We could call "Gauss_Elimination" multiple times or fully generalize it for multiple rhs,
-   the performance of both routines would suffer in both cases without the use of exotic templating.
-   And so it feels reasonable to have some duplication here. ---*/
-
   assert((matrix != inverse) && "Output cannot be the same as the input.");
 
-#define M(I, J) inverse[(I)*nVar + (J)]
-
-  /*--- Initialize the inverse with the identity. ---*/
-  for (auto iVar = 0ul; iVar < nVar; iVar++)
-    for (auto jVar = 0ul; jVar < nVar; jVar++) M(iVar, jVar) = ScalarType(iVar == jVar);
-
-      /*--- Inversion ---*/
 #ifdef USE_MKL_LAPACK
   // With MKL_DIRECT_CALL enabled, this is significantly faster than native code on Intel Architectures.
+  for (auto iVar = 0ul; iVar < nVar; iVar++)
+    for (auto jVar = 0ul; jVar < nVar; jVar++) inverse[iVar * nVar + jVar] = ScalarType(iVar == jVar);
+
   lapack_int ipiv[MAXNVAR];
   LAPACKE_dgetrf(LAPACK_ROW_MAJOR, nVar, nVar, matrix, nVar, ipiv);
   LAPACKE_dgetrs(LAPACK_ROW_MAJOR, 'N', nVar, nVar, matrix, nVar, ipiv, inverse, nVar);
 #else
-#define A(I, J) matrix[(I)*nVar + (J)]
-
-  /*--- Transform system in Upper Matrix ---*/
-  for (auto iVar = 1ul; iVar < nVar; iVar++) {
-    for (auto jVar = 0ul; jVar < iVar; jVar++) {
-      ScalarType weight = A(iVar, jVar) / A(jVar, jVar);
-
-      for (auto kVar = jVar; kVar < nVar; kVar++) A(iVar, kVar) -= weight * A(jVar, kVar);
-
-      /*--- at this stage M is lower triangular so not all cols need updating ---*/
-      for (auto kVar = 0ul; kVar <= jVar; kVar++) M(iVar, kVar) -= weight * M(jVar, kVar);
-    }
-  }
-
-  /*--- Backwards substitution ---*/
-  for (auto iVar = nVar; iVar > 0ul;) {
-    iVar--;  // unsigned type
-    for (auto jVar = iVar + 1; jVar < nVar; jVar++)
-      for (auto kVar = 0ul; kVar < nVar; kVar++) M(iVar, kVar) -= A(iVar, jVar) * M(jVar, kVar);
-
-    for (auto kVar = 0ul; kVar < nVar; kVar++) M(iVar, kVar) /= A(iVar, iVar);
-  }
-#undef A
+  DispatchBlockSize([&](auto N) { matrix_inverse_impl<ScalarType, decltype(N)::value>(nVar, matrix, inverse); });
 #endif
-#undef M
 }
 
 template <class ScalarType>
@@ -577,6 +710,8 @@ void CSysMatrix<ScalarType>::DeleteValsRowi(unsigned long i) {
   const auto block_i = i / nVar;
   const auto row = i % nVar;
 
+  InvalidateSlicedEll();
+
   for (auto index = row_ptr[block_i]; index < row_ptr[block_i + 1]; index++) {
     for (auto iVar = 0u; iVar < nVar; iVar++)
       matrix[index * nVar * nVar + row * nVar + iVar] = 0.0;  // Delete row values in the block
@@ -589,8 +724,11 @@ template <class ScalarType>
 void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
                                                  CGeometry* geometry, const CConfig* config) const {
   /*--- Some checks for consistency between CSysMatrix and the CSysVector<ScalarType>s ---*/
+  /*--- Number of vectors of a multi-vector (see CSysVector::SetColumn). ---*/
+  const auto nVec = vec.GetNVar() / nEqn;
+
 #ifndef NDEBUG
-  if ((nEqn != vec.GetNVar()) || (nVar != prod.GetNVar())) {
+  if ((nEqn * nVec != vec.GetNVar()) || (nVar * nVec != prod.GetNVar())) {
     SU2_MPI::Error("nVar values incompatible.", CURRENT_FUNCTION);
   }
   if (nPoint != prod.GetNBlk()) {
@@ -604,14 +742,64 @@ void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType>& v
 
   SU2_OMP_BARRIER
 
+  if (nVec > 1) {
+    /*--- Each block is loaded once and applied to all the vectors. ---*/
+    SU2_OMP_FOR_DYN(omp_heavy_size)
+    for (auto row_i = 0ul; row_i < nPointDomain; row_i++) {
+      auto prod_i = &prod[row_i * nVec * nVar];
+      for (auto iVar = 0ul; iVar < nVec * nVar; iVar++) prod_i[iVar] = 0.0;
+
+      for (auto index = row_ptr[row_i]; index < row_ptr[row_i + 1]; index++) {
+        const auto vec_j = &vec[col_ind[index] * nVec * nEqn];
+        for (auto iVec = 0ul; iVec < nVec; iVec++)
+          MatrixVectorProductAdd(&matrix[index * nVar * nEqn], &vec_j[iVec * nEqn], &prod_i[iVec * nVar]);
+      }
+    }
+    END_SU2_OMP_FOR
+  } else if (useSlicedEll && validSlicedEll) {
+    SlicedEllProduct(vec, prod);
+  } else {
+    SU2_OMP_FOR_DYN(omp_heavy_size)
+    for (auto row_i = 0ul; row_i < nPointDomain; row_i++) {
+      RowProduct(vec, row_i, &prod[row_i * nVar]);
+    }
+    END_SU2_OMP_FOR
+  }
+
+  /*--- MPI Parallelization. ---*/
+
+  CSysMatrixComms::Initiate(prod, geometry, config);
+  CSysMatrixComms::Complete(prod, geometry, config);
+}
+
+template <class ScalarType>
+template <class OtherType>
+void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<OtherType>& vec, CSysVector<OtherType>& prod,
+                                                 CGeometry* geometry, const CConfig* config) const {
+#ifndef NDEBUG
+  if ((nEqn != vec.GetNVar()) || (nVar != prod.GetNVar())) {
+    SU2_MPI::Error("nVar values incompatible.", CURRENT_FUNCTION);
+  }
+#endif
+
+  SU2_OMP_BARRIER
   SU2_OMP_FOR_DYN(omp_heavy_size)
   for (auto row_i = 0ul; row_i < nPointDomain; row_i++) {
-    RowProduct(vec, row_i, &prod[row_i * nVar]);
+    auto prod_i = &prod[row_i * nVar];
+    for (auto iVar = 0ul; iVar < nVar; iVar++) prod_i[iVar] = 0.0;
+
+    for (auto index = row_ptr[row_i]; index < row_ptr[row_i + 1]; index++) {
+      const auto block = &matrix[index * nVar * nEqn];
+      const auto vec_j = &vec[col_ind[index] * nEqn];
+      for (auto iVar = 0ul; iVar < nVar; iVar++) {
+        OtherType sum = 0.0;
+        for (auto jVar = 0ul; jVar < nEqn; jVar++) sum += OtherType(block[iVar * nEqn + jVar]) * vec_j[jVar];
+        prod_i[iVar] += sum;
+      }
+    }
   }
   END_SU2_OMP_FOR
 
-  /*--- MPI Parallelization. ---*/
-
   CSysMatrixComms::Initiate(prod, geometry, config);
   CSysMatrixComms::Complete(prod, geometry, config);
 }
@@ -630,10 +818,15 @@ void CSysMatrix<ScalarType>::ComputeJacobiPreconditioner(const CSysVector<Scalar
                                                          CSysVector<ScalarType>& prod, CGeometry* geometry,
                                                          const CConfig* config) const {
   /*--- Apply Jacobi preconditioner, y = D^{-1} * x, the inverse of the diagonal is already known. ---*/
+  const auto nVec = vec.GetNVar() / nVar;
   SU2_OMP_BARRIER
   SU2_OMP_FOR_DYN(omp_heavy_size)
-  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
-    MatrixVectorProduct(&(invM[iPoint * nVar * nVar]), &vec[iPoint * nVar], &prod[iPoint * nVar]);
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (auto iVec = 0ul; iVec < nVec; iVec++) {
+      const auto idx = (iPoint * nVec + iVec) * nVar;
+      MatrixVectorProduct(&(invM[iPoint * nVar * nVar]), &vec[idx], &prod[idx]);
+    }
+  }
   END_SU2_OMP_FOR
 
   /*--- MPI Parallelization ---*/
@@ -670,72 +863,33 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner() {
 
   /*--- Transform system in Upper Matrix ---*/
 
-  /*--- OpenMP Parallelization, a loop construct is used to ensure
-   *    the preconditioner is computed correctly even if called
-   *    outside of a parallel section. ---*/
-
-  SU2_OMP_FOR_STAT(1)
-  for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
-    const auto begin = omp_partitions[thread];
-    const auto end = omp_partitions[thread + 1];
-    if (begin == end) continue;
-
-    /*--- Each thread will work on the submatrix defined from row/col "begin"
-     *    to row/col "end-1" (i.e. the range [begin,end[). Which is exactly
-     *    what the MPI-only implementation does. ---*/
-
-    ScalarType weight[MAXNVAR * MAXNVAR], aux_block[MAXNVAR * MAXNVAR];
-
-    for (auto iPoint = begin + 1; iPoint < end; iPoint++) {
-      /*--- Invert and store the previous diagonal block to later compute the weight. ---*/
-
-      InverseDiagonalBlock_ILUMatrix(iPoint - 1, &invM[(iPoint - 1) * nVar * nVar]);
-
-      /*--- For this row (unknown), loop over its lower diagonal entries. ---*/
-
-      for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
-        /*--- jPoint is the column index (jPoint < iPoint). ---*/
-
-        auto jPoint = col_ind_ilu[index];
-
-        /*--- We only care about the sub matrix within "begin" and "end-1". ---*/
-
-        if (jPoint < begin) continue;
-
-        /*--- Multiply the block by the inverse of the corresponding diagonal block. ---*/
-
-        auto Block_ij = &ILU_matrix[index * nVar * nVar];
-        MatrixMatrixProduct(Block_ij, &invM[jPoint * nVar * nVar], weight);
-
-        /*--- "weight" holds Aij*inv(Ajj). Jump to the upper part of the jPoint row. ---*/
-
-        for (auto index_ = dia_ptr_ilu[jPoint] + 1; index_ < row_ptr_ilu[jPoint + 1]; index_++) {
-          /*--- Get the column index (kPoint > jPoint). ---*/
-
-          auto kPoint = col_ind_ilu[index_];
-
-          if (kPoint >= end) break;
-
-          /*--- If Aik exists, update it: Aik -= Aij*inv(Ajj)*Ajk ---*/
-
-          auto Block_ik = GetBlock_ILUMatrix(iPoint, kPoint);
+  if (ilu_level_scheduling) {
+    /*--- Exact ILU of the entire rank, the rows of each level depend only on previous levels.
+     *    The implicit barrier at the end of each loop separates the levels. ---*/
+    for (auto iLevel = 0ul; iLevel < ilu_levels_lower.nLevels(); ++iLevel) {
+      SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+      for (auto k = ilu_levels_lower.ptr[iLevel]; k < ilu_levels_lower.ptr[iLevel + 1]; ++k)
+        FactorizeRow_ILUMatrix(ilu_levels_lower.rows[k], 0, nPointDomain);
+      END_SU2_OMP_FOR
+    }
+  } else {
+    /*--- OpenMP Parallelization, a loop construct is used to ensure
+     *    the preconditioner is computed correctly even if called
+     *    outside of a parallel section. ---*/
 
-          if (Block_ik != nullptr) {
-            auto Block_jk = &ILU_matrix[index_ * nVar * nVar];
-            MatrixMatrixProduct(weight, Block_jk, aux_block);
-            MatrixSubtraction(Block_ik, aux_block, Block_ik);
-          }
-        }
+    SU2_OMP_FOR_STAT(1)
+    for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
+      const auto begin = omp_partitions[thread];
+      const auto end = omp_partitions[thread + 1];
 
-        /*--- Lastly, store "weight" in the lower triangular part, which
-         will be reused during the forward solve in the precon/smoother. ---*/
+      /*--- Each thread will work on the submatrix defined from row/col "begin"
+       *    to row/col "end-1" (i.e. the range [begin,end[). Which is exactly
+       *    what the MPI-only implementation does. ---*/
 
-        for (auto iVar = 0ul; iVar < nVar * nVar; ++iVar) Block_ij[iVar] = weight[iVar];
-      }
+      for (auto iPoint = begin; iPoint < end; iPoint++) FactorizeRow_ILUMatrix(iPoint, begin, end);
     }
-    InverseDiagonalBlock_ILUMatrix(end - 1, &invM[(end - 1) * nVar * nVar]);
+    END_SU2_OMP_FOR
   }
-  END_SU2_OMP_FOR
 }
 
 template <class ScalarType>
@@ -744,49 +898,54 @@ void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarTyp
   /*--- Coherent view of vectors. ---*/
   SU2_OMP_BARRIER
 
-  /*--- OpenMP Parallelization ---*/
-  SU2_OMP_FOR_STAT(1)
-  for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
-    const auto begin = omp_partitions[thread];
-    const auto end = omp_partitions[thread + 1];
-    if (begin == end) continue;
+  if (ilu_level_scheduling) {
+    /*--- Copy vector to then work on prod in place. ---*/
+    SU2_OMP_FOR_STAT(omp_light_size)
+    for (auto iVar = 0ul; iVar < nPointDomain * vec.GetNVar(); iVar++) prod[iVar] = vec[iVar];
+    END_SU2_OMP_FOR
 
-    ScalarType aux_vec[MAXNVAR];
+    /*--- Forward and backward substitutions level by level, the rows of a level are independent. ---*/
 
-    /*--- Copy vector to then work on prod in place ---*/
+    for (auto iLevel = 0ul; iLevel < ilu_levels_lower.nLevels(); ++iLevel) {
+      SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+      for (auto k = ilu_levels_lower.ptr[iLevel]; k < ilu_levels_lower.ptr[iLevel + 1]; ++k)
+        ForwardSubstitutionRow_ILUMatrix(ilu_levels_lower.rows[k], 0, prod);
+      END_SU2_OMP_FOR
+    }
 
-    for (auto iVar = begin * nVar; iVar < end * nVar; iVar++) prod[iVar] = vec[iVar];
+    for (auto iLevel = 0ul; iLevel < ilu_levels_upper.nLevels(); ++iLevel) {
+      SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+      for (auto k = ilu_levels_upper.ptr[iLevel]; k < ilu_levels_upper.ptr[iLevel + 1]; ++k)
+        BackwardSubstitutionRow_ILUMatrix(ilu_levels_upper.rows[k], nPointDomain, prod);
+      END_SU2_OMP_FOR
+    }
+  } else {
+    /*--- OpenMP Parallelization ---*/
+    SU2_OMP_FOR_STAT(1)
+    for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
+      const auto begin = omp_partitions[thread];
+      const auto end = omp_partitions[thread + 1];
+      if (begin == end) continue;
 
-    /*--- Forward solve the system using the lower matrix entries that
-     were computed and stored during the ILU preprocessing. Note
-     that we are overwriting the residual vector as we go. ---*/
+      /*--- Copy vector to then work on prod in place ---*/
 
-    for (auto iPoint = begin + 1; iPoint < end; iPoint++) {
-      for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
-        auto jPoint = col_ind_ilu[index];
-        if (jPoint < begin) continue;
-        auto Block_ij = &ILU_matrix[index * nVar * nVar];
-        MatrixVectorProductSub(Block_ij, &prod[jPoint * nVar], &prod[iPoint * nVar]);
-      }
-    }
+      for (auto iVar = begin * vec.GetNVar(); iVar < end * vec.GetNVar(); iVar++) prod[iVar] = vec[iVar];
 
-    /*--- Backwards substitution (starts at the last row) ---*/
+      /*--- Forward solve the system using the lower matrix entries that
+       were computed and stored during the ILU preprocessing. Note
+       that we are overwriting the residual vector as we go. ---*/
 
-    for (auto iPoint = end; iPoint > begin;) {
-      iPoint--;  // unsigned type
-      for (auto iVar = 0ul; iVar < nVar; iVar++) aux_vec[iVar] = prod[iPoint * nVar + iVar];
+      for (auto iPoint = begin + 1; iPoint < end; iPoint++) ForwardSubstitutionRow_ILUMatrix(iPoint, begin, prod);
 
-      for (auto index = dia_ptr_ilu[iPoint] + 1; index < row_ptr_ilu[iPoint + 1]; index++) {
-        auto jPoint = col_ind_ilu[index];
-        if (jPoint >= end) break;
-        auto Block_ij = &ILU_matrix[index * nVar * nVar];
-        MatrixVectorProductSub(Block_ij, &prod[jPoint * nVar], aux_vec);
-      }
+      /*--- Backwards substitution (starts at the last row) ---*/
 
-      MatrixVectorProduct(&invM[iPoint * nVar * nVar], aux_vec, &prod[iPoint * nVar]);
+      for (auto iPoint = end; iPoint > begin;) {
+        iPoint--;  // unsigned type
+        BackwardSubstitutionRow_ILUMatrix(iPoint, end, prod);
+      }
     }
+    END_SU2_OMP_FOR
   }
-  END_SU2_OMP_FOR
 
   /*--- MPI Parallelization ---*/
 
@@ -1119,6 +1278,7 @@ void CSysMatrix<ScalarType>::SetDiagonalAsColumnSum() {
     }
   }
   END_SU2_OMP_FOR
+  InvalidateSlicedEll();
 }
 
 template <class ScalarType>
@@ -1189,6 +1349,8 @@ void CSysMatrix<ScalarType>::TransposeInPlace() {
   }
   END_SU2_OMP_FOR
 
+  InvalidateSlicedEll();
+
 #ifdef HAVE_PASTIX
   SU2_OMP_MASTER
   pastix_wrapper.SetTransposedSolve();
@@ -1209,6 +1371,30 @@ void CSysMatrix<ScalarType>::MatrixMatrixAddition(ScalarType alpha, const CSysMa
   SU2_OMP_FOR_STAT(omp_light_size)
   for (auto i = 0ul; i < nnz * nVar * nEqn; ++i) matrix[i] += alpha * B.matrix[i];
   END_SU2_OMP_FOR
+  InvalidateSlicedEll();
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::BuildAMGPreconditioner() {
+  if (nVar != nEqn) {
+    SU2_MPI::Error("The AMG preconditioner requires square blocks.", CURRENT_FUNCTION);
+  }
+
+  /*--- The hierarchy is shared by all threads, its setup is serial. ---*/
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS { amg.Build(nVar, nPointDomain, row_ptr, col_ind, matrix); }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::ComputeAMGPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
+                                                      CGeometry* geometry, const CConfig* config) const {
+  /*--- Coherent view of vectors. ---*/
+  SU2_OMP_BARRIER
+
+  amg.Apply(vec, prod);
+
+  CSysMatrixComms::Initiate(prod, geometry, config);
+  CSysMatrixComms::Complete(prod, geometry, config);
 }
 
 template <class ScalarType>
@@ -1261,6 +1447,9 @@ INSTANTIATE_MATRIX(su2mixedfloat)
 /*--- If using mixed precision (float) instantiate also a version for doubles, and allow cross communications. ---*/
 #ifdef USE_MIXED_PRECISION
 INSTANTIATE_MATRIX(passivedouble)
+template void CSysMatrix<su2mixedfloat>::MatrixVectorProduct(const CSysVector<passivedouble>&,
+                                                             CSysVector<passivedouble>&, CGeometry*,
+                                                             const CConfig*) const;
 #endif
 #ifdef CODI_REVERSE_TYPE
 INSTANTIATE_COMMS(su2double)
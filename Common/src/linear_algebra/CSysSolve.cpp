@@ -33,6 +33,7 @@
 #include "../../include/linear_algebra/CSysMatrix.hpp"
 #include "../../include/linear_algebra/CMatrixVectorProduct.hpp"
 #include "../../include/linear_algebra/CPreconditioner.hpp"
+#include "../../include/linear_algebra/blas_structure.hpp"
 
 #include <limits>
 
@@ -172,6 +173,82 @@ void CSysSolve<ScalarType>::ModGramSchmidt(bool shared_hsbg, int i, su2matrix<Sc
   w[i + 1] /= nrm;
 }
 
+template <class ScalarType>
+void CSysSolve<ScalarType>::StartDotProducts(unsigned long n, const CSysVector<ScalarType>* const* a,
+                                             const CSysVector<ScalarType>* const* b, unsigned long nCol) const {
+  const auto nDots = n * nCol;
+
+  /*--- All threads get the same "view" of the vectors and shared variables. ---*/
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    dotLocal.assign(nDots, 0.0);
+    dotGlobal.resize(nDots);
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  /*--- Local dot products for each thread, in a single pass over the vectors. ---*/
+  vector<ScalarType> sum(nDots, 0.0);
+
+  if (nCol == 1) {
+    const auto size = a[0]->GetNElmDomain();
+    const auto chunk = computeStaticChunkSize(a[0]->GetLocSize(), omp_get_max_threads(), 4096);
+
+    SU2_OMP_FOR_(schedule(static, chunk) SU2_NOWAIT)
+    for (auto i = 0ul; i < size; ++i) {
+      for (auto k = 0ul; k < n; ++k) sum[k] += (*a[k])[i] * (*b[k])[i];
+    }
+    END_SU2_OMP_FOR
+  } else {
+    /*--- Separate products for each column of multi-vectors. ---*/
+    const auto nBlk = a[0]->GetNBlkDomain();
+    const auto nVar = a[0]->GetNVar() / nCol;
+    const auto chunk = computeStaticChunkSize(a[0]->GetNBlk(), omp_get_max_threads(), 512);
+
+    SU2_OMP_FOR_(schedule(static, chunk) SU2_NOWAIT)
+    for (auto iBlk = 0ul; iBlk < nBlk; ++iBlk) {
+      for (auto k = 0ul; k < n; ++k) {
+        for (auto iCol = 0ul; iCol < nCol; ++iCol) {
+          const auto i = (iBlk * nCol + iCol) * nVar;
+          for (auto iVar = 0ul; iVar < nVar; ++iVar) sum[k * nCol + iCol] += (*a[k])[i + iVar] * (*b[k])[i + iVar];
+        }
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+
+  for (auto k = 0ul; k < nDots; ++k) atomicAdd(sum[k], dotLocal[k]);
+  SU2_OMP_BARRIER
+
+  /*--- Only the master thread communicates, the others continue (Finish has a barrier). ---*/
+  SU2_OMP_MASTER {
+#ifdef HAVE_MPI
+    const auto mpi_type = (sizeof(ScalarType) < sizeof(double)) ? MPI_FLOAT : MPI_DOUBLE;
+#ifdef CODI_FORWARD_TYPE
+    /*--- The AD wrapper does not have non-blocking reductions. ---*/
+    SelectMPIWrapper<ScalarType>::W::Allreduce(dotLocal.data(), dotGlobal.data(), nDots, mpi_type, MPI_SUM,
+                                               SU2_MPI::GetComm());
+#else
+    CBaseMPIWrapper::Iallreduce(dotLocal.data(), dotGlobal.data(), nDots, mpi_type, MPI_SUM, SU2_MPI::GetComm(),
+                                &dotRequest);
+#endif
+#else
+    dotGlobal = dotLocal;
+#endif
+  }
+  END_SU2_OMP_MASTER
+}
+
+template <class ScalarType>
+void CSysSolve<ScalarType>::FinishDotProducts(ScalarType* result) const {
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+#if defined(HAVE_MPI) && !defined(CODI_FORWARD_TYPE)
+    CBaseMPIWrapper::Wait(&dotRequest, MPI_STATUS_IGNORE);
+#endif
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  for (auto k = 0ul; k < dotGlobal.size(); ++k) result[k] = dotGlobal[k];
+}
+
 template <class ScalarType>
 void CSysSolve<ScalarType>::WriteHeader(const string& solver, ScalarType restol, ScalarType resinit) const {
   cout << "\n# " << solver << " residual history\n";
@@ -306,58 +383,1139 @@ unsigned long CSysSolve<ScalarType>::CG_LinSolver(const CSysVector<ScalarType>&
       }
     }
 
-    precond(r, z);
+    precond(r, z);
+
+    /*--- Calculate Gram-Schmidt coefficient, beta = (r_{i+1}, z_{i+1}) / (r_{i}, z_{i}) ---*/
+
+    ScalarType beta = r_dot_z;
+    r_dot_z = r.dot(z);
+    beta = r_dot_z / beta;
+
+    /*--- Gram-Schmidt orthogonalization. ---*/
+
+    p = beta * p + z;
+  }
+
+  /*--- Recalculate final residual (this should be optional) ---*/
+
+  if ((monitoring) && (config->GetComm_Level() == COMM_FULL)) {
+    if (masterRank) {
+      SU2_OMP_MASTER
+      WriteFinalResidual("CG", i, norm_r / norm0);
+      END_SU2_OMP_MASTER
+    }
+
+    if (recomputeRes) {
+      mat_vec(x, A_x);
+      r = b - A_x;
+      ScalarType true_res = r.norm();
+
+      if (fabs(true_res - norm_r) > tol * 10.0) {
+        if (masterRank) {
+          SU2_OMP_MASTER
+          WriteWarning(norm_r, true_res, tol);
+          END_SU2_OMP_MASTER
+        }
+      }
+    }
+  }
+
+  residual = norm_r / norm0;
+  return i;
+}
+
+template <class ScalarType>
+unsigned long CSysSolve<ScalarType>::PipelinedCG_LinSolver(const CSysVector<ScalarType>& b, CSysVector<ScalarType>& x,
+                                                           const CMatrixVectorProduct<ScalarType>& mat_vec,
+                                                           const CPreconditioner<ScalarType>& precond, ScalarType tol,
+                                                           unsigned long m, ScalarType& residual, bool monitoring,
+                                                           const CConfig* config) const {
+  const bool masterRank = (SU2_MPI::GetRank() == MASTER_NODE);
+  ScalarType norm_r = 0.0, norm0 = 0.0;
+  unsigned long i = 0;
+
+  /*--- Check the subspace size ---*/
+
+  if (m < 1) {
+    SU2_MPI::Error("Number of linear solver iterations must be greater than 0.", CURRENT_FUNCTION);
+  }
+
+  /*--- Allocate if not allocated yet, the CG vectors and the auxiliary ones. ---*/
+
+  if (!cg_ready || PCG.empty()) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      auto nVar = b.GetNVar();
+      auto nBlk = b.GetNBlk();
+      auto nBlkDomain = b.GetNBlkDomain();
+
+      if (!cg_ready) {
+        A_x.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+        r.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+        z.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+        p.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+        cg_ready = true;
+      }
+      PCG.resize(6);
+      for (auto& vec : PCG) vec.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
+
+  /*--- Notation of the reference, u = M r, w = A u, m = M w, n = A m,
+   *    and the vectors updated with recurrences, s = A p, q = M s, z = A q. ---*/
+
+  auto& u = PCG[0];
+  auto& w = PCG[1];
+  auto& m_i = PCG[2];
+  auto& n_i = PCG[3];
+  auto& q = PCG[4];
+  auto& s = PCG[5];
+
+  /*--- Calculate the initial residual, compute norms, and check if system is already solved ---*/
+
+  if (!xIsZero) {
+    mat_vec(x, A_x);
+    r = b - A_x;
+  } else {
+    r = b;
+  }
+
+  {
+    const VectorType* vecs[] = {&r, &b};
+    ScalarType dots[2];
+    StartDotProducts(2, vecs, vecs);
+    FinishDotProducts(dots);
+    norm_r = sqrt(dots[0]);
+    norm0 = sqrt(dots[1]);
+  }
+
+  /*--- Set the norm to the initial initial residual value ---*/
+
+  if (tol_type == LinearToleranceType::RELATIVE) norm0 = norm_r;
+
+  if ((norm_r < tol * norm0) || (norm_r < eps)) {
+    if (masterRank && (lin_sol_mode != LINEAR_SOLVER_MODE::MESH_DEFORM)) {
+      SU2_OMP_MASTER
+      cout << "CSysSolve::PipelinedCG(): system solved by initial guess." << endl;
+      END_SU2_OMP_MASTER
+    }
+    return 0;
+  }
+
+  /*--- Output header information including initial residual ---*/
+
+  if (monitoring && masterRank) {
+    SU2_OMP_MASTER {
+      WriteHeader("Pipelined CG", tol, norm_r);
+      WriteHistory(i, norm_r / norm0);
+    }
+    END_SU2_OMP_MASTER
+  }
+
+  precond(r, u);
+  mat_vec(u, w);
+
+  ScalarType gamma_old = 0.0, alpha_old = 0.0;
+
+  /*---  Loop over all search directions ---*/
+
+  for (i = 0; i < m; i++) {
+    /*--- Start the reduction of (r,u), (w,u), and (r,r), and overlap it with the preconditioner and product. ---*/
+
+    const VectorType* left[] = {&r, &w, &r};
+    const VectorType* right[] = {&u, &u, &r};
+    StartDotProducts(3, left, right);
+
+    precond(w, m_i);
+    mat_vec(m_i, n_i);
+
+    ScalarType dots[3];
+    FinishDotProducts(dots);
+    const ScalarType gamma = dots[0], delta = dots[1];
+    norm_r = sqrt(dots[2]);
+
+    /*--- Check if solution has converged (the residual is from the previous iteration) ---*/
+
+    if (norm_r < tol * norm0) break;
+    if (((monitoring) && (masterRank)) && (i > 0) && (i % monitorFreq == 0)) {
+      SU2_OMP_MASTER
+      WriteHistory(i, norm_r / norm0);
+      END_SU2_OMP_MASTER
+    }
+
+    /*--- Step-length and Gram-Schmidt coefficient. ---*/
+
+    ScalarType alpha = gamma / delta, beta = 0.0;
+    if (i > 0) {
+      beta = gamma / gamma_old;
+      alpha = gamma / (delta - beta * gamma / alpha_old);
+    }
+    gamma_old = gamma;
+    alpha_old = alpha;
+
+    /*--- Update the directions and their products with the recurrences. ---*/
+
+    if (i == 0) {
+      z = n_i;
+      q = m_i;
+      s = w;
+      p = u;
+    } else {
+      z = beta * z + n_i;
+      q = beta * q + m_i;
+      s = beta * s + w;
+      p = beta * p + u;
+    }
+
+    /*--- Update solution, residual, and their preconditioned products. ---*/
+
+    x += alpha * p;
+    r -= alpha * s;
+    u -= alpha * q;
+    w -= alpha * z;
+  }
+
+  /*--- The last residual norm is not available if the loop did not break. ---*/
+
+  if (i == m) norm_r = r.norm();
+
+  /*--- Recalculate final residual (this should be optional) ---*/
+
+  if ((monitoring) && (config->GetComm_Level() == COMM_FULL)) {
+    if (masterRank) {
+      SU2_OMP_MASTER
+      WriteFinalResidual("Pipelined CG", i, norm_r / norm0);
+      END_SU2_OMP_MASTER
+    }
+
+    if (recomputeRes) {
+      mat_vec(x, A_x);
+      r = b - A_x;
+      ScalarType true_res = r.norm();
+
+      if (fabs(true_res - norm_r) > tol * 10.0) {
+        if (masterRank) {
+          SU2_OMP_MASTER
+          WriteWarning(norm_r, true_res, tol);
+          END_SU2_OMP_MASTER
+        }
+      }
+    }
+  }
+
+  residual = norm_r / norm0;
+  return i;
+}
+
+template <class ScalarType>
+unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarType>& b, CSysVector<ScalarType>& x,
+                                                      const CMatrixVectorProduct<ScalarType>& mat_vec,
+                                                      const CPreconditioner<ScalarType>& precond, ScalarType tol,
+                                                      unsigned long m, ScalarType& residual, bool monitoring,
+                                                      const CConfig* config) const {
+  const bool masterRank = (SU2_MPI::GetRank() == MASTER_NODE);
+  const bool flexible = !precond.IsIdentity();
+  /*--- If we call the solver outside of a parallel region, but the number of threads allows,
+   * we still want to parallelize some of the expensive operations. ---*/
+  const bool nestedParallel = !omp_in_parallel() && omp_get_max_threads() > 1;
+
+  /*---  Check the subspace size ---*/
+
+  if (m < 1) {
+    SU2_MPI::Error("Number of linear solver iterations must be greater than 0.", CURRENT_FUNCTION);
+  }
+
+  if (m > 5000) {
+    SU2_MPI::Error("FGMRES subspace is too large.", CURRENT_FUNCTION);
+  }
+
+  /*--- Allocate if not allocated yet ---*/
+
+  if (W.size() <= m || (flexible && Z.size() <= m)) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      W.resize(m + 1);
+      for (auto& w : W) w.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+      if (flexible) {
+        Z.resize(m + 1);
+        for (auto& z : Z) z.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+      }
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
+
+  /*--- Define various arrays. In parallel, each thread of each rank has and works
+   on its own thread, since calculations on these arrays are based on dot products
+   (reduced across all threads and ranks) all threads do the same computations. ---*/
+
+  su2vector<ScalarType> g(m + 1), sn(m + 1), cs(m + 1), y(m);
+  g = ScalarType(0);
+  sn = ScalarType(0);
+  cs = ScalarType(0);
+  y = ScalarType(0);
+  su2matrix<ScalarType> H(m + 1, m);
+  H = ScalarType(0);
+
+  /*--- Calculate the norm of the rhs vector. ---*/
+
+  ScalarType norm0 = b.norm();
+
+  /*--- Calculate the initial residual (actually the negative residual) and compute its norm. ---*/
+
+  if (!xIsZero) {
+    mat_vec(x, W[0]);
+    W[0] -= b;
+  } else {
+    W[0] = -b;
+  }
+
+  ScalarType beta = W[0].norm();
+
+  /*--- Set the norm to the initial initial residual value ---*/
+
+  if (tol_type == LinearToleranceType::RELATIVE) norm0 = beta;
+
+  if ((beta < tol * norm0) || (beta < eps)) {
+    /*--- System is already solved ---*/
+
+    if (masterRank) {
+      SU2_OMP_MASTER
+      cout << "CSysSolve::FGMRES(): system solved by initial guess." << endl;
+      END_SU2_OMP_MASTER
+    }
+    residual = beta;
+    return 0;
+  }
+
+  /*--- Normalize residual to get w_{0} (the negative sign is because w[0]
+        holds the negative residual, as mentioned above). ---*/
+
+  W[0] /= -beta;
+
+  /*--- Initialize the RHS of the reduced system ---*/
+
+  g[0] = beta;
+
+  /*--- Output header information including initial residual ---*/
+
+  unsigned long i = 0;
+  if ((monitoring) && (masterRank)) {
+    SU2_OMP_MASTER {
+      WriteHeader("FGMRES", tol, beta);
+      WriteHistory(i, beta / norm0);
+    }
+    END_SU2_OMP_MASTER
+  }
+
+  /*---  Loop over all search directions ---*/
+
+  for (i = 0; i < m; i++) {
+    /*---  Check if solution has converged ---*/
+
+    if (beta < tol * norm0) break;
+
+    if (flexible) {
+      /*---  Precondition the CSysVector w[i] and store result in z[i] ---*/
+
+      precond(W[i], Z[i]);
+
+      /*---  Add to Krylov subspace ---*/
+
+      mat_vec(Z[i], W[i + 1]);
+    } else {
+      mat_vec(W[i], W[i + 1]);
+    }
+
+    /*---  Modified Gram-Schmidt orthogonalization ---*/
+
+    if (nestedParallel) {
+      /*--- "omp parallel if" does not work well here ---*/
+      SU2_OMP_PARALLEL
+      ModGramSchmidt(true, i, H, W);
+      END_SU2_OMP_PARALLEL
+    } else {
+      ModGramSchmidt(false, i, H, W);
+    }
+
+    /*---  Apply old Givens rotations to new column of the Hessenberg matrix then generate the
+     new Givens rotation matrix and apply it to the last two elements of H[:][i] and g ---*/
+
+    for (unsigned long k = 0; k < i; k++) ApplyGivens(sn[k], cs[k], H[k][i], H[k + 1][i]);
+    GenerateGivens(H[i][i], H[i + 1][i], sn[i], cs[i]);
+    ApplyGivens(sn[i], cs[i], g[i], g[i + 1]);
+
+    /*---  Set L2 norm of residual and check if solution has converged ---*/
+
+    beta = fabs(g[i + 1]);
+
+    /*---  Output the relative residual if necessary ---*/
+
+    if ((((monitoring) && (masterRank)) && ((i + 1) % monitorFreq == 0))) {
+      SU2_OMP_MASTER
+      WriteHistory(i + 1, beta / norm0);
+      END_SU2_OMP_MASTER
+    }
+  }
+
+  /*---  Solve the least-squares system and update solution ---*/
+
+  SolveReduced(i, H, g, y);
+
+  const auto& basis = flexible ? Z : W;
+
+  if (nestedParallel) {
+    SU2_OMP_PARALLEL
+    for (unsigned long k = 0; k < i; k++) x += y[k] * basis[k];
+    END_SU2_OMP_PARALLEL
+  } else {
+    for (unsigned long k = 0; k < i; k++) x += y[k] * basis[k];
+  }
+
+  /*---  Recalculate final (neg.) residual (this should be optional) ---*/
+
+  if ((monitoring) && (config->GetComm_Level() == COMM_FULL)) {
+    if (masterRank) {
+      SU2_OMP_MASTER
+      WriteFinalResidual("FGMRES", i, beta / norm0);
+      END_SU2_OMP_MASTER
+    }
+
+    if (recomputeRes) {
+      mat_vec(x, W[0]);
+      W[0] -= b;
+      ScalarType res = W[0].norm();
+
+      if (fabs(res - beta) > tol * 10) {
+        if (masterRank) {
+          SU2_OMP_MASTER
+          WriteWarning(beta, res, tol);
+          END_SU2_OMP_MASTER
+        }
+      }
+    }
+  }
+
+  residual = beta / norm0;
+  return i;
+}
+
+template <class ScalarType>
+unsigned long CSysSolve<ScalarType>::RFGMRES_LinSolver(const CSysVector<ScalarType>& b, CSysVector<ScalarType>& x,
+                                                       const CMatrixVectorProduct<ScalarType>& mat_vec,
+                                                       const CPreconditioner<ScalarType>& precond, ScalarType tol,
+                                                       unsigned long MaxIter, ScalarType& residual, bool monitoring,
+                                                       const CConfig* config) {
+  const auto restartIter = config->GetLinear_Solver_Restart_Frequency();
+
+  SU2_OMP_MASTER {
+    xIsZero = false;
+    tol_type = LinearToleranceType::ABSOLUTE;
+  }
+  END_SU2_OMP_MASTER
+
+  const ScalarType norm0 = b.norm();  // <- Has a barrier
+
+  for (auto totalIter = 0ul; totalIter < MaxIter;) {
+    /*--- Enforce a hard limit on total number of iterations ---*/
+    auto iterLimit = min(restartIter, MaxIter - totalIter);
+    auto iter = FGMRES_LinSolver(b, x, mat_vec, precond, tol, iterLimit, residual, monitoring, config);
+    totalIter += iter;
+    if (residual <= tol * norm0 || iter < iterLimit) return totalIter;
+  }
+  return 0;
+}
+
+template <class ScalarType>
+unsigned long CSysSolve<ScalarType>::GCRODR_LinSolver(const CSysVector<ScalarType>& b, CSysVector<ScalarType>& x,
+                                                      const CMatrixVectorProduct<ScalarType>& mat_vec,
+                                                      const CPreconditioner<ScalarType>& precond, ScalarType tol,
+                                                      unsigned long MaxIter, ScalarType& residual, bool monitoring,
+                                                      const CConfig* config, unsigned short iSpace) {
+  const bool masterRank = (SU2_MPI::GetRank() == MASTER_NODE);
+  const auto m = min(config->GetLinear_Solver_Restart_Frequency(), MaxIter);
+  const auto k = min(config->GetLinear_Solver_Recycle_Size(), m);
+  auto& space = recycled[iSpace];
+
+  if (m < 1) {
+    SU2_MPI::Error("Number of linear solver iterations must be greater than 0.", CURRENT_FUNCTION);
+  }
+
+  if (m > 5000) {
+    SU2_MPI::Error("FGMRES subspace is too large.", CURRENT_FUNCTION);
+  }
+
+  /*--- Allocate if not allocated yet, the recycled subspace is discarded if the size of the system changes. ---*/
+
+  const bool sizeChanged = !space.U.empty() && space.U[0].GetLocSize() != x.GetLocSize();
+
+  if (W.size() <= m || Z.size() <= m || space.U.size() < k || recycleTmp.size() < 2 * k || sizeChanged) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      if (sizeChanged) {
+        space.U.clear();
+        space.C.clear();
+        space.size = 0;
+      }
+      for (auto* basis : {&W, &Z}) {
+        basis->resize(max<size_t>(basis->size(), m + 1));
+        for (auto& w : *basis) {
+          if (w.GetLocSize() != x.GetLocSize()) w.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+        }
+      }
+      for (auto* vecs : {&space.U, &space.C}) {
+        vecs->resize(max<size_t>(vecs->size(), k));
+        for (auto& u : *vecs) {
+          if (u.GetLocSize() != x.GetLocSize()) u.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+        }
+      }
+      recycleTmp.resize(2 * k);
+      for (auto& t : recycleTmp) t.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
+
+  /*--- Each thread has its own copy of the small arrays (see FGMRES_LinSolver). B holds the projections of
+   *    A z_i on the recycled subspace, Hraw is the Hessenberg matrix before the Givens rotations, and S is the
+   *    Gram matrix of the augmented space [U Z]. ---*/
+
+  su2vector<ScalarType> g(m + 1), sn(m + 1), cs(m + 1), y(m), dots(k * k + 2 * k + m + 1);
+  su2matrix<ScalarType> H(m + 1, m), Hraw(m + 1, m), B(max(k, 1ul), m), S(k + m, k + m);
+
+  vector<const VectorType*> left(dots.size()), right(dots.size());
+
+  const auto size = x.GetLocSize();
+  const auto chunk = computeStaticChunkSize(size, omp_get_max_threads(), 4096);
+
+  /*--- dst = sum_a coef_a src_a, zero coefficients are skipped (the last vector of a basis may be invalid). ---*/
+
+  auto combine = [&](const vector<const VectorType*>& src, const su2vector<ScalarType>& coef, VectorType& dst) {
+    SU2_OMP_FOR_STAT(chunk)
+    for (auto iElm = 0ul; iElm < size; ++iElm) {
+      ScalarType v = 0.0;
+      for (auto a = 0ul; a < src.size(); ++a) {
+        if (coef[a] != 0.0) v += coef[a] * (*src[a])[iElm];
+      }
+      dst[iElm] = v;
+    }
+    END_SU2_OMP_FOR
+  };
+
+  /*--- The recycled subspace comes from the previous call, the matrix has changed in the meantime.
+   *    C = A U is recomputed and orthonormalized, the same operations are applied to U. ---*/
+
+  unsigned long nRec = 0;
+  for (auto j = 0ul; j < min(space.size, k); ++j) {
+    if (nRec != j) space.U[nRec] = space.U[j];
+    mat_vec(space.U[nRec], space.C[nRec]);
+    const ScalarType norm = space.C[nRec].norm();
+
+    for (auto l = 0ul; l < nRec; ++l) {
+      const ScalarType proj = space.C[nRec].dot(space.C[l]);
+      space.C[nRec] -= proj * space.C[l];
+      space.U[nRec] -= proj * space.U[l];
+    }
+    const ScalarType nrm = space.C[nRec].norm();
+
+    /*--- Directions that became linearly dependent are dropped. ---*/
+    if (nrm > sqrt(eps) * norm) {
+      space.C[nRec] /= nrm;
+      space.U[nRec] /= nrm;
+      ++nRec;
+    }
+  }
+
+  /*--- Calculate the norm of the rhs vector. ---*/
+
+  ScalarType norm0 = b.norm();
+  ScalarType beta = 0.0;
+
+  unsigned long totalIter = 0;
+
+  while (true) {
+    /*--- Calculate the initial residual (actually the negative residual) and project it out of range(C),
+     *    the correction of x comes from x = x + U C^T r. ---*/
+
+    if (!xIsZero || totalIter > 0) {
+      mat_vec(x, W[0]);
+      W[0] -= b;
+    } else {
+      W[0] = -b;
+    }
+
+    if (totalIter == 0) {
+      beta = W[0].norm();
+
+      /*--- Set the norm to the initial residual value ---*/
+
+      if (tol_type == LinearToleranceType::RELATIVE) norm0 = beta;
+
+      if ((beta < tol * norm0) || (beta < eps)) {
+        /*--- System is already solved ---*/
+
+        if (masterRank) {
+          SU2_OMP_MASTER
+          cout << "CSysSolve::GCRO-DR(): system solved by initial guess." << endl;
+          END_SU2_OMP_MASTER
+        }
+        residual = beta;
+        return 0;
+      }
+
+      if ((monitoring) && (masterRank)) {
+        SU2_OMP_MASTER {
+          WriteHeader("GCRO-DR", tol, beta);
+          WriteHistory(totalIter, beta / norm0);
+        }
+        END_SU2_OMP_MASTER
+      }
+    }
+
+    if (nRec > 0) {
+      for (auto j = 0ul; j < nRec; ++j) {
+        left[j] = &W[0];
+        right[j] = &space.C[j];
+      }
+      StartDotProducts(nRec, left.data(), right.data());
+      FinishDotProducts(dots.data());
+
+      for (auto j = 0ul; j < nRec; ++j) {
+        x -= dots[j] * space.U[j];
+        W[0] -= dots[j] * space.C[j];
+      }
+    }
+
+    beta = W[0].norm();
+
+    if ((beta < tol * norm0) || (totalIter >= MaxIter)) break;
+
+    /*--- Normalize residual to get w_{0}, and initialize the RHS of the reduced system. ---*/
+
+    W[0] /= -beta;
+
+    g = ScalarType(0);
+    sn = ScalarType(0);
+    cs = ScalarType(0);
+    H = ScalarType(0);
+    Hraw = ScalarType(0);
+    B = ScalarType(0);
+    S = ScalarType(0);
+    g[0] = beta;
+
+    /*--- Gram matrix of the recycled directions (one reduction). ---*/
+
+    if (nRec > 0) {
+      unsigned long nDots = 0;
+      for (auto j = 0ul; j < nRec; ++j) {
+        for (auto l = 0ul; l <= j; ++l, ++nDots) {
+          left[nDots] = &space.U[j];
+          right[nDots] = &space.U[l];
+        }
+      }
+      StartDotProducts(nDots, left.data(), right.data());
+      FinishDotProducts(dots.data());
+
+      nDots = 0;
+      for (auto j = 0ul; j < nRec; ++j) {
+        for (auto l = 0ul; l <= j; ++l, ++nDots) S[j][l] = S[l][j] = dots[nDots];
+      }
+    }
+
+    /*--- One cycle of FGMRES for the deflated operator (I - C C^T) A. ---*/
+
+    const auto mCycle = min(m, MaxIter - totalIter);
+    unsigned long i = 0;
+
+    for (i = 0; i < mCycle; i++) {
+      /*---  Check if solution has converged ---*/
+
+      if (beta < tol * norm0) break;
+
+      precond(W[i], Z[i]);
+      mat_vec(Z[i], W[i + 1]);
+
+      /*--- Orthogonalization against the recycled subspace, then the Krylov basis. The products of z_i with
+       *    the augmented space are done in the same reduction. ---*/
+
+      if (k > 0) {
+        unsigned long nDots = 0;
+        for (auto j = 0ul; j < nRec; ++j, ++nDots) {
+          left[nDots] = &W[i + 1];
+          right[nDots] = &space.C[j];
+        }
+        for (auto j = 0ul; j < nRec; ++j, ++nDots) {
+          left[nDots] = &Z[i];
+          right[nDots] = &space.U[j];
+        }
+        for (auto l = 0ul; l <= i; ++l, ++nDots) {
+          left[nDots] = &Z[i];
+          right[nDots] = &Z[l];
+        }
+        StartDotProducts(nDots, left.data(), right.data());
+        FinishDotProducts(dots.data());
+
+        for (auto j = 0ul; j < nRec; ++j) {
+          B[j][i] = dots[j];
+          W[i + 1] -= dots[j] * space.C[j];
+        }
+        for (auto l = 0ul; l < nRec + i + 1; ++l) S[nRec + i][l] = S[l][nRec + i] = dots[nRec + l];
+      }
+
+      ModGramSchmidt(false, i, H, W);
+
+      for (auto l = 0ul; l <= i + 1; ++l) Hraw[l][i] = H[l][i];
+
+      /*---  Apply old Givens rotations to new column of the Hessenberg matrix then generate the
+       new Givens rotation matrix and apply it to the last two elements of H[:][i] and g ---*/
+
+      for (unsigned long l = 0; l < i; l++) ApplyGivens(sn[l], cs[l], H[l][i], H[l + 1][i]);
+      GenerateGivens(H[i][i], H[i + 1][i], sn[i], cs[i]);
+      ApplyGivens(sn[i], cs[i], g[i], g[i + 1]);
+
+      beta = fabs(g[i + 1]);
+
+      if ((((monitoring) && (masterRank)) && ((totalIter + i + 1) % monitorFreq == 0))) {
+        SU2_OMP_MASTER
+        WriteHistory(totalIter + i + 1, beta / norm0);
+        END_SU2_OMP_MASTER
+      }
+    }
+
+    /*--- Solve the least-squares system and update the solution, x = x + Z y - U B y. ---*/
+
+    SolveReduced(i, H, g, y);
+
+    for (auto l = 0ul; l < i; l++) x += y[l] * Z[l];
+
+    for (auto j = 0ul; j < nRec; ++j) {
+      ScalarType By = 0.0;
+      for (auto l = 0ul; l < i; l++) By += B[j][l] * y[l];
+      x -= By * space.U[j];
+    }
+    totalIter += i;
+
+    /*--- Update the recycled subspace with the directions u of the augmented space [U Z] that minimize
+     *    |A u| / |u|, these are the modes that slow down convergence. With A [U Z] = [C W] G, where [C W] is
+     *    orthonormal, they are the solutions of G^T G v = theta S v with the smallest theta. ---*/
+
+    const auto p = nRec + i;
+    const auto kNew = min(k, p);
+
+    if (kNew > 0) {
+      const auto q = p + 1;
+      su2matrix<ScalarType> G(q, p);
+      G = ScalarType(0);
+      for (auto j = 0ul; j < nRec; ++j) {
+        G[j][j] = 1.0;
+        for (auto l = 0ul; l < i; ++l) G[j][nRec + l] = B[j][l];
+      }
+      for (auto l = 0ul; l < i; ++l) {
+        for (auto r = 0ul; r <= l + 1; ++r) G[nRec + r][nRec + l] = Hraw[r][l];
+      }
+
+      /*--- The eigenproblems are only used to select directions, they are solved in passive double.
+       *    S = Q L Q^T, the basis T = Q L^-1/2 (without the nearly dependent directions) is S-orthonormal,
+       *    and the problem becomes T^T G^T G T w = theta w, v = T w. ---*/
+
+      su2passivematrix Sp(p, p), Q(p, p);
+      vector<passivedouble> lambda(p), work(p);
+      for (auto a = 0ul; a < p; ++a) {
+        for (auto c = 0ul; c < p; ++c) Sp[a][c] = SU2_TYPE::GetValue(S[a][c]);
+      }
+      CBlasStructure::EigenDecomposition(Sp, Q, lambda, int(p), work);
+
+      unsigned long nInd = 0;
+      su2passivematrix T(p, p);
+      for (auto c = p; c-- > 0;) {
+        if (lambda[c] <= 1e-12 * lambda[p - 1]) break;
+        for (auto a = 0ul; a < p; ++a) T[a][nInd] = Q[a][c] / sqrt(lambda[c]);
+        ++nInd;
+      }
+
+      su2passivematrix GT(q, nInd), GtG(nInd, nInd), eigVec(nInd, nInd);
+      for (auto r = 0ul; r < q; ++r) {
+        for (auto c = 0ul; c < nInd; ++c) {
+          passivedouble sum = 0.0;
+          for (auto a = 0ul; a < p; ++a) sum += SU2_TYPE::GetValue(G[r][a]) * T[a][c];
+          GT[r][c] = sum;
+        }
+      }
+      for (auto a = 0ul; a < nInd; ++a) {
+        for (auto c = 0ul; c < nInd; ++c) {
+          passivedouble sum = 0.0;
+          for (auto r = 0ul; r < q; ++r) sum += GT[r][a] * GT[r][c];
+          GtG[a][c] = sum;
+        }
+      }
+      vector<passivedouble> eigVal(nInd);
+      work.resize(nInd);
+      CBlasStructure::EigenDecomposition(GtG, eigVec, eigVal, int(nInd), work);
+
+      /*--- Coefficients of the new U in [U Z], and of the new C in [C W], C is orthonormalized with MGS in
+       *    the small space since [C W] is orthonormal. ---*/
+
+      const auto kEig = min(kNew, nInd);
+      su2matrix<ScalarType> coefU(p, kEig), coefC(q, kEig);
+      for (auto j = 0ul; j < kEig; ++j) {
+        for (auto a = 0ul; a < p; ++a) {
+          passivedouble sum = 0.0;
+          for (auto c = 0ul; c < nInd; ++c) sum += T[a][c] * eigVec[c][j];
+          coefU[a][j] = sum;
+        }
+        for (auto r = 0ul; r < q; ++r) {
+          passivedouble sum = 0.0;
+          for (auto c = 0ul; c < nInd; ++c) sum += GT[r][c] * eigVec[c][j];
+          coefC[r][j] = sum;
+        }
+      }
+
+      const ScalarType normG = sqrt(max(eigVal.empty() ? 0.0 : eigVal.back(), 0.0));
+      unsigned long nNew = 0;
+
+      for (auto j = 0ul; j < kEig; ++j) {
+        if (nNew != j) {
+          for (auto a = 0ul; a < p; ++a) coefU[a][nNew] = coefU[a][j];
+          for (auto r = 0ul; r < q; ++r) coefC[r][nNew] = coefC[r][j];
+        }
+        for (auto l = 0ul; l < nNew; ++l) {
+          ScalarType proj = 0.0;
+          for (auto r = 0ul; r < q; ++r) proj += coefC[r][nNew] * coefC[r][l];
+          for (auto r = 0ul; r < q; ++r) coefC[r][nNew] -= proj * coefC[r][l];
+          for (auto a = 0ul; a < p; ++a) coefU[a][nNew] -= proj * coefU[a][l];
+        }
+        ScalarType nrm = 0.0;
+        for (auto r = 0ul; r < q; ++r) nrm += pow(coefC[r][nNew], 2);
+        nrm = sqrt(nrm);
+
+        if (nrm > eps * normG) {
+          for (auto r = 0ul; r < q; ++r) coefC[r][nNew] /= nrm;
+          for (auto a = 0ul; a < p; ++a) coefU[a][nNew] /= nrm;
+          ++nNew;
+        }
+      }
+
+      /*--- Form the new vectors in the work space, then copy them to the recycled subspace. ---*/
+
+      vector<const VectorType*> srcU(p), srcC(q);
+      for (auto j = 0ul; j < nRec; ++j) {
+        srcU[j] = &space.U[j];
+        srcC[j] = &space.C[j];
+      }
+      for (auto l = 0ul; l < i; ++l) srcU[nRec + l] = &Z[l];
+      for (auto l = 0ul; l <= i; ++l) srcC[nRec + l] = &W[l];
+
+      su2vector<ScalarType> coef(q);
+      for (auto j = 0ul; j < nNew; ++j) {
+        for (auto a = 0ul; a < p; ++a) coef[a] = coefU[a][j];
+        combine(srcU, coef, recycleTmp[j]);
+        for (auto r = 0ul; r < q; ++r) coef[r] = coefC[r][j];
+        combine(srcC, coef, recycleTmp[k + j]);
+      }
+      for (auto j = 0ul; j < nNew; ++j) {
+        space.U[j] = recycleTmp[j];
+        space.C[j] = recycleTmp[k + j];
+      }
+      nRec = nNew;
+    }
+
+    if (beta < tol * norm0 || totalIter >= MaxIter) break;
+  }
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS { space.size = nRec; }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  /*---  Recalculate final (neg.) residual (this should be optional) ---*/
+
+  if ((monitoring) && (config->GetComm_Level() == COMM_FULL)) {
+    if (masterRank) {
+      SU2_OMP_MASTER
+      WriteFinalResidual("GCRO-DR", totalIter, beta / norm0);
+      END_SU2_OMP_MASTER
+    }
+
+    if (recomputeRes) {
+      mat_vec(x, W[0]);
+      W[0] -= b;
+      ScalarType res = W[0].norm();
+
+      if (fabs(res - beta) > tol * 10) {
+        if (masterRank) {
+          SU2_OMP_MASTER
+          WriteWarning(beta, res, tol);
+          END_SU2_OMP_MASTER
+        }
+      }
+    }
+  }
+
+  residual = beta / norm0;
+  return totalIter;
+}
+
+template <class ScalarType>
+unsigned long CSysSolve<ScalarType>::BatchedFGMRES_LinSolver(const CSysVector<ScalarType>& b, CSysVector<ScalarType>& x,
+                                                             unsigned long nRhs,
+                                                             const CMatrixVectorProduct<ScalarType>& mat_vec,
+                                                             const CPreconditioner<ScalarType>& precond,
+                                                             ScalarType tol, unsigned long m, ScalarType& residual,
+                                                             bool monitoring, const CConfig* config) const {
+  const bool masterRank = (SU2_MPI::GetRank() == MASTER_NODE);
+
+  /*---  Check the subspace size and the layout of the multi-vectors ---*/
+
+  if (m < 1) {
+    SU2_MPI::Error("Number of linear solver iterations must be greater than 0.", CURRENT_FUNCTION);
+  }
+
+  if (m > 5000) {
+    SU2_MPI::Error("FGMRES subspace is too large.", CURRENT_FUNCTION);
+  }
+
+  if (nRhs < 1 || x.GetNVar() % nRhs != 0) {
+    SU2_MPI::Error("Invalid number of right hand sides for the multi-vector.", CURRENT_FUNCTION);
+  }
+
+  /*--- Allocate if not allocated yet, or if the vectors have a different layout. ---*/
+
+  if (W.size() <= m || Z.size() <= m || W[0].GetNVar() != x.GetNVar()) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      for (auto* basis : {&W, &Z}) {
+        basis->resize(max<size_t>(basis->size(), m + 1));
+        for (auto& w : *basis) w.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+      }
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
+
+  /*--- Each right hand side (column) has its own reduced system, each thread has its own copy of them
+   *    (see FGMRES_LinSolver). Columns are deactivated as they converge. ---*/
+
+  vector<su2matrix<ScalarType>> H(nRhs, su2matrix<ScalarType>(m + 1, m));
+  vector<su2vector<ScalarType>> g(nRhs, su2vector<ScalarType>(m + 1)), sn(g), cs(g);
+  su2vector<ScalarType> y(m), beta(nRhs), norm0(nRhs), alpha(nRhs), dots((m + 1) * nRhs);
+  su2matrix<ScalarType> coef(m + 1, nRhs);
+  vector<unsigned long> nIter(nRhs, 0);
+  vector<char> active(nRhs, true);
+  vector<const VectorType*> left(m + 1), right(m + 1);
+
+  for (auto iRhs = 0ul; iRhs < nRhs; ++iRhs) {
+    H[iRhs] = ScalarType(0);
+    g[iRhs] = ScalarType(0);
+    sn[iRhs] = ScalarType(0);
+    cs[iRhs] = ScalarType(0);
+  }
+
+  const auto nVar = x.GetNVar() / nRhs;
+  const auto nBlk = x.GetNBlk();
+  const auto chunk = computeStaticChunkSize(nBlk, omp_get_max_threads(), 512);
+
+  /*--- Norms of the columns of a multi-vector (one reduction). ---*/
+
+  auto columnNorms = [&](const VectorType& u, su2vector<ScalarType>& norms) {
+    const VectorType* vecs[] = {&u};
+    StartDotProducts(1, vecs, vecs, nRhs);
+    FinishDotProducts(norms.data());
+    for (auto iRhs = 0ul; iRhs < nRhs; ++iRhs) norms[iRhs] = sqrt(norms[iRhs]);
+  };
+
+  /*--- v_c = v_c * s_c + sum_k a(k,c) u[k]_c, for each column c, in one pass. ---*/
+
+  auto update = [&](const su2vector<ScalarType>& s, unsigned long n, const VectorType* const* u,
+                    const su2matrix<ScalarType>& a, VectorType& v) {
+    SU2_OMP_FOR_STAT(chunk)
+    for (auto iBlk = 0ul; iBlk < nBlk; ++iBlk) {
+      for (auto iRhs = 0ul; iRhs < nRhs; ++iRhs) {
+        const auto i = (iBlk * nRhs + iRhs) * nVar;
+        for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+          ScalarType val = s[iRhs] * v[i + iVar];
+          for (auto k = 0ul; k < n; ++k) val += a(k, iRhs) * (*u[k])[i + iVar];
+          v[i + iVar] = val;
+        }
+      }
+    }
+    END_SU2_OMP_FOR
+  };
+
+  su2vector<ScalarType> one(nRhs);
+  one = ScalarType(1);
+
+  /*--- Calculate the norm of the rhs vectors, and the initial residuals (actually the negative residuals). ---*/
+
+  columnNorms(b, norm0);
+
+  if (!xIsZero) {
+    mat_vec(x, W[0]);
+    W[0] -= b;
+  } else {
+    W[0] = -b;
+  }
+
+  columnNorms(W[0], beta);
+
+  if (tol_type == LinearToleranceType::RELATIVE) norm0 = beta;
+
+  ScalarType maxRes = 0.0;
+  for (auto iRhs = 0ul; iRhs < nRhs; ++iRhs) {
+    active[iRhs] = (beta[iRhs] >= tol * norm0[iRhs]) && (beta[iRhs] >= eps);
+    if (norm0[iRhs] > 0.0) maxRes = max(maxRes, beta[iRhs] / norm0[iRhs]);
+
+    /*--- Converged columns are zeroed, they stay zero through the products and the preconditioner. ---*/
+    alpha[iRhs] = active[iRhs] ? -1.0 / beta[iRhs] : 0.0;
+    g[iRhs][0] = beta[iRhs];
+  }
+
+  if (none_of(active.begin(), active.end(), [](char a) { return a; })) {
+    /*--- System is already solved ---*/
+
+    if (masterRank) {
+      SU2_OMP_MASTER
+      cout << "CSysSolve::BatchedFGMRES(): system solved by initial guess." << endl;
+      END_SU2_OMP_MASTER
+    }
+    residual = maxRes;
+    return 0;
+  }
+
+  /*--- Normalize residual to get w_{0}. ---*/
+
+  update(alpha, 0, nullptr, coef, W[0]);
+
+  /*--- Output header information including initial residual ---*/
+
+  unsigned long i = 0;
+  if ((monitoring) && (masterRank)) {
+    SU2_OMP_MASTER {
+      WriteHeader("Batched FGMRES", tol, maxRes);
+      WriteHistory(i, maxRes);
+    }
+    END_SU2_OMP_MASTER
+  }
+
+  /*---  Loop over all search directions ---*/
+
+  for (i = 0; i < m; i++) {
+    /*---  Check if all the systems have converged ---*/
+
+    if (none_of(active.begin(), active.end(), [](char a) { return a; })) break;
+
+    /*--- The matrix and the preconditioner are applied to all columns at once. ---*/
+
+    precond(W[i], Z[i]);
+    mat_vec(Z[i], W[i + 1]);
+
+    /*--- Classical Gram-Schmidt with one re-orthogonalization, one reduction per pass for all columns. ---*/
+
+    for (auto k = 0ul; k <= i; ++k) {
+      left[k] = &W[i + 1];
+      right[k] = &W[k];
+    }
+    for (auto pass = 0; pass < 2; ++pass) {
+      StartDotProducts(i + 1, left.data(), right.data(), nRhs);
+      FinishDotProducts(dots.data());
+
+      for (auto k = 0ul; k <= i; ++k) {
+        for (auto iRhs = 0ul; iRhs < nRhs; ++iRhs) {
+          const auto h = dots[k * nRhs + iRhs];
+          H[iRhs](k, i) += h;
+          coef(k, iRhs) = -h;
+        }
+      }
+      update(one, i + 1, right.data(), coef, W[i + 1]);
+    }
+
+    columnNorms(W[i + 1], alpha);
+
+    maxRes = 0.0;
+    for (auto iRhs = 0ul; iRhs < nRhs; ++iRhs) {
+      const auto nrm = alpha[iRhs];
+      alpha[iRhs] = 0.0;
+      if (!active[iRhs]) continue;
+
+      auto& Hc = H[iRhs];
+      Hc(i + 1, i) = nrm;
+
+      /*--- Apply old Givens rotations to new column of the Hessenberg matrix then generate the
+       new Givens rotation matrix and apply it to the last two elements of H[:][i] and g ---*/
+
+      for (unsigned long k = 0; k < i; k++) ApplyGivens(sn[iRhs][k], cs[iRhs][k], Hc[k][i], Hc[k + 1][i]);
+      GenerateGivens(Hc[i][i], Hc[i + 1][i], sn[iRhs][i], cs[iRhs][i]);
+      ApplyGivens(sn[iRhs][i], cs[iRhs][i], g[iRhs][i], g[iRhs][i + 1]);
+
+      beta[iRhs] = fabs(g[iRhs][i + 1]);
+      nIter[iRhs] = i + 1;
+      maxRes = max(maxRes, beta[iRhs] / norm0[iRhs]);
+
+      /*--- Exact breakdown (the solution is in the subspace) or convergence deactivate the column. ---*/
+      active[iRhs] = (beta[iRhs] >= tol * norm0[iRhs]) && (nrm > eps * beta[iRhs]);
+      if (active[iRhs]) alpha[iRhs] = 1.0 / nrm;
+    }
+
+    /*--- Normalize the new vectors (zero for inactive columns). ---*/
+
+    update(alpha, 0, nullptr, coef, W[i + 1]);
 
-    /*--- Calculate Gram-Schmidt coefficient, beta = (r_{i+1}, z_{i+1}) / (r_{i}, z_{i}) ---*/
+    /*---  Output the relative residual if necessary ---*/
 
-    ScalarType beta = r_dot_z;
-    r_dot_z = r.dot(z);
-    beta = r_dot_z / beta;
+    if ((((monitoring) && (masterRank)) && ((i + 1) % monitorFreq == 0))) {
+      SU2_OMP_MASTER
+      WriteHistory(i + 1, maxRes);
+      END_SU2_OMP_MASTER
+    }
+  }
 
-    /*--- Gram-Schmidt orthogonalization. ---*/
+  /*---  Solve the least-squares systems and update the solutions ---*/
 
-    p = beta * p + z;
+  coef = ScalarType(0);
+  maxRes = 0.0;
+  for (auto iRhs = 0ul; iRhs < nRhs; ++iRhs) {
+    if (norm0[iRhs] > 0.0) maxRes = max(maxRes, beta[iRhs] / norm0[iRhs]);
+    if (nIter[iRhs] == 0) continue;
+    SolveReduced(nIter[iRhs], H[iRhs], g[iRhs], y);
+    for (auto k = 0ul; k < nIter[iRhs]; ++k) coef(k, iRhs) = y[k];
   }
 
-  /*--- Recalculate final residual (this should be optional) ---*/
+  for (auto k = 0ul; k < i; ++k) right[k] = &Z[k];
+  update(one, i, right.data(), coef, x);
+
+  /*---  Recalculate final (neg.) residual (this should be optional) ---*/
 
   if ((monitoring) && (config->GetComm_Level() == COMM_FULL)) {
     if (masterRank) {
       SU2_OMP_MASTER
-      WriteFinalResidual("CG", i, norm_r / norm0);
+      WriteFinalResidual("Batched FGMRES", i, maxRes);
       END_SU2_OMP_MASTER
     }
 
     if (recomputeRes) {
-      mat_vec(x, A_x);
-      r = b - A_x;
-      ScalarType true_res = r.norm();
-
-      if (fabs(true_res - norm_r) > tol * 10.0) {
-        if (masterRank) {
-          SU2_OMP_MASTER
-          WriteWarning(norm_r, true_res, tol);
-          END_SU2_OMP_MASTER
+      mat_vec(x, W[0]);
+      W[0] -= b;
+      columnNorms(W[0], alpha);
+
+      for (auto iRhs = 0ul; iRhs < nRhs; ++iRhs) {
+        if (fabs(alpha[iRhs] - beta[iRhs]) > tol * 10) {
+          if (masterRank) {
+            SU2_OMP_MASTER
+            WriteWarning(beta[iRhs], alpha[iRhs], tol);
+            END_SU2_OMP_MASTER
+          }
         }
       }
     }
   }
 
-  residual = norm_r / norm0;
+  residual = maxRes;
   return i;
 }
 
 template <class ScalarType>
-unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarType>& b, CSysVector<ScalarType>& x,
-                                                      const CMatrixVectorProduct<ScalarType>& mat_vec,
-                                                      const CPreconditioner<ScalarType>& precond, ScalarType tol,
-                                                      unsigned long m, ScalarType& residual, bool monitoring,
-                                                      const CConfig* config) const {
+unsigned long CSysSolve<ScalarType>::PipelinedGMRES_LinSolver(const CSysVector<ScalarType>& b,
+                                                              CSysVector<ScalarType>& x,
+                                                              const CMatrixVectorProduct<ScalarType>& mat_vec,
+                                                              const CPreconditioner<ScalarType>& precond,
+                                                              ScalarType tol, unsigned long m, ScalarType& residual,
+                                                              bool monitoring, const CConfig* config) const {
   const bool masterRank = (SU2_MPI::GetRank() == MASTER_NODE);
-  const bool flexible = !precond.IsIdentity();
-  /*--- If we call the solver outside of a parallel region, but the number of threads allows,
-   * we still want to parallelize some of the expensive operations. ---*/
-  const bool nestedParallel = !omp_in_parallel() && omp_get_max_threads() > 1;
+
+  /*--- If less than this fraction of the squared norm remains after orthogonalization, the norm from the
+   *    Pythagorean theorem is not reliable and it is computed explicitly (with an extra reduction). ---*/
+  const ScalarType cancel = 1e-4;
 
   /*---  Check the subspace size ---*/
 
@@ -369,37 +1527,33 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
     SU2_MPI::Error("FGMRES subspace is too large.", CURRENT_FUNCTION);
   }
 
-  /*--- Allocate if not allocated yet ---*/
+  /*--- Allocate if not allocated yet, W is the orthonormal basis, Z the preconditioned basis, and AZ = A Z. ---*/
 
-  if (W.size() <= m || (flexible && Z.size() <= m)) {
+  if (W.size() <= m || Z.size() <= m || AZ.size() <= m) {
     BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
-      W.resize(m + 1);
-      for (auto& w : W) w.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
-      if (flexible) {
-        Z.resize(m + 1);
-        for (auto& z : Z) z.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+      for (auto* basis : {&W, &Z, &AZ}) {
+        basis->resize(m + 1);
+        for (auto& w : *basis) w.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
       }
     }
     END_SU2_OMP_SAFE_GLOBAL_ACCESS
   }
 
-  /*--- Define various arrays. In parallel, each thread of each rank has and works
-   on its own thread, since calculations on these arrays are based on dot products
-   (reduced across all threads and ranks) all threads do the same computations. ---*/
+  /*--- Define various arrays, each thread has its own copy (see FGMRES_LinSolver). Hraw is the Hessenberg
+   *    matrix before the Givens rotations, gRot the RHS before each rotation. ---*/
 
-  su2vector<ScalarType> g(m + 1), sn(m + 1), cs(m + 1), y(m);
+  su2vector<ScalarType> g(m + 1), gRot(m + 1), sn(m + 1), cs(m + 1), y(m), hi(m + 1), dots(2 * m + 3);
   g = ScalarType(0);
   sn = ScalarType(0);
   cs = ScalarType(0);
   y = ScalarType(0);
-  su2matrix<ScalarType> H(m + 1, m);
+  su2matrix<ScalarType> H(m + 1, m), Hraw(m + 1, m);
   H = ScalarType(0);
+  Hraw = ScalarType(0);
 
-  /*--- Calculate the norm of the rhs vector. ---*/
-
-  ScalarType norm0 = b.norm();
+  vector<const VectorType*> left(2 * m + 3), right(2 * m + 3);
 
-  /*--- Calculate the initial residual (actually the negative residual) and compute its norm. ---*/
+  /*--- Calculate the initial residual (actually the negative residual), and the norms of it and of b. ---*/
 
   if (!xIsZero) {
     mat_vec(x, W[0]);
@@ -408,7 +1562,14 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
     W[0] = -b;
   }
 
-  ScalarType beta = W[0].norm();
+  ScalarType beta = 0.0, norm0 = 0.0;
+  {
+    const VectorType* vecs[] = {&W[0], &b};
+    StartDotProducts(2, vecs, vecs);
+    FinishDotProducts(dots.data());
+    beta = sqrt(dots[0]);
+    norm0 = sqrt(dots[1]);
+  }
 
   /*--- Set the norm to the initial initial residual value ---*/
 
@@ -419,17 +1580,18 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
 
     if (masterRank) {
       SU2_OMP_MASTER
-      cout << "CSysSolve::FGMRES(): system solved by initial guess." << endl;
+      cout << "CSysSolve::PipelinedGMRES(): system solved by initial guess." << endl;
       END_SU2_OMP_MASTER
     }
     residual = beta;
     return 0;
   }
 
-  /*--- Normalize residual to get w_{0} (the negative sign is because w[0]
-        holds the negative residual, as mentioned above). ---*/
+  /*--- Normalize residual to get w_{0}, and start the basis. ---*/
 
   W[0] /= -beta;
+  precond(W[0], Z[0]);
+  mat_vec(Z[0], AZ[0]);
 
   /*--- Initialize the RHS of the reduced system ---*/
 
@@ -440,12 +1602,26 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
   unsigned long i = 0;
   if ((monitoring) && (masterRank)) {
     SU2_OMP_MASTER {
-      WriteHeader("FGMRES", tol, beta);
+      WriteHeader("Pipelined GMRES", tol, beta);
       WriteHistory(i, beta / norm0);
     }
     END_SU2_OMP_MASTER
   }
 
+  /*--- Apply the rotations to column j of the Hessenberg matrix, generate rotation j, and apply it to g. ---*/
+
+  auto rotateColumn = [&](unsigned long j) {
+    for (unsigned long k = 0; k <= j + 1; k++) H[k][j] = Hraw[k][j];
+    for (unsigned long k = 0; k < j; k++) ApplyGivens(sn[k], cs[k], H[k][j], H[k + 1][j]);
+    g[j] = gRot[j];
+    g[j + 1] = 0.0;
+    GenerateGivens(H[j][j], H[j + 1][j], sn[j], cs[j]);
+    ApplyGivens(sn[j], cs[j], g[j], g[j + 1]);
+  };
+
+  const auto size = x.GetLocSize();
+  const auto chunk = computeStaticChunkSize(size, omp_get_max_threads(), 4096);
+
   /*---  Loop over all search directions ---*/
 
   for (i = 0; i < m; i++) {
@@ -453,35 +1629,105 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
 
     if (beta < tol * norm0) break;
 
-    if (flexible) {
-      /*---  Precondition the CSysVector w[i] and store result in z[i] ---*/
+    /*--- One reduction for: the projections of A z_i on the basis, (A z_i, w_k) k <= i; the orthogonality
+     *    and norm of the last basis vector, (w_i, w_k) k <= i (delayed re-orthogonalization); and |A z_i|^2. ---*/
 
-      precond(W[i], Z[i]);
+    unsigned long nDots = 0;
+    for (auto k = 0ul; k <= i; ++k, ++nDots) {
+      left[nDots] = &AZ[i];
+      right[nDots] = &W[k];
+    }
+    for (auto k = 0ul; k <= i; ++k, ++nDots) {
+      left[nDots] = &W[i];
+      right[nDots] = &W[k];
+    }
+    left[nDots] = right[nDots] = &AZ[i];
+    StartDotProducts(++nDots, left.data(), right.data());
 
-      /*---  Add to Krylov subspace ---*/
+    /*--- Overlapped with the preconditioner and product of A z_i, see below. ---*/
 
-      mat_vec(Z[i], W[i + 1]);
-    } else {
-      mat_vec(W[i], W[i + 1]);
+    precond(AZ[i], Z[i + 1]);
+    mat_vec(Z[i + 1], AZ[i + 1]);
+
+    FinishDotProducts(dots.data());
+
+    const ScalarType* h = dots.data();
+    const ScalarType* c = dots.data() + i + 1;
+    const ScalarType normAZ2 = dots[2 * i + 2];
+
+    /*--- Second Gram-Schmidt pass for w_i, w_i = (w_i - sum_k c_k w_k) / s, with s the new norm. The previous
+     *    column of the Hessenberg matrix and the projection of A z_i on w_i are updated accordingly. ---*/
+
+    for (auto k = 0ul; k <= i; ++k) hi[k] = h[k];
+
+    if (i > 0) {
+      ScalarType s2 = c[i];
+      for (auto k = 0ul; k < i; ++k) s2 -= pow(c[k], 2);
+      if (!(s2 > 0.0)) {
+        /*--- s2 is the result of a dot product, communications are implicitly handled. ---*/
+        SU2_MPI::Error("FGMRES orthogonalization failed, linear solver diverged.", CURRENT_FUNCTION);
+      }
+      const ScalarType s = sqrt(s2);
+
+      for (auto k = 0ul; k < i; ++k) {
+        Hraw[k][i - 1] += c[k] * Hraw[i][i - 1];
+        hi[i] -= c[k] * h[k];
+      }
+      Hraw[i][i - 1] *= s;
+      hi[i] /= s;
+
+      SU2_OMP_FOR_STAT(chunk)
+      for (auto iElm = 0ul; iElm < size; ++iElm) {
+        ScalarType v = W[i][iElm];
+        for (auto k = 0ul; k < i; ++k) v -= c[k] * W[k][iElm];
+        W[i][iElm] = v / s;
+      }
+      END_SU2_OMP_FOR
+
+      rotateColumn(i - 1);
     }
 
-    /*---  Modified Gram-Schmidt orthogonalization ---*/
+    /*--- Norm of the new vector after orthogonalization. ---*/
 
-    if (nestedParallel) {
-      /*--- "omp parallel if" does not work well here ---*/
-      SU2_OMP_PARALLEL
-      ModGramSchmidt(true, i, H, W);
-      END_SU2_OMP_PARALLEL
-    } else {
-      ModGramSchmidt(false, i, H, W);
+    ScalarType nrm = normAZ2;
+    for (auto k = 0ul; k <= i; ++k) nrm -= pow(hi[k], 2);
+    const bool explicitNorm = !(nrm > cancel * normAZ2);
+
+    if (explicitNorm) {
+      W[i + 1] = AZ[i];
+      for (auto k = 0ul; k <= i; ++k) W[i + 1] -= hi[k] * W[k];
+      nrm = W[i + 1].squaredNorm();
+
+      if (!(nrm > 0.0)) {
+        SU2_MPI::Error("FGMRES orthogonalization failed, linear solver diverged.", CURRENT_FUNCTION);
+      }
+    }
+    nrm = sqrt(nrm);
+
+    /*--- Since w_{i+1} = (A z_i - sum_k h_k w_k) / nrm, by linearity z_{i+1} and A z_{i+1} are the same
+     *    combinations of M A z_i and A M A z_i, and of the previous z_k and A z_k. This keeps A z_{i+1}
+     *    consistent with z_{i+1}, and the latter close to M w_{i+1}, which is enough for flexible GMRES. ---*/
+
+    SU2_OMP_FOR_STAT(chunk)
+    for (auto iElm = 0ul; iElm < size; ++iElm) {
+      ScalarType v = AZ[i][iElm], mv = Z[i + 1][iElm], amv = AZ[i + 1][iElm];
+      for (auto k = 0ul; k <= i; ++k) {
+        v -= hi[k] * W[k][iElm];
+        mv -= hi[k] * Z[k][iElm];
+        amv -= hi[k] * AZ[k][iElm];
+      }
+      W[i + 1][iElm] = (explicitNorm ? W[i + 1][iElm] : v) / nrm;
+      Z[i + 1][iElm] = mv / nrm;
+      AZ[i + 1][iElm] = amv / nrm;
     }
+    END_SU2_OMP_FOR
 
-    /*---  Apply old Givens rotations to new column of the Hessenberg matrix then generate the
-     new Givens rotation matrix and apply it to the last two elements of H[:][i] and g ---*/
+    /*--- New column of the Hessenberg matrix (w_{i+1} is corrected in the next iteration). ---*/
 
-    for (unsigned long k = 0; k < i; k++) ApplyGivens(sn[k], cs[k], H[k][i], H[k + 1][i]);
-    GenerateGivens(H[i][i], H[i + 1][i], sn[i], cs[i]);
-    ApplyGivens(sn[i], cs[i], g[i], g[i + 1]);
+    for (auto k = 0ul; k <= i; ++k) Hraw[k][i] = hi[k];
+    Hraw[i + 1][i] = nrm;
+    gRot[i] = g[i];
+    rotateColumn(i);
 
     /*---  Set L2 norm of residual and check if solution has converged ---*/
 
@@ -500,22 +1746,14 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
 
   SolveReduced(i, H, g, y);
 
-  const auto& basis = flexible ? Z : W;
-
-  if (nestedParallel) {
-    SU2_OMP_PARALLEL
-    for (unsigned long k = 0; k < i; k++) x += y[k] * basis[k];
-    END_SU2_OMP_PARALLEL
-  } else {
-    for (unsigned long k = 0; k < i; k++) x += y[k] * basis[k];
-  }
+  for (unsigned long k = 0; k < i; k++) x += y[k] * Z[k];
 
   /*---  Recalculate final (neg.) residual (this should be optional) ---*/
 
   if ((monitoring) && (config->GetComm_Level() == COMM_FULL)) {
     if (masterRank) {
       SU2_OMP_MASTER
-      WriteFinalResidual("FGMRES", i, beta / norm0);
+      WriteFinalResidual("Pipelined GMRES", i, beta / norm0);
       END_SU2_OMP_MASTER
     }
 
@@ -538,32 +1776,6 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
   return i;
 }
 
-template <class ScalarType>
-unsigned long CSysSolve<ScalarType>::RFGMRES_LinSolver(const CSysVector<ScalarType>& b, CSysVector<ScalarType>& x,
-                                                       const CMatrixVectorProduct<ScalarType>& mat_vec,
-                                                       const CPreconditioner<ScalarType>& precond, ScalarType tol,
-                                                       unsigned long MaxIter, ScalarType& residual, bool monitoring,
-                                                       const CConfig* config) {
-  const auto restartIter = config->GetLinear_Solver_Restart_Frequency();
-
-  SU2_OMP_MASTER {
-    xIsZero = false;
-    tol_type = LinearToleranceType::ABSOLUTE;
-  }
-  END_SU2_OMP_MASTER
-
-  const ScalarType norm0 = b.norm();  // <- Has a barrier
-
-  for (auto totalIter = 0ul; totalIter < MaxIter;) {
-    /*--- Enforce a hard limit on total number of iterations ---*/
-    auto iterLimit = min(restartIter, MaxIter - totalIter);
-    auto iter = FGMRES_LinSolver(b, x, mat_vec, precond, tol, iterLimit, residual, monitoring, config);
-    totalIter += iter;
-    if (residual <= tol * norm0 || iter < iterLimit) return totalIter;
-  }
-  return 0;
-}
-
 template <class ScalarType>
 unsigned long CSysSolve<ScalarType>::BCGSTAB_LinSolver(const CSysVector<ScalarType>& b, CSysVector<ScalarType>& x,
                                                        const CMatrixVectorProduct<ScalarType>& mat_vec,
@@ -863,24 +2075,8 @@ unsigned long CSysSolve<ScalarType>::Smoother_LinSolver(const CSysVector<ScalarT
 }
 
 template <class ScalarType>
-unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, const CSysVector<su2double>& LinSysRes,
-                                           CSysVector<su2double>& LinSysSol, CGeometry* geometry,
-                                           const CConfig* config) {
-  /*---
-   A word about the templated types. It is assumed that the residual and solution vectors are always of su2doubles,
-   meaning that they are active in the discrete adjoint. The same assumption is made in SetExternalSolve.
-   When the Jacobian is passive (and therefore not compatible with the vectors) we go through the "HandleTemporaries"
-   mechanisms. Note that CG, BCGSTAB, and FGMRES, all expect the vector to be compatible with the Product and
-   Preconditioner (and therefore with the Matrix). Likewise for Solve_b (which is used by CSysSolve_b).
-   There are no provisions here for active Matrix and passive Vectors as that makes no sense since we only handle the
-   derivatives of the residual in CSysSolve_b.
-  ---*/
-
-  unsigned short KindSolver, KindPrecond;
-  unsigned long MaxIter;
-  ScalarType SolverTol;
-  bool ScreenOutput;
-
+void CSysSolve<ScalarType>::GetSettings(const CConfig* config, unsigned short& KindSolver, unsigned short& KindPrecond,
+                                        unsigned long& MaxIter, ScalarType& SolverTol, bool& ScreenOutput) const {
   switch (lin_sol_mode) {
     /*--- Mesh Deformation mode ---*/
     case LINEAR_SOLVER_MODE::MESH_DEFORM: {
@@ -914,6 +2110,28 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
       break;
     }
   }
+}
+
+template <class ScalarType>
+unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, const CSysVector<su2double>& LinSysRes,
+                                           CSysVector<su2double>& LinSysSol, CGeometry* geometry,
+                                           const CConfig* config) {
+  /*---
+   A word about the templated types. It is assumed that the residual and solution vectors are always of su2doubles,
+   meaning that they are active in the discrete adjoint. The same assumption is made in SetExternalSolve.
+   When the Jacobian is passive (and therefore not compatible with the vectors) we go through the "HandleTemporaries"
+   mechanisms. Note that CG, BCGSTAB, and FGMRES, all expect the vector to be compatible with the Product and
+   Preconditioner (and therefore with the Matrix). Likewise for Solve_b (which is used by CSysSolve_b).
+   There are no provisions here for active Matrix and passive Vectors as that makes no sense since we only handle the
+   derivatives of the residual in CSysSolve_b.
+  ---*/
+
+  unsigned short KindSolver, KindPrecond;
+  unsigned long MaxIter;
+  ScalarType SolverTol;
+  bool ScreenOutput;
+
+  GetSettings(config, KindSolver, KindPrecond, MaxIter, SolverTol, ScreenOutput);
 
   /*--- Stop the recording for the linear solver ---*/
   bool TapeActive = NO;
@@ -952,9 +2170,10 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
 
     auto precond = CPreconditioner<ScalarType>::Create(kindPrec, Jacobian, geometry, config);
 
-    /*--- Build preconditioner. ---*/
+    /*--- Build preconditioner, and the copy of the matrix used in the products (if any). ---*/
 
     precond->Build();
+    Jacobian.BuildSlicedEllMatrix();
 
     /*--- Solve system. ---*/
 
@@ -973,10 +2192,22 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
         IterLinSol = RFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
                                        ScreenOutput, config);
         break;
+      case GCRODR:
+        IterLinSol = GCRODR_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
+                                      ScreenOutput, config, 0);
+        break;
       case CONJUGATE_GRADIENT:
         IterLinSol = CG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
                                   ScreenOutput, config);
         break;
+      case PIPELINED_CG:
+        IterLinSol = PipelinedCG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter,
+                                           residual, ScreenOutput, config);
+        break;
+      case PIPELINED_GMRES:
+        IterLinSol = PipelinedGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter,
+                                              residual, ScreenOutput, config);
+        break;
       case SMOOTHER:
         IterLinSol = Smoother_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
                                         ScreenOutput, config);
@@ -1022,6 +2253,9 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
         case ILU:
           if (RequiresTranspose) Jacobian.BuildILUPreconditioner();
           break;
+        case AMG:
+          if (RequiresTranspose) Jacobian.BuildAMGPreconditioner();
+          break;
         case JACOBI:
         case LINELET:
           if (RequiresTranspose) Jacobian.BuildJacobiPreconditioner();
@@ -1064,39 +2298,7 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType>& Jacobian, c
   ScalarType SolverTol;
   bool ScreenOutput;
 
-  switch (lin_sol_mode) {
-    /*--- Mesh Deformation mode ---*/
-    case LINEAR_SOLVER_MODE::MESH_DEFORM: {
-      KindSolver = config->GetKind_Deform_Linear_Solver();
-      KindPrecond = config->GetKind_Deform_Linear_Solver_Prec();
-      MaxIter = config->GetDeform_Linear_Solver_Iter();
-      SolverTol = SU2_TYPE::GetValue(config->GetDeform_Linear_Solver_Error());
-      ScreenOutput = config->GetDeform_Output();
-      break;
-    }
-
-    /*--- Gradient Smoothing mode ---*/
-    case LINEAR_SOLVER_MODE::GRADIENT_MODE: {
-      KindSolver = config->GetKind_Grad_Linear_Solver();
-      KindPrecond = config->GetKind_Grad_Linear_Solver_Prec();
-      MaxIter = config->GetGrad_Linear_Solver_Iter();
-      SolverTol = SU2_TYPE::GetValue(config->GetGrad_Linear_Solver_Error());
-      ScreenOutput = true;
-      break;
-    }
-
-    /*--- Normal mode
-     * assumes that 'lin_sol_mode==LINEAR_SOLVER_MODE::STANDARD', but does not enforce it to avoid compiler warning.
-     * ---*/
-    default: {
-      KindSolver = config->GetKind_Linear_Solver();
-      KindPrecond = config->GetKind_Linear_Solver_Prec();
-      MaxIter = config->GetLinear_Solver_Iter();
-      SolverTol = SU2_TYPE::GetValue(config->GetLinear_Solver_Error());
-      ScreenOutput = false;
-      break;
-    }
-  }
+  GetSettings(config, KindSolver, KindPrecond, MaxIter, SolverTol, ScreenOutput);
 
   /*--- Set up preconditioner and matrix-vector product ---*/
 
@@ -1110,6 +2312,9 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType>& Jacobian, c
     precond->Build();
   }
 
+  /*--- The matrix was transposed (here or at the end of Solve) after the copy used in the products was built. ---*/
+  Jacobian.BuildSlicedEllMatrix();
+
   auto mat_vec = CSysMatrixVectorProduct<ScalarType>(Jacobian, geometry, config);
 
   /*--- Solve the system ---*/
@@ -1128,6 +2333,10 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType>& Jacobian, c
       IterLinSol = RFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
                                      ScreenOutput, config);
       break;
+    case GCRODR:
+      IterLinSol = GCRODR_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
+                                    ScreenOutput, config, 1);
+      break;
     case BCGSTAB:
       IterLinSol = BCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
                                      ScreenOutput, config);
@@ -1136,6 +2345,14 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType>& Jacobian, c
       IterLinSol = CG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
                                 ScreenOutput, config);
       break;
+    case PIPELINED_CG:
+      IterLinSol = PipelinedCG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter,
+                                         residual, ScreenOutput, config);
+      break;
+    case PIPELINED_GMRES:
+      IterLinSol = PipelinedGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter,
+                                            residual, ScreenOutput, config);
+      break;
     case SMOOTHER:
       IterLinSol = Smoother_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
                                       ScreenOutput, config);
@@ -1165,6 +2382,61 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType>& Jacobian, c
   return IterLinSol;
 }
 
+template <class ScalarType>
+unsigned long CSysSolve<ScalarType>::SolveMultiRHS_b(CSysMatrix<ScalarType>& Jacobian,
+                                                     const CSysVector<su2double>& LinSysRes,
+                                                     CSysVector<su2double>& LinSysSol, unsigned long nRhs,
+                                                     CGeometry* geometry, const CConfig* config) {
+  unsigned short KindSolver, KindPrecond;
+  unsigned long MaxIter;
+  ScalarType SolverTol;
+  bool ScreenOutput;
+
+  GetSettings(config, KindSolver, KindPrecond, MaxIter, SolverTol, ScreenOutput);
+
+  /*--- Only these preconditioners support multi-vectors. ---*/
+  if (KindPrecond != JACOBI && KindPrecond != ILU) {
+    SU2_MPI::Error("Multiple right hand sides are only supported with the JACOBI and ILU preconditioners.",
+                   CURRENT_FUNCTION);
+  }
+
+  /*--- Set up the transposed system, preconditioner, and matrix-vector product. ---*/
+
+  Jacobian.TransposeInPlace();
+
+  const auto kindPrec = static_cast<ENUM_LINEAR_SOLVER_PREC>(KindPrecond);
+
+  auto precond = CPreconditioner<ScalarType>::Create(kindPrec, Jacobian, geometry, config);
+  precond->Build();
+
+  auto mat_vec = CSysMatrixVectorProduct<ScalarType>(Jacobian, geometry, config);
+
+  /*--- Solve the systems, any of the FGMRES-type solvers (the default for adjoints) maps to the batched one. ---*/
+
+  ScalarType residual = 0.0;
+
+  HandleTemporariesIn(LinSysRes, LinSysSol);
+
+  const auto IterLinSol = BatchedFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, nRhs, mat_vec, *precond, SolverTol,
+                                                  MaxIter, residual, ScreenOutput, config);
+
+  HandleTemporariesOut(LinSysSol);
+
+  delete precond;
+
+  /*--- Restore the matrix. ---*/
+
+  Jacobian.TransposeInPlace();
+
+  SU2_OMP_MASTER {
+    Residual = residual;
+    Iterations = IterLinSol;
+  }
+  END_SU2_OMP_MASTER
+
+  return IterLinSol;
+}
+
 /*--- Explicit instantiations ---*/
 
 #ifdef CODI_FORWARD_TYPE
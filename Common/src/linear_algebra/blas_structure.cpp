@@ -28,6 +28,7 @@
 
 #include "../../include/CConfig.hpp"
 #include "../../include/linear_algebra/blas_structure.hpp"
+#include "../../include/parallelization/vectorization.hpp"
 #include <cstring>
 
 /* MKL or BLAS, if supported. */
@@ -151,13 +152,82 @@ void CBlasStructure::gemm_imp(const int m, const int n, const int k, const su2do
   }
 }
 
+namespace {
+
+/* SIMD type used in the register blocked kernels. */
+using GemmVec = simd::Array<su2double>;
+
+/* Register blocked kernel, which adds the product of a (NV*GemmVec::Size x k) and
+   b (k x NR) to c. The rows of a and c, which are contiguous, are treated with
+   NV SIMD registers and the columns of b and c are unrolled NR times. */
+template <size_t NV, int NR>
+void gemm_micro(const int k, const su2double* a, const int lda, const su2double* b, const int ldb, su2double* c,
+                const int ldc) {
+  GemmVec acc[NR][NV];
+  for (int j = 0; j < NR; ++j)
+    for (size_t v = 0; v < NV; ++v) acc[j][v] = 0.0;
+
+  for (int p = 0; p < k; ++p) {
+    GemmVec av[NV];
+    for (size_t v = 0; v < NV; ++v) av[v].load(&A(v * GemmVec::Size, p));
+
+    for (int j = 0; j < NR; ++j) {
+      const GemmVec bv(B(p, j));
+      for (size_t v = 0; v < NV; ++v) acc[j][v] += av[v] * bv;
+    }
+  }
+
+  for (int j = 0; j < NR; ++j) {
+    for (size_t v = 0; v < NV; ++v) {
+      su2double* cP = &C(v * GemmVec::Size, j);
+      GemmVec cv(cP);
+      cv += acc[j][v];
+      cv.store(cP);
+    }
+  }
+}
+
+/* Apply the register blocked kernels to NR columns of c. Only the first
+   m rows are treated, m must be a multiple of the SIMD size. */
+template <int NR>
+void gemm_columns(const int m, const int k, const su2double* a, const int lda, const su2double* b, const int ldb,
+                  su2double* c, const int ldc) {
+  constexpr int vecLen = GemmVec::Size;
+  int i = 0;
+  for (; i + 2 * vecLen <= m; i += 2 * vecLen) gemm_micro<2, NR>(k, &A(i, 0), lda, b, ldb, &C(i, 0), ldc);
+  for (; i + vecLen <= m; i += vecLen) gemm_micro<1, NR>(k, &A(i, 0), lda, b, ldb, &C(i, 0), ldc);
+}
+
+}  // namespace
+
 /* Compute a portion of the c matrix one block at a time.
    Handle ragged edges with calls to a slow but general function. */
 void CBlasStructure::gemm_inner(int m, int n, int k, const su2double* a, int lda, const su2double* b, int ldb,
                                 su2double* c, int ldc) {
-  /* Carry out the multiplication for this block. At the
-     moment simply a call to gemm_arbitrary. */
-  gemm_arbitrary(m, n, k, a, lda, b, ldb, c, ldc);
+  /* The rows of a and c are contiguous in memory and are treated with SIMD
+     registers, while 4 columns of b and c are treated simultaneously. The
+     matrices in the DG solver are small, hence no packing is carried out. */
+  constexpr int nColUnroll = 4;
+  const int mSIMD = m - m % GemmVec::Size;
+
+  int j = 0;
+  for (; j + nColUnroll <= n; j += nColUnroll)
+    gemm_columns<nColUnroll>(mSIMD, k, a, lda, &B(0, j), ldb, &C(0, j), ldc);
+
+  switch (n - j) {
+    case 3:
+      gemm_columns<3>(mSIMD, k, a, lda, &B(0, j), ldb, &C(0, j), ldc);
+      break;
+    case 2:
+      gemm_columns<2>(mSIMD, k, a, lda, &B(0, j), ldb, &C(0, j), ldc);
+      break;
+    case 1:
+      gemm_columns<1>(mSIMD, k, a, lda, &B(0, j), ldb, &C(0, j), ldc);
+      break;
+  }
+
+  /* The remaining rows, which do not fill a SIMD register. */
+  if (mSIMD < m) gemm_arbitrary(m - mSIMD, n, k, &A(mSIMD, 0), lda, b, ldb, &C(mSIMD, 0), ldc);
 }
 
 /* Naive gemm implementation to handle arbitrary sized matrices. */
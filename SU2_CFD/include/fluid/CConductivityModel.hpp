@@ -28,6 +28,7 @@
 #pragma once
 
 #include "../../../Common/include/basic_types/datatype_structure.hpp"
+#include "CFluidStateBatch.hpp"
 
 using namespace std;
 
@@ -64,6 +65,20 @@ class CConductivityModel {
   virtual void SetConductivity(su2double t, su2double rho, su2double mu_lam, su2double mu_turb, su2double cp,
                                su2double dmudrho_t, su2double dmudt_rho) = 0;
 
+  /*!
+   * \brief Set the conductivity (and its derivatives) of a batch of points, the viscosity must be set first.
+   * \note The default implementation evaluates the points one by one, the state of the model is not defined after.
+   */
+  virtual void SetConductivityBatch(CFluidStateBatch& batch) {
+    for (size_t i = 0; i < batch.size; ++i) {
+      SetConductivity(batch.Temperature[i], batch.Density[i], batch.Mu[i], batch.Mu_Turb[i], batch.Cp[i],
+                      batch.dmudrho_T[i], batch.dmudT_rho[i]);
+      batch.Kt[i] = kt_;
+      batch.dktdrho_T[i] = dktdrho_t_;
+      batch.dktdT_rho[i] = dktdt_rho_;
+    }
+  }
+
  protected:
   su2double kt_{0.0};        /*!< \brief Thermal conductivity. */
   su2double dktdrho_t_{0.0}; /*!< \brief DktDrho_T. */
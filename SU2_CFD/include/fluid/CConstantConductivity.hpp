@@ -47,4 +47,15 @@ class CConstantConductivity final : public CConductivityModel {
    * \brief Set thermal conductivity.
    */
   void SetConductivity(su2double, su2double, su2double, su2double, su2double, su2double, su2double) override {}
+
+  /*!
+   * \brief Set thermal conductivity of a batch of points.
+   */
+  void SetConductivityBatch(CFluidStateBatch& batch) override {
+    for (size_t i = 0; i < batch.size; ++i) {
+      batch.Kt[i] = kt_;
+      batch.dktdrho_T[i] = 0.0;
+      batch.dktdT_rho[i] = 0.0;
+    }
+  }
 };
@@ -52,6 +52,18 @@ class CConstantConductivityRANS final : public CConductivityModel {
     kt_ = kt_lam_const_ + cp * mu_turb / pr_turb_;
   }
 
+  /*!
+   * \brief Set thermal conductivity of a batch of points.
+   */
+  void SetConductivityBatch(CFluidStateBatch& batch) override {
+    SU2_OMP_SIMD_IF_NOT_AD
+    for (size_t i = 0; i < batch.size; ++i) {
+      batch.Kt[i] = kt_lam_const_ + batch.Cp[i] * batch.Mu_Turb[i] / pr_turb_;
+      batch.dktdrho_T[i] = dktdrho_t_;
+      batch.dktdT_rho[i] = dktdt_rho_;
+    }
+  }
+
  private:
   const su2double kt_lam_const_{0.0}; /*!< \brief Constant laminar conductivity. */
   const su2double pr_turb_{0.0};      /*!< \brief Turbulent Prandtl number. */
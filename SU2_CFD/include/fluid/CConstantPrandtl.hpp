@@ -51,6 +51,18 @@ class CConstantPrandtl final : public CConductivityModel {
     dktdt_rho_ = dmudt_rho * cp / pr_lam_;
   }
 
+  /*!
+   * \brief Set thermal conductivity of a batch of points.
+   */
+  void SetConductivityBatch(CFluidStateBatch& batch) override {
+    SU2_OMP_SIMD_IF_NOT_AD
+    for (size_t i = 0; i < batch.size; ++i) {
+      batch.Kt[i] = batch.Mu[i] * batch.Cp[i] / pr_lam_;
+      batch.dktdrho_T[i] = batch.dmudrho_T[i] * batch.Cp[i] / pr_lam_;
+      batch.dktdT_rho[i] = batch.dmudT_rho[i] * batch.Cp[i] / pr_lam_;
+    }
+  }
+
  private:
   const su2double pr_lam_{0.0};    /*!< \brief Laminar Prandtl number. */
 };
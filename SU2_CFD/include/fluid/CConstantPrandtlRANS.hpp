@@ -49,6 +49,18 @@ class CConstantPrandtlRANS final : public CConductivityModel {
     kt_ = cp * ((mu_lam / pr_lam_) + (mu_turb / pr_turb_));
   }
 
+  /*!
+   * \brief Set thermal conductivity of a batch of points.
+   */
+  void SetConductivityBatch(CFluidStateBatch& batch) override {
+    SU2_OMP_SIMD_IF_NOT_AD
+    for (size_t i = 0; i < batch.size; ++i) {
+      batch.Kt[i] = batch.Cp[i] * ((batch.Mu[i] / pr_lam_) + (batch.Mu_Turb[i] / pr_turb_));
+      batch.dktdrho_T[i] = dktdrho_t_;
+      batch.dktdT_rho[i] = dktdt_rho_;
+    }
+  }
+
  private:
   const su2double pr_lam_{0.0};    /*!< \brief Laminar Prandtl number. */
   const su2double pr_turb_{0.0};   /*!< \brief Turbulent Prandtl number. */
@@ -47,4 +47,15 @@ class CConstantViscosity final : public CViscosityModel {
    * \brief Set Viscosity.
    */
   void SetViscosity(su2double t, su2double rho) override {}
+
+  /*!
+   * \brief Set Viscosity of a batch of points.
+   */
+  void SetViscosityBatch(CFluidStateBatch& batch) override {
+    for (size_t i = 0; i < batch.size; ++i) {
+      batch.Mu[i] = mu_;
+      batch.dmudrho_T[i] = 0.0;
+      batch.dmudT_rho[i] = 0.0;
+    }
+  }
 };
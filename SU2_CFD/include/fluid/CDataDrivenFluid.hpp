@@ -77,6 +77,17 @@ class CDataDrivenFluid final : public CFluidModel {
       d2sdedrho,      /*!< \brief Entropy second derivative w.r.t. density and static energy. */
       d2sdrho2;       /*!< \brief Entropy second derivative w.r.t. static density. */
 
+  /*!
+   * \brief Inputs and entropy derivatives of a batch of points, work space of SetTDStateBatch_rhoe
+   *        (the fluid model is local to each thread).
+   */
+  struct {
+    su2double rho[CFluidStateBatch::MaxSize], e[CFluidStateBatch::MaxSize];
+    su2double dsde_rho[CFluidStateBatch::MaxSize], dsdrho_e[CFluidStateBatch::MaxSize];
+    su2double d2sde2[CFluidStateBatch::MaxSize], d2sdedrho[CFluidStateBatch::MaxSize];
+    su2double d2sdrho2[CFluidStateBatch::MaxSize];
+  } BatchWork;
+
   su2double R_idealgas,     /*!< \brief Approximated ideal gas constant. */
             Cp_idealgas,    /*!< \brief Approximated ideal gas specific heat at constant pressure. */
             gamma_idealgas, /*!< \brief Approximated ideal gas specific heat ratio. */
@@ -185,6 +196,13 @@ class CDataDrivenFluid final : public CFluidModel {
    */
   void SetTDState_rhoe(su2double rho, su2double e) override;
 
+  /*!
+   * \brief Set the thermodynamic state of a batch of points. The data set is queried for all
+   *        points first, the thermodynamic relations are then evaluated in a vectorized loop.
+   * \param[in,out] batch - Density and StaticEnergy in, thermodynamic state out.
+   */
+  void SetTDStateBatch_rhoe(CFluidStateBatch& batch) override;
+
   /*!
    * \brief Set the Dimensionless State using Pressure  and Temperature.
    * \param[in] P - first thermodynamic variable (pressure).
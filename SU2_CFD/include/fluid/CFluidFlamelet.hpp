@@ -82,6 +82,7 @@ class CFluidFlamelet final : public CFluidModel {
 #endif
 
   vector<su2double> scalars_vector;
+  vector<su2double*> refs_vars; /*!< \brief Pointers to the outputs of a MLP look-up (reused between calls). */
 
   vector<string> varnames_TD, /*!< \brief Lookup names for thermodynamic state variables. */
       varnames_Sources,       /*!< \brief Lookup names for source terms. */
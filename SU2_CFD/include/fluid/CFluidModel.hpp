@@ -35,6 +35,7 @@
 #include "CConductivityModel.hpp"
 #include "CViscosityModel.hpp"
 #include "CDiffusivityModel.hpp"
+#include "CFluidStateBatch.hpp"
 
 using namespace std;
 
@@ -274,6 +275,37 @@ class CFluidModel {
    */
   virtual void SetTDState_rhoe(su2double rho, su2double e) {}
 
+  /*!
+   * \brief Set the thermodynamic state of a batch of points from their density and internal energy.
+   * \note The default implementation calls SetTDState_rhoe point by point, the vectorized
+   *       overrides do not modify the (point-wise) state of the model.
+   * \param[in,out] batch - Density and StaticEnergy in, thermodynamic state out.
+   */
+  virtual void SetTDStateBatch_rhoe(CFluidStateBatch& batch);
+
+  /*!
+   * \brief Set the laminar viscosity and thermal conductivity of a batch of points (after SetTDStateBatch_rhoe).
+   * \note Models that override GetLaminarViscosity or GetThermalConductivity do not support this yet.
+   * \param[in,out] batch - Thermodynamic state in, transport properties out.
+   */
+  void SetTransportPropertiesBatch(CFluidStateBatch& batch);
+
+  /*!
+   * \brief Copy the current (point-wise) thermodynamic state of the model to position i of a batch.
+   */
+  void CopyTDStateToBatch(size_t i, CFluidStateBatch& batch) const {
+    batch.Pressure[i] = Pressure;
+    batch.Temperature[i] = Temperature;
+    batch.SoundSpeed2[i] = SoundSpeed2;
+    batch.dPdrho_e[i] = dPdrho_e;
+    batch.dPde_rho[i] = dPde_rho;
+    batch.dTdrho_e[i] = dTdrho_e;
+    batch.dTde_rho[i] = dTde_rho;
+    batch.Cp[i] = Cp;
+    batch.Entropy[i] = Entropy;
+    batch.Extrapolation[i] = GetExtrapolation();
+  }
+
   /*!
    * \brief virtual member that would be different for each gas model implemented
    * \param[in] InputSpec - Input pair for FLP calls ("PT").
@@ -0,0 +1,65 @@
+/*!
+ * \file CFluidStateBatch.hpp
+ * \brief Storage for the thermodynamic and transport properties of a batch of points.
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../../Common/include/basic_types/datatype_structure.hpp"
+#include "../../../Common/include/parallelization/omp_structure.hpp"
+
+/*!
+ * \struct CFluidStateBatch
+ * \brief Thermodynamic and transport properties of a batch of points, stored as a structure
+ *        of arrays for the batched (vectorizable) interface of CFluidModel.
+ * \note The inputs are Density and StaticEnergy, the outputs have the same meaning as
+ *       the homonymous members of CFluidModel.
+ */
+struct CFluidStateBatch {
+  static constexpr size_t MaxSize = 64;  /*!< \brief Maximum number of points in a batch. */
+
+  size_t size = 0;                   /*!< \brief Number of points in the batch. */
+
+  su2double Density[MaxSize];        /*!< \brief Density (input). */
+  su2double StaticEnergy[MaxSize];   /*!< \brief Internal energy (input). */
+  su2double Mu_Turb[MaxSize];        /*!< \brief Eddy viscosity seen by the conductivity model (set by CFluidModel). */
+
+  su2double Pressure[MaxSize];       /*!< \brief Pressure. */
+  su2double Temperature[MaxSize];    /*!< \brief Temperature. */
+  su2double SoundSpeed2[MaxSize];    /*!< \brief Square of the speed of sound. */
+  su2double dPdrho_e[MaxSize];       /*!< \brief DpDd_e. */
+  su2double dPde_rho[MaxSize];       /*!< \brief DpDe_d. */
+  su2double dTdrho_e[MaxSize];       /*!< \brief DTDd_e. */
+  su2double dTde_rho[MaxSize];       /*!< \brief DTDe_d. */
+  su2double Cp[MaxSize];             /*!< \brief Specific heat capacity at constant pressure. */
+  su2double Entropy[MaxSize];        /*!< \brief Entropy (only required from data-driven models). */
+  unsigned long Extrapolation[MaxSize]; /*!< \brief Point outside the data set (only for data-driven models). */
+
+  su2double Mu[MaxSize];             /*!< \brief Laminar viscosity. */
+  su2double dmudrho_T[MaxSize];      /*!< \brief Partial derivative of viscosity w.r.t. density. */
+  su2double dmudT_rho[MaxSize];      /*!< \brief Partial derivative of viscosity w.r.t. temperature. */
+  su2double Kt[MaxSize];             /*!< \brief Thermal conductivity. */
+  su2double dktdrho_T[MaxSize];      /*!< \brief Partial derivative of conductivity w.r.t. density. */
+  su2double dktdT_rho[MaxSize];      /*!< \brief Partial derivative of conductivity w.r.t. temperature. */
+};
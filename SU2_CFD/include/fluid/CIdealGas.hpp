@@ -54,6 +54,12 @@ class CIdealGas : public CFluidModel {
    */
   void SetTDState_rhoe(su2double rho, su2double e) override;
 
+  /*!
+   * \brief Vectorized version of SetTDState_rhoe for a batch of points.
+   * \param[in,out] batch - Density and StaticEnergy in, thermodynamic state out.
+   */
+  void SetTDStateBatch_rhoe(CFluidStateBatch& batch) override;
+
   /*!
    * \brief Set the Dimensionless State using Pressure  and Temperature
    * \param[in] P - first thermodynamic variable.
@@ -55,6 +55,22 @@ class CSutherland final : public CViscosityModel {
     dmudt_rho_ = mu_ref_ * (t_ref_ + s_) * ts_inv * sqrt(t_nondim) * (1.5 * t_ref_inv - t_nondim * ts_inv);
   }
 
+  /*!
+   * \brief Set Viscosity of a batch of points.
+   */
+  void SetViscosityBatch(CFluidStateBatch& batch) override {
+    const su2double t_ref_inv = 1.0 / t_ref_;
+    SU2_OMP_SIMD_IF_NOT_AD
+    for (size_t i = 0; i < batch.size; ++i) {
+      const su2double t = batch.Temperature[i];
+      const su2double t_nondim = t_ref_inv * t;
+      const su2double ts_inv = 1.0 / (t + s_);
+      batch.Mu[i] = mu_ref_ * t_nondim * sqrt(t_nondim) * (t_ref_ + s_) * ts_inv;
+      batch.dmudrho_T[i] = 0.0;
+      batch.dmudT_rho[i] = mu_ref_ * (t_ref_ + s_) * ts_inv * sqrt(t_nondim) * (1.5 * t_ref_inv - t_nondim * ts_inv);
+    }
+  }
+
  private:
   const su2double mu_ref_{0.0};    /*!< \brief Internal Energy. */
   const su2double t_ref_{0.0};     /*!< \brief DpDd_e. */
@@ -28,6 +28,7 @@
 #pragma once
 
 #include "../../../Common/include/basic_types/datatype_structure.hpp"
+#include "CFluidStateBatch.hpp"
 
 using namespace std;
 
@@ -63,6 +64,19 @@ class CViscosityModel {
    */
   virtual void SetViscosity(su2double t, su2double rho) = 0;
 
+  /*!
+   * \brief Set the viscosity (and its derivatives) of a batch of points from their temperature and density.
+   * \note The default implementation evaluates the points one by one, the state of the model is not defined after.
+   */
+  virtual void SetViscosityBatch(CFluidStateBatch& batch) {
+    for (size_t i = 0; i < batch.size; ++i) {
+      SetViscosity(batch.Temperature[i], batch.Density[i]);
+      batch.Mu[i] = mu_;
+      batch.dmudrho_T[i] = dmudrho_t_;
+      batch.dmudT_rho[i] = dmudt_rho_;
+    }
+  }
+
  protected:
   su2double mu_{0.0};        /*!< \brief Dynamic viscosity. */
   su2double dmudrho_t_{0.0}; /*!< \brief DmuDrho_T. */
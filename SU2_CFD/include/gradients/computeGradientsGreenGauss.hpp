@@ -56,11 +56,14 @@ namespace detail {
  * \param[in] varEnd - Index of last variable for which to compute the gradient.
  * \param[in] idxVel - Index of velocity, or -1 if no velocity present.
  * \param[out] gradient - Generic object implementing operator (iPoint, iVar, iDim).
+ * \param[in] overlapComms - Leave the MPI comms of the gradient in flight, the caller
+ *            must then complete them via CGeometry::CompletePendingComms.
  */
 template <size_t nDim, class FieldType, class GradientType>
 void computeGradientsGreenGauss(CSolver* solver, MPI_QUANTITIES kindMpiComm, PERIODIC_QUANTITIES kindPeriodicComm,
                                 CGeometry& geometry, const CConfig& config, const FieldType& field,
-                                const size_t varBegin, const size_t varEnd, const int idxVel, GradientType& gradient) {
+                                const size_t varBegin, const size_t varEnd, const int idxVel, GradientType& gradient,
+                                bool overlapComms = false) {
   const size_t nPointDomain = geometry.GetnPointDomain();
 
 #ifdef HAVE_OMP
@@ -176,8 +179,12 @@ void computeGradientsGreenGauss(CSolver* solver, MPI_QUANTITIES kindMpiComm, PER
 
   /*--- Obtain the gradients at halo points from the MPI ranks that own them. ---*/
 
-  solver->InitiateComms(&geometry, &config, kindMpiComm);
-  solver->CompleteComms(&geometry, &config, kindMpiComm);
+  if (overlapComms) {
+    solver->InitiateOverlappedComms(&geometry, &config, kindMpiComm);
+  } else {
+    solver->InitiateComms(&geometry, &config, kindMpiComm);
+    solver->CompleteComms(&geometry, &config, kindMpiComm);
+  }
 }
 }  // namespace detail
 
@@ -190,15 +197,16 @@ void computeGradientsGreenGauss(CSolver* solver, MPI_QUANTITIES kindMpiComm, PER
 template <class FieldType, class GradientType>
 void computeGradientsGreenGauss(CSolver* solver, MPI_QUANTITIES kindMpiComm, PERIODIC_QUANTITIES kindPeriodicComm,
                                 CGeometry& geometry, const CConfig& config, const FieldType& field,
-                                const size_t varBegin, const size_t varEnd, const int idxVel, GradientType& gradient) {
+                                const size_t varBegin, const size_t varEnd, const int idxVel, GradientType& gradient,
+                                bool overlapComms = false) {
   switch (geometry.GetnDim()) {
     case 2:
       detail::computeGradientsGreenGauss<2>(solver, kindMpiComm, kindPeriodicComm, geometry, config, field, varBegin,
-                                            varEnd, idxVel, gradient);
+                                            varEnd, idxVel, gradient, overlapComms);
       break;
     case 3:
       detail::computeGradientsGreenGauss<3>(solver, kindMpiComm, kindPeriodicComm, geometry, config, field, varBegin,
-                                            varEnd, idxVel, gradient);
+                                            varEnd, idxVel, gradient, overlapComms);
       break;
     default:
       SU2_MPI::Error("Too many dimensions to compute gradients.", CURRENT_FUNCTION);
@@ -67,32 +67,20 @@ FORCEINLINE void computeSmatrix(su2double r11, su2double r12, su2double r13,
 }
 
 /*!
- * \brief Solve the least-squares problem for one point.
+ * \brief Compute S := inv(R)*transpose(inv(R)) from the sums of the normal equations.
  * \ingroup FvmAlgos
- * \note See detail::computeGradientsLeastSquares for the
- *       purpose of template "nDim" and "periodic".
+ * \note Only the upper triangle of R is used, plus R(2,1) in 3D (see computeGradientsLeastSquares).
  */
-template<size_t nDim, bool periodic, class GradientType, class RMatrixType>
-FORCEINLINE void solveLeastSquares(size_t iPoint,
-                                   size_t varBegin,
-                                   size_t varEnd,
-                                   const RMatrixType& Rmatrix,
-                                   GradientType& gradient)
-{
+template<size_t nDim>
+FORCEINLINE void computeSmatrix(const su2double Rmatrix[][nDim], su2double Smatrix[][nDim]) {
+
   const auto eps = pow(std::numeric_limits<passivedouble>::epsilon(),2);
 
   /*--- Entries of upper triangular matrix R. ---*/
 
-  if (periodic) {
-    AD::StartPreacc();
-    AD::SetPreaccIn(Rmatrix(iPoint,0,0));
-    AD::SetPreaccIn(Rmatrix(iPoint,0,1));
-    AD::SetPreaccIn(Rmatrix(iPoint,1,1));
-  }
-
-  su2double r11 = Rmatrix(iPoint,0,0);
-  su2double r12 = Rmatrix(iPoint,0,1);
-  su2double r22 = Rmatrix(iPoint,1,1);
+  su2double r11 = Rmatrix[0][0];
+  su2double r12 = Rmatrix[0][1];
+  su2double r22 = Rmatrix[1][1];
   su2double r13 = 0.0, r23 = 0.0, r33 = 1.0;
 
   r11 = sqrt(max(r11, eps));
@@ -100,17 +88,10 @@ FORCEINLINE void solveLeastSquares(size_t iPoint,
   r22 = sqrt(max(r22 - r12*r12, eps));
 
   if (nDim == 3) {
-    if (periodic) {
-      AD::SetPreaccIn(Rmatrix(iPoint,0,2));
-      AD::SetPreaccIn(Rmatrix(iPoint,1,2));
-      AD::SetPreaccIn(Rmatrix(iPoint,2,1));
-      AD::SetPreaccIn(Rmatrix(iPoint,2,2));
-    }
-
-    r13 = Rmatrix(iPoint,0,2);
-    r33 = Rmatrix(iPoint,2,2);
-    const auto r23_a = Rmatrix(iPoint,1,2);
-    const auto r23_b = Rmatrix(iPoint,2,1);
+    r13 = Rmatrix[0][nDim-1];
+    r33 = Rmatrix[nDim-1][nDim-1];
+    const auto r23_a = Rmatrix[1][nDim-1];
+    const auto r23_b = Rmatrix[nDim-1][1];
 
     r13 /= r11;
     r23 = r23_a/r22 - r23_b*r12/(r11*r22);
@@ -121,15 +102,41 @@ FORCEINLINE void solveLeastSquares(size_t iPoint,
 
   const su2double detR2 = pow(r11*r22*r33, 2);
 
-  /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
-
-  su2double Smatrix[nDim][nDim] = {{0.0}};
-
   /*--- Detect singular matrix ---*/
 
+  for (size_t iDim = 0; iDim < nDim; ++iDim)
+    for (size_t jDim = 0; jDim < nDim; ++jDim)
+      Smatrix[iDim][jDim] = 0.0;
+
   if (detR2 > eps) {
     computeSmatrix(r11, r12, r13, r22, r23, r33, detR2, Smatrix);
   }
+}
+
+/*!
+ * \brief Solve the least-squares problem for one point.
+ * \ingroup FvmAlgos
+ * \note See detail::computeGradientsLeastSquares for the
+ *       purpose of template "nDim" and "periodic".
+ */
+template<size_t nDim, bool periodic, class GradientType>
+FORCEINLINE void solveLeastSquares(size_t iPoint,
+                                   size_t varBegin,
+                                   size_t varEnd,
+                                   const su2double Rmatrix[][nDim],
+                                   GradientType& gradient)
+{
+  if (periodic) {
+    AD::StartPreacc();
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      for (size_t jDim = 0; jDim < nDim; ++jDim)
+        AD::SetPreaccIn(Rmatrix[iDim][jDim]);
+  }
+
+  /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
+
+  su2double Smatrix[nDim][nDim];
+  computeSmatrix<nDim>(Rmatrix, Smatrix);
 
   if (periodic) {
     /*--- Stop preacc here as gradient is in/out. ---*/
@@ -162,6 +169,111 @@ FORCEINLINE void solveLeastSquares(size_t iPoint,
   }
 }
 
+/*!
+ * \brief Accumulate the entries of the upper triangular matrix R for one neighbor.
+ * \ingroup FvmAlgos
+ * \param[in] coord_i, coord_j - Coordinates of the point and of the neighbor.
+ * \param[in] weighted - Use inverse-distance weights.
+ * \param[out] dist_ij - Distance vector from i to j.
+ * \param[in,out] Rmatrix - Sums of the normal equations.
+ * \return Weight of the neighbor, 0 if it coincides with the point.
+ */
+template<size_t nDim>
+FORCEINLINE su2double accumulateRmatrix(const su2double* coord_i, const su2double* coord_j, bool weighted,
+                                        su2double* dist_ij, su2double Rmatrix[][nDim]) {
+
+  GeometryToolbox::Distance(nDim, coord_j, coord_i, dist_ij);
+
+  /*--- Compute inverse weight, default 1 (unweighted). ---*/
+
+  su2double weight = 1.0;
+  if(weighted) weight = GeometryToolbox::SquaredNorm(nDim, dist_ij);
+
+  if (weight <= 0.0) return 0.0;
+
+  weight = 1.0 / weight;
+
+  for (size_t iDim = 0; iDim < nDim; ++iDim)
+    for (size_t jDim = iDim; jDim < nDim; ++jDim)
+      Rmatrix[iDim][jDim] += dist_ij[iDim]*dist_ij[jDim]*weight;
+
+  if (nDim == 3)
+    Rmatrix[nDim-1][1] += dist_ij[0]*dist_ij[nDim-1]*weight;
+
+  return weight;
+}
+
+/*!
+ * \brief Get the least-squares coefficients of the geometry, computing them if needed.
+ * \ingroup FvmAlgos
+ * \note The coefficients only depend on the coordinates, they are computed once and reused
+ *       by all fields (and solvers) until the grid moves (see CGeometry::SetControlVolume).
+ *       The gradient of iPoint is then a weighted sum of differences with its neighbors.
+ * \param[in] geometry - Geometric grid properties.
+ * \param[in] weighted - Use inverse-distance weights.
+ * \return Coefficients for each neighbor (in the order of CPoint::GetPoints) of the domain points.
+ */
+template<size_t nDim>
+const su2activematrix& leastSquaresCoefficients(CGeometry& geometry, bool weighted)
+{
+  auto& coeffs = geometry.GetLeastSquaresCoefficients(weighted);
+
+  /*--- All threads see the same state since changes are only made in "safe global access" regions. ---*/
+  if (!coeffs.empty()) return coeffs;
+
+  const auto& points = geometry.nodes->GetPoints();
+  const size_t nPointDomain = geometry.GetnPointDomain();
+
+#ifdef HAVE_OMP
+  constexpr size_t OMP_MAX_CHUNK = 512;
+
+  size_t chunkSize = computeStaticChunkSize(nPointDomain,
+                     omp_get_max_threads(), OMP_MAX_CHUNK);
+#endif
+
+  SU2_OMP_SAFE_GLOBAL_ACCESS(coeffs.resize(points.getNumNonZeros(), nDim) = su2double(0.0);)
+
+  SU2_OMP_FOR_DYN(chunkSize)
+  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+  {
+    const auto coord_i = geometry.nodes->GetCoord(iPoint);
+    const auto begin = points.outerPtr()[iPoint];
+    const auto end = points.outerPtr()[iPoint+1];
+
+    su2double Rmatrix[nDim][nDim] = {{0.0}};
+    su2double Smatrix[nDim][nDim];
+
+    /*--- Temporarily store the weighted distance vectors in the coefficients. ---*/
+
+    for (auto k = begin; k < end; ++k) {
+      su2double dist_ij[nDim] = {0.0};
+      const auto coord_j = geometry.nodes->GetCoord(points.innerIdx()[k]);
+      const su2double weight = accumulateRmatrix<nDim>(coord_i, coord_j, weighted, dist_ij, Rmatrix);
+
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        coeffs(k, iDim) = weight * dist_ij[iDim];
+    }
+
+    computeSmatrix<nDim>(Rmatrix, Smatrix);
+
+    /*--- Coefficients := S * weight * dist_ij ---*/
+
+    for (auto k = begin; k < end; ++k) {
+      su2double Cvector[nDim] = {0.0};
+
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        for (size_t jDim = 0; jDim < nDim; ++jDim)
+          Cvector[iDim] += Smatrix[min(iDim,jDim)][max(iDim,jDim)] * coeffs(k, jDim);
+
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        coeffs(k, iDim) = Cvector[iDim];
+    }
+  }
+  END_SU2_OMP_FOR
+
+  return coeffs;
+}
+
 /*!
  * \brief Compute the gradient of a field using inverse-distance-weighted or
  *        unweighted Least-Squares approximation.
@@ -178,7 +290,9 @@ FORCEINLINE void solveLeastSquares(size_t iPoint,
  * \param[in] varEnd - Index of last variable for which to compute the gradient.
  * \param[in] idxVel - Index to velocity, -1 if no velocity is present in the solver.
  * \param[out] gradient - Generic object implementing operator (iPoint, iVar, iDim).
- * \param[out] Rmatrix - Generic object implementing operator (iPoint, iDim, iDim).
+ * \param[out] Rmatrix - Generic object implementing operator (iPoint, iDim, iDim), only used with periodic comms.
+ * \param[in] overlapComms - Leave the MPI comms of the gradient in flight, the caller
+ *            must then complete them via CGeometry::CompletePendingComms.
  */
 template<size_t nDim, class FieldType, class GradientType, class RMatrixType>
 void computeGradientsLeastSquares(CSolver* solver,
@@ -192,7 +306,8 @@ void computeGradientsLeastSquares(CSolver* solver,
                                   const size_t varEnd,
                                   const int idxVel,
                                   GradientType& gradient,
-                                  RMatrixType& Rmatrix)
+                                  RMatrixType& Rmatrix,
+                                  bool overlapComms = false)
 {
   const bool periodic = (solver != nullptr) && (config.GetnMarker_Periodic() > 0);
 
@@ -205,97 +320,114 @@ void computeGradientsLeastSquares(CSolver* solver,
                      omp_get_max_threads(), OMP_MAX_CHUNK);
 #endif
 
-  /*--- First loop over non-halo points of the grid. ---*/
+#ifndef CODI_REVERSE_TYPE
+  /*--- Without periodic comms the geometric part of the problem can be reused, this is
+   *    not done for reverse AD as the coefficients would need to be recorded each time. ---*/
 
-  SU2_OMP_FOR_DYN(chunkSize)
-  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+  if (!periodic)
   {
-    auto nodes = geometry.nodes;
-    const auto coord_i = nodes->GetCoord(iPoint);
+    const auto& coeffs = leastSquaresCoefficients<nDim>(geometry, weighted);
+    const auto& points = geometry.nodes->GetPoints();
 
-    /*--- Cannot preaccumulate if hybrid parallel due to shared reading. ---*/
-    if (omp_get_num_threads() == 1) AD::StartPreacc();
-    AD::SetPreaccIn(coord_i, nDim);
-
-    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
-      AD::SetPreaccIn(field(iPoint,iVar));
-
-    /*--- Clear gradient and Rmatrix. ---*/
+    SU2_OMP_FOR_DYN(chunkSize)
+    for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+    {
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          gradient(iPoint, iVar, iDim) = 0.0;
 
-    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
-      for (size_t iDim = 0; iDim < nDim; ++iDim)
-        gradient(iPoint, iVar, iDim) = 0.0;
+      for (auto k = points.outerPtr()[iPoint]; k < points.outerPtr()[iPoint+1]; ++k)
+      {
+        const auto jPoint = points.innerIdx()[k];
 
-    for (size_t iDim = 0; iDim < nDim; ++iDim)
-      for (size_t jDim = 0; jDim < nDim; ++jDim)
-        Rmatrix(iPoint, iDim, jDim) = 0.0;
+        for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        {
+          const su2double delta_ij = field(jPoint,iVar) - field(iPoint,iVar);
 
+          for (size_t iDim = 0; iDim < nDim; ++iDim)
+            gradient(iPoint, iVar, iDim) += coeffs(k, iDim) * delta_ij;
+        }
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+  else
+#endif
+  {
+    /*--- First loop over non-halo points of the grid. ---*/
 
-    for (auto jPoint : nodes->GetPoints(iPoint))
+    SU2_OMP_FOR_DYN(chunkSize)
+    for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
     {
-      const auto coord_j = geometry.nodes->GetCoord(jPoint);
-      AD::SetPreaccIn(coord_j, nDim);
-
+      auto nodes = geometry.nodes;
+      const auto coord_i = nodes->GetCoord(iPoint);
 
-      /*--- Distance vector from iPoint to jPoint ---*/
-
-      su2double dist_ij[nDim] = {0.0};
-      GeometryToolbox::Distance(nDim, coord_j, coord_i, dist_ij);
+      /*--- Cannot preaccumulate if hybrid parallel due to shared reading. ---*/
+      if (omp_get_num_threads() == 1) AD::StartPreacc();
+      AD::SetPreaccIn(coord_i, nDim);
 
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        AD::SetPreaccIn(field(iPoint,iVar));
 
-      /*--- Compute inverse weight, default 1 (unweighted). ---*/
+      /*--- Clear gradient and R (only stored for periodic comms). ---*/
 
-      su2double weight = 1.0;
-      if(weighted) weight = GeometryToolbox::SquaredNorm(nDim, dist_ij);
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          gradient(iPoint, iVar, iDim) = 0.0;
 
-      /*--- Summations for entries of upper triangular matrix R. ---*/
+      su2double Rlocal[nDim][nDim] = {{0.0}};
 
-      if (weight > 0.0)
+      for (auto jPoint : nodes->GetPoints(iPoint))
       {
-        weight = 1.0 / weight;
+        const auto coord_j = geometry.nodes->GetCoord(jPoint);
+        AD::SetPreaccIn(coord_j, nDim);
 
-        for (size_t iDim = 0; iDim < nDim; ++iDim)
-          for (size_t jDim = iDim; jDim < nDim; ++jDim)
-            Rmatrix(iPoint,iDim,jDim) += dist_ij[iDim]*dist_ij[jDim]*weight;
+        /*--- Distance vector from iPoint to jPoint and summations for entries of R. ---*/
 
-        if (nDim == 3)
-          Rmatrix(iPoint,2,1) += dist_ij[0]*dist_ij[nDim-1]*weight;
+        su2double dist_ij[nDim] = {0.0};
+        const su2double weight = accumulateRmatrix<nDim>(coord_i, coord_j, weighted, dist_ij, Rlocal);
 
-        /*--- Entries of c:= transpose(A)*b ---*/
-
-        for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        if (weight > 0.0)
         {
-          AD::SetPreaccIn(field(jPoint,iVar));
+          /*--- Entries of c:= transpose(A)*b ---*/
 
-          su2double delta_ij = weight * (field(jPoint,iVar) - field(iPoint,iVar));
+          for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+          {
+            AD::SetPreaccIn(field(jPoint,iVar));
 
-          for (size_t iDim = 0; iDim < nDim; ++iDim)
-            gradient(iPoint, iVar, iDim) += dist_ij[iDim] * delta_ij;
+            su2double delta_ij = weight * (field(jPoint,iVar) - field(iPoint,iVar));
+
+            for (size_t iDim = 0; iDim < nDim; ++iDim)
+              gradient(iPoint, iVar, iDim) += dist_ij[iDim] * delta_ij;
+          }
         }
       }
-    }
 
-    if (periodic)
-    {
-      /*--- A second loop is required after periodic comms, checkpoint the preacc. ---*/
+      if (periodic)
+      {
+        /*--- A second loop is required after periodic comms, checkpoint the preacc. ---*/
 
-      for (size_t iDim = 0; iDim < nDim; ++iDim)
-        for (size_t jDim = 0; jDim < nDim; ++jDim)
-          AD::SetPreaccOut(Rmatrix(iPoint, iDim, jDim));
+        for (size_t iDim = 0; iDim < nDim; ++iDim) {
+          for (size_t jDim = 0; jDim < nDim; ++jDim) {
+            Rmatrix(iPoint, iDim, jDim) = Rlocal[iDim][jDim];
+            AD::SetPreaccOut(Rmatrix(iPoint, iDim, jDim));
+          }
+        }
 
-      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
-        for (size_t iDim = 0; iDim < nDim; ++iDim)
-          AD::SetPreaccOut(gradient(iPoint, iVar, iDim));
+        for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+          for (size_t iDim = 0; iDim < nDim; ++iDim)
+            AD::SetPreaccOut(gradient(iPoint, iVar, iDim));
 
-      AD::EndPreacc();
-    }
-    else {
-      /*--- Periodic comms are not needed, solve the LS problem for iPoint. ---*/
+        AD::EndPreacc();
+      }
+      else {
+        /*--- Periodic comms are not needed, solve the LS problem for iPoint. ---*/
 
-      solveLeastSquares<nDim, false>(iPoint, varBegin, varEnd, Rmatrix, gradient);
+        solveLeastSquares<nDim, false>(iPoint, varBegin, varEnd, Rlocal, gradient);
+      }
     }
+    END_SU2_OMP_FOR
   }
-  END_SU2_OMP_FOR
 
   /*--- Correct the gradient values across any periodic boundaries. ---*/
 
@@ -310,8 +442,14 @@ void computeGradientsLeastSquares(CSolver* solver,
     /*--- Second loop over points of the grid to compute final gradient. ---*/
 
     SU2_OMP_FOR_DYN(chunkSize)
-    for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
-      solveLeastSquares<nDim, true>(iPoint, varBegin, varEnd, Rmatrix, gradient);
+    for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint) {
+      su2double Rlocal[nDim][nDim];
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        for (size_t jDim = 0; jDim < nDim; ++jDim)
+          Rlocal[iDim][jDim] = Rmatrix(iPoint, iDim, jDim);
+
+      solveLeastSquares<nDim, true>(iPoint, varBegin, varEnd, Rlocal, gradient);
+    }
     END_SU2_OMP_FOR
   }
 
@@ -321,10 +459,14 @@ void computeGradientsLeastSquares(CSolver* solver,
 
   /*--- If no solver was provided we do not communicate ---*/
 
-  if (solver != nullptr)
+  if (solver != nullptr && overlapComms)
   {
     /*--- Obtain the gradients at halo points from the MPI ranks that own them. ---*/
 
+    solver->InitiateOverlappedComms(&geometry, &config, kindMpiComm);
+  }
+  else if (solver != nullptr)
+  {
     solver->InitiateComms(&geometry, &config, kindMpiComm);
     solver->CompleteComms(&geometry, &config, kindMpiComm);
   }
@@ -348,15 +490,18 @@ void computeGradientsLeastSquares(CSolver* solver,
                                   const size_t varEnd,
                                   const int idxVel,
                                   GradientType& gradient,
-                                  RMatrixType& Rmatrix) {
+                                  RMatrixType& Rmatrix,
+                                  bool overlapComms = false) {
   switch (geometry.GetnDim()) {
   case 2:
     detail::computeGradientsLeastSquares<2>(solver, kindMpiComm, kindPeriodicComm, geometry, config,
-                                            weighted, field, varBegin, varEnd, idxVel, gradient, Rmatrix);
+                                            weighted, field, varBegin, varEnd, idxVel, gradient, Rmatrix,
+                                            overlapComms);
     break;
   case 3:
     detail::computeGradientsLeastSquares<3>(solver, kindMpiComm, kindPeriodicComm, geometry, config,
-                                            weighted, field, varBegin, varEnd, idxVel, gradient, Rmatrix);
+                                            weighted, field, varBegin, varEnd, idxVel, gradient, Rmatrix,
+                                            overlapComms);
     break;
   default:
     SU2_MPI::Error("Too many dimensions to compute gradients.", CURRENT_FUNCTION);
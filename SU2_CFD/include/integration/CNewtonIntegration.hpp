@@ -90,6 +90,14 @@ private:
   unsigned short tolRelaxFactor = 0;
   su2double fullTolResidual = 0.0;
 
+  /*--- Solve the startup systems by iterative refinement, i.e. single precision FGMRES for the corrections
+   * and double precision residuals, using the single precision Jacobian. If a refinement step does not
+   * reduce the residual enough, double precision FGMRES (on the same matrix) finishes that solve. ---*/
+  bool refinement = false;
+  static constexpr passivedouble refineInnerTol = 1e-4;  /*!< \brief Tolerance reachable in single precision. */
+  static constexpr passivedouble refineStallFactor = 0.5; /*!< \brief Min. residual reduction per refinement. */
+  CSysVector<Scalar> refineRes, refineCorr;
+
   CConfig* config = nullptr;
   CSolver** solvers = nullptr;
   CGeometry* geometry = nullptr;
@@ -165,6 +173,16 @@ private:
    */
   void Setup();
 
+  /*!
+   * \brief Solve the system of the approximate Jacobian by mixed precision iterative refinement (see IterativeRefinement).
+   * \param[in] b - Right hand side.
+   * \param[out] x - Solution.
+   * \param[in] maxIter - Maximum total number of inner iterations.
+   * \param[in,out] eps - Target relative residual on entry, achieved relative residual on exit.
+   * \return Total number of inner iterations.
+   */
+  unsigned long RefinedSolve(const CSysVector<Scalar>& b, CSysVector<Scalar>& x, unsigned long maxIter, Scalar& eps);
+
   /*!
    * \brief Increment the solution, x := x+mag*dir.
    */
@@ -211,11 +229,78 @@ public:
    */
   void MatrixFreeProduct(const CSysVector<Scalar>& u, CSysVector<Scalar>& v);
 
+  /*!
+   * \brief Product with the approximate Jacobian, in the precision of the vectors.
+   */
+  void ApproxJacobianProduct(const CSysVector<Scalar>& u, CSysVector<Scalar>& v) const;
+
   /*!
    * \brief Wrapper for the preconditioner.
    */
   void Preconditioner(const CSysVector<Scalar>& u, CSysVector<Scalar>& v) const;
 
+  /*!
+   * \brief Solve A x = b by iterative refinement, the corrections (A c = r) are computed in low precision and
+   * the residuals (r = b - A x) in working precision. If a step does not reduce the residual by refineStallFactor,
+   * the fallback solver (in working precision) is used for the rest of the solve.
+   * \note Must be called by all threads, the stall decision is based on reduced norms, hence it is the same for all.
+   * \param[in] b - Right hand side.
+   * \param[out] x - Solution.
+   * \param[in] product - Callable (u, v), v = A u in working precision.
+   * \param[in] correction - Callable (r, c, maxIter, eps) that solves A c = r to a relative tolerance eps (updated
+   *            with the value achieved), and returns the number of iterations.
+   * \param[in] fallback - Callable with the same signature as correction.
+   * \param[in] maxIter - Maximum total number of inner iterations.
+   * \param[in,out] eps - Target relative residual on entry, achieved relative residual on exit.
+   * \param[out] res - Working vector for the residual.
+   * \param[out] corr - Working vector for the corrections.
+   * \return Total number of inner iterations.
+   */
+  template <class Product, class Correction, class Fallback>
+  static unsigned long IterativeRefinement(const CSysVector<Scalar>& b, CSysVector<Scalar>& x, const Product& product,
+                                           const Correction& correction, const Fallback& fallback,
+                                           unsigned long maxIter, Scalar& eps, CSysVector<Scalar>& res,
+                                           CSysVector<Scalar>& corr) {
+    x = Scalar(0.0);
+    const Scalar normB = b.norm();
+    if (normB == 0.0) {
+      eps = 0.0;
+      return 0;
+    }
+
+    /*--- With x = 0 the residual is the right hand side. ---*/
+    res = b;
+    Scalar relRes = 1.0;
+    unsigned long totalIter = 0;
+    bool stalled = false;
+
+    while (!stalled && relRes > eps && totalIter < maxIter) {
+
+      /*--- Correction in low precision, to the accuracy it can reach. ---*/
+      Scalar epsInner = max(eps / relRes, Scalar(refineInnerTol));
+      totalIter += max(1ul, correction(res, corr, maxIter - totalIter, epsInner));
+      x += corr;
+
+      /*--- True residual in working precision. ---*/
+      product(x, res);
+      res = b - res;
+
+      const Scalar prevRes = relRes;
+      relRes = res.norm() / normB;
+      stalled = (relRes > refineStallFactor * prevRes);
+    }
+
+    if (stalled && relRes > eps && totalIter < maxIter) {
+      Scalar epsCorr = eps / relRes;
+      totalIter += fallback(res, corr, maxIter - totalIter, epsCorr);
+      x += corr;
+      relRes *= epsCorr;
+    }
+
+    eps = relRes;
+    return totalIter;
+  }
+
 };
 
 #undef CNEWTON_PARFOR
@@ -49,7 +49,8 @@ void computeLimiters(LIMITER LimiterKind,
                      const GradientType& gradient,
                      FieldType& fieldMin,
                      FieldType& fieldMax,
-                     FieldType& limiter)
+                     FieldType& limiter,
+                     bool overlapComms = false)
 {
   if (geometry.GetnDim() != 2 && geometry.GetnDim() != 3)
     SU2_MPI::Error("Too many dimensions to compute limiters.", CURRENT_FUNCTION);
@@ -57,10 +58,10 @@ void computeLimiters(LIMITER LimiterKind,
 #define INSTANTIATE(KIND)\
 if (geometry.GetnDim() == 2) {\
   computeLimiters_impl<2,KIND>(solver, kindMpiComm, kindPeriodicComm1, kindPeriodicComm2, geometry,\
-                               config, varBegin, varEnd, field, gradient, fieldMin, fieldMax, limiter);\
+                               config, varBegin, varEnd, field, gradient, fieldMin, fieldMax, limiter, overlapComms);\
 } else {\
   computeLimiters_impl<3,KIND>(solver, kindMpiComm, kindPeriodicComm1, kindPeriodicComm2, geometry,\
-                               config, varBegin, varEnd, field, gradient, fieldMin, fieldMax, limiter);\
+                               config, varBegin, varEnd, field, gradient, fieldMin, fieldMax, limiter, overlapComms);\
 }
   switch (LimiterKind) {
     case LIMITER::NONE:
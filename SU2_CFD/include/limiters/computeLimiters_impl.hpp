@@ -54,6 +54,8 @@
  * \param[out] fieldMin - Minimum field values over direct neighbors of each point.
  * \param[out] fieldMax - As above but maximum values.
  * \param[out] limiter - Reconstruction limiter for the field.
+ * \param[in] overlapComms - Leave the MPI comms of the limiter in flight, the caller
+ *            must then complete them via CGeometry::CompletePendingComms.
  *
  * Template parameters:
  * \param nDim - Number of dimensions.
@@ -74,7 +76,8 @@ void computeLimiters_impl(CSolver* solver,
                           const GradientType& gradient,
                           FieldType& fieldMin,
                           FieldType& fieldMax,
-                          FieldType& limiter)
+                          FieldType& limiter,
+                          bool overlapComms = false)
 {
   constexpr size_t MAXNVAR = 32;
 
@@ -232,7 +235,11 @@ void computeLimiters_impl(CSolver* solver,
 
   /*--- Obtain the limiters at halo points from the MPI ranks that own them.
    *    If no solver was provided we do not communicate. ---*/
-  if (solver != nullptr)
+  if (solver != nullptr && overlapComms)
+  {
+    solver->InitiateOverlappedComms(&geometry, &config, kindMpiComm);
+  }
+  else if (solver != nullptr)
   {
     solver->InitiateComms(&geometry, &config, kindMpiComm);
     solver->CompleteComms(&geometry, &config, kindMpiComm);
@@ -29,8 +29,13 @@
 
 #include "CNumericsSIMD.hpp"
 #include "flow/convection/roe.hpp"
+#include "flow/convection/hllc.hpp"
+#include "flow/convection/ausm_slau.hpp"
+#include "flow/convection/fds.hpp"
 #include "flow/convection/centered.hpp"
 #include "flow/diffusion/viscous_fluxes.hpp"
+#include "scalar/convection.hpp"
+#include "../solvers/CSolver.hpp"
 
 namespace {
 
@@ -44,6 +49,24 @@ CNumericsSIMD* createUpwindIdealNumerics(const CConfig& config, int iMesh, const
     case UPWIND::ROE:
       obj = new CRoeScheme<ViscousDecorator>(config, iMesh, turbVars);
       break;
+    case UPWIND::HLLC:
+      obj = new CHLLCScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+    case UPWIND::AUSM:
+      obj = new CAUSMScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+    case UPWIND::AUSMPLUSUP:
+      obj = new CAUSMPLUSUPScheme<ViscousDecorator,false>(config, iMesh, turbVars);
+      break;
+    case UPWIND::AUSMPLUSUP2:
+      obj = new CAUSMPLUSUPScheme<ViscousDecorator,true>(config, iMesh, turbVars);
+      break;
+    case UPWIND::SLAU:
+      obj = new CSLAUScheme<ViscousDecorator,false>(config, iMesh, turbVars);
+      break;
+    case UPWIND::SLAU2:
+      obj = new CSLAUScheme<ViscousDecorator,true>(config, iMesh, turbVars);
+      break;
     default:
       break;
   }
@@ -83,6 +106,36 @@ CNumericsSIMD* createCenteredNumerics(const CConfig& config, int iMesh, const CV
   return obj;
 }
 
+/*!
+ * \brief Incompressible flow factory implementation.
+ */
+template<class ViscousDecorator>
+CNumericsSIMD* createIncNumerics(const CConfig& config, int iMesh, const CVariable* turbVars) {
+  CNumericsSIMD* obj = nullptr;
+  switch (config.GetKind_ConvNumScheme_Flow()) {
+    case SPACE_UPWIND:
+      if (config.GetKind_Upwind_Flow() == UPWIND::FDS)
+        obj = new CFDSIncScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+
+    case SPACE_CENTERED:
+      switch ((iMesh==MESH_0)? config.GetKind_Centered_Flow() : CENTERED::LAX) {
+        case CENTERED::LAX:
+          obj = new CLaxIncScheme<ViscousDecorator>(config, iMesh, turbVars);
+          break;
+        case CENTERED::JST:
+          obj = new CJSTIncScheme<ViscousDecorator>(config, iMesh, turbVars);
+          break;
+        default:
+          break;
+      }
+      break;
+    default:
+    break;
+  }
+  return obj;
+}
+
 /*!
  * \brief Generic factory implementation.
  */
@@ -92,6 +145,12 @@ CNumericsSIMD* createNumerics(const CConfig& config, int iMesh, const CVariable*
   const bool ideal_gas = (config.GetKind_FluidModel() == STANDARD_AIR) ||
                          (config.GetKind_FluidModel() == IDEAL_GAS);
 
+  if (config.GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE) {
+    if (config.GetViscous())
+      return createIncNumerics<CIncompressibleViscousFlux<nDim> >(config, iMesh, turbVars);
+    return createIncNumerics<CNoViscousFlux<nDim> >(config, iMesh, turbVars);
+  }
+
   switch (config.GetKind_ConvNumScheme_Flow()) {
     case SPACE_UPWIND:
       if (config.GetViscous()) {
@@ -126,6 +185,102 @@ CNumericsSIMD* createNumerics(const CConfig& config, int iMesh, const CVariable*
   return obj;
 }
 
+/*!
+ * \brief Arguments of the scalar schemes that depend on the solvers.
+ */
+struct CScalarSchemeArgs {
+  const CVariable* flowVars;
+  const su2activevector* edgeMassFluxes;
+  bool bounded;
+  bool musclFlowDensity;
+  const su2double* constants;
+};
+
+/*!
+ * \brief Instantiate one scalar scheme.
+ */
+template<class FlowIndices, class Decorator>
+CNumericsSIMD* newScalarScheme(const CConfig& config, const CScalarSchemeArgs& args) {
+  return new CUpwScalarScheme<FlowIndices, Decorator>(config, args.flowVars, args.edgeMassFluxes,
+                                                      args.bounded, args.musclFlowDensity, args.constants);
+}
+
+/*!
+ * \brief Species factory, the number of species is a compile-time parameter.
+ */
+template<class FlowIndices, int nDim, size_t nVar = 1>
+CNumericsSIMD* createSpeciesNumerics(const CConfig& config, unsigned short nSpeciesVar,
+                                     const CScalarSchemeArgs& args) {
+  if constexpr (nVar > 8) {
+    return nullptr;
+  } else {
+    if (nSpeciesVar == nVar)
+      return newScalarScheme<FlowIndices, CSpeciesDiffusion<nDim,nVar> >(config, args);
+    return createSpeciesNumerics<FlowIndices, nDim, nVar+1>(config, nSpeciesVar, args);
+  }
+}
+
+/*!
+ * \brief Scalar factory implementation.
+ */
+template<class FlowIndices, int nDim>
+CNumericsSIMD* createScalarNumerics(const CConfig& config, unsigned short iSol, const CSolver* const* solvers) {
+  CScalarSchemeArgs args;
+  args.flowVars = solvers[FLOW_SOL]->GetNodes();
+  args.edgeMassFluxes = solvers[FLOW_SOL]->GetEdgeMassFluxes();
+  args.bounded = false;
+  /*--- Density is reconstructed if the flow solver has its gradient (the primitive
+   *    variables before density are temperature/pressure and velocity). ---*/
+  args.musclFlowDensity = solvers[FLOW_SOL]->GetnPrimVarGrad() > nDim + 2;
+  args.constants = nullptr;
+
+  switch (iSol) {
+    case TURB_SOL:
+      if (config.GetKind_ConvNumScheme_Turb() != SPACE_UPWIND) return nullptr;
+      args.bounded = config.GetBounded_Turb();
+      switch (TurbModelFamily(config.GetKind_Turb_Model())) {
+        case TURB_FAMILY::SA:
+          return newScalarScheme<FlowIndices, CSADiffusion<nDim> >(config, args);
+        case TURB_FAMILY::KW:
+          args.constants = solvers[TURB_SOL]->GetConstants();
+          return newScalarScheme<FlowIndices, CSSTDiffusion<nDim> >(config, args);
+        default:
+          return nullptr;
+      }
+
+    case TRANS_SOL:
+      if (config.GetKind_ConvNumScheme_Turb() != SPACE_UPWIND ||
+          config.GetKind_Trans_Model() != TURB_TRANS_MODEL::LM) return nullptr;
+      return newScalarScheme<FlowIndices, CTransLMDiffusion<nDim> >(config, args);
+
+    case SPECIES_SOL:
+      if (config.GetKind_ConvNumScheme_Species() != SPACE_UPWIND) return nullptr;
+      args.bounded = config.GetBounded_Species();
+      return createSpeciesNumerics<FlowIndices, nDim>(config, solvers[SPECIES_SOL]->GetnVar(), args);
+
+    default:
+      return nullptr;
+  }
+}
+
+/*!
+ * \brief Dispatch the scalar factory on the flow regime.
+ */
+template<int nDim>
+CNumericsSIMD* createScalarNumerics(const CConfig& config, unsigned short iSol, const CSolver* const* solvers) {
+  /*--- The primitive variables of NEMO have a different layout. ---*/
+  if (config.GetNEMOProblem()) return nullptr;
+
+  switch (config.GetKind_Regime()) {
+    case ENUM_REGIME::COMPRESSIBLE:
+      return createScalarNumerics<CEulerVariable::CIndices<unsigned short>, nDim>(config, iSol, solvers);
+    case ENUM_REGIME::INCOMPRESSIBLE:
+      return createScalarNumerics<CIncEulerVariable::CIndices<unsigned short>, nDim>(config, iSol, solvers);
+    default:
+      return nullptr;
+  }
+}
+
 } // namespace
 
 /*!
@@ -145,3 +300,13 @@ CNumericsSIMD* CNumericsSIMD::CreateNumerics(const CConfig& config, int nDim, in
 
   return nullptr;
 }
+
+CNumericsSIMD* CNumericsSIMD::CreateScalarNumerics(const CConfig& config, int nDim, unsigned short iSol,
+                                                   const CSolver* const* solvers) {
+  if (solvers[FLOW_SOL] == nullptr || solvers[iSol] == nullptr) return nullptr;
+
+  if (nDim == 2) return createScalarNumerics<2>(config, iSol, solvers);
+  if (nDim == 3) return createScalarNumerics<3>(config, iSol, solvers);
+
+  return nullptr;
+}
@@ -49,6 +49,7 @@ template<class T> class CSysMatrix;
 class CConfig;
 class CGeometry;
 class CVariable;
+class CSolver;
 
 #ifdef CODI_FORWARD_TYPE
 using SparseMatrixType = CSysMatrix<su2double>;
@@ -97,4 +98,15 @@ public:
    */
   static CNumericsSIMD* CreateNumerics(const CConfig& config, int nDim, int iMesh, const CVariable* turbVars = nullptr);
 
+  /*!
+   * \brief Factory method for the edge terms of scalar transport equations.
+   * \param[in] config - Problem definitions.
+   * \param[in] nDim - 2D or 3D.
+   * \param[in] iSol - Position of the scalar solver (TURB_SOL, TRANS_SOL, or SPECIES_SOL).
+   * \param[in] solvers - Container of solvers, the flow solver provides the convecting velocity.
+   * \return Nullptr if the model and options in use are not supported.
+   */
+  static CNumericsSIMD* CreateScalarNumerics(const CConfig& config, int nDim, unsigned short iSol,
+                                             const CSolver* const* solvers);
+
 };
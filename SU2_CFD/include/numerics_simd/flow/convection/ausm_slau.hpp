@@ -0,0 +1,597 @@
+/*!
+ * \file ausm_slau.hpp
+ * \brief AUSM-family of convective schemes (AUSM, AUSM+up, AUSM+up2, SLAU, SLAU2).
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../variables.hpp"
+#include "common.hpp"
+#include "../../../variables/CEulerVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \brief Derivatives of velocity, pressure, density, and enthalpy (in this order)
+ * w.r.t. the conservative variables (ideal gas).
+ */
+template<size_t nDim, size_t N>
+FORCEINLINE MatrixDbl<nDim+3,nDim+2> primitiveJacobian(Double gamma, const CCompressiblePrimitives<nDim,N>& V) {
+  MatrixDbl<nDim+3,nDim+2> dVdU;
+  for (size_t iVar = 0; iVar < nDim+3; ++iVar) {
+    for (size_t jVar = 0; jVar < nDim+2; ++jVar) {
+      dVdU(iVar,jVar) = 0.0;
+    }
+  }
+  const Double gamma_m_1 = gamma - 1;
+  const Double oneOnRho = 1 / V.density();
+  const Double sqVel = squaredNorm<nDim>(V.velocity());
+
+  /*--- Density. ---*/
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    dVdU(iDim,0) = -V.velocity(iDim) * oneOnRho;
+  }
+  dVdU(nDim,0) = 0.5 * gamma_m_1 * sqVel;
+  dVdU(nDim+1,0) = 1.0;
+  dVdU(nDim+2,0) = (0.5*(gamma-2)*sqVel - gamma*V.pressure()/(gamma_m_1*V.density())) * oneOnRho;
+
+  /*--- Momentum. ---*/
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    dVdU(iDim,iDim+1) = oneOnRho;
+    dVdU(nDim,iDim+1) = -gamma_m_1 * V.velocity(iDim);
+    dVdU(nDim+2,iDim+1) = -gamma_m_1 * V.velocity(iDim) * oneOnRho;
+  }
+
+  /*--- Energy. ---*/
+  dVdU(nDim,nDim+1) = gamma_m_1;
+  dVdU(nDim+2,nDim+1) = gamma * oneOnRho;
+
+  return dVdU;
+}
+
+/*!
+ * \class CAUSMBase
+ * \ingroup ConvDiscr
+ * \brief Base class for the schemes that fit in the general form of AUSM+up
+ * and SLAU, F = mdot * psi_upwind + p * n, with psi = (1, velocity, enthalpy).
+ * Derived classes implement the face mass flux (per unit area) and pressure in
+ * a const "massAndPressureFluxes" method, which can only depend on the velocity,
+ * pressure, density, and enthalpy of each side (and on the value returned by
+ * "pressureDissipation"), see CUpwAUSMPLUS_SLAU_Base_Flow.
+ * The Jacobians are either those of the Roe scheme, or the accurate ones
+ * obtained by finite differences of the mass and pressure fluxes (if derived
+ * sets "hasAccurateJacobian"). A base class implementing "viscousTerms" is
+ * accepted as template parameter, see CRoeBase.
+ */
+template<class Derived, class Base>
+class CAUSMBase : public Base {
+protected:
+  using Base::nDim;
+  static constexpr size_t nVar = CCompressibleConservatives<nDim>::nVar;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nPrimVarGrad);
+
+  const su2double gamma;
+  const su2double gasConst;
+  const bool finestGrid;
+  const bool muscl;
+  const LIMITER typeLimiter;
+  const bool accurateJacobian;
+
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CAUSMBase(const CConfig& config, unsigned iMesh, Ts&... args) : Base(config, iMesh, args...),
+    gamma(config.GetGamma()),
+    gasConst(config.GetGas_ConstantND()),
+    finestGrid(iMesh == MESH_0),
+    muscl(finestGrid && config.GetMUSCL_Flow()),
+    typeLimiter(config.GetKind_SlopeLimit_Flow()),
+    accurateJacobian(Derived::hasAccurateJacobian && config.GetUse_Accurate_Jacobians()) {
+  }
+
+  /*!
+   * \brief Approximate (Roe) Jacobians.
+   */
+  template<class PrimVarType, class ConsVarType>
+  FORCEINLINE void approximateJacobians(const CPair<PrimVarType>& V,
+                                        const CPair<ConsVarType>& U,
+                                        const VectorDbl<nDim>& normal,
+                                        Double area,
+                                        const VectorDbl<nDim>& unitNormal,
+                                        MatrixDbl<nVar>& jac_i,
+                                        MatrixDbl<nVar>& jac_j) const {
+
+    auto roeAvg = roeAveragedVariables(gamma, V, unitNormal);
+
+    auto pMat = pMatrix(gamma, roeAvg.density, roeAvg.velocity,
+                        roeAvg.projVel, roeAvg.speedSound, unitNormal);
+    auto pMatInv = pMatrixInv(gamma, roeAvg.density, roeAvg.velocity,
+                              roeAvg.projVel, roeAvg.speedSound, unitNormal);
+
+    VectorDbl<nVar> lambda;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      lambda(iDim) = abs(roeAvg.projVel);
+    }
+    lambda(nDim) = abs(roeAvg.projVel + roeAvg.speedSound);
+    lambda(nDim+1) = abs(roeAvg.projVel - roeAvg.speedSound);
+
+    /*--- Scale = 0.5 because the flux is ~ 0.5*(fc_i+fc_j)*normal. ---*/
+
+    jac_i = inviscidProjJac(gamma, V.i.velocity(), U.i.energy(), normal, 0.5);
+    jac_j = inviscidProjJac(gamma, V.j.velocity(), U.j.energy(), normal, 0.5);
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        /*--- Compute |projModJacTensor| = P x |Lambda| x P^-1. ---*/
+
+        Double projModJacTensor = 0.0;
+        for (size_t kVar = 0; kVar < nVar; ++kVar) {
+          projModJacTensor += pMat(iVar,kVar) * lambda(kVar) * pMatInv(kVar,jVar);
+        }
+        jac_i(iVar,jVar) += 0.5 * projModJacTensor * area;
+        jac_j(iVar,jVar) -= 0.5 * projModJacTensor * area;
+      }
+    }
+  }
+
+  /*!
+   * \brief Accurate Jacobians, mass and pressure fluxes are differentiated numerically
+   * w.r.t. the primitive variables, and then the chain rule is applied.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void accurateJacobians(const CPair<PrimVarType>& V,
+                                     const VectorDbl<nDim>& normal,
+                                     Double area,
+                                     const VectorDbl<nDim>& unitNormal,
+                                     Double dissipation,
+                                     Double mdot,
+                                     Double pressure,
+                                     MatrixDbl<nVar>& jac_i,
+                                     MatrixDbl<nVar>& jac_j) const {
+    constexpr size_t nPrim = nDim+3;
+    constexpr passivedouble finDiffStep = 1e-4;
+    const auto derived = static_cast<const Derived*>(this);
+
+    /*--- Forward finite differences w.r.t. velocity, pressure, density, and
+     *    enthalpy, i.e. the primitives that follow the temperature in V. ---*/
+
+    VectorDbl<nPrim> dmdot_dVi, dmdot_dVj, dpres_dVi, dpres_dVj;
+    auto Vp = V;
+
+    for (size_t iVar = 0; iVar < nPrim; ++iVar) {
+      Double mdotPert, pressurePert;
+
+      const Double eps_i = finDiffStep * fmax(1.0, abs(V.i.all(iVar+1)));
+      Vp.i.all(iVar+1) += eps_i;
+      derived->massAndPressureFluxes(Vp, unitNormal, dissipation, mdotPert, pressurePert);
+      dmdot_dVi(iVar) = (mdotPert - mdot) / eps_i;
+      dpres_dVi(iVar) = (pressurePert - pressure) / eps_i;
+      Vp.i.all(iVar+1) = V.i.all(iVar+1);
+
+      const Double eps_j = finDiffStep * fmax(1.0, abs(V.j.all(iVar+1)));
+      Vp.j.all(iVar+1) += eps_j;
+      derived->massAndPressureFluxes(Vp, unitNormal, dissipation, mdotPert, pressurePert);
+      dmdot_dVj(iVar) = (mdotPert - mdot) / eps_j;
+      dpres_dVj(iVar) = (pressurePert - pressure) / eps_j;
+      Vp.j.all(iVar+1) = V.j.all(iVar+1);
+    }
+
+    /*--- Chain rule for the derivatives w.r.t. the conservatives. ---*/
+
+    const auto dVi_dUi = primitiveJacobian(gamma, V.i);
+    const auto dVj_dUj = primitiveJacobian(gamma, V.j);
+
+    VectorDbl<nVar> dmdot_dUi, dmdot_dUj, dpres_dUi, dpres_dUj;
+    for (size_t jVar = 0; jVar < nVar; ++jVar) {
+      dmdot_dUi(jVar) = 0.0; dpres_dUi(jVar) = 0.0;
+      dmdot_dUj(jVar) = 0.0; dpres_dUj(jVar) = 0.0;
+      for (size_t iVar = 0; iVar < nPrim; ++iVar) {
+        dmdot_dUi(jVar) += dmdot_dVi(iVar) * dVi_dUi(iVar,jVar);
+        dpres_dUi(jVar) += dpres_dVi(iVar) * dVi_dUi(iVar,jVar);
+        dmdot_dUj(jVar) += dmdot_dVj(iVar) * dVj_dUj(iVar,jVar);
+        dpres_dUj(jVar) += dpres_dVj(iVar) * dVj_dUj(iVar,jVar);
+      }
+    }
+
+    /*--- Contributions from the mass flux and pressure derivatives, psi is upwinded. ---*/
+
+    const Double upwind_i = mdot > 0.0;
+    const Double upwind_j = 1 - upwind_i;
+
+    VectorDbl<nVar> psiHat;
+    psiHat(0) = area;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      psiHat(iDim+1) = area * (upwind_i*V.i.velocity(iDim) + upwind_j*V.j.velocity(iDim));
+    }
+    psiHat(nVar-1) = area * (upwind_i*V.i.enthalpy() + upwind_j*V.j.enthalpy());
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        jac_i(iVar,jVar) = psiHat(iVar) * dmdot_dUi(jVar);
+        jac_j(iVar,jVar) = psiHat(iVar) * dmdot_dUj(jVar);
+      }
+    }
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        jac_i(iDim+1,jVar) += normal(iDim) * dpres_dUi(jVar);
+        jac_j(iDim+1,jVar) += normal(iDim) * dpres_dUj(jVar);
+      }
+    }
+
+    /*--- Contributions from the derivatives of psi (velocity and enthalpy) of the upwind side. ---*/
+
+    const Double mdotArea = mdot * area;
+
+    for (size_t jVar = 0; jVar < nVar; ++jVar) {
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        jac_i(iDim+1,jVar) += upwind_i * mdotArea * dVi_dUi(iDim,jVar);
+        jac_j(iDim+1,jVar) += upwind_j * mdotArea * dVj_dUj(iDim,jVar);
+      }
+      jac_i(nVar-1,jVar) += upwind_i * mdotArea * dVi_dUi(nDim+2,jVar);
+      jac_j(nVar-1,jVar) += upwind_j * mdotArea * dVj_dUj(nDim+2,jVar);
+    }
+  }
+
+public:
+  /*!
+   * \brief Default coefficient of the pressure dissipation term (schemes without low dissipation).
+   */
+  FORCEINLINE Double pressureDissipation(Int, Int, const CEulerVariable&) const { return 1.0; }
+
+  /*!
+   * \brief Implementation of the general AUSM-type flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Reconstructed primitives. ---*/
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    auto V = reconstructPrimitives<CCompressiblePrimitives<nDim,nPrimVarGrad> >(
+        iEdge, iPoint, jPoint, gamma, gasConst, muscl, typeLimiter, V1st, vector_ij, solution);
+
+    /*--- Mass and pressure fluxes (static polymorphism). ---*/
+
+    const auto derived = static_cast<const Derived*>(this);
+
+    const Double dissipation = derived->pressureDissipation(iPoint, jPoint, solution);
+
+    Double mdot, pressure;
+    derived->massAndPressureFluxes(V, unitNormal, dissipation, mdot, pressure);
+
+    /*--- Flux, mdot * (psi_i or psi_j) + p * n. ---*/
+
+    const Double absMdot = abs(mdot);
+
+    VectorDbl<nVar> flux;
+    flux(0) = area * mdot;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      flux(iDim+1) = area * (0.5*mdot*(V.i.velocity(iDim) + V.j.velocity(iDim)) +
+                             0.5*absMdot*(V.i.velocity(iDim) - V.j.velocity(iDim)) + unitNormal(iDim)*pressure);
+    }
+    flux(nVar-1) = area * (0.5*mdot*(V.i.enthalpy() + V.j.enthalpy()) +
+                           0.5*absMdot*(V.i.enthalpy() - V.j.enthalpy()));
+
+    /*--- Jacobians. ---*/
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      if (accurateJacobian) {
+        accurateJacobians(V, normal, area, unitNormal, dissipation, mdot, pressure, jac_i, jac_j);
+      } else {
+        CPair<CCompressibleConservatives<nDim> > U;
+        U.i = compressibleConservatives(V.i);
+        U.j = compressibleConservatives(V.j);
+        approximateJacobians(V, U, normal, area, unitNormal, jac_i, jac_j);
+      }
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V1st, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
+
+/*!
+ * \class CAUSMScheme
+ * \ingroup ConvDiscr
+ * \brief Classical AUSM scheme (always uses the Roe Jacobians), see CUpwAUSM_Flow.
+ */
+template<class Decorator>
+class CAUSMScheme : public CAUSMBase<CAUSMScheme<Decorator>,Decorator> {
+private:
+  using Base = CAUSMBase<CAUSMScheme<Decorator>,Decorator>;
+  using Base::nDim;
+  using Base::gamma;
+
+public:
+  static constexpr bool hasAccurateJacobian = false;
+
+  /*!
+   * \brief Constructor, forward everything to base.
+   */
+  template<class... Ts>
+  CAUSMScheme(Ts&... args) : Base(args...) {}
+
+  /*!
+   * \brief Face mass flux and pressure.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void massAndPressureFluxes(const CPair<PrimVarType>& V,
+                                         const VectorDbl<nDim>& unitNormal,
+                                         Double,
+                                         Double& mdot,
+                                         Double& pressure) const {
+    const Double energy_i = V.i.enthalpy() - V.i.pressure() / V.i.density();
+    const Double energy_j = V.j.enthalpy() - V.j.pressure() / V.j.density();
+    const Double a_i = sqrt(abs(gamma*(gamma-1)*(energy_i - 0.5*squaredNorm<nDim>(V.i.velocity()))));
+    const Double a_j = sqrt(abs(gamma*(gamma-1)*(energy_j - 0.5*squaredNorm<nDim>(V.j.velocity()))));
+
+    const Double mL = dot(V.i.velocity(), unitNormal) / a_i;
+    const Double mR = dot(V.j.velocity(), unitNormal) / a_j;
+
+    const Double subsonicL = abs(mL) <= 1.0;
+    const Double subsonicR = abs(mR) <= 1.0;
+
+    const Double mLP = subsonicL*0.25*(mL+1)*(mL+1) + (1-subsonicL)*0.5*(mL+abs(mL));
+    const Double mRM = -subsonicR*0.25*(mR-1)*(mR-1) + (1-subsonicR)*0.5*(mR-abs(mR));
+    const Double mF = mLP + mRM;
+
+    const Double pLP = subsonicL*0.25*(mL+1)*(mL+1)*(2-mL) + (1-subsonicL)*(mL > 0.0);
+    const Double pRM = subsonicR*0.25*(mR-1)*(mR-1)*(2+mR) + (1-subsonicR)*(mR < 0.0);
+
+    mdot = fmax(mF, 0.0)*V.i.density()*a_i + fmin(mF, 0.0)*V.j.density()*a_j;
+    pressure = pLP*V.i.pressure() + pRM*V.j.pressure();
+  }
+};
+
+/*!
+ * \class CAUSMPLUSUPScheme
+ * \ingroup ConvDiscr
+ * \brief AUSM+up (version 2 if "upVersion2" is true), see CUpwAUSMPLUSUP(2)_Flow.
+ */
+template<class Decorator, bool upVersion2>
+class CAUSMPLUSUPScheme : public CAUSMBase<CAUSMPLUSUPScheme<Decorator,upVersion2>,Decorator> {
+private:
+  using Base = CAUSMBase<CAUSMPLUSUPScheme<Decorator,upVersion2>,Decorator>;
+  using Base::nDim;
+  using Base::gamma;
+  const su2double Minf;
+  static constexpr passivedouble Kp = 0.25;
+  static constexpr passivedouble Ku = 0.75;
+  static constexpr passivedouble sigma = 1.0;
+
+public:
+  static constexpr bool hasAccurateJacobian = true;
+
+  /*!
+   * \brief Constructor, store some constants and forward to base.
+   */
+  template<class... Ts>
+  CAUSMPLUSUPScheme(const CConfig& config, Ts&... args) : Base(config, args...),
+    Minf(config.GetMach()) {
+    if (Minf < EPS)
+      SU2_MPI::Error("AUSM+Up requires a reference Mach number (\"MACH_NUMBER\") greater than 0.", CURRENT_FUNCTION);
+  }
+
+  /*!
+   * \brief Face mass flux and pressure.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void massAndPressureFluxes(const CPair<PrimVarType>& V,
+                                         const VectorDbl<nDim>& unitNormal,
+                                         Double,
+                                         Double& mdot,
+                                         Double& pressure) const {
+    const Double projVel_i = dot(V.i.velocity(), unitNormal);
+    const Double projVel_j = dot(V.j.velocity(), unitNormal);
+
+    /*--- Interface speed of sound (aF). ---*/
+
+    const Double astarL = sqrt(2*(gamma-1)/(gamma+1)*V.i.enthalpy());
+    const Double astarR = sqrt(2*(gamma-1)/(gamma+1)*V.j.enthalpy());
+
+    const Double ahatL = astarL*astarL / fmax(astarL, projVel_i);
+    const Double ahatR = astarR*astarR / fmax(astarR, -projVel_j);
+
+    const Double aF = fmin(ahatL, ahatR);
+
+    /*--- Left and right pressure functions and Mach numbers. ---*/
+
+    const Double mL = projVel_i / aF;
+    const Double mR = projVel_j / aF;
+
+    const Double MFsq = 0.5*(mL*mL + mR*mR);
+    const Double Mrefsq = fmin(1.0, fmax(MFsq, Minf*Minf));
+    const Double fa = 2*sqrt(Mrefsq) - Mrefsq;
+
+    const Double alpha = 3.0/16.0*(-4+5*fa*fa);
+    constexpr passivedouble beta = 1.0/8.0;
+
+    const Double subsonicL = abs(mL) <= 1.0;
+    const Double p1L = 0.25*(mL+1)*(mL+1);
+    const Double p2L = (mL*mL-1)*(mL*mL-1);
+    const Double mLP = subsonicL*(p1L + beta*p2L) + (1-subsonicL)*0.5*(mL+abs(mL));
+    const Double pLP = subsonicL*(p1L*(2-mL) + alpha*mL*p2L) + (1-subsonicL)*(mL > 0.0);
+
+    const Double subsonicR = abs(mR) <= 1.0;
+    const Double p1R = 0.25*(mR-1)*(mR-1);
+    const Double p2R = (mR*mR-1)*(mR*mR-1);
+    const Double mRM = subsonicR*(-p1R - beta*p2R) + (1-subsonicR)*0.5*(mR-abs(mR));
+    const Double pRM = subsonicR*(p1R*(2+mR) - alpha*mR*p2R) + (1-subsonicR)*(mR < 0.0);
+
+    /*--- Mass flux with pressure diffusion term. ---*/
+
+    const Double rhoF = 0.5*(V.i.density() + V.j.density());
+    const Double Mp = -(Kp/fa)*fmax(1-sigma*MFsq, 0.0)*(V.j.pressure()-V.i.pressure())/(rhoF*aF*aF);
+
+    const Double mF = mLP + mRM + Mp;
+    mdot = aF * (fmax(mF, 0.0)*V.i.density() + fmin(mF, 0.0)*V.j.density());
+
+    /*--- Pressure flux, with velocity diffusion term (modified in version 2). ---*/
+
+    if (upVersion2) {
+      const Double sqVel = 0.5*(squaredNorm<nDim>(V.i.velocity()) + squaredNorm<nDim>(V.j.velocity()));
+      pressure = 0.5*(V.j.pressure()+V.i.pressure()) + 0.5*(pLP-pRM)*(V.i.pressure()-V.j.pressure()) +
+                 sqrt(sqVel)*(pLP+pRM-1)*rhoF*aF;
+    } else {
+      const Double Pu = -Ku*fa*pLP*pRM*2*rhoF*aF*(projVel_j-projVel_i);
+      pressure = pLP*V.i.pressure() + pRM*V.j.pressure() + Pu;
+    }
+  }
+};
+
+/*!
+ * \class CSLAUScheme
+ * \ingroup ConvDiscr
+ * \brief SLAU (SLAU2 if "slau2" is true) with optional low dissipation, see CUpwSLAU(2)_Flow.
+ */
+template<class Decorator, bool slau2>
+class CSLAUScheme : public CAUSMBase<CSLAUScheme<Decorator,slau2>,Decorator> {
+private:
+  using Base = CAUSMBase<CSLAUScheme<Decorator,slau2>,Decorator>;
+  using Base::nDim;
+  using Base::gamma;
+  const ENUM_ROELOWDISS typeDissip;
+
+public:
+  static constexpr bool hasAccurateJacobian = true;
+
+  /*!
+   * \brief Constructor, store some constants and forward to base.
+   */
+  template<class... Ts>
+  CSLAUScheme(const CConfig& config, Ts&... args) : Base(config, args...),
+    typeDissip(static_cast<ENUM_ROELOWDISS>(config.GetKind_RoeLowDiss())) {
+  }
+
+  /*!
+   * \brief Low dissipation coefficient.
+   */
+  FORCEINLINE Double pressureDissipation(Int iPoint, Int jPoint, const CEulerVariable& solution) const {
+    return roeDissipation(iPoint, jPoint, typeDissip, solution);
+  }
+
+  /*!
+   * \brief Face mass flux and pressure.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void massAndPressureFluxes(const CPair<PrimVarType>& V,
+                                         const VectorDbl<nDim>& unitNormal,
+                                         Double dissipation,
+                                         Double& mdot,
+                                         Double& pressure) const {
+    const Double projVel_i = dot(V.i.velocity(), unitNormal);
+    const Double projVel_j = dot(V.j.velocity(), unitNormal);
+    const Double sqVel_i = squaredNorm<nDim>(V.i.velocity());
+    const Double sqVel_j = squaredNorm<nDim>(V.j.velocity());
+
+    const Double energy_i = V.i.enthalpy() - V.i.pressure() / V.i.density();
+    const Double energy_j = V.j.enthalpy() - V.j.pressure() / V.j.density();
+    const Double a_i = sqrt(abs(gamma*(gamma-1)*(energy_i - 0.5*sqVel_i)));
+    const Double a_j = sqrt(abs(gamma*(gamma-1)*(energy_j - 0.5*sqVel_j)));
+
+    /*--- Interface speed of sound (aF), and left/right Mach number. ---*/
+
+    const Double aF = 0.5*(a_i + a_j);
+    const Double mL = projVel_i / aF;
+    const Double mR = projVel_j / aF;
+
+    /*--- Smooth function of the local Mach number. ---*/
+
+    const Double machTilde = fmin(1.0, sqrt(0.5*(sqVel_i+sqVel_j)) / aF);
+    const Double chi = (1-machTilde)*(1-machTilde);
+    const Double f_rho = -fmax(fmin(mL, 0.0), -1.0) * fmin(fmax(mR, 0.0), 1.0);
+
+    /*--- Mean normal velocity with density weighting. ---*/
+
+    const Double vnMag = (V.i.density()*abs(projVel_i) + V.j.density()*abs(projVel_j)) /
+                         (V.i.density() + V.j.density());
+    const Double vnMagL = (1-f_rho)*vnMag + f_rho*abs(projVel_i);
+    const Double vnMagR = (1-f_rho)*vnMag + f_rho*abs(projVel_j);
+
+    /*--- Mass flux function. ---*/
+
+    mdot = 0.5*(V.i.density()*(projVel_i+vnMagL) + V.j.density()*(projVel_j-vnMagR) -
+                (chi/aF)*(V.j.pressure()-V.i.pressure()));
+
+    /*--- Pressure function. ---*/
+
+    const Double subsonicL = abs(mL) < 1.0;
+    const Double subsonicR = abs(mR) < 1.0;
+    const Double betaL = subsonicL*0.25*(2-mL)*(mL+1)*(mL+1) + (1-subsonicL)*(mL >= 0.0);
+    const Double betaR = subsonicR*0.25*(2+mR)*(mR-1)*(mR-1) + (1-subsonicR)*(mR < 0.0);
+
+    pressure = 0.5*(V.i.pressure()+V.j.pressure()) + 0.5*(betaL-betaR)*(V.i.pressure()-V.j.pressure());
+
+    if (slau2) {
+      pressure += dissipation*sqrt(0.5*(sqVel_i+sqVel_j))*(betaL+betaR-1)*aF*0.5*(V.i.density()+V.j.density());
+    } else {
+      pressure += dissipation*(1-chi)*(betaL+betaR-1)*0.5*(V.i.pressure()+V.j.pressure());
+    }
+  }
+};
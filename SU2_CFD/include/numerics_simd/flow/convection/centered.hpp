@@ -32,8 +32,22 @@
 #include "../variables.hpp"
 #include "common.hpp"
 #include "../../../variables/CEulerVariable.hpp"
+#include "../../../variables/CIncEulerVariable.hpp"
 #include "../../../../../Common/include/geometry/CGeometry.hpp"
 
+/*!
+ * \brief Number of neighbors of the points, special treatment needed to fetch integer data.
+ */
+template<class T, size_t N>
+FORCEINLINE Double numNeighbor(simd::Array<T,N> idx, const CGeometry& geometry) {
+  Double n;
+  for (size_t k=0; k<N; ++k) n[k] = geometry.nodes->GetnNeighbor(idx[k]);
+  return n;
+}
+FORCEINLINE Double numNeighbor(unsigned long idx, const CGeometry& geometry) {
+  return geometry.nodes->GetnNeighbor(idx);
+}
+
 /*!
  * \class CCenteredBase
  * \ingroup ConvDiscr
@@ -63,19 +77,6 @@ protected:
     dynamicGrid(config.GetDynamic_Grid()) {
   }
 
-  /*!
-   * \brief Special treatment needed to fetch integer data.
-   */
-  template<class T, size_t N>
-  FORCEINLINE static Double numNeighbor(simd::Array<T,N> idx, const CGeometry& geometry) {
-    Double n;
-    for (size_t k=0; k<N; ++k) n[k] = geometry.nodes->GetnNeighbor(idx[k]);
-    return n;
-  }
-  FORCEINLINE static Double numNeighbor(unsigned long idx, const CGeometry& geometry) {
-    return geometry.nodes->GetnNeighbor(idx);
-  }
-
 public:
   /*!
    * \brief Implementation of the base centered flux.
@@ -237,8 +238,8 @@ public:
 
     /*--- Compute dissipation coefficients. ---*/
 
-    const auto ni = Base::numNeighbor(iPoint, geometry);
-    const auto nj = Base::numNeighbor(jPoint, geometry);
+    const auto ni = numNeighbor(iPoint, geometry);
+    const auto nj = numNeighbor(jPoint, geometry);
     const Double sc2 = 3 * (ni+nj) / (ni*nj);
     const Double sc4 = 0.25*pow(sc2, 2);
 
@@ -316,8 +317,8 @@ public:
 
     /*--- Compute scalar dissipation. ---*/
 
-    const auto ni = Base::numNeighbor(iPoint, geometry);
-    const auto nj = Base::numNeighbor(jPoint, geometry);
+    const auto ni = numNeighbor(iPoint, geometry);
+    const auto nj = numNeighbor(jPoint, geometry);
     const Double sc2 = 3 * (ni+nj) / (ni*nj);
     const Double sc4 = 0.25*pow(sc2, 2);
 
@@ -442,8 +443,8 @@ public:
 
     /*--- Compute dissipation coefficient. ---*/
 
-    const auto ni = Base::numNeighbor(iPoint, geometry);
-    const auto nj = Base::numNeighbor(jPoint, geometry);
+    const auto ni = numNeighbor(iPoint, geometry);
+    const auto nj = numNeighbor(jPoint, geometry);
     const Double sc2 = 3 * (ni+nj) / (ni*nj);
 
     const auto si = gatherVariables(iPoint, solution.GetSensor());
@@ -513,8 +514,8 @@ public:
 
     /*--- Compute dissipation coefficient. ---*/
 
-    const auto ni = Base::numNeighbor(iPoint, geometry);
-    const auto nj = Base::numNeighbor(jPoint, geometry);
+    const auto ni = numNeighbor(iPoint, geometry);
+    const auto nj = numNeighbor(jPoint, geometry);
     const Double dissip = kappa0 * nDim * (ni+nj) / (ni*nj) * lambda;
 
     /*--- Update flux and Jacobians with dissipation term. ---*/
@@ -529,3 +530,287 @@ public:
     }
   }
 };
+
+/*!
+ * \class CCenteredIncBase
+ * \ingroup ConvDiscr
+ * \brief Base class for centered schemes (incompressible flow), derived classes
+ * implement the preconditioned dissipation term in a const "finalizeFlux" method.
+ * \note See CRoeBase for the role of Base.
+ */
+template<class Derived, class Base>
+class CCenteredIncBase : public Base {
+protected:
+  using Base::nDim;
+  static constexpr size_t nVar = CIncompressibleConservatives<nDim>::nVar;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nDim+8);
+
+  const su2double fixFactor;
+  const bool dynamicGrid;
+  const bool variableDensity;
+  const bool energy;
+  const su2double stretchParam = 0.3;
+
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CCenteredIncBase(const CConfig& config, Ts&... args) : Base(config, args...),
+    fixFactor(config.GetCent_Inc_Jac_Fix_Factor()),
+    dynamicGrid(config.GetDynamic_Grid()),
+    variableDensity(config.GetVariable_Density_Model()),
+    energy(config.GetEnergy_Equation()) {
+  }
+
+public:
+  /*!
+   * \brief Implementation of the base centered flux (incompressible flow).
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CIncEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Primitive variables. ---*/
+
+    CPair<CIncompressiblePrimitives<nDim,nPrimVar> > V;
+    V.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    CIncompressiblePrimitives<nDim,nPrimVar> avgV;
+    for (size_t iVar = 0; iVar < nPrimVar; ++iVar) {
+      avgV.all(iVar) = 0.5 * (V.i.all(iVar) + V.j.all(iVar));
+    }
+    const Double avgEnthalpy = 0.5 * (V.i.enthalpy() + V.j.enthalpy());
+
+    /*--- Derivative of the equation of state, only the ideal gas law for now. ---*/
+
+    const Double dRhodT = variableDensity? Double(-avgV.density() / avgV.temperature()) : Double(0.0);
+
+    /*--- Inviscid fluxes and Jacobians, based on the mean state. ---*/
+
+    auto flux = inviscidIncProjFlux(avgV.density(), avgV.velocity(), avgV.pressure(),
+                                    avgEnthalpy, normal);
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      jac_i = inviscidIncProjJac(avgV.density(), avgV.velocity(), avgV.beta2(), avgV.cp(),
+                                 avgV.temperature(), dRhodT, normal, 0.5);
+      jac_j = jac_i;
+    }
+
+    /*--- Grid motion. ---*/
+
+    Double projGridVel = 0.0;
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      projGridVel = 0.5*(dot(gatherVariables<nDim>(iPoint,gridVel), normal)+
+                         dot(gatherVariables<nDim>(jPoint,gridVel), normal));
+
+      incGridMotionCorrection(projGridVel, V, implicit, flux, jac_i, jac_j);
+    }
+
+    /*--- Preconditioner, difference of primitives, and mean of the local
+     *    spectral radii of the preconditioned system. ---*/
+
+    const auto precon = incPreconditioner<nDim>(avgV.density(), avgV.velocity(), avgV.beta2(),
+                                          avgV.cp(), avgV.temperature(), dRhodT);
+
+    VectorDbl<nVar> diffV;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      diffV(iVar) = V.i.all(iVar) - V.j.all(iVar);
+    }
+
+    const Double lambda_i = abs(dot(V.i.velocity(), normal) - projGridVel) + sqrt(V.i.beta2())*area;
+    const Double lambda_j = abs(dot(V.j.velocity(), normal) - projGridVel) + sqrt(V.j.beta2())*area;
+    const Double meanLambda = 0.5 * (lambda_i + lambda_j);
+
+    /*--- Finalize in derived class (static polymorphism). ---*/
+
+    const auto derived = static_cast<const Derived*>(this);
+
+    derived->finalizeFlux(flux, jac_i, jac_j, implicit, meanLambda, precon,
+                          diffV, iPoint, jPoint, geometry, solution);
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, avgV, V, solution_, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    if (!energy) removeEnergyContributions(implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
+
+/*!
+ * \class CJSTIncScheme
+ * \ingroup ConvDiscr
+ * \brief JST scheme with preconditioned scalar dissipation (incompressible flow).
+ */
+template<class Decorator>
+class CJSTIncScheme : public CCenteredIncBase<CJSTIncScheme<Decorator>,Decorator> {
+private:
+  using Base = CCenteredIncBase<CJSTIncScheme<Decorator>,Decorator>;
+  using Base::nDim;
+  using Base::nVar;
+  using Base::fixFactor;
+  using Base::stretchParam;
+  const su2double kappa2;
+  const su2double kappa4;
+
+public:
+  /*!
+   * \brief Constructor, forward everything to base.
+   */
+  template<class... Ts>
+  CJSTIncScheme(const CConfig& config, Ts&... args) : Base(config, args...),
+    kappa2(config.GetKappa_2nd_Flow()),
+    kappa4(config.GetKappa_4th_Flow()) {
+  }
+
+  /*!
+   * \brief Updates flux and Jacobians with preconditioned JST dissipation.
+   */
+  FORCEINLINE void finalizeFlux(VectorDbl<nVar>& flux,
+                                MatrixDbl<nVar>& jac_i,
+                                MatrixDbl<nVar>& jac_j,
+                                bool implicit,
+                                Double meanLambda,
+                                const MatrixDbl<nVar>& precon,
+                                const VectorDbl<nVar>& diffV,
+                                Int iPoint,
+                                Int jPoint,
+                                const CGeometry& geometry,
+                                const CIncEulerVariable& solution) const {
+
+    const Double lambda = correctedSpectralRadius(iPoint, jPoint, meanLambda, stretchParam, solution);
+
+    /*--- Compute dissipation coefficients. ---*/
+
+    const auto ni = numNeighbor(iPoint, geometry);
+    const auto nj = numNeighbor(jPoint, geometry);
+    const Double sc2 = 3 * (ni+nj) / (ni*nj);
+    const Double sc4 = 0.25*pow(sc2, 2);
+
+    const auto si = gatherVariables(iPoint, solution.GetSensor());
+    const auto sj = gatherVariables(jPoint, solution.GetSensor());
+    const Double eps2 = kappa2 * 0.5*(si+sj) * sc2;
+    const Double eps4 = fmax(0.0, kappa4-eps2) * sc4;
+
+    /*--- Update flux and Jacobians with preconditioned dissipation terms. ---*/
+
+    const auto lapl_i = gatherVariables<nVar>(iPoint, solution.GetUndivided_Laplacian());
+    const auto lapl_j = gatherVariables<nVar>(jPoint, solution.GetUndivided_Laplacian());
+
+    VectorDbl<nVar> dissip;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      dissip(iVar) = (eps2*diffV(iVar) - eps4*(lapl_i(iVar)-lapl_j(iVar))) * lambda;
+    }
+
+    const Double dissip_i = fixFactor * (eps2 + eps4*(ni+1)) * lambda;
+    const Double dissip_j = fixFactor * (eps2 + eps4*(nj+1)) * lambda;
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        flux(iVar) += precon(iVar,jVar) * dissip(jVar);
+        if (implicit) {
+          jac_i(iVar,jVar) += precon(iVar,jVar) * dissip_i;
+          jac_j(iVar,jVar) -= precon(iVar,jVar) * dissip_j;
+        }
+      }
+    }
+  }
+};
+
+/*!
+ * \class CLaxIncScheme
+ * \ingroup ConvDiscr
+ * \brief Lax–Friedrichs 1st order scheme with preconditioned dissipation (incompressible flow).
+ */
+template<class Decorator>
+class CLaxIncScheme : public CCenteredIncBase<CLaxIncScheme<Decorator>,Decorator> {
+private:
+  using Base = CCenteredIncBase<CLaxIncScheme<Decorator>,Decorator>;
+  using Base::nDim;
+  using Base::nVar;
+  using Base::fixFactor;
+  using Base::stretchParam;
+  const su2double kappa0;
+
+public:
+  /*!
+   * \brief Constructor, forward everything to base.
+   */
+  template<class... Ts>
+  CLaxIncScheme(const CConfig& config, Ts&... args) : Base(config, args...),
+    kappa0(config.GetKappa_1st_Flow()) {
+  }
+
+  /*!
+   * \brief Updates flux and Jacobians with 1st order preconditioned dissipation.
+   */
+  FORCEINLINE void finalizeFlux(VectorDbl<nVar>& flux,
+                                MatrixDbl<nVar>& jac_i,
+                                MatrixDbl<nVar>& jac_j,
+                                bool implicit,
+                                Double meanLambda,
+                                const MatrixDbl<nVar>& precon,
+                                const VectorDbl<nVar>& diffV,
+                                Int iPoint,
+                                Int jPoint,
+                                const CGeometry& geometry,
+                                const CIncEulerVariable& solution) const {
+
+    Double lambda = correctedSpectralRadius(iPoint, jPoint, meanLambda, stretchParam, solution);
+
+    /*--- Compute dissipation coefficient. ---*/
+
+    const auto ni = numNeighbor(iPoint, geometry);
+    const auto nj = numNeighbor(jPoint, geometry);
+    const Double dissip = kappa0 * nDim * (ni+nj) / (ni*nj) * lambda;
+
+    /*--- Update flux and Jacobians with preconditioned dissipation term. ---*/
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        const Double scale = precon(iVar,jVar) * dissip;
+        flux(iVar) += scale * diffV(jVar);
+        if (implicit) {
+          jac_i(iVar,jVar) += fixFactor * scale;
+          jac_j(iVar,jVar) -= fixFactor * scale;
+        }
+      }
+    }
+  }
+};
@@ -93,6 +93,33 @@ FORCEINLINE void musclEdgeLimited(Int iPoint,
   }
 }
 
+/*!
+ * \brief MUSCL reconstruction of the first nVarGrad variables of a pair, with the limiter type
+ * selected at runtime (none, edge-based van Albada, or the point-based limiters).
+ */
+template<size_t nVarGrad, size_t nDim, class VarType, class Limiter_t, class Gradient_t>
+FORCEINLINE void musclReconstruction(Int iPoint,
+                                     Int jPoint,
+                                     LIMITER limiterType,
+                                     const VectorDbl<nDim>& vector_ij,
+                                     const Limiter_t& limiters,
+                                     const Gradient_t& gradients,
+                                     CPair<VarType>& V) {
+  switch (limiterType) {
+  case LIMITER::NONE:
+    musclUnlimited<nVarGrad>(iPoint, vector_ij, 0.5, gradients, V.i.all);
+    musclUnlimited<nVarGrad>(jPoint, vector_ij,-0.5, gradients, V.j.all);
+    break;
+  case LIMITER::VAN_ALBADA_EDGE:
+    musclEdgeLimited<nVarGrad>(iPoint, jPoint, vector_ij, gradients, V);
+    break;
+  default:
+    musclPointLimited<nVarGrad>(iPoint, vector_ij, 0.5, limiters, gradients, V.i.all);
+    musclPointLimited<nVarGrad>(jPoint, vector_ij,-0.5, limiters, gradients, V.j.all);
+    break;
+  }
+}
+
 /*!
  * \brief Retrieve primitive variables for points i/j, reconstructing them if needed.
  * \note Density and enthalpy are recomputed from ideal gas EOS.
@@ -130,19 +157,8 @@ FORCEINLINE CPair<ReconVarType> reconstructPrimitives(Int iEdge, Int iPoint, Int
     /*--- Recompute density and enthalpy instead of reconstructing. ---*/
     constexpr auto nVarGrad = ReconVarType::nVar - 2;
 
-    switch (limiterType) {
-    case LIMITER::NONE:
-      musclUnlimited<nVarGrad>(iPoint, vector_ij, 0.5, gradients, V.i.all);
-      musclUnlimited<nVarGrad>(jPoint, vector_ij,-0.5, gradients, V.j.all);
-      break;
-    case LIMITER::VAN_ALBADA_EDGE:
-      musclEdgeLimited<nVarGrad>(iPoint, jPoint, vector_ij, gradients, V);
-      break;
-    default:
-      musclPointLimited<nVarGrad>(iPoint, vector_ij, 0.5, limiters, gradients, V.i.all);
-      musclPointLimited<nVarGrad>(jPoint, vector_ij,-0.5, limiters, gradients, V.j.all);
-      break;
-    }
+    musclReconstruction<nVarGrad>(iPoint, jPoint, limiterType, vector_ij, limiters, gradients, V);
+
     V.i.density() = V.i.pressure() / (gasConst * V.i.temperature());
     V.j.density() = V.j.pressure() / (gasConst * V.j.temperature());
 
@@ -452,3 +468,218 @@ FORCEINLINE void scalarDissipationJacobian(const VariableType& V,
     jac(nVar-1,0) += dissipConst * pow(V.velocity(iDim), 2);
   }
 }
+
+/*!
+ * \brief Retrieve incompressible primitive variables for points i/j, reconstructing them if needed.
+ * \note Only the first nVarGrad variables are reconstructed (pressure, velocity, temperature,
+ * density, and beta^2), the pressure is the dynamic pressure and can be negative, therefore
+ * only the temperature and the density are checked for non-physical values.
+ * \param[in] iEdge, iPoint, jPoint - Edge and its nodes.
+ * \param[in] muscl - If true, reconstruct, else simply copy.
+ * \param[in] checkRecon - Revert to first order if the reconstruction is non-physical.
+ * \param[in] limiterType - Type of flux limiter.
+ * \param[in] V1st - Pair of incompressible flow primitives for nodes i,j.
+ * \param[in] vector_ij - Distance vector from i to j.
+ * \param[in] solution - Entire solution container (a derived CVariable).
+ * \return Pair of primitive variables.
+ */
+template<size_t nVarGrad, class PrimVarType, size_t nDim, class VariableType>
+FORCEINLINE CPair<PrimVarType> reconstructIncPrimitives(Int iEdge, Int iPoint, Int jPoint,
+                                                        bool muscl, bool checkRecon,
+                                                        LIMITER limiterType,
+                                                        const CPair<PrimVarType>& V1st,
+                                                        const VectorDbl<nDim>& vector_ij,
+                                                        const VariableType& solution) {
+  static_assert(nVarGrad <= PrimVarType::nVar,"");
+
+  CPair<PrimVarType> V = V1st;
+  if (!muscl) return V;
+
+  musclReconstruction<nVarGrad>(iPoint, jPoint, limiterType, vector_ij, solution.GetLimiter_Primitive(),
+                                solution.GetGradient_Reconstruction(), V);
+  if (!checkRecon) return V;
+
+  /*--- Detect a non-physical reconstruction based on negative temperature or density. ---*/
+  Double bad_recon = fmax(fmin(V.i.temperature(), V.j.temperature()) < 0.0,
+                          fmin(V.i.density(), V.j.density()) < 0.0);
+  /*--- Handle SIMD dimensions 1 by 1. ---*/
+  for (size_t k = 0; k < Double::Size; ++k) {
+    bad_recon[k] = solution.UpdateNonPhysicalEdgeCounter(iEdge[k], bad_recon[k]);
+  }
+  /*--- Revert to first order if the state is non-physical. ---*/
+  for (size_t iVar = 0; iVar < nVarGrad; ++iVar) {
+    V.i.all(iVar) = bad_recon * V1st.i.all(iVar) + (1-bad_recon) * V.i.all(iVar);
+    V.j.all(iVar) = bad_recon * V1st.j.all(iVar) + (1-bad_recon) * V.j.all(iVar);
+  }
+  return V;
+}
+
+/*!
+ * \brief Convective projected (onto normal) flux (incompressible flow).
+ */
+template<size_t nDim, class RandomAccessIterator>
+FORCEINLINE VectorDbl<nDim+2> inviscidIncProjFlux(Double density, RandomAccessIterator velocity,
+                                                  Double pressure, Double enthalpy,
+                                                  const VectorDbl<nDim>& normal) {
+  const Double mdot = density * dot(velocity, normal);
+  VectorDbl<nDim+2> flux;
+  flux(0) = mdot;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    flux(iDim+1) = mdot*velocity[iDim] + normal(iDim)*pressure;
+  }
+  flux(nDim+1) = mdot*enthalpy;
+  return flux;
+}
+
+/*!
+ * \brief Jacobian of the convective flux w.r.t. the primitive variables (incompressible flow).
+ */
+template<size_t nDim, class RandomAccessIterator>
+FORCEINLINE MatrixDbl<nDim+2> inviscidIncProjJac(Double density, RandomAccessIterator velocity,
+                                                 Double beta2, Double cp, Double temperature,
+                                                 Double dRhodT, const VectorDbl<nDim>& normal,
+                                                 Double scale) {
+  MatrixDbl<nDim+2> jac;
+
+  const Double projVel = dot(velocity, normal);
+  const Double projVelOnBeta2 = projVel / beta2;
+  const Double enthalpy = cp * temperature;
+
+  jac(0,0) = scale * projVelOnBeta2;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    jac(0,iDim+1) = scale * density * normal(iDim);
+  }
+  jac(0,nDim+1) = scale * dRhodT * projVel;
+
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    jac(iDim+1,0) = scale * (normal(iDim) + velocity[iDim]*projVelOnBeta2);
+    for (size_t jDim = 0; jDim < nDim; ++jDim) {
+      jac(iDim+1,jDim+1) = scale * density * normal(jDim) * velocity[iDim];
+    }
+    jac(iDim+1,iDim+1) += scale * density * projVel;
+    jac(iDim+1,nDim+1) = scale * dRhodT * velocity[iDim] * projVel;
+  }
+
+  jac(nDim+1,0) = scale * enthalpy * projVelOnBeta2;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    jac(nDim+1,iDim+1) = scale * enthalpy * density * normal(iDim);
+  }
+  jac(nDim+1,nDim+1) = scale * cp * (temperature*dRhodT + density) * projVel;
+
+  return jac;
+}
+
+/*!
+ * \brief Preconditioning matrix, i.e. the Jacobian of the conservative
+ * w.r.t. the primitive variables (incompressible flow).
+ */
+template<size_t nDim, class RandomAccessIterator>
+FORCEINLINE MatrixDbl<nDim+2> incPreconditioner(Double density, RandomAccessIterator velocity,
+                                                Double beta2, Double cp, Double temperature,
+                                                Double dRhodT) {
+  MatrixDbl<nDim+2> precon;
+  precon = Double(0.0);
+
+  const Double oneOnBeta2 = 1 / beta2;
+
+  precon(0,0) = oneOnBeta2;
+  precon(0,nDim+1) = dRhodT;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    precon(iDim+1,0) = velocity[iDim] * oneOnBeta2;
+    precon(iDim+1,iDim+1) = density;
+    precon(iDim+1,nDim+1) = velocity[iDim] * dRhodT;
+  }
+  precon(nDim+1,0) = cp * temperature * oneOnBeta2;
+  precon(nDim+1,nDim+1) = cp * (dRhodT*temperature + density);
+
+  return precon;
+}
+
+/*!
+ * \brief Absolute value of the preconditioned projected Jacobian, i.e. P x |Lambda| x inv(P),
+ * where P diagonalizes inv(Precon) x dF/dV (incompressible flow).
+ * \note Same coefficients as CNumerics::GetPreconditionedProjJac.
+ */
+template<size_t nDim>
+FORCEINLINE MatrixDbl<nDim+2> incPreconditionedProjJac(Double density,
+                                                       const VectorDbl<nDim+2>& lambda,
+                                                       Double beta2,
+                                                       const VectorDbl<nDim>& unitNormal) {
+  MatrixDbl<nDim+2> mat;
+
+  const Double sumLambda = lambda(nDim) + lambda(nDim+1);
+  const Double diffLambda = lambda(nDim+1) - lambda(nDim);
+  const Double beta = sqrt(beta2);
+
+  mat(0,0) = 0.5 * sumLambda;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    mat(iDim+1,0) = unitNormal(iDim) * diffLambda / (2*beta*density);
+    mat(0,iDim+1) = 0.5 * beta * unitNormal(iDim) * density * diffLambda;
+  }
+  mat(nDim+1,0) = 0.0;
+
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    for (size_t jDim = 0; jDim < nDim; ++jDim) {
+      mat(iDim+1,jDim+1) = 0.5 * unitNormal(iDim) * unitNormal(jDim) * (sumLambda - 2*lambda(0));
+    }
+    mat(iDim+1,iDim+1) = 0.5 * sumLambda * pow(unitNormal(iDim),2);
+    for (size_t kDim = 0; kDim < nDim; ++kDim) {
+      if (kDim != iDim) mat(iDim+1,iDim+1) += 2 * lambda(0) * pow(unitNormal(kDim),2);
+    }
+    mat(nDim+1,iDim+1) = 0.0;
+    mat(iDim+1,nDim+1) = 0.0;
+  }
+
+  mat(0,nDim+1) = 0.0;
+  mat(nDim+1,nDim+1) = lambda(nDim-1);
+
+  return mat;
+}
+
+/*!
+ * \brief Correct the flux and Jacobians of incompressible schemes for grid motion.
+ * \note The scalar schemes (e.g. CCentJSTInc_Flow) add the Jacobian correction inside
+ * their loop over variables, i.e. nVar times, here it is added once. The residuals match.
+ * \param[in] projGridVel - Grid velocity projected onto the (area-scaled) normal.
+ */
+template<class PrimVarType, size_t nVar>
+FORCEINLINE void incGridMotionCorrection(Double projGridVel,
+                                         const CPair<PrimVarType>& V,
+                                         bool implicit,
+                                         VectorDbl<nVar>& flux,
+                                         MatrixDbl<nVar>& jac_i,
+                                         MatrixDbl<nVar>& jac_j) {
+  constexpr size_t nDim = PrimVarType::nDim;
+  const auto U_i = incompressibleConservatives(V.i);
+  const auto U_j = incompressibleConservatives(V.j);
+
+  for (size_t iVar = 0; iVar < nVar; ++iVar) {
+    flux(iVar) -= projGridVel * 0.5*(U_i.all(iVar) + U_j.all(iVar));
+  }
+  if (implicit) {
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      jac_i(iDim+1,iDim+1) -= 0.5*projGridVel*V.i.density();
+      jac_j(iDim+1,iDim+1) -= 0.5*projGridVel*V.j.density();
+    }
+    jac_i(nDim+1,nDim+1) -= 0.5*projGridVel*V.i.density()*V.i.cp();
+    jac_j(nDim+1,nDim+1) -= 0.5*projGridVel*V.j.density()*V.j.cp();
+  }
+}
+
+/*!
+ * \brief Remove the energy contributions when the energy equation is not solved (incompressible flow).
+ */
+template<size_t nVar>
+FORCEINLINE void removeEnergyContributions(bool implicit,
+                                           VectorDbl<nVar>& flux,
+                                           MatrixDbl<nVar>& jac_i,
+                                           MatrixDbl<nVar>& jac_j) {
+  flux(nVar-1) = 0.0;
+  if (!implicit) return;
+  for (size_t iVar = 0; iVar < nVar; ++iVar) {
+    jac_i(iVar,nVar-1) = 0.0;
+    jac_j(iVar,nVar-1) = 0.0;
+    jac_i(nVar-1,iVar) = 0.0;
+    jac_j(nVar-1,iVar) = 0.0;
+  }
+}
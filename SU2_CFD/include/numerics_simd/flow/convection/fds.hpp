@@ -0,0 +1,223 @@
+/*!
+ * \file fds.hpp
+ * \brief Flux-Difference-Splitting scheme (incompressible flow).
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../variables.hpp"
+#include "common.hpp"
+#include "../../../variables/CIncEulerVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CFDSIncScheme
+ * \ingroup ConvDiscr
+ * \brief Flux-Difference-Splitting scheme for incompressible flow,
+ * vectorized version of CUpwFDSInc_Flow.
+ */
+template<class Decorator>
+class CFDSIncScheme : public Decorator {
+private:
+  using Base = Decorator;
+  using Base::nDim;
+  static constexpr size_t nVar = CIncompressibleConservatives<nDim>::nVar;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nDim+8);
+
+  const bool finestGrid;
+  const bool dynamicGrid;
+  const bool muscl;
+  const bool variableDensity;
+  const bool energy;
+  const LIMITER typeLimiter;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CFDSIncScheme(const CConfig& config, unsigned iMesh, Ts&... args) : Base(config, iMesh, args...),
+    finestGrid(iMesh == MESH_0),
+    dynamicGrid(config.GetDynamic_Grid()),
+    muscl(finestGrid && config.GetMUSCL_Flow()),
+    variableDensity(config.GetVariable_Density_Model()),
+    energy(config.GetEnergy_Equation()),
+    typeLimiter(config.GetKind_SlopeLimit_Flow()) {
+  }
+
+  /*!
+   * \brief Implementation of the FDS flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CIncEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Reconstructed primitives, the temperature and density
+     *    are only checked if the energy equation is solved. ---*/
+
+    CPair<CIncompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    auto V = reconstructIncPrimitives<nPrimVarGrad>(
+        iEdge, iPoint, jPoint, muscl, energy, typeLimiter, V1st, vector_ij, solution);
+
+    /*--- Mean variables. ---*/
+
+    VectorDbl<nDim> meanVel;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      meanVel(iDim) = 0.5 * (V.i.velocity(iDim) + V.j.velocity(iDim));
+    }
+    const Double meanDensity = 0.5 * (V.i.density() + V.j.density());
+    const Double meanBeta2 = 0.5 * (V.i.beta2() + V.j.beta2());
+    const Double meanCp = 0.5 * (V.i.cp() + V.j.cp());
+    const Double meanTemperature = 0.5 * (V.i.temperature() + V.j.temperature());
+
+    /*--- Derivative of the equation of state, only the ideal gas law for now. ---*/
+
+    Double dRhodT_i = 0.0, dRhodT_j = 0.0, meandRhodT = 0.0;
+    if (variableDensity) {
+      dRhodT_i = -V.i.density() / V.i.temperature();
+      dRhodT_j = -V.j.density() / V.j.temperature();
+      meandRhodT = -meanDensity / meanTemperature;
+    }
+
+    /*--- Grid motion. ---*/
+
+    Double projGridVel = 0.0;
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      projGridVel = 0.5*(dot(gatherVariables<nDim>(iPoint,gridVel), normal)+
+                         dot(gatherVariables<nDim>(jPoint,gridVel), normal));
+    }
+
+    /*--- Eigenvalues of the preconditioned system, with the
+     *    artificial sound speed based on beta^2. ---*/
+
+    const Double projVel = dot(meanVel, normal) - projGridVel;
+    const Double meanSoundSpeed = sqrt(meanBeta2) * area;
+
+    VectorDbl<nVar> lambda;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      lambda(iDim) = abs(projVel);
+    }
+    lambda(nDim) = abs(projVel - meanSoundSpeed);
+    lambda(nDim+1) = abs(projVel + meanSoundSpeed);
+
+    /*--- Preconditioner and |A_precon| = P x |Lambda| x inv(P). ---*/
+
+    const auto precon = incPreconditioner<nDim>(meanDensity, meanVel, meanBeta2,
+                                          meanCp, meanTemperature, meandRhodT);
+    const auto invPreconA = incPreconditionedProjJac(meanDensity, lambda, meanBeta2, unitNormal);
+
+    /*--- Inviscid fluxes and Jacobians. ---*/
+
+    const auto flux_i = inviscidIncProjFlux(V.i.density(), V.i.velocity(), V.i.pressure(),
+                                            V.i.enthalpy(), normal);
+    const auto flux_j = inviscidIncProjFlux(V.j.density(), V.j.velocity(), V.j.pressure(),
+                                            V.j.enthalpy(), normal);
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      jac_i = inviscidIncProjJac(V.i.density(), V.i.velocity(), V.i.beta2(), V.i.cp(),
+                                 V.i.temperature(), dRhodT_i, normal, 0.5);
+      jac_j = inviscidIncProjJac(V.j.density(), V.j.velocity(), V.j.beta2(), V.j.cp(),
+                                 V.j.temperature(), dRhodT_j, normal, 0.5);
+    }
+
+    /*--- Dissipation, Precon x |A_precon| x (V_j - V_i). ---*/
+
+    VectorDbl<nVar> diffV;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      diffV(iVar) = V.j.all(iVar) - V.i.all(iVar);
+    }
+
+    VectorDbl<nVar> flux;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) = 0.5 * (flux_i(iVar) + flux_j(iVar));
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        Double dissip = 0.0;
+        for (size_t kVar = 0; kVar < nVar; ++kVar) {
+          dissip += 0.5 * precon(iVar,kVar) * invPreconA(kVar,jVar);
+        }
+        flux(iVar) -= dissip * diffV(jVar);
+        if (implicit) {
+          jac_i(iVar,jVar) += dissip;
+          jac_j(iVar,jVar) -= dissip;
+        }
+      }
+    }
+
+    /*--- Correct for grid motion. ---*/
+
+    if (dynamicGrid) {
+      incGridMotionCorrection(projGridVel, V, implicit, flux, jac_i, jac_j);
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V1st, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    if (!energy) removeEnergyContributions(implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
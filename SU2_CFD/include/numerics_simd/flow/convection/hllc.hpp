@@ -0,0 +1,317 @@
+/*!
+ * \file hllc.hpp
+ * \brief HLLC convective scheme (ideal gas).
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../variables.hpp"
+#include "common.hpp"
+#include "../../../variables/CEulerVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \brief Jacobian of the HLLC star flux w.r.t. the conservative variables of one of the sides (X).
+ * \note The star state may be on the side of X (own = 1) or on the other side (own = 0), the
+ * contributions that only exist when the star state is computed from X are scaled by "own".
+ * \param[in] sign - 1 for the left (i) side, -1 for the right (j) side.
+ * \param[in] sX - Wave speed of side X (sL or sR).
+ * \param[in] rhoSY - rho_X * (s_Y - vn_Y), where Y is the other side.
+ */
+template<size_t nDim, class RandomAccessIterator>
+FORCEINLINE MatrixDbl<nDim+2> hllcStarJacobian(Double gamma, Double own, Double sign,
+                                               const VectorDbl<nDim>& unitNormal,
+                                               RandomAccessIterator velocity, Double projVel,
+                                               Double enthalpy, Double sX, Double rhoSY,
+                                               Double rhoSum, Double sM, Double pStar,
+                                               Double omega, const VectorDbl<nDim+2>& starU) {
+  constexpr size_t nVar = nDim+2;
+  const Double gamma_m_1 = gamma - 1;
+  const Double omegaSM = omega * sM;
+  const Double eStar = starU(nVar-1);
+
+  /*--- Derivatives of pressure. ---*/
+
+  VectorDbl<nVar> dPI;
+  dPI(0) = 0.5 * gamma_m_1 * squaredNorm<nDim>(velocity);
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    dPI(iDim+1) = -gamma_m_1 * velocity[iDim];
+  }
+  dPI(nVar-1) = gamma_m_1;
+
+  /*--- Derivatives of the contact speed, pressure, and energy of the star state. ---*/
+
+  VectorDbl<nVar> dSm, dpStar, dEStar;
+  dSm(0) = -projVel*projVel + sM*sX + dPI(0);
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    dSm(iDim+1) = unitNormal(iDim) * (2*projVel - sX - sM) + dPI(iDim+1);
+  }
+  dSm(nVar-1) = dPI(nVar-1);
+
+  for (size_t iVar = 0; iVar < nVar; ++iVar) {
+    dSm(iVar) *= sign / rhoSum;
+    dpStar(iVar) = rhoSY * dSm(iVar);
+    dEStar(iVar) = omega * (sM * dpStar(iVar) + (eStar + pStar) * dSm(iVar));
+  }
+  dEStar(0) += own * omega * projVel * (enthalpy - dPI(0));
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    dEStar(iDim+1) -= own * omega * (unitNormal(iDim) * enthalpy + projVel * dPI(iDim+1));
+  }
+  dEStar(nVar-1) += own * omega * (sX - projVel - projVel * dPI(nVar-1));
+
+  /*--- Assemble the Jacobian. ---*/
+
+  MatrixDbl<nVar> jac;
+
+  for (size_t iVar = 0; iVar < nVar; ++iVar) {
+    jac(0,iVar) = (omegaSM + 1) * starU(0) * dSm(iVar);
+  }
+  jac(0,0) += own * omegaSM * sX;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    jac(0,iDim+1) -= own * omegaSM * unitNormal(iDim);
+  }
+
+  for (size_t jDim = 0; jDim < nDim; ++jDim) {
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      jac(jDim+1,iVar) = (omegaSM + 1) * (unitNormal(jDim) * dpStar(iVar) + starU(jDim+1) * dSm(iVar)) -
+                         own * omegaSM * dPI(iVar) * unitNormal(jDim);
+    }
+    jac(jDim+1,0) += own * omegaSM * velocity[jDim] * projVel;
+    jac(jDim+1,jDim+1) += own * omegaSM * (sX - projVel);
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      jac(jDim+1,iDim+1) -= own * omegaSM * velocity[jDim] * unitNormal(iDim);
+    }
+  }
+
+  for (size_t iVar = 0; iVar < nVar; ++iVar) {
+    jac(nVar-1,iVar) = sM * (dEStar(iVar) + dpStar(iVar)) + (eStar + pStar) * dSm(iVar);
+  }
+  return jac;
+}
+
+/*!
+ * \class CHLLCScheme
+ * \ingroup ConvDiscr
+ * \brief HLLC scheme for ideal gas, vectorized version of CUpwHLLC_Flow.
+ * \note The four wave configurations are evaluated for all edges of the
+ * SIMD batch and then blended, i.e. the scheme is branchless.
+ */
+template<class Decorator>
+class CHLLCScheme : public Decorator {
+private:
+  using Base = Decorator;
+  using Base::nDim;
+  static constexpr size_t nVar = CCompressibleConservatives<nDim>::nVar;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nPrimVarGrad);
+
+  const su2double gamma;
+  const su2double gasConst;
+  const bool finestGrid;
+  const bool dynamicGrid;
+  const bool muscl;
+  const LIMITER typeLimiter;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CHLLCScheme(const CConfig& config, unsigned iMesh, Ts&... args) : Base(config, iMesh, args...),
+    gamma(config.GetGamma()),
+    gasConst(config.GetGas_ConstantND()),
+    finestGrid(iMesh == MESH_0),
+    dynamicGrid(config.GetDynamic_Grid()),
+    muscl(finestGrid && config.GetMUSCL_Flow()),
+    typeLimiter(config.GetKind_SlopeLimit_Flow()) {
+  }
+
+  /*!
+   * \brief Implementation of the HLLC flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Reconstructed primitives. ---*/
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    auto V = reconstructPrimitives<CCompressiblePrimitives<nDim,nPrimVarGrad> >(
+        iEdge, iPoint, jPoint, gamma, gasConst, muscl, typeLimiter, V1st, vector_ij, solution);
+
+    /*--- Compute conservative variables. ---*/
+
+    CPair<CCompressibleConservatives<nDim> > U;
+    U.i = compressibleConservatives(V.i);
+    U.j = compressibleConservatives(V.j);
+
+    /*--- Grid motion. ---*/
+
+    Double projGridVel = 0.0;
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      projGridVel = 0.5*(dot(gatherVariables<nDim>(iPoint,gridVel), unitNormal)+
+                         dot(gatherVariables<nDim>(jPoint,gridVel), unitNormal));
+    }
+
+    /*--- Speeds of sound and projected velocities relative to the grid (the
+     *    grid velocity correction of the sound speeds is as in CUpwHLLC_Flow). ---*/
+
+    const Double a_i = sqrt((gamma-1) * (V.i.enthalpy() - 0.5*squaredNorm<nDim>(V.i.velocity()))) - projGridVel;
+    const Double a_j = sqrt((gamma-1) * (V.j.enthalpy() - 0.5*squaredNorm<nDim>(V.j.velocity()))) + projGridVel;
+    const Double vn_i = dot(V.i.velocity(), unitNormal) - projGridVel;
+    const Double vn_j = dot(V.j.velocity(), unitNormal) - projGridVel;
+
+    /*--- Wave speeds, from the Roe-averaged variables. ---*/
+
+    const auto roeAvg = roeAveragedVariables(gamma, V, unitNormal);
+    const Double roeProjVel = roeAvg.projVel - projGridVel;
+    const Double roeSoundSpeed = roeAvg.speedSound - projGridVel;
+
+    const Double sL = fmin(roeProjVel - roeSoundSpeed, vn_i - a_i);
+    const Double sR = fmax(roeProjVel + roeSoundSpeed, vn_j + a_j);
+
+    /*--- Speed of the contact surface and pressure in the star region. ---*/
+
+    const Double rhoSum = V.j.density()*(sR - vn_j) - V.i.density()*(sL - vn_i);
+    const Double sM = (V.i.pressure() - V.j.pressure() - V.i.density()*vn_i*(sL - vn_i) +
+                       V.j.density()*vn_j*(sR - vn_j)) / rhoSum;
+    const Double pStar = V.j.density()*(vn_j - sR)*(vn_j - sM) + V.j.pressure();
+
+    /*--- Masks for the wave configurations, the star state is on
+     *    the side of iPoint if the contact speed is positive. ---*/
+
+    const Double leftStar = sM > 0.0;
+    const Double supersonic_i = leftStar * (sL > 0.0);
+    const Double supersonic_j = (1-leftStar) * (sR < 0.0);
+    const Double subsonic = 1 - supersonic_i - supersonic_j;
+
+    const auto blend = [&leftStar](const Double& left, const Double& right) {
+      return leftStar*left + (1-leftStar)*right;
+    };
+
+    /*--- Star state. ---*/
+
+    const Double sK = blend(sL, sR);
+    const Double vnK = blend(vn_i, vn_j);
+    const Double rhoK = blend(V.i.density(), V.j.density());
+    const Double pK = blend(V.i.pressure(), V.j.pressure());
+    const Double omega = 1 / (sK - sM);
+    const Double rhoStar = rhoK * (sK - vnK) * omega;
+
+    VectorDbl<nVar> starU;
+    starU(0) = rhoStar;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      starU(iDim+1) = rhoStar * blend(V.i.velocity(iDim), V.j.velocity(iDim)) +
+                      (pStar - pK) * unitNormal(iDim) * omega;
+    }
+    starU(nVar-1) = rhoStar * blend(U.i.energy(), U.j.energy()) - (pK*vnK - pStar*sM) * omega;
+
+    /*--- Flux. ---*/
+
+    const Double mdot_i = V.i.density() * vn_i;
+    const Double mdot_j = V.j.density() * vn_j;
+
+    VectorDbl<nVar> flux;
+    flux(0) = supersonic_i*mdot_i + supersonic_j*mdot_j + subsonic*sM*starU(0);
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      flux(iDim+1) = supersonic_i * (mdot_i*V.i.velocity(iDim) + V.i.pressure()*unitNormal(iDim)) +
+                     supersonic_j * (mdot_j*V.j.velocity(iDim) + V.j.pressure()*unitNormal(iDim)) +
+                     subsonic * (sM*starU(iDim+1) + pStar*unitNormal(iDim));
+    }
+    flux(nVar-1) = supersonic_i*mdot_i*V.i.enthalpy() + supersonic_j*mdot_j*V.j.enthalpy() +
+                   subsonic * (sM*(starU(nVar-1) + pStar) + pStar*projGridVel);
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) *= area;
+    }
+
+    /*--- Jacobians. ---*/
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      const auto starJac_i = hllcStarJacobian(gamma, leftStar, 1.0, unitNormal, V.i.velocity(), vn_i,
+                                              V.i.enthalpy(), sL, V.i.density()*(sR - vn_j), rhoSum,
+                                              sM, pStar, omega, starU);
+      const auto starJac_j = hllcStarJacobian(gamma, 1-leftStar, -1.0, unitNormal, V.j.velocity(), vn_j,
+                                              V.j.enthalpy(), sR, V.j.density()*(sL - vn_i), rhoSum,
+                                              sM, pStar, omega, starU);
+
+      jac_i = inviscidProjJac(gamma, V.i.velocity(), U.i.energy(), normal, supersonic_i);
+      jac_j = inviscidProjJac(gamma, V.j.velocity(), U.j.energy(), normal, supersonic_j);
+
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        for (size_t jVar = 0; jVar < nVar; ++jVar) {
+          jac_i(iVar,jVar) += subsonic * area * starJac_i(iVar,jVar);
+          jac_j(iVar,jVar) += subsonic * area * starJac_j(iVar,jVar);
+        }
+      }
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V1st, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
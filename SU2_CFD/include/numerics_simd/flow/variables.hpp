@@ -97,6 +97,71 @@ FORCEINLINE CCompressibleConservatives<nDim> compressibleConservatives(const CCo
   return U;
 }
 
+/*!
+ * \brief Type to store incompressible primitive variables and access them by name.
+ */
+template<size_t nDim_, size_t nVar_>
+struct CIncompressiblePrimitives {
+  static constexpr size_t nDim = nDim_;
+  static constexpr size_t nVar = nVar_;
+  VectorDbl<nVar> all;
+  FORCEINLINE Double& pressure() { return all(0); }
+  FORCEINLINE Double& temperature() { return all(nDim+1); }
+  FORCEINLINE Double& density() { return all(nDim+2); }
+  FORCEINLINE Double& beta2() { return all(nDim+3); }
+  FORCEINLINE Double& velocity(size_t iDim) { return all(iDim+1); }
+  FORCEINLINE const Double& pressure() const { return all(0); }
+  FORCEINLINE const Double& temperature() const { return all(nDim+1); }
+  FORCEINLINE const Double& density() const { return all(nDim+2); }
+  FORCEINLINE const Double& beta2() const { return all(nDim+3); }
+  FORCEINLINE const Double& velocity(size_t iDim) const { return all(iDim+1); }
+  FORCEINLINE const Double* velocity() const { return &velocity(0); }
+
+  /*--- Un-reconstructed variables. ---*/
+  FORCEINLINE Double& laminarVisc() { return all(nDim+4); }
+  FORCEINLINE Double& eddyVisc() { return all(nDim+5); }
+  FORCEINLINE Double& thermalCond() { return all(nDim+6); }
+  FORCEINLINE Double& cp() { return all(nDim+7); }
+  FORCEINLINE const Double& laminarVisc() const { return all(nDim+4); }
+  FORCEINLINE const Double& eddyVisc() const { return all(nDim+5); }
+  FORCEINLINE const Double& thermalCond() const { return all(nDim+6); }
+  FORCEINLINE const Double& cp() const { return all(nDim+7); }
+
+  FORCEINLINE Double enthalpy() const { return cp() * temperature(); }
+};
+
+/*!
+ * \brief Type to store incompressible conservative (i.e. solution) variables.
+ * \note The first variable is density, not pressure, see the grid motion terms.
+ */
+template<size_t nDim_>
+struct CIncompressibleConservatives {
+  static constexpr size_t nDim = nDim_;
+  static constexpr size_t nVar = nDim+2;
+  VectorDbl<nVar> all;
+
+  FORCEINLINE Double& density() { return all(0); }
+  FORCEINLINE Double& rhoEnthalpy() { return all(nDim+1); }
+  FORCEINLINE Double& momentum(size_t iDim) { return all(iDim+1); }
+  FORCEINLINE const Double& density() const { return all(0); }
+  FORCEINLINE const Double& rhoEnthalpy() const { return all(nDim+1); }
+  FORCEINLINE const Double& momentum(size_t iDim) const { return all(iDim+1); }
+};
+
+/*!
+ * \brief Primitive to conservative conversion (incompressible flow).
+ */
+template<size_t nDim, size_t N>
+FORCEINLINE CIncompressibleConservatives<nDim> incompressibleConservatives(const CIncompressiblePrimitives<nDim,N>& V) {
+  CIncompressibleConservatives<nDim> U;
+  U.density() = V.density();
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    U.momentum(iDim) = V.density() * V.velocity(iDim);
+  }
+  U.rhoEnthalpy() = V.density() * V.enthalpy();
+  return U;
+}
+
 /*!
  * \brief Roe-averaged variables.
  */
@@ -0,0 +1,233 @@
+/*!
+ * \file common.hpp
+ * \brief Common types and helpers for the discretization of scalar transport equations.
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../CNumericsSIMD.hpp"
+#include "../util.hpp"
+#include "../flow/diffusion/common.hpp"
+
+/*!
+ * \brief Flow properties used by the diffusion of scalars (not reconstructed).
+ */
+struct CScalarFlowProperties {
+  Double density;
+  Double laminarVisc;
+  Double eddyVisc;
+};
+
+/*!
+ * \brief Square Jacobian block, unlike MatrixDbl it has (i,j) access also for a single variable.
+ */
+template<size_t N>
+struct CScalarJacobian {
+  VectorDbl<N*N> all;
+  FORCEINLINE Double& operator()(size_t i, size_t j) { return all(i*N + j); }
+  FORCEINLINE const Double& operator()(size_t i, size_t j) const { return all(i*N + j); }
+};
+
+/*!
+ * \brief Residual contributions of one edge to the scalar transport equations.
+ * \note In a conservative discretization the i and j terms are equal, the
+ * non-conservative SA and SST diffusion are evaluated on each side of the edge.
+ */
+template<size_t nVar_>
+struct CScalarEdgeTerms {
+  static constexpr size_t nVar = nVar_;
+  CPair<VectorDbl<nVar> > flux;   /*!< \brief Flux added to point i (flux.i) and subtracted from point j (flux.j). */
+  CPair<CScalarJacobian<nVar> > jac_i;  /*!< \brief Derivatives of flux.i w.r.t. the variables of i and j. */
+  CPair<CScalarJacobian<nVar> > jac_j;  /*!< \brief Derivatives of flux.j w.r.t. the variables of i and j. */
+
+  /*!
+   * \brief The terms are accumulated, therefore they start at zero.
+   */
+  CScalarEdgeTerms() {
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux.i(iVar) = 0.0;
+      flux.j(iVar) = 0.0;
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        jac_i.i(iVar,jVar) = 0.0;
+        jac_i.j(iVar,jVar) = 0.0;
+        jac_j.i(iVar,jVar) = 0.0;
+        jac_j.j(iVar,jVar) = 0.0;
+      }
+    }
+  }
+
+  /*!
+   * \brief Add a conservative flux (the same for i and j) and its Jacobians.
+   */
+  FORCEINLINE void addConservative(const VectorDbl<nVar>& f, const CScalarJacobian<nVar>& dfdUi,
+                                   const CScalarJacobian<nVar>& dfdUj, passivedouble scale = 1) {
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux.i(iVar) += scale * f(iVar);
+      flux.j(iVar) += scale * f(iVar);
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        jac_i.i(iVar,jVar) += scale * dfdUi(iVar,jVar);
+        jac_i.j(iVar,jVar) += scale * dfdUj(iVar,jVar);
+        jac_j.i(iVar,jVar) += scale * dfdUi(iVar,jVar);
+        jac_j.j(iVar,jVar) += scale * dfdUj(iVar,jVar);
+      }
+    }
+  }
+};
+
+/*!
+ * \brief Gather the gradient of one variable.
+ * \note The gather helpers of the flow numerics (e.g. averageGradient) return MatrixDbl<nVar,nDim>,
+ * which is a row vector when nVar is 1, the scalar equations are therefore handled 1 by 1.
+ */
+template<size_t nDim, class Gradient_t>
+FORCEINLINE VectorDbl<nDim> gatherGradient(Int iPoint, size_t iVar, const Gradient_t& gradient) {
+  VectorDbl<nDim> grad;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    for (size_t k = 0; k < Double::Size; ++k) {
+      AD::SetPreaccIn(gradient(iPoint[k],iVar,iDim));
+      grad(iDim)[k] = gradient(iPoint[k],iVar,iDim);
+    }
+  }
+  return grad;
+}
+
+/*!
+ * \brief MUSCL reconstruction of scalar variables, with an optional point-based limiter.
+ * \param[in] iPoint - Point being reconstructed.
+ * \param[in] vector_ij - Distance vector from i to j.
+ * \param[in] scale - 0.5 for i, -0.5 for j.
+ * \param[in] limiter - Limiters of the variables, or nullptr if they are not used.
+ * \param[in] gradient - Reconstruction gradients.
+ * \param[in,out] U - Variables at iPoint, reconstructed at the mid point of the edge.
+ */
+template<size_t nVar, size_t nDim, class Limiter_t, class Gradient_t>
+FORCEINLINE void musclScalar(Int iPoint, const VectorDbl<nDim>& vector_ij, Double scale,
+                             const Limiter_t* limiter, const Gradient_t& gradient, VectorDbl<nVar>& U) {
+  for (size_t iVar = 0; iVar < nVar; ++iVar) {
+    Double proj = scale * dot(gatherGradient<nDim>(iPoint, iVar, gradient), vector_ij);
+    if (limiter) {
+      Double lim;
+      for (size_t k = 0; k < Double::Size; ++k) {
+        AD::SetPreaccIn((*limiter)(iPoint[k],iVar));
+        lim[k] = (*limiter)(iPoint[k],iVar);
+      }
+      proj *= lim;
+    }
+    U(iVar) += proj;
+  }
+}
+
+/*!
+ * \brief Projected (onto the normal) average gradient, corrected with the
+ * directional derivative along the edge to avoid odd-even decoupling.
+ * \param[in] iPoint, jPoint - Points of the edge.
+ * \param[in] normal - Area-scaled normal.
+ * \param[in] vector_ij - Distance vector from i to j.
+ * \param[in] U - Pair of (not reconstructed) variables.
+ * \param[in] gradient - Gradients of the variables.
+ * \param[out] projVector_ij - (vector_ij . normal) / |vector_ij|^2, for the Jacobians.
+ * \return Corrected projected gradients.
+ */
+template<size_t nVar, size_t nDim, class Gradient_t>
+FORCEINLINE VectorDbl<nVar> projectedMeanGradient(Int iPoint, Int jPoint,
+                                                  const VectorDbl<nDim>& normal,
+                                                  const VectorDbl<nDim>& vector_ij,
+                                                  const CPair<VectorDbl<nVar> >& U,
+                                                  const Gradient_t& gradient,
+                                                  Double& projVector_ij) {
+  projVector_ij = dot(vector_ij, normal) / fmax(squaredNorm(vector_ij), EPS);
+
+  VectorDbl<nVar> projGrad;
+  for (size_t iVar = 0; iVar < nVar; ++iVar) {
+    auto avgGrad = gatherGradient<nDim>(iPoint, iVar, gradient);
+    const auto grad_j = gatherGradient<nDim>(jPoint, iVar, gradient);
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      avgGrad(iDim) = 0.5 * (avgGrad(iDim) + grad_j(iDim));
+    }
+    const Double edgeProj = dot(avgGrad, vector_ij);
+    projGrad(iVar) = dot(avgGrad, normal) - (edgeProj - (U.j(iVar) - U.i(iVar))) * projVector_ij;
+  }
+  return projGrad;
+}
+
+/*!
+ * \brief Update the matrix and right-hand-side of a linear system with the residual of a scalar edge.
+ * \note With the reducer strategy only conservative discretizations are supported, i.e. the "i" terms are
+ * used, the flux is stored per edge and the diagonal blocks are computed later by the solver.
+ */
+template<size_t nVar>
+FORCEINLINE void updateLinearSystem(Int iEdge,
+                                    Int iPoint,
+                                    Int jPoint,
+                                    bool implicit,
+                                    UpdateType updateType,
+                                    Double updateMask,
+                                    const CScalarEdgeTerms<nVar>& terms,
+                                    CSysVector<su2double>& vector,
+                                    SparseMatrixType& matrix) {
+  const bool reduction = (updateType == UpdateType::REDUCTION);
+
+  /*--- Handle SIMD dimensions 1 by 1, skipping if the mask is 0. ---*/
+  for (size_t k = 0; k < Double::Size; ++k) {
+    if (updateMask[k] == 0) continue;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      if (reduction) {
+        vector(iEdge[k],iVar) = terms.flux.i(iVar)[k];
+      } else {
+        vector(iPoint[k],iVar) += terms.flux.i(iVar)[k];
+        vector(jPoint[k],iVar) -= terms.flux.j(iVar)[k];
+      }
+    }
+  }
+  if (!implicit) return;
+
+  auto wasActive = AD::BeginPassive();
+  for (size_t k = 0; k < Double::Size; ++k) {
+    if (updateMask[k] == 0) continue;
+
+#ifdef CODI_FORWARD_TYPE
+    su2double *bii, *bij, *bji, *bjj;
+#else
+    su2mixedfloat *bii, *bij, *bji, *bjj;
+#endif
+    matrix.GetBlocks(iEdge[k], iPoint[k], jPoint[k], bii, bij, bji, bjj);
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        const auto idx = iVar*nVar + jVar;
+        if (reduction) {
+          /*--- Off-diagonal blocks only, the diagonal is the column sum (see CSysMatrix::SetBlocks). ---*/
+          bij[idx] = SU2_TYPE::GetValue(terms.jac_i.j(iVar,jVar)[k]);
+          bji[idx] = -SU2_TYPE::GetValue(terms.jac_i.i(iVar,jVar)[k]);
+          continue;
+        }
+        bii[idx] += SU2_TYPE::GetValue(terms.jac_i.i(iVar,jVar)[k]);
+        bij[idx] += SU2_TYPE::GetValue(terms.jac_i.j(iVar,jVar)[k]);
+        bji[idx] -= SU2_TYPE::GetValue(terms.jac_j.i(iVar,jVar)[k]);
+        bjj[idx] -= SU2_TYPE::GetValue(terms.jac_j.j(iVar,jVar)[k]);
+      }
+    }
+  }
+  AD::EndPassive(wasActive);
+}
@@ -0,0 +1,226 @@
+/*!
+ * \file convection.hpp
+ * \brief Upwind convection of scalar transport equations (turbulence,
+ *        transition and species), combined with their diffusion.
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "common.hpp"
+#include "diffusion.hpp"
+#include "../flow/convection/common.hpp"
+#include "../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CUpwScalarScheme
+ * \ingroup ConvDiscr
+ * \brief First order upwind convection of scalars (optionally MUSCL-reconstructed),
+ * the vectorized version of CUpwScalar and its derived classes. The diffusion of
+ * each equation system is added by the decorator (see CSADiffusion for example).
+ * \note Scalars are convected with the (un)reconstructed velocity of the flow, or with
+ * the mass fluxes of the flow solver for the "bounded scalar" formulation.
+ */
+template<class FlowIndices, class Decorator>
+class CUpwScalarScheme final : public Decorator {
+private:
+  using Base = Decorator;
+  using Base::nDim;
+  using Base::nVar;
+  using Base::densityWeighted;
+  static constexpr size_t nFlowPrimVar = nDim+7;
+
+  const FlowIndices idx;
+  const CVariable* const flowVars;
+  const su2activevector* const edgeMassFluxes;
+  const bool bounded;
+  const bool musclFlowDensity;
+  const bool dynamicGrid;
+
+  /*!
+   * \brief Reconstruct the velocity (and density if nVarGrad allows) of the flow.
+   */
+  template<size_t nVarGrad>
+  FORCEINLINE void reconstructFlow(Int iPoint, Int jPoint, const VectorDbl<nDim>& vector_ij,
+                                   bool limiterFlow, CPair<VectorDbl<nFlowPrimVar> >& V) const {
+    const auto& gradients = flowVars->GetGradient_Reconstruction();
+    if (limiterFlow) {
+      const auto& limiters = flowVars->GetLimiter_Primitive();
+      musclPointLimited<nVarGrad>(iPoint, vector_ij, 0.5, limiters, gradients, V.i);
+      musclPointLimited<nVarGrad>(jPoint, vector_ij,-0.5, limiters, gradients, V.j);
+    } else {
+      musclUnlimited<nVarGrad>(iPoint, vector_ij, 0.5, gradients, V.i);
+      musclUnlimited<nVarGrad>(jPoint, vector_ij,-0.5, gradients, V.j);
+    }
+  }
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   * \param[in] config - Problem definitions.
+   * \param[in] flowVars_ - Variables of the flow solver.
+   * \param[in] edgeMassFluxes_ - Mass fluxes of the flow solver (for bounded scalars).
+   * \param[in] bounded_ - Use the bounded scalar formulation.
+   * \param[in] musclFlowDensity_ - Whether the flow solver has gradients of density.
+   * \param[in] constants - Model constants, used by the decorator.
+   */
+  CUpwScalarScheme(const CConfig& config, const CVariable* flowVars_, const su2activevector* edgeMassFluxes_,
+                   bool bounded_, bool musclFlowDensity_, const su2double* constants) :
+    Base(config, constants),
+    idx(nDim, config.GetnSpecies()),
+    flowVars(flowVars_),
+    edgeMassFluxes(edgeMassFluxes_),
+    bounded(bounded_ && edgeMassFluxes_ != nullptr),
+    musclFlowDensity(musclFlowDensity_),
+    dynamicGrid(config.GetDynamic_Grid()) {
+  }
+
+  /*!
+   * \brief Implementation of the scalar edge flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const override {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    /*--- The MUSCL options are specific to each solver, see CScalarSolver::Upwind_Residual. ---*/
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const bool muscl = config.GetMUSCL();
+    const bool limiter = (config.GetKind_SlopeLimit() != LIMITER::NONE) &&
+                         (config.GetInnerIter() <= config.GetLimiterIter());
+    const bool musclFlow = config.GetMUSCL_Flow() && muscl &&
+                           (config.GetKind_ConvNumScheme_Flow() == SPACE_UPWIND);
+    const bool limiterFlow = (config.GetKind_SlopeLimit_Flow() != LIMITER::NONE) &&
+                             (config.GetKind_SlopeLimit_Flow() != LIMITER::VAN_ALBADA_EDGE);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    /*--- Flow and scalar variables w/o reconstruction. ---*/
+
+    CPair<VectorDbl<nFlowPrimVar> > V;
+    V.i = gatherVariables<nFlowPrimVar>(iPoint, flowVars->GetPrimitive());
+    V.j = gatherVariables<nFlowPrimVar>(jPoint, flowVars->GetPrimitive());
+
+    CPair<VectorDbl<nVar> > U;
+    U.i = gatherVariables<nVar>(iPoint, solution.GetSolution());
+    U.j = gatherVariables<nVar>(jPoint, solution.GetSolution());
+
+    CPair<CScalarFlowProperties> flow;
+    flow.i = {V.i(idx.Density()), V.i(idx.LaminarViscosity()), V.i(idx.EddyViscosity())};
+    flow.j = {V.j(idx.Density()), V.j(idx.LaminarViscosity()), V.j(idx.EddyViscosity())};
+
+    /*--- MUSCL reconstruction, the flow is not reconstructed in bounded mode since
+     *    the mass fluxes are taken directly from the flow solver. ---*/
+
+    auto Vr = V;
+    auto Ur = U;
+
+    if (musclFlow && !bounded) {
+      if (musclFlowDensity) reconstructFlow<nDim+3>(iPoint, jPoint, vector_ij, limiterFlow, Vr);
+      else reconstructFlow<nDim+1>(iPoint, jPoint, vector_ij, limiterFlow, Vr);
+    }
+    if (muscl) {
+      const auto& gradients = solution.GetGradient_Reconstruction();
+      const auto* limiters = limiter ? &solution.GetLimiter() : nullptr;
+      musclScalar(iPoint, vector_ij, 0.5, limiters, gradients, Ur.i);
+      musclScalar(jPoint, vector_ij,-0.5, limiters, gradients, Ur.j);
+    }
+
+    /*--- Upwind convective flux. ---*/
+
+    Double massFlux = 0.0, a0, a1;
+    if (bounded) {
+      massFlux = gatherVariables(iEdge, *edgeMassFluxes);
+      a0 = fmax(massFlux, 0.0) / Vr.i(idx.Density());
+      a1 = fmin(massFlux, 0.0) / Vr.j(idx.Density());
+    } else {
+      Double projVel = 0.0;
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        projVel += 0.5 * (Vr.i(idx.Velocity()+iDim) + Vr.j(idx.Velocity()+iDim)) * normal(iDim);
+      }
+      if (dynamicGrid) {
+        const auto& gridVel = geometry.nodes->GetGridVel();
+        projVel -= 0.5 * (dot(gatherVariables<nDim>(iPoint,gridVel), normal) +
+                          dot(gatherVariables<nDim>(jPoint,gridVel), normal));
+      }
+      a0 = fmax(projVel, 0.0);
+      a1 = fmin(projVel, 0.0);
+    }
+
+    const Double rho_i = densityWeighted ? Vr.i(idx.Density()) : Double(1.0);
+    const Double rho_j = densityWeighted ? Vr.j(idx.Density()) : Double(1.0);
+
+    CScalarEdgeTerms<nVar> terms;
+    VectorDbl<nVar> flux;
+    CScalarJacobian<nVar> jac_i, jac_j;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) = a0 * rho_i * Ur.i(iVar) + a1 * rho_j * Ur.j(iVar);
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        jac_i(iVar,jVar) = 0.0;
+        jac_j(iVar,jVar) = 0.0;
+      }
+      jac_i(iVar,iVar) = a0;
+      jac_j(iVar,iVar) = a1;
+    }
+    terms.addConservative(flux, jac_i, jac_j);
+
+    /*--- Remove the effects of the flow divergence in bounded mode, for the
+     *    reducer strategy this is done by the solver in a loop over points. ---*/
+
+    if (bounded && updateType == UpdateType::COLORING) {
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        terms.flux.i(iVar) -= massFlux * U.i(iVar);
+        terms.flux.j(iVar) -= massFlux * U.j(iVar);
+        terms.jac_i.i(iVar,iVar) -= massFlux;
+        terms.jac_j.j(iVar,iVar) -= massFlux;
+      }
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, flow, U, normal, vector_ij, solution, terms);
+
+    /*--- Stop preaccumulation. ---*/
+
+    AD::SetPreaccOut(terms.flux.i, nVar, Double::Size);
+    stopPreacc(terms.flux.j);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType, updateMask, terms, vector, matrix);
+  }
+};
@@ -0,0 +1,357 @@
+/*!
+ * \file diffusion.hpp
+ * \brief Decorator classes for the diffusion of scalar transport equations
+ *        (turbulence, transition and species), see CUpwScalarScheme.
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "common.hpp"
+#include "../../variables/CTurbSSTVariable.hpp"
+#include "../../variables/CSpeciesVariable.hpp"
+
+/*!
+ * \class CSADiffusion
+ * \ingroup ViscDiscr
+ * \brief Non-conservative diffusion of the SA model, the vectorized
+ * version of CAvgGrad_TurbSA and CAvgGrad_TurbSA_Neg.
+ */
+template<size_t NDIM>
+class CSADiffusion : public CNumericsSIMD {
+protected:
+  static constexpr size_t nDim = NDIM;
+  static constexpr size_t nVar = 1;
+  static constexpr bool densityWeighted = false;
+  static constexpr bool conservative = false;
+
+  static constexpr passivedouble sigma = 2.0/3.0;
+  static constexpr passivedouble cb2 = 0.622;
+  static constexpr passivedouble cn1 = 16.0;
+
+  const bool negativeSA;
+  const bool useAccurateJacobians;
+
+  /*!
+   * \brief Constructor, initialize constants and booleans.
+   */
+  CSADiffusion(const CConfig& config, const su2double*) :
+    negativeSA(config.GetSAParsedOptions().version == SA_OPTIONS::NEG),
+    useAccurateJacobians(config.GetUse_Accurate_Turb_Jacobians()) {
+  }
+
+  /*!
+   * \brief Flux and Jacobians as seen from point "a" of an edge a-b.
+   */
+  FORCEINLINE void sideFlux(const CScalarFlowProperties& flow_a, const CScalarFlowProperties& flow_b,
+                            Double nuTilde_a, Double nuTilde_b, Double projGrad, Double projVector,
+                            Double& flux, Double& jac_a, Double& jac_b) const {
+    const Double nu_a = flow_a.laminarVisc / flow_a.density;
+    const Double nu_b = flow_b.laminarVisc / flow_b.density;
+
+    Double diffCoeff;
+    if (negativeSA) {
+      const Double nu_ab = 0.5 * (nu_a + nu_b);
+      const Double nuTilde_ab = 0.5 * (nuTilde_a + nuTilde_b);
+      const Double zeta = ((1 + cb2) * nuTilde_ab - cb2 * nuTilde_a) / nu_ab;
+      const Double zeta3 = pow(zeta, 3);
+      const Double fn = 1 + (zeta < 0.0) * ((cn1 + zeta3) / (cn1 - zeta3) - 1);
+      diffCoeff = nu_ab + (1 + cb2) * nuTilde_ab * fn - cb2 * nuTilde_a * fn;
+    } else {
+      diffCoeff = 0.5 * (nu_a + nu_b + (1 + cb2) * (nuTilde_a + nuTilde_b)) - cb2 * nuTilde_a;
+    }
+    flux = diffCoeff * projGrad / sigma;
+    jac_a = -diffCoeff * projVector / sigma;
+    jac_b = diffCoeff * projVector / sigma;
+
+    if (useAccurateJacobians && !negativeSA) {
+      /*--- The diffusion coefficient is also a function of nu tilde. ---*/
+      jac_a += (0.5 * (1 + cb2) - cb2) * projGrad / sigma;
+      jac_b += 0.5 * (1 + cb2) * projGrad / sigma;
+    }
+  }
+
+  /*!
+   * \brief Add the viscous terms of the edge to the residual.
+   */
+  FORCEINLINE void viscousTerms(Int iEdge, Int iPoint, Int jPoint,
+                                const CPair<CScalarFlowProperties>& flow,
+                                const CPair<VectorDbl<nVar> >& U,
+                                const VectorDbl<nDim>& normal,
+                                const VectorDbl<nDim>& vector_ij,
+                                const CVariable& solution,
+                                CScalarEdgeTerms<nVar>& terms) const {
+    Double projVector;
+    const auto projGrad = projectedMeanGradient(iPoint, jPoint, normal, vector_ij, U,
+                                                solution.GetGradient(), projVector);
+
+    /*--- Side i, subtracted from i. ---*/
+    Double flux, jac_a, jac_b;
+    sideFlux(flow.i, flow.j, U.i(0), U.j(0), projGrad(0), projVector, flux, jac_a, jac_b);
+    terms.flux.i(0) -= flux;
+    terms.jac_i.i(0,0) -= jac_a;
+    terms.jac_i.j(0,0) -= jac_b;
+
+    /*--- Side j (the flux is in the opposite direction), subtracted from j. ---*/
+    sideFlux(flow.j, flow.i, U.j(0), U.i(0), -projGrad(0), projVector, flux, jac_a, jac_b);
+    terms.flux.j(0) += flux;
+    terms.jac_j.j(0,0) += jac_a;
+    terms.jac_j.i(0,0) += jac_b;
+  }
+};
+
+/*!
+ * \class CSSTDiffusion
+ * \ingroup ViscDiscr
+ * \brief Non-conservative diffusion of the SST model (cross-diffusion is
+ * treated as diffusion), the vectorized version of CAvgGrad_TurbSST.
+ */
+template<size_t NDIM>
+class CSSTDiffusion : public CNumericsSIMD {
+protected:
+  static constexpr size_t nDim = NDIM;
+  static constexpr size_t nVar = 2;
+  static constexpr bool densityWeighted = true;
+  static constexpr bool conservative = false;
+
+  const su2double sigma_k1, sigma_k2, sigma_om1, sigma_om2;
+  const bool useAccurateJacobians;
+
+  /*!
+   * \brief Constructor, initialize constants and booleans.
+   */
+  CSSTDiffusion(const CConfig& config, const su2double* constants) :
+    sigma_k1(constants[0]),
+    sigma_k2(constants[1]),
+    sigma_om1(constants[2]),
+    sigma_om2(constants[3]),
+    useAccurateJacobians(config.GetUse_Accurate_Turb_Jacobians()) {
+  }
+
+  /*!
+   * \brief Flux and Jacobians as seen from point "a" of an edge a-b.
+   */
+  FORCEINLINE void sideFlux(const CScalarFlowProperties& flow_a, const CScalarFlowProperties& flow_b,
+                            const VectorDbl<nVar>& U_a, const VectorDbl<nVar>& U_b,
+                            Double F1_a, Double F1_b, const VectorDbl<nVar>& projGrad, Double projVector,
+                            VectorDbl<nVar>& flux, CScalarJacobian<nVar>& jac_a, CScalarJacobian<nVar>& jac_b) const {
+    /*--- Blended constants. ---*/
+    const Double sigma_k_a = F1_a*sigma_k1 + (1 - F1_a)*sigma_k2;
+    const Double sigma_k_b = F1_b*sigma_k1 + (1 - F1_b)*sigma_k2;
+    const Double sigma_om_a = F1_a*sigma_om1 + (1 - F1_a)*sigma_om2;
+    const Double sigma_om_b = F1_b*sigma_om1 + (1 - F1_b)*sigma_om2;
+
+    /*--- Mean effective dynamic viscosities. ---*/
+    const Double diffKine = 0.5 * (flow_a.laminarVisc + sigma_k_a*flow_a.eddyVisc +
+                                   flow_b.laminarVisc + sigma_k_b*flow_b.eddyVisc);
+    const Double diffOmegaT1 = 0.5 * (flow_a.laminarVisc + sigma_om_a*flow_a.eddyVisc +
+                                      flow_b.laminarVisc + sigma_om_b*flow_b.eddyVisc);
+
+    /*--- Cross-diffusion treated as diffusion of k in the omega equation. ---*/
+    const Double lambda_a = 2 * (1 - F1_a) * flow_a.density * sigma_om_a;
+    const Double lambda_b = 2 * (1 - F1_b) * flow_b.density * sigma_om_b;
+    const Double lambda_ab = 0.5 * (lambda_a + lambda_b);
+    const Double omega_ab = 0.5 * (U_a(1) + U_b(1));
+    const Double diffOmegaT23 = lambda_ab - U_a(1) * lambda_ab / omega_ab;
+
+    flux(0) = diffKine * projGrad(0);
+    flux(1) = diffOmegaT1 * projGrad(1) + diffOmegaT23 * projGrad(0);
+
+    /*--- Thin shear layer approximation of the derivatives of the gradients. ---*/
+    const Double projOnRho_a = projVector / flow_a.density;
+    const Double projOnRho_b = projVector / flow_b.density;
+
+    jac_a(0,0) = -diffKine * projOnRho_a;
+    jac_a(0,1) = 0.0;
+    jac_a(1,0) = -diffOmegaT23 * projOnRho_a;
+    jac_a(1,1) = -diffOmegaT1 * projOnRho_a;
+
+    jac_b(0,0) = diffKine * projOnRho_b;
+    jac_b(0,1) = 0.0;
+    jac_b(1,0) = diffOmegaT23 * projOnRho_b;
+    jac_b(1,1) = diffOmegaT1 * projOnRho_b;
+
+    if (useAccurateJacobians) {
+      const Double factor = 2 * lambda_ab / pow(U_a(1) + U_b(1), 2) * projGrad(0);
+      jac_a(1,1) -= factor * U_b(1);
+      jac_b(1,1) += factor * U_a(1);
+    }
+  }
+
+  /*!
+   * \brief Add the viscous terms of the edge to the residual.
+   */
+  FORCEINLINE void viscousTerms(Int iEdge, Int iPoint, Int jPoint,
+                                const CPair<CScalarFlowProperties>& flow,
+                                const CPair<VectorDbl<nVar> >& U,
+                                const VectorDbl<nDim>& normal,
+                                const VectorDbl<nDim>& vector_ij,
+                                const CVariable& solution,
+                                CScalarEdgeTerms<nVar>& terms) const {
+    const auto& F1 = static_cast<const CTurbSSTVariable&>(solution).GetF1blending();
+    const Double F1_i = gatherVariables(iPoint, F1);
+    const Double F1_j = gatherVariables(jPoint, F1);
+
+    Double projVector;
+    auto projGrad = projectedMeanGradient(iPoint, jPoint, normal, vector_ij, U,
+                                          solution.GetGradient(), projVector);
+
+    VectorDbl<nVar> flux;
+    CScalarJacobian<nVar> jac_a, jac_b;
+
+    /*--- Side i, subtracted from i. ---*/
+    sideFlux(flow.i, flow.j, U.i, U.j, F1_i, F1_j, projGrad, projVector, flux, jac_a, jac_b);
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      terms.flux.i(iVar) -= flux(iVar);
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        terms.jac_i.i(iVar,jVar) -= jac_a(iVar,jVar);
+        terms.jac_i.j(iVar,jVar) -= jac_b(iVar,jVar);
+      }
+    }
+
+    /*--- Side j (the flux is in the opposite direction), subtracted from j. ---*/
+    for (size_t iVar = 0; iVar < nVar; ++iVar) projGrad(iVar) = -projGrad(iVar);
+
+    sideFlux(flow.j, flow.i, U.j, U.i, F1_j, F1_i, projGrad, projVector, flux, jac_a, jac_b);
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      terms.flux.j(iVar) += flux(iVar);
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        terms.jac_j.j(iVar,jVar) += jac_a(iVar,jVar);
+        terms.jac_j.i(iVar,jVar) += jac_b(iVar,jVar);
+      }
+    }
+  }
+};
+
+/*!
+ * \class CTransLMDiffusion
+ * \ingroup ViscDiscr
+ * \brief Diffusion of the LM transition model, the vectorized version of CAvgGrad_TransLM.
+ */
+template<size_t NDIM>
+class CTransLMDiffusion : public CNumericsSIMD {
+protected:
+  static constexpr size_t nDim = NDIM;
+  static constexpr size_t nVar = 2;
+  static constexpr bool densityWeighted = true;
+  static constexpr bool conservative = true;
+
+  /*!
+   * \brief Constructor, nothing to initialize.
+   */
+  CTransLMDiffusion(const CConfig&, const su2double*) {}
+
+  /*!
+   * \brief Add the viscous terms of the edge to the residual.
+   */
+  FORCEINLINE void viscousTerms(Int iEdge, Int iPoint, Int jPoint,
+                                const CPair<CScalarFlowProperties>& flow,
+                                const CPair<VectorDbl<nVar> >& U,
+                                const VectorDbl<nDim>& normal,
+                                const VectorDbl<nDim>& vector_ij,
+                                const CVariable& solution,
+                                CScalarEdgeTerms<nVar>& terms) const {
+    Double projVector;
+    const auto projGrad = projectedMeanGradient(iPoint, jPoint, normal, vector_ij, U,
+                                                solution.GetGradient(), projVector);
+
+    /*--- Mean effective dynamic viscosities, the one of Re_theta_t is doubled. ---*/
+    const Double diffCoeff = 0.5 * (flow.i.laminarVisc + flow.i.eddyVisc + flow.j.laminarVisc + flow.j.eddyVisc);
+    const passivedouble factor[] = {1.0, 2.0};
+
+    VectorDbl<nVar> flux;
+    CScalarJacobian<nVar> jac_i, jac_j;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) = factor[iVar] * diffCoeff * projGrad(iVar);
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        jac_i(iVar,jVar) = 0.0;
+        jac_j(iVar,jVar) = 0.0;
+      }
+      jac_i(iVar,iVar) = -factor[iVar] * diffCoeff * projVector / flow.i.density;
+      jac_j(iVar,iVar) = factor[iVar] * diffCoeff * projVector / flow.j.density;
+    }
+    terms.addConservative(flux, jac_i, jac_j, -1);
+  }
+};
+
+/*!
+ * \class CSpeciesDiffusion
+ * \ingroup ViscDiscr
+ * \brief Diffusion of transported species (laminar and turbulent), the
+ * vectorized version of CAvgGrad_Species.
+ */
+template<size_t NDIM, size_t NVAR>
+class CSpeciesDiffusion : public CNumericsSIMD {
+protected:
+  static constexpr size_t nDim = NDIM;
+  static constexpr size_t nVar = NVAR;
+  static constexpr bool densityWeighted = true;
+  static constexpr bool conservative = true;
+
+  const bool turbulence;
+  const su2double schmidtTurb;
+
+  /*!
+   * \brief Constructor, initialize constants and booleans.
+   */
+  CSpeciesDiffusion(const CConfig& config, const su2double*) :
+    turbulence(config.GetKind_Turb_Model() != TURB_MODEL::NONE),
+    schmidtTurb(config.GetSchmidt_Number_Turbulent()) {
+  }
+
+  /*!
+   * \brief Add the viscous terms of the edge to the residual.
+   */
+  FORCEINLINE void viscousTerms(Int iEdge, Int iPoint, Int jPoint,
+                                const CPair<CScalarFlowProperties>& flow,
+                                const CPair<VectorDbl<nVar> >& U,
+                                const VectorDbl<nDim>& normal,
+                                const VectorDbl<nDim>& vector_ij,
+                                const CVariable& solution,
+                                CScalarEdgeTerms<nVar>& terms) const {
+    const auto& diffusivity = static_cast<const CSpeciesVariable&>(solution).GetDiffusivity();
+    const auto diff_i = gatherVariables<nVar>(iPoint, diffusivity);
+    const auto diff_j = gatherVariables<nVar>(jPoint, diffusivity);
+
+    Double projVector;
+    const auto projGrad = projectedMeanGradient(iPoint, jPoint, normal, vector_ij, U,
+                                                solution.GetGradient(), projVector);
+
+    Double diffTurb = 0.0;
+    if (turbulence) diffTurb = 0.5 * (flow.i.eddyVisc + flow.j.eddyVisc) / schmidtTurb;
+
+    VectorDbl<nVar> flux;
+    CScalarJacobian<nVar> jac_i, jac_j;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      const Double diffCoeff = 0.5 * (flow.i.density * diff_i(iVar) + flow.j.density * diff_j(iVar)) + diffTurb;
+      flux(iVar) = diffCoeff * projGrad(iVar);
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        jac_i(iVar,jVar) = 0.0;
+        jac_j(iVar,jVar) = 0.0;
+      }
+      jac_i(iVar,iVar) = -diffCoeff * projVector / flow.i.density;
+      jac_j(iVar,iVar) = diffCoeff * projVector / flow.j.density;
+    }
+    terms.addConservative(flux, jac_i, jac_j, -1);
+  }
+};
@@ -32,6 +32,13 @@ class CSU2MeshFileWriter final: public CFileWriter{
 private:
   unsigned short iZone, //!< Index of the current zone
   nZone;                //!< Number of zones
+  bool binary;          //!< Write the binary format (see CSU2BinaryMeshReaderFVM)
+
+  /*!
+   * \brief Write sorted data to file in SU2 binary mesh file format
+   * \param[in] val_filename - The name of the file
+   */
+  void WriteDataBinary(const string& val_filename);
 
 public:
 
@@ -40,17 +47,23 @@ public:
    */
   const static string fileExt;
 
+  /*!
+   * \brief File extension of the binary format
+   */
+  const static string fileExtBinary;
+
   /*!
    * \brief Construct a file writer using field names, dimension.
    * \param[in] valDataSorter - The parallel sorted data to write
    * \param[in] valiZone - The index of the current zone
    * \param[in] valnZone - The total number of zones
+   * \param[in] valBinary - Write the binary instead of the ASCII format
    */
   CSU2MeshFileWriter(CParallelDataSorter* valDataSorter,
-                     unsigned short valiZone, unsigned short valnZone);
+                     unsigned short valiZone, unsigned short valnZone, bool valBinary = false);
 
   /*!
-   * \brief Write sorted data to file in SU2 mesh file format
+   * \brief Write sorted data to file in SU2 (ASCII or binary) mesh file format
    * \param[in] val_filename - The name of the file
    */
   void WriteData(string val_filename) override ;
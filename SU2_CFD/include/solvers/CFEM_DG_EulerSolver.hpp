@@ -43,7 +43,7 @@ protected:
   su2double Gamma;           /*!< \brief Fluid's Gamma constant (ratio of specific heats). */
   su2double Gamma_Minus_One; /*!< \brief Fluids's Gamma - 1.0  . */
 
-  CFluidModel  *FluidModel; /*!< \brief fluid model used in the solver */
+  vector<CFluidModel*> FluidModel; /*!< \brief Fluid model used in the solver, one per OpenMP thread. */
 
   su2double
   Mach_Inf,         /*!< \brief Mach number at infinity. */
@@ -210,7 +210,15 @@ protected:
                                                                           faces for the time levels of internal faces
                                                                           between an owned and a halo element. */
 
-  bool symmetrizingTermsPresent;    /*!< \brief Whether or not symmetrizing terms are present in the
+  vector<unsigned long> startLocResMatchingFaces;              /*!< \brief The starting location in the residual of the
+                                                                           faces for every internal matching face. */
+  vector<vector<unsigned long> > startLocResSurfElemMarkers;   /*!< \brief The starting location in the residual of the
+                                                                           faces for every surface element of the
+                                                                           boundary markers. */
+
+  vector<vector<su2double> > workArrayThreads; /*!< \brief The work arrays of the OpenMP threads. */
+
+  bool symmetrizingTermsPresent;   /*!< \brief Whether or not symmetrizing terms are present in the
                                                 discretization. */
 
   vector<unsigned long> nDOFsPerRank;                    /*!< \brief Number of DOFs per rank in
@@ -324,7 +332,7 @@ public:
    * \brief Compute the pressure at the infinity.
    * \return Value of the pressure at the infinity.
    */
-  inline CFluidModel* GetFluidModel(void) const final { return FluidModel;}
+  inline CFluidModel* GetFluidModel(void) const final { return FluidModel[omp_get_thread_num()]; }
 
   /*!
    * \brief Compute the density at the infinity.
@@ -434,7 +442,11 @@ public:
 
   /*!
    * \brief Function, which processes the list of tasks to be executed by
-            the DG solver.
+            the DG solver. The tasks are carried out by the OpenMP threads as
+            soon as the tasks they depend on have been completed. The work of
+            the computational tasks is split into chunks, which are distributed
+            over the threads, while the MPI communication is carried out by
+            the master thread only.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] solver_container - Container vector with all the solutions.
    * \param[in] numerics - Description of the numerical method.
@@ -558,13 +570,11 @@ public:
    * \param[in]  numerics            - Description of the numerical method.
    * \param[in]  haloInfoNeededForBC - If true,  treat boundaries for which halo data is needed.
                                        If false, treat boundaries for which only owned data is needed.
-   * \param[out] workArray           - Work array.
    */
   void Boundary_Conditions(const unsigned short timeLevel,
                            CConfig              *config,
                            CNumerics            **numerics,
-                           const bool           haloInfoNeededForBC,
-                           su2double            *workArray);
+                           const bool           haloInfoNeededForBC);
 
   /*!
    * \brief Compute the spatial residual for the given range of faces. It is a virtual
@@ -1681,4 +1691,92 @@ protected:
     NPad  = llEnd*nVar;
     if( NPad%nPadMin ) NPad += nPadMin - (NPad%nPadMin);
   }
+
+  /*!
+   * \brief Template function, which determines the chunks of the range of
+            elements/faces elemBeg to elemEnd that are treated simultaneously in
+            the residual computations, i.e. consecutive elements/faces with the
+            same standard element, with at most nElemSimul entities per chunk.
+   * \param[in]  elem       - Const pointer the volume or face elements.
+   * \param[in]  elemBeg    - Begin index of the elements/faces to be treated.
+   * \param[in]  elemEnd    - End index (index not included) of the elements/faces.
+   * \param[in]  nElemSimul - Maximum number of elements/faces in a chunk.
+   * \param[out] chunkBeg   - Begin indices of the chunks, followed by elemEnd.
+   */
+  template <class TElemType>
+  static void DetermineChunksOfElem(const TElemType       *elem,
+                                    const unsigned long   elemBeg,
+                                    const unsigned long   elemEnd,
+                                    const unsigned short  nElemSimul,
+                                    vector<unsigned long> &chunkBeg) {
+    chunkBeg.clear();
+    for(unsigned long l=elemBeg; l<elemEnd;) {
+      chunkBeg.push_back(l);
+
+      const unsigned long  lEndMax = min(l+nElemSimul, elemEnd);
+      const unsigned short ind     = elem[l].indStandardElement;
+      for(++l; l<lEndMax; ++l) {
+        if(elem[l].indStandardElement != ind) break;
+      }
+    }
+    chunkBeg.push_back(elemEnd);
+  }
+
+  /*!
+   * \brief Template function, which carries out a function for the range of
+            elements/faces elemBeg to elemEnd in parallel with OpenMP. The range
+            is split into the chunks determined by DetermineChunksOfElem and these
+            chunks are distributed dynamically over the threads. When called from
+            within a parallel region, e.g. by a task of ProcessTaskList_DG, the
+            chunks are treated by the calling thread only.
+   * \param[in] elem       - Const pointer the volume or face elements.
+   * \param[in] elemBeg    - Begin index of the elements/faces to be treated.
+   * \param[in] elemEnd    - End index (index not included) of the elements/faces.
+   * \param[in] nElemSimul - Maximum number of elements/faces in a chunk.
+   * \param[in] func       - Function (object) with arguments (chunkBeg, chunkEnd, workArray),
+                             where workArray is the work array of the executing thread.
+   */
+  template <class TElemType, class TFunc>
+  void ParallelLoopChunksOfElem(const TElemType      *elem,
+                                const unsigned long  elemBeg,
+                                const unsigned long  elemEnd,
+                                const unsigned short nElemSimul,
+                                const TFunc          &func) {
+
+    /* Determine the begin indices of the chunks. */
+    vector<unsigned long> chunkBeg;
+    DetermineChunksOfElem(elem, elemBeg, elemEnd, nElemSimul, chunkBeg);
+
+    const unsigned long nChunks = chunkBeg.size() - 1;
+    if(nChunks == 0) return;
+
+    /* Make sure that every thread has a work array. The allocation is done by the
+       thread itself, such that the memory is placed close to it (first touch). */
+    if(workArrayThreads.size() < static_cast<size_t>(omp_get_max_threads()))
+      workArrayThreads.resize(omp_get_max_threads());
+
+    /* Inside a parallel region the thread numbers of a nested region do not
+       identify the work arrays and numerics of the calling thread uniquely,
+       hence the chunks are treated by the calling thread. */
+    if( omp_in_parallel() ) {
+      vector<su2double> &workArray = workArrayThreads[omp_get_thread_num()];
+      if(workArray.size() != sizeWorkArray) workArray.assign(sizeWorkArray, 0.0);
+
+      for(unsigned long i=0; i<nChunks; ++i)
+        func(chunkBeg[i], chunkBeg[i+1], workArray.data());
+      return;
+    }
+
+    SU2_OMP_PARALLEL_(if(nChunks > 1))
+    {
+      vector<su2double> &workArray = workArrayThreads[omp_get_thread_num()];
+      if(workArray.size() != sizeWorkArray) workArray.assign(sizeWorkArray, 0.0);
+
+      SU2_OMP_FOR_DYN(1)
+      for(unsigned long i=0; i<nChunks; ++i)
+        func(chunkBeg[i], chunkBeg[i+1], workArray.data());
+      END_SU2_OMP_FOR
+    }
+    END_SU2_OMP_PARALLEL
+  }
 };
@@ -199,10 +199,13 @@ class CFVMFlowSolverBase : public CSolver {
   vector<GridColor<> > EdgeColoring; /*!< \brief Edge colors. */
   bool ReducerStrategy = false;      /*!< \brief If the reducer strategy is in use. */
 #else
-  array<DummyGridColor<>, 1> EdgeColoring;
+  array<DummyGridColor<>, 2> EdgeColoring;
   /*--- Never use the reducer strategy if compiling for MPI-only. ---*/
   static constexpr bool ReducerStrategy = false;
 #endif
+  /*--- The first colors only contain edges between domain points (see CGeometry::SetEdges), those
+   *    can be computed while the halo data is being communicated (see CSolver::InitiateOverlappedComms). ---*/
+  unsigned long nDomainEdgeColors = 0;
 
   /*--- Edge fluxes, for OpenMP parallelization of difficult-to-color grids.
    * We first store the fluxes and then compute the sum for each cell.
@@ -1007,6 +1010,18 @@ class CFVMFlowSolverBase : public CSolver {
     ComputeVerificationError(geometry, config);
   }
 
+  /*!
+   * \brief Whether the MPI comms of a primitive gradient can be left in flight (see CSolver::InitiateOverlappedComms).
+   * \note Only the reconstruction gradient qualifies, until the edge loops its halo values are not needed (the limiters
+   *       only use domain points). The other gradient is used at halo points by, e.g., ComputeVorticityAndStrainMag.
+   *       The discrete adjoint needs the comms to be recorded where they are started.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] reconstruction - Indicator that the gradient being computed is for upwind reconstruction.
+   */
+  inline bool OverlapGradientComms(const CConfig* config, bool reconstruction) const {
+    return reconstruction && !config->GetDiscrete_Adjoint();
+  }
+
   /*!
    * \brief Evaluate the vorticity and strain rate magnitude.
    */
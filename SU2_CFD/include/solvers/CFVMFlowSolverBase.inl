@@ -309,11 +309,7 @@ void CFVMFlowSolverBase<V, R>::HybridParallelInitialization(const CConfig& confi
     /*--- If the reducer strategy is used we are not constrained by group
      *    size as we have no other edge loops in the Euler/NS solvers. ---*/
     auto groupSize = ReducerStrategy ? 1ul : geometry.GetEdgeColorGroupSize();
-    auto nColor = coloring.getOuterSize();
-    EdgeColoring.reserve(nColor);
-
-    for (auto iColor = 0ul; iColor < nColor; ++iColor)
-      EdgeColoring.emplace_back(coloring.innerIdx(iColor), coloring.getNumNonZeros(iColor), groupSize);
+    nDomainEdgeColors = splitColoring(coloring, groupSize, geometry.GetnEdgeDomain(), EdgeColoring);
   }
 
   /*--- If the reducer strategy is not being forced (by EDGE_COLORING_GROUP_SIZE=0) print some messages. ---*/
@@ -363,7 +359,9 @@ void CFVMFlowSolverBase<V, R>::HybridParallelInitialization(const CConfig& confi
 
   omp_chunk_size = computeStaticChunkSize(nPoint, omp_get_max_threads(), OMP_MAX_SIZE);
 #else
-  EdgeColoring[0] = DummyGridColor<>(geometry.GetnEdge());
+  EdgeColoring[0] = DummyGridColor<>(geometry.GetnEdgeDomain());
+  EdgeColoring[1] = DummyGridColor<>(geometry.GetnEdge() - geometry.GetnEdgeDomain(), geometry.GetnEdgeDomain());
+  nDomainEdgeColors = 1;
 #endif
 }
 
@@ -385,8 +383,10 @@ void CFVMFlowSolverBase<V, R>::SetPrimitive_Gradient_GG(CGeometry* geometry, con
   auto& gradient = reconstruction ? nodes->GetGradient_Reconstruction() : nodes->GetGradient_Primitive();
   const auto comm = reconstruction? MPI_QUANTITIES::PRIMITIVE_GRAD_REC : MPI_QUANTITIES::PRIMITIVE_GRADIENT;
   const auto commPer = reconstruction? PERIODIC_PRIM_GG_R : PERIODIC_PRIM_GG;
+  const bool overlapComms = OverlapGradientComms(config, reconstruction);
 
-  computeGradientsGreenGauss(this, comm, commPer, *geometry, *config, primitives, 0, nPrimVarGrad, prim_idx.Velocity(), gradient);
+  computeGradientsGreenGauss(this, comm, commPer, *geometry, *config, primitives, 0, nPrimVarGrad, prim_idx.Velocity(), gradient,
+                             overlapComms);
 }
 
 template <class V, ENUM_REGIME R>
@@ -409,9 +409,10 @@ void CFVMFlowSolverBase<V, R>::SetPrimitive_Gradient_LS(CGeometry* geometry, con
   auto& rmatrix = nodes->GetRmatrix();
   auto& gradient = reconstruction ? nodes->GetGradient_Reconstruction() : nodes->GetGradient_Primitive();
   const auto comm = reconstruction? MPI_QUANTITIES::PRIMITIVE_GRAD_REC : MPI_QUANTITIES::PRIMITIVE_GRADIENT;
+  const bool overlapComms = OverlapGradientComms(config, reconstruction);
 
   computeGradientsLeastSquares(this, comm, commPer, *geometry, *config, weighted,
-                               primitives, 0, nPrimVarGrad, prim_idx.Velocity(), gradient, rmatrix);
+                               primitives, 0, nPrimVarGrad, prim_idx.Velocity(), gradient, rmatrix, overlapComms);
 }
 
 template <class V, ENUM_REGIME R>
@@ -423,8 +424,12 @@ void CFVMFlowSolverBase<V, R>::SetPrimitive_Limiter(CGeometry* geometry, const C
   auto& primMax = nodes->GetSolution_Max();
   auto& limiter = nodes->GetLimiter_Primitive();
 
+  /*--- The limiters are only needed by the edge loops, their comms can overlap with the
+   *    interior edges, except for the discrete adjoint which needs them to be recorded here. ---*/
+  const bool overlapComms = !config->GetDiscrete_Adjoint();
+
   computeLimiters(kindLimiter, this, MPI_QUANTITIES::PRIMITIVE_LIMITER, PERIODIC_LIM_PRIM_1, PERIODIC_LIM_PRIM_2, *geometry, *config, 0,
-                  nPrimVarGrad, primitives, gradient, primMin, primMax, limiter);
+                  nPrimVarGrad, primitives, gradient, primMin, primMax, limiter, overlapComms);
 }
 
 template <class V, ENUM_REGIME R>
@@ -1524,8 +1529,9 @@ void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
     }
     InstantiateEdgeNumerics(solvers, config);
 
-    /*--- The SIMD numerics do not use gradients of density and enthalpy. ---*/
-    if (!config->GetContinuous_Adjoint()) {
+    /*--- The compressible SIMD numerics do not use gradients of density and enthalpy,
+     *    the incompressible ones reconstruct density and beta^2. ---*/
+    if (R == ENUM_REGIME::COMPRESSIBLE && !config->GetContinuous_Adjoint()) {
       SU2_OMP_SAFE_GLOBAL_ACCESS(nPrimVarGrad = std::min<unsigned short>(nDim + 2, nPrimVarGrad);)
     }
   }
@@ -1543,7 +1549,11 @@ void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
   else AD::StartNoSharedReading();
 
   /*--- Loop over edge colors. ---*/
-  for (auto color : EdgeColoring) {
+  for (auto iColor = 0ul; iColor < EdgeColoring.size(); ++iColor) {
+    /*--- The remaining colors have edges with halo points, their data must have arrived. ---*/
+    if (iColor == nDomainEdgeColors) geometry->CompletePendingComms();
+    const auto& color = EdgeColoring[iColor];
+
     /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
     SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
     for(auto k = 0ul; k < color.size; k += Double::Size) {
@@ -34,8 +34,32 @@ private:
 
 protected:
 
+  enum : size_t { OMP_MAX_SIZE = 512 }; /*!< \brief Max chunk size for light point loops. */
+
+  unsigned long omp_chunk_size; /*!< \brief Chunk size used in light point loops. */
+
   su2double Temperature_Inf;      /*!< \brief Temperature at the infinity. */
 
+  /*--- Shallow copy of grid coloring for OpenMP parallelization. ---*/
+
+#ifdef HAVE_OMP
+  vector<GridColor<> > EdgeColoring; /*!< \brief Edge colors. */
+  bool ReducerStrategy = false;      /*!< \brief If the reducer strategy is in use. */
+#else
+  array<DummyGridColor<>, 1> EdgeColoring;
+  /*--- Never use the reducer strategy if compiling for MPI-only. ---*/
+  static constexpr bool ReducerStrategy = false;
+#endif
+
+  /*--- Edge fluxes for reducer strategy (see the notes in CEulerSolver.hpp). ---*/
+  CSysVector<su2double> EdgeFluxes; /*!< \brief Flux across each edge. */
+
+  /*!
+   * \brief Sum the edge fluxes for each cell to populate the residual vector, used with the reducer strategy.
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void SumEdgeFluxes(const CGeometry* geometry);
+
   /*!
    * \brief Impose the Marshak boundary condition.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -256,4 +280,9 @@ public:
    */
   inline su2double GetTemperature_Inf(void) const { return Temperature_Inf; }
 
+  /*!
+   * \brief The P1 solver supports OpenMP+MPI.
+   */
+  inline bool GetHasHybridParallel() const override { return true; }
+
 };
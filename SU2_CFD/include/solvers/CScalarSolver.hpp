@@ -35,6 +35,8 @@
 #include "../variables/CPrimitiveIndices.hpp"
 #include "CSolver.hpp"
 
+class CNumericsSIMD;
+
 /*!
  * \brief Main class for defining a scalar solver.
  * \tparam VariableType - Class of variable used by the solver inheriting from this template.
@@ -70,15 +72,21 @@ class CScalarSolver : public CSolver {
   vector<GridColor<> > EdgeColoring; /*!< \brief Edge colors. */
   bool ReducerStrategy = false;      /*!< \brief If the reducer strategy is in use. */
 #else
-  array<DummyGridColor<>, 1> EdgeColoring;
+  array<DummyGridColor<>, 2> EdgeColoring;
   /*--- Never use the reducer strategy if compiling for MPI-only. ---*/
   static constexpr bool ReducerStrategy = false;
 #endif
+  /*--- The first colors only contain edges between domain points (see CGeometry::SetEdges), those
+   *    can be computed while the halo data is being communicated (see CSolver::InitiateOverlappedComms). ---*/
+  unsigned long nDomainEdgeColors = 0;
 
   /*--- Edge fluxes for reducer strategy (see the notes in CEulerSolver.hpp). ---*/
   CSysVector<su2double> EdgeFluxes; /*!< \brief Flux across each edge. */
   CSysVector<su2double> EdgeFluxesDiff; /*!< \brief Flux difference between ij and ji for non-conservative discretisation. */
 
+  CNumericsSIMD* edgeNumerics = nullptr; /*!< \brief Object for vectorized edge terms (convection and diffusion). */
+  bool edgeNumericsInstantiated = false; /*!< \brief The object above is only created once, it may not be supported. */
+
   /*!
    * \brief The highest level in the variable hierarchy this solver can safely use.
    */
@@ -89,6 +97,13 @@ class CScalarSolver : public CSolver {
    */
   inline CVariable* GetBaseClassPointerToNodes() final { return nodes; }
 
+  /*!
+   * \brief Instantiate a SIMD numerics object for the edge terms, by default the scalar numerics are used.
+   * \param[in] solvers - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void InstantiateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) {}
+
   /*!
    * \brief Compute the viscous flux for the scalar equation at a particular edge.
    * \tparam SolverSpecificNumericsFunc - lambda-function, that implements solver specific contributions to numerics.
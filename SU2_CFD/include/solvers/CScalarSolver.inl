@@ -28,6 +28,7 @@
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 #include "../../include/solvers/CScalarSolver.hpp"
 #include "../../include/variables/CFlowVariable.hpp"
+#include "../../include/numerics_simd/CNumericsSIMD.hpp"
 
 template <class VariableType>
 CScalarSolver<VariableType>::CScalarSolver(CGeometry* geometry, CConfig* config, bool conservative)
@@ -62,17 +63,15 @@ CScalarSolver<VariableType>::CScalarSolver(CGeometry* geometry, CConfig* config,
 
   if (!coloring.empty()) {
     auto groupSize = ReducerStrategy ? 1ul : geometry->GetEdgeColorGroupSize();
-    auto nColor = coloring.getOuterSize();
-    EdgeColoring.reserve(nColor);
-
-    for (auto iColor = 0ul; iColor < nColor; ++iColor)
-      EdgeColoring.emplace_back(coloring.innerIdx(iColor), coloring.getNumNonZeros(iColor), groupSize);
+    nDomainEdgeColors = splitColoring(coloring, groupSize, geometry->GetnEdgeDomain(), EdgeColoring);
   }
 
   nPoint = geometry->GetnPoint();
   omp_chunk_size = computeStaticChunkSize(nPoint, omp_get_max_threads(), OMP_MAX_SIZE);
 #else
-  EdgeColoring[0] = DummyGridColor<>(geometry->GetnEdge());
+  EdgeColoring[0] = DummyGridColor<>(geometry->GetnEdgeDomain());
+  EdgeColoring[1] = DummyGridColor<>(geometry->GetnEdge() - geometry->GetnEdgeDomain(), geometry->GetnEdgeDomain());
+  nDomainEdgeColors = 1;
 #endif
 
   /*--- Initialize lower and upper limits for solution clipping. Solvers might overwrite these values. ---*/
@@ -85,6 +84,7 @@ CScalarSolver<VariableType>::CScalarSolver(CGeometry* geometry, CConfig* config,
 template <class VariableType>
 CScalarSolver<VariableType>::~CScalarSolver() {
   delete nodes;
+  delete edgeNumerics;
 }
 
 template <class VariableType>
@@ -122,7 +122,8 @@ void CScalarSolver<VariableType>::CommonPreprocessing(CGeometry *geometry, const
     case WEIGHTED_LEAST_SQUARES: SetSolution_Gradient_LS(geometry, config, -1); break;
   }
 
-  if (limiter && muscl) SetSolution_Limiter(geometry, config);
+  /*--- The comms of the limiters overlap with the interior edges of Upwind_Residual (not for the discrete adjoint). ---*/
+  if (limiter && muscl) SetSolution_Limiter(geometry, config, !config->GetDiscrete_Adjoint());
 }
 
 template <class VariableType>
@@ -151,6 +152,19 @@ void CScalarSolver<VariableType>::Upwind_Residual(CGeometry* geometry, CSolver**
   /*--- Apply scalar advection correction terms for bounded scalar problems ---*/
   const bool bounded_scalar = numerics->GetBoundedScalar();
 
+  /*--- Vectorized convection and diffusion, if supported by the model and the
+   * coloring (the group size must be a multiple of the SIMD length). ---*/
+  if (!edgeNumericsInstantiated) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      if (ReducerStrategy || (omp_get_max_threads() == 1) ||
+          (config->GetEdgeColoringGroupSize() % Double::Size == 0)) {
+        InstantiateEdgeNumerics(solver_container, config);
+      }
+      edgeNumericsInstantiated = true;
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
+
   /*--- Static arrays of MUSCL-reconstructed flow primitives and turbulence variables (thread safety). ---*/
   su2double solution_i[MAXNVAR] = {0.0}, flowPrimVar_i[MAXNVARFLOW] = {0.0};
   su2double solution_j[MAXNVAR] = {0.0}, flowPrimVar_j[MAXNVARFLOW] = {0.0};
@@ -164,7 +178,32 @@ void CScalarSolver<VariableType>::Upwind_Residual(CGeometry* geometry, CSolver**
     AD::StartNoSharedReading();
 
   /*--- Loop over edge colors. ---*/
-  for (auto color : EdgeColoring) {
+  for (auto iColor = 0ul; iColor < EdgeColoring.size(); ++iColor) {
+    /*--- The remaining colors have edges with halo points, their data must have arrived. ---*/
+    if (iColor == nDomainEdgeColors) geometry->CompletePendingComms();
+    const auto& color = EdgeColoring[iColor];
+
+    if (edgeNumerics) {
+      /*--- Batches of edges, as in CFVMFlowSolverBase::EdgeFluxResidual. ---*/
+      SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+      for (auto k = 0ul; k < color.size; k += Double::Size) {
+        Int iEdge;
+        Double mask;
+        for (auto j = 0ul; j < Double::Size; ++j) {
+          bool in = (k+j < color.size);
+          mask[j] = in;
+          iEdge[j] = color.indices[k+j*in];
+        }
+        if (ReducerStrategy) {
+          edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::REDUCTION, mask, EdgeFluxes, Jacobian);
+        } else {
+          edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::COLORING, mask, LinSysRes, Jacobian);
+        }
+      }
+      END_SU2_OMP_FOR
+      continue;
+    }
+
     /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
     SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
     for (auto k = 0ul; k < color.size; ++k) {
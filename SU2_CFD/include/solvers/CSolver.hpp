@@ -37,6 +37,7 @@
 #include <algorithm>
 #include <iostream>
 #include <set>
+#include <initializer_list>
 #include <stdlib.h>
 #include <stdio.h>
 
@@ -244,15 +245,38 @@ public:
                            unsigned short &COUNT_PER_POINT,
                            unsigned short &MPI_TYPE) const;
 
+  /*!
+   * \brief Routine to load solver quantities into the data structures for MPI point-to-point communication and to launch non-blocking sends and recvs.
+   * \note The quantities are packed in a single message per neighbor, which reduces the overhead when several are exchanged back to back.
+   * \param[in] geometry  - Geometrical definition of the problem.
+   * \param[in] config    - Definition of the particular problem.
+   * \param[in] commTypes - Enumerated types for the quantities to be communicated.
+   */
+  void InitiateComms(CGeometry *geometry,
+                     const CConfig *config,
+                     std::initializer_list<MPI_QUANTITIES> commTypes);
+
   /*!
    * \brief Routine to load a solver quantity into the data structures for MPI point-to-point communication and to launch non-blocking sends and recvs.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config   - Definition of the particular problem.
    * \param[in] commType - Enumerated type for the quantity to be communicated.
    */
-  void InitiateComms(CGeometry *geometry,
+  inline void InitiateComms(CGeometry *geometry,
+                            const CConfig *config,
+                            MPI_QUANTITIES commType) {
+    InitiateComms(geometry, config, {commType});
+  }
+
+  /*!
+   * \brief Routine to complete the set of non-blocking communications launched by InitiateComms() and unpacking of the data in the solver class.
+   * \param[in] geometry  - Geometrical definition of the problem.
+   * \param[in] config    - Definition of the particular problem.
+   * \param[in] commTypes - Enumerated types for the quantities to be unpacked (the same as for InitiateComms).
+   */
+  void CompleteComms(CGeometry *geometry,
                      const CConfig *config,
-                     MPI_QUANTITIES commType);
+                     std::initializer_list<MPI_QUANTITIES> commTypes);
 
   /*!
    * \brief Routine to complete the set of non-blocking communications launched by InitiateComms() and unpacking of the data in the solver class.
@@ -260,9 +284,23 @@ public:
    * \param[in] config   - Definition of the particular problem.
    * \param[in] commType - Enumerated type for the quantity to be unpacked.
    */
-  void CompleteComms(CGeometry *geometry,
-                     const CConfig *config,
-                     MPI_QUANTITIES commType);
+  inline void CompleteComms(CGeometry *geometry,
+                            const CConfig *config,
+                            MPI_QUANTITIES commType) {
+    CompleteComms(geometry, config, {commType});
+  }
+
+  /*!
+   * \brief Launch the communication of a quantity and leave it in flight, the edges that only touch domain points can
+   *        be computed in the meantime (see CGeometry::SetEdges) and then CGeometry::CompletePendingComms is called.
+   * \note The comms are also completed before other comms are started (using the same geometry).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config   - Definition of the particular problem.
+   * \param[in] commType - Enumerated type for the quantity to be communicated.
+   */
+  void InitiateOverlappedComms(CGeometry *geometry,
+                               const CConfig *config,
+                               MPI_QUANTITIES commType);
 
   /*!
    * \brief Helper function to define the type and number of variables per point for each communication type.
@@ -568,8 +606,9 @@ public:
    * \brief Compute slope limiter.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
+   * \param[in] overlapComms - Leave the comms of the limiters in flight (see InitiateOverlappedComms).
    */
-  void SetSolution_Limiter(CGeometry *geometry, const CConfig *config);
+  void SetSolution_Limiter(CGeometry *geometry, const CConfig *config, bool overlapComms = false);
 
   /*!
    * \brief A virtual member.
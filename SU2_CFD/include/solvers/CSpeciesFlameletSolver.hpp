@@ -184,6 +184,13 @@ class CSpeciesFlameletSolver final : public CSpeciesSolver {
   void BC_ConjugateHeat_Interface(CGeometry* geometry, CSolver** solver_container, CNumerics* numerics, CConfig* config,
                                   unsigned short val_marker) override;
 
+  /*!
+   * \brief Instantiate a SIMD numerics object for the edge terms of the flamelet equations.
+   * \param[in] solvers - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void InstantiateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) final;
+
   /*!
    * \brief Compute the fluxes due to viscous and preferential diffusion effects of the flamelet species at a particular edge.
    * \param[in] iEdge - Edge for which we want to compute the flux
@@ -80,6 +80,13 @@ class CSpeciesSolver : public CScalarSolver<CSpeciesVariable> {
   void Preprocessing(CGeometry* geometry, CSolver** solver_container, CConfig* config, unsigned short iMesh,
                      unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) override;
 
+  /*!
+   * \brief Instantiate a SIMD numerics object for the edge terms of the species equations.
+   * \param[in] solvers - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void InstantiateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) override;
+
   /*!
    * \brief Compute the viscous flux for the turbulent equation at a particular edge.
    * \param[in] iEdge - Edge for which we want to compute the flux
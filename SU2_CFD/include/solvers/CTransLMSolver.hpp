@@ -89,6 +89,13 @@ public:
                       CConfig *config,
                       unsigned short iMesh) override;
 
+  /*!
+   * \brief Instantiate a SIMD numerics object for the edge terms of the transition model.
+   * \param[in] solvers - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void InstantiateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) override;
+
   /*!
    * \brief Compute the viscous flux for the LM equation at a particular edge.
    * \param[in] iEdge - Edge for which we want to compute the flux
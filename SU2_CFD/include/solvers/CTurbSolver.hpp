@@ -110,6 +110,13 @@ public:
    */
   void LoadRestart(CGeometry** geometry, CSolver*** solver, CConfig* config, int val_iter, bool val_update_geo) override;
 
+  /*!
+   * \brief Instantiate a SIMD numerics object for the edge terms of the turbulence model.
+   * \param[in] solvers - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void InstantiateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) override;
+
   /*!
    * \brief Impose fixed values to turbulence quantities.
    * \details Turbulence quantities are set to far-field values in an upstream half-plane
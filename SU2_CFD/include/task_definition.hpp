@@ -77,7 +77,7 @@ public:
   bool           secondPartTimeIntADER; /*!< \brief Whether or not this is the second part of the time interval for elements
                                                     adjacent to a lower time level. */
   unsigned short nIndMustBeCompleted;   /*!< \brief Number of relevant indices in indMustBeCompleted. */
-  int            indMustBeCompleted[5]; /*!< \brief Indices in the list of tasks that must be completed before this task can be carried out. */
+  int            indMustBeCompleted[7]; /*!< \brief Indices in the list of tasks that must be completed before this task can be carried out. */
 
   /*!
    * \brief Constructor of the class.
@@ -94,6 +94,8 @@ public:
    * \param[in] val_ind2MustBeCompleted - Completed index to be set, defaulted to -1.
    * \param[in] val_ind3MustBeCompleted - Completed index to be set, defaulted to -1.
    * \param[in] val_ind4MustBeCompleted - Completed index to be set, defaulted to -1.
+   * \param[in] val_ind5MustBeCompleted - Completed index to be set, defaulted to -1.
+   * \param[in] val_ind6MustBeCompleted - Completed index to be set, defaulted to -1.
    */
   CTaskDefinition(SOLVER_TASK    val_task,
                   unsigned short val_timeLevel,
@@ -101,7 +103,9 @@ public:
                   int            val_ind1MustBeCompleted = -1,
                   int            val_ind2MustBeCompleted = -1,
                   int            val_ind3MustBeCompleted = -1,
-                  int            val_ind4MustBeCompleted = -1);
+                  int            val_ind4MustBeCompleted = -1,
+                  int            val_ind5MustBeCompleted = -1,
+                  int            val_ind6MustBeCompleted = -1);
 
   /*!
    * \brief Destructor of the class.
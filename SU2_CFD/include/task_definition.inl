@@ -31,7 +31,7 @@ inline CTaskDefinition::CTaskDefinition(void) {
   task                = NO_TASK;
   timeLevel           = 0;
   nIndMustBeCompleted = 0;
-  for(int i=0; i<5; ++i) indMustBeCompleted[i] = -1;
+  for(int i=0; i<7; ++i) indMustBeCompleted[i] = -1;
 
   intPointADER = 0;
   secondPartTimeIntADER = false;
@@ -43,7 +43,9 @@ inline CTaskDefinition::CTaskDefinition(SOLVER_TASK    val_task,
                                         int            val_ind1MustBeCompleted,
                                         int            val_ind2MustBeCompleted,
                                         int            val_ind3MustBeCompleted,
-                                        int            val_ind4MustBeCompleted) {
+                                        int            val_ind4MustBeCompleted,
+                                        int            val_ind5MustBeCompleted,
+                                        int            val_ind6MustBeCompleted) {
 
   /* Copy the data from the arguments. */
   task                  = val_task;
@@ -53,12 +55,14 @@ inline CTaskDefinition::CTaskDefinition(SOLVER_TASK    val_task,
   indMustBeCompleted[2] = val_ind2MustBeCompleted;
   indMustBeCompleted[3] = val_ind3MustBeCompleted;
   indMustBeCompleted[4] = val_ind4MustBeCompleted;
+  indMustBeCompleted[5] = val_ind5MustBeCompleted;
+  indMustBeCompleted[6] = val_ind6MustBeCompleted;
 
   /* Make sure that the -1 values are numbered last. */
-  sort(indMustBeCompleted, indMustBeCompleted+5, greater<int>());
+  sort(indMustBeCompleted, indMustBeCompleted+7, greater<int>());
 
   /* Determine the actual number of tasks that must be completed. */
-  for(nIndMustBeCompleted=0; nIndMustBeCompleted<5; ++nIndMustBeCompleted) {
+  for(nIndMustBeCompleted=0; nIndMustBeCompleted<7; ++nIndMustBeCompleted) {
     if(indMustBeCompleted[nIndMustBeCompleted] < 0) break;
   }
 
@@ -80,6 +84,6 @@ inline void CTaskDefinition::Copy(const CTaskDefinition &other) {
   secondPartTimeIntADER = other.secondPartTimeIntADER;
   nIndMustBeCompleted   = other.nIndMustBeCompleted;
 
-  for(int i=0; i<5; ++i)
+  for(int i=0; i<7; ++i)
     indMustBeCompleted[i] = other.indMustBeCompleted[i];
 }
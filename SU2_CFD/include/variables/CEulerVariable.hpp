@@ -30,6 +30,8 @@
 #include <limits>
 #include "CFlowVariable.hpp"
 
+struct CFluidStateBatch;
+
 /*!
  * \class CEulerVariable
  * \brief Class for defining the variables of the compressible Euler solver.
@@ -78,6 +80,17 @@ class CEulerVariable : public CFlowVariable {
   su2vector<unsigned long> NIterNewtonsolver;    /*!< \brief Stores number of Newton solver iterations when using data-driven fluid models. */
   VectorType FluidEntropy;          /*!< \brief Stores the fluid entropy value as computed by the data-driven fluid model. */
 
+  /*!
+   * \brief Set the thermodynamic primitive variables (T, P, rho, h, c) of a batch of contiguous points.
+   * \param[in] iPoint - First point of the batch.
+   * \param[in] turb_ke - Turbulent kinetic energy of the points, nullptr if not used.
+   * \param[in] FluidModel - Fluid model.
+   * \param[in,out] batch - Work space for the fluid model, batch.size is the number of points.
+   * \return Number of non-physical points (their solution is reset to the old solution).
+   */
+  unsigned long SetThermodynamicStateBatch(unsigned long iPoint, const su2double* turb_ke, CFluidModel *FluidModel,
+                                           CFluidStateBatch& batch);
+
  public:
   /*!
    * \brief Constructor of the class.
@@ -133,6 +146,18 @@ class CEulerVariable : public CFlowVariable {
    */
   bool SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel) final;
 
+  /*!
+   * \brief Set the primitive and secondary variables of a batch of contiguous points, the
+   *        fluid model is evaluated with its batched (vectorized) interface.
+   * \param[in] iPoint - First point of the batch.
+   * \param[in] nPointBatch - Number of points, at most CFluidStateBatch::MaxSize.
+   * \param[in] FluidModel - Fluid model.
+   * \param[in,out] batch - Work space for the fluid model.
+   * \return Number of non-physical points.
+   */
+  unsigned long SetPrimVarBatch(unsigned long iPoint, unsigned long nPointBatch, CFluidModel *FluidModel,
+                                CFluidStateBatch& batch);
+
   /*!
    * \brief A virtual member.
    */
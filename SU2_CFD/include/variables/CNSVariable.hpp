@@ -155,6 +155,20 @@ public:
   bool SetPrimVar(unsigned long iPoint, su2double eddy_visc, su2double turb_ke, CFluidModel *FluidModel) override;
   using CVariable::SetPrimVar;
 
+  /*!
+   * \brief Set the primitive and secondary variables of a batch of contiguous points, the
+   *        fluid model is evaluated with its batched (vectorized) interface.
+   * \param[in] iPoint - First point of the batch.
+   * \param[in] nPointBatch - Number of points, at most CFluidStateBatch::MaxSize.
+   * \param[in] eddy_visc - Eddy viscosity of the points.
+   * \param[in] turb_ke - Turbulent kinetic energy of the points.
+   * \param[in] FluidModel - Fluid model.
+   * \param[in,out] batch - Work space for the fluid model.
+   * \return Number of non-physical points.
+   */
+  unsigned long SetPrimVarBatch(unsigned long iPoint, unsigned long nPointBatch, const su2double* eddy_visc,
+                                const su2double* turb_ke, CFluidModel *FluidModel, CFluidStateBatch& batch);
+
   /*!
    * \brief Set all the secondary variables (partial derivatives) for compressible flows
    */
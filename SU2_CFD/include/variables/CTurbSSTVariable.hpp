@@ -78,6 +78,11 @@ public:
    */
   inline su2double GetF1blending(unsigned long iPoint) const override { return F1(iPoint); }
 
+  /*!
+   * \brief Get the first blending function of all points.
+   */
+  inline const VectorType& GetF1blending() const { return F1; }
+
   /*!
    * \brief Get the second blending function.
    */
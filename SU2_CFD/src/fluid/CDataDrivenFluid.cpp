@@ -242,6 +242,64 @@ void CDataDrivenFluid::SetTDState_rhoe(su2double rho, su2double e) {
   AD::EndPreacc();
 }
 
+void CDataDrivenFluid::SetTDStateBatch_rhoe(CFluidStateBatch& batch) {
+  auto& work = BatchWork;
+
+  /*--- Query the data set, the outputs are copied from the point-wise members. ---*/
+
+  for (size_t i = 0; i < batch.size; ++i) {
+    work.rho[i] = max(min(batch.Density[i], rho_max), rho_min);
+    work.e[i] = max(min(batch.StaticEnergy[i], e_max), e_min);
+
+    Evaluate_Dataset(work.rho[i], work.e[i]);
+
+    batch.Entropy[i] = Entropy;
+    batch.Extrapolation[i] = outside_dataset;
+    work.dsde_rho[i] = dsde_rho;
+    work.dsdrho_e[i] = dsdrho_e;
+    work.d2sde2[i] = d2sde2;
+    work.d2sdedrho[i] = d2sdedrho;
+    work.d2sdrho2[i] = d2sdrho2;
+  }
+
+  /*--- Thermodynamic state from the entropy derivatives, same as SetTDState_rhoe. ---*/
+
+  SU2_OMP_SIMD_IF_NOT_AD
+  for (size_t i = 0; i < batch.size; ++i) {
+    const su2double rho = work.rho[i];
+    const su2double rho_2 = rho * rho;
+    const su2double s_e = work.dsde_rho[i];
+    const su2double s_rho = work.dsdrho_e[i];
+    const su2double s_ee = work.d2sde2[i];
+    const su2double s_erho = work.d2sdedrho[i];
+    const su2double s_rhorho = work.d2sdrho2[i];
+
+    const su2double T = 1 / s_e;
+    const su2double P = -rho_2 * T * s_rho;
+    const su2double dTde = -T * T * s_ee;
+    const su2double dTdrho = -T * T * s_erho;
+
+    const su2double blue_term = (s_rho * (2 - rho * T * s_erho) + rho * s_rhorho);
+    const su2double green_term = (-T * s_ee * s_rho + s_erho);
+
+    const su2double dPde = -rho_2 * T * (-T * (s_ee * s_rho) + s_erho);
+    const su2double dPdrho = -rho * T * (s_rho * (2 - rho * T * s_erho) + rho * s_rhorho);
+
+    const su2double dhdrho = -P * (1 / rho_2) + dPdrho / rho;
+    const su2double dhde = 1 + dPde / rho;
+    const su2double drhode_p = -dPde / dPdrho;
+
+    batch.Temperature[i] = T;
+    batch.Pressure[i] = P;
+    batch.SoundSpeed2[i] = -rho * T * (blue_term - rho * green_term * (s_rho / s_e));
+    batch.dPde_rho[i] = dPde;
+    batch.dPdrho_e[i] = dPdrho;
+    batch.dTde_rho[i] = dTde;
+    batch.dTdrho_e[i] = dTdrho;
+    batch.Cp[i] = (dhde + drhode_p * dhdrho) / (dTde + dTdrho * drhode_p);
+  }
+}
+
 void CDataDrivenFluid::SetTDState_PT(su2double P, su2double T) {
 
   /*--- Approximate density and static energy with ideal gas law. ---*/
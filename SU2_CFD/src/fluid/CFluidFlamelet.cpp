@@ -283,30 +283,31 @@ unsigned long CFluidFlamelet::EvaluateDataSet(const vector<su2double>& input_sca
   su2double val_enth = input_scalar[I_ENTH];
   su2double val_prog = input_scalar[I_PROGVAR];
   su2double val_mixfrac = include_mixture_fraction ? input_scalar[I_MIXFRAC] : 0.0;
-  vector<su2double> val_vars;
-  vector<su2double*> refs_vars;
-  vector<unsigned long> LUT_idx;
+
+  /*--- The indices are not copied and the pointers to the outputs are reused, this
+   *    function is called several times per point and iteration. ---*/
+  const vector<unsigned long>* LUT_idx_ptr = &LUT_idx_TD;
   switch (lookup_type) {
     case FLAMELET_LOOKUP_OPS::THERMO:
-      LUT_idx = LUT_idx_TD;
+      LUT_idx_ptr = &LUT_idx_TD;
 #ifdef USE_MLPCPP
       iomap_Current = iomap_TD;
 #endif
       break;
     case FLAMELET_LOOKUP_OPS::PREFDIF:
-      LUT_idx = LUT_idx_PD;
+      LUT_idx_ptr = &LUT_idx_PD;
 #ifdef USE_MLPCPP
       iomap_Current = iomap_PD;
 #endif
       break;
     case FLAMELET_LOOKUP_OPS::SOURCES:
-      LUT_idx = LUT_idx_Sources;
+      LUT_idx_ptr = &LUT_idx_Sources;
 #ifdef USE_MLPCPP
       iomap_Current = iomap_Sources;
 #endif
       break;
     case FLAMELET_LOOKUP_OPS::LOOKUP:
-      LUT_idx = LUT_idx_LookUp;
+      LUT_idx_ptr = &LUT_idx_LookUp;
 #ifdef USE_MLPCPP
       iomap_Current = iomap_LookUp;
 #endif
@@ -316,6 +317,8 @@ unsigned long CFluidFlamelet::EvaluateDataSet(const vector<su2double>& input_sca
   }
   
 
+  const auto& LUT_idx = *LUT_idx_ptr;
+
   /*--- Add all quantities and their names to the look up vectors. ---*/
   bool inside;
   switch (Kind_DataDriven_Method) {
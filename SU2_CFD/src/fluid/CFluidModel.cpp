@@ -153,3 +153,16 @@ unique_ptr<CDiffusivityModel> CFluidModel::MakeMassDiffusivityModel(const CConfi
 void CFluidModel::SetMassDiffusivityModel(const CConfig* config) {
   MassDiffusivity = MakeMassDiffusivityModel(config, 0);
 }
+
+void CFluidModel::SetTDStateBatch_rhoe(CFluidStateBatch& batch) {
+  for (size_t i = 0; i < batch.size; ++i) {
+    SetTDState_rhoe(batch.Density[i], batch.StaticEnergy[i]);
+    CopyTDStateToBatch(i, batch);
+  }
+}
+
+void CFluidModel::SetTransportPropertiesBatch(CFluidStateBatch& batch) {
+  for (size_t i = 0; i < batch.size; ++i) batch.Mu_Turb[i] = Mu_Turb;
+  LaminarViscosity->SetViscosityBatch(batch);
+  ThermalConductivity->SetConductivityBatch(batch);
+}
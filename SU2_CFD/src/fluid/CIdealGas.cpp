@@ -51,6 +51,23 @@ void CIdealGas::SetTDState_rhoe(su2double rho, su2double e) {
   if (ComputeEntropy) Entropy = (1.0 / Gamma_Minus_One * log(Temperature) + log(1.0 / Density)) * Gas_Constant;
 }
 
+void CIdealGas::SetTDStateBatch_rhoe(CFluidStateBatch& batch) {
+  SU2_OMP_SIMD_IF_NOT_AD
+  for (size_t i = 0; i < batch.size; ++i) {
+    const su2double rho = batch.Density[i];
+    const su2double e = batch.StaticEnergy[i];
+    const su2double P = Gamma_Minus_One * rho * e;
+    batch.Pressure[i] = P;
+    batch.Temperature[i] = Gamma_Minus_One * e / Gas_Constant;
+    batch.SoundSpeed2[i] = Gamma * P / rho;
+    batch.dPdrho_e[i] = Gamma_Minus_One * e;
+    batch.dPde_rho[i] = Gamma_Minus_One * rho;
+    batch.dTdrho_e[i] = 0.0;
+    batch.dTde_rho[i] = Gamma_Minus_One / Gas_Constant;
+    batch.Cp[i] = Cp;
+  }
+}
+
 void CIdealGas::SetTDState_PT(su2double P, su2double T) {
   su2double e = T * Gas_Constant / Gamma_Minus_One;
   su2double rho = P / (T * Gas_Constant);
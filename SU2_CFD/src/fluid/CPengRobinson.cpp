@@ -143,6 +143,63 @@ void CPengRobinson::SetTDState_rhoe(su2double rho, su2double e) {
   AD::EndPreacc();
 }
 
+void CPengRobinson::SetTDStateBatch_rhoe(CFluidStateBatch& batch) {
+  const su2double sqrt2 = sqrt(2.0);
+  const su2double A_T = Gas_Constant / Gamma_Minus_One;
+
+  SU2_OMP_SIMD_IF_NOT_AD
+  for (size_t i = 0; i < batch.size; ++i) {
+    const su2double rho = batch.Density[i];
+    const su2double e = batch.StaticEnergy[i];
+
+    /*--- Same as SetTDState_rhoe, including the preaccumulation for AD. ---*/
+    AD::StartPreacc();
+    AD::SetPreaccIn(rho);
+    AD::SetPreaccIn(e);
+
+    const su2double rho2 = rho * rho;
+    const su2double fv = (log(1.0 + (rho * b * sqrt2 / (1 + rho * b))) - log(1.0 - (rho * b * sqrt2 / (1 + rho * b)))) / 2.0;
+
+    const su2double B_T = a * k * (k + 1) * fv / (b * sqrt2 * sqrt(TstarCrit));
+    const su2double C_T = a * (k + 1) * (k + 1) * fv / (b * sqrt2) + e;
+
+    su2double T = (-B_T + sqrt(B_T * B_T + 4 * A_T * C_T)) / (2 * A_T);
+    T *= T;
+
+    const su2double a2T = alpha2(T);
+    const su2double A = (1 / rho2 + 2 * b / rho - b * b);
+    const su2double B = 1 / rho - b;
+
+    su2double P = T * Gas_Constant / B - a * a2T / A;
+    const su2double DpDd_T = (T * Gas_Constant / (B * B) - 2 * a * a2T * (1 / rho + b) / (A * A)) / rho2;
+    const su2double DpDT_d = Gas_Constant / B + a * k / A * sqrt(a2T / (T * TstarCrit));
+    const su2double Cv_T = A_T + (a * k * (k + 1) * fv) / (2 * b * sqrt(2 * T * TstarCrit));
+    const su2double DeDd_T = -a * (1 + k) * sqrt(a2T) / A / rho2;
+
+    su2double dPde = DpDT_d / Cv_T;
+    su2double dPdrho = DpDd_T - dPde * DeDd_T;
+    su2double c2 = dPdrho + P / rho2 * dPde;
+    su2double dTde = 1 / Cv_T;
+
+    AD::SetPreaccOut(T);
+    AD::SetPreaccOut(c2);
+    AD::SetPreaccOut(dPde);
+    AD::SetPreaccOut(dPdrho);
+    AD::SetPreaccOut(dTde);
+    AD::SetPreaccOut(P);
+    AD::EndPreacc();
+
+    batch.Pressure[i] = P;
+    batch.Temperature[i] = T;
+    batch.SoundSpeed2[i] = c2;
+    batch.dPde_rho[i] = dPde;
+    batch.dPdrho_e[i] = dPdrho;
+    batch.dTdrho_e[i] = dTdrho_e;
+    batch.dTde_rho[i] = dTde;
+    batch.Cp[i] = Cp;
+  }
+}
+
 void CPengRobinson::SetTDState_PT(su2double P, su2double T) {
   su2double toll = 1e-6;
   su2double A, B, Z, DZ = 1.0, F, F1, atanh;
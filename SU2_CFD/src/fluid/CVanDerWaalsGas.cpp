@@ -53,6 +53,28 @@ void CVanDerWaalsGas::SetTDState_rhoe(su2double rho, su2double e) {
   Zed = Pressure / (Gas_Constant * Temperature * Density);
 }
 
+void CVanDerWaalsGas::SetTDStateBatch_rhoe(CFluidStateBatch& batch) {
+  SU2_OMP_SIMD_IF_NOT_AD
+  for (size_t i = 0; i < batch.size; ++i) {
+    const su2double rho = batch.Density[i];
+    const su2double e = batch.StaticEnergy[i];
+    const su2double vb = 1.0 - rho * b;
+
+    const su2double P = Gamma_Minus_One * rho / vb * (e + rho * a) - a * rho * rho;
+    const su2double dPde = rho * Gamma_Minus_One / vb;
+    const su2double dPdrho = Gamma_Minus_One / vb * ((e + 2 * rho * a) + rho * b * (e + rho * a) / vb) - 2 * rho * a;
+
+    batch.Pressure[i] = P;
+    batch.Temperature[i] = (P + rho * rho * a) * (vb / (rho * Gas_Constant));
+    batch.dPde_rho[i] = dPde;
+    batch.dPdrho_e[i] = dPdrho;
+    batch.dTdrho_e[i] = Gamma_Minus_One / Gas_Constant * a;
+    batch.dTde_rho[i] = Gamma_Minus_One / Gas_Constant;
+    batch.SoundSpeed2[i] = dPdrho + P / (rho * rho) * dPde;
+    batch.Cp[i] = Cp;
+  }
+}
+
 void CVanDerWaalsGas::SetTDState_PT(su2double P, su2double T) {
   su2double toll = 1e-5;
   unsigned short nmax = 20, count = 0;
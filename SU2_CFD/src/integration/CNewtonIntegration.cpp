@@ -45,6 +45,19 @@ public:
   }
 };
 
+class CApproxProductWrapper final : public CMatrixVectorProduct<Scalar> {
+  const CNewtonIntegration* integration;
+public:
+  CApproxProductWrapper(const CNewtonIntegration* i) : integration(i) {}
+
+  /*!
+   * \brief Operator for the product operation.
+   */
+  inline void operator()(const CSysVector<Scalar>& u, CSysVector<Scalar>& v) const override {
+    integration->ApproxJacobianProduct(u, v);
+  }
+};
+
 class CPreconditionerWrapper final : public CPreconditioner<Scalar> {
   const CNewtonIntegration* integration;
 public:
@@ -103,6 +116,18 @@ void CNewtonIntegration::Setup() {
   /*--- Only possible with a preconditioner. ---*/
   startupPeriod = (startupIters > 0) || (startupResidual < 0.0);
 
+  /*--- Iterative refinement only makes sense if the Jacobian is stored in lower precision. ---*/
+  refinement = config->GetNewtonKrylovRefinement() && startupPeriod;
+
+  if (refinement && std::is_same<Scalar,MixedScalar>::value) {
+    SU2_MPI::Error("NEWTON_KRYLOV_REFINEMENT requires a single precision Jacobian (-Denable-mixedprec=true).",
+                   CURRENT_FUNCTION);
+  }
+  if (refinement) {
+    refineRes.Initialize(nPoint, nPointDomain, nVar, nullptr);
+    refineCorr.Initialize(nPoint, nPointDomain, nVar, nullptr);
+  }
+
 }
 
 void CNewtonIntegration::PerturbSolution(const CSysVector<Scalar>& dir, Scalar mag) {
@@ -189,7 +214,11 @@ void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver **
 
   solvers[FLOW_SOL]->PrepareImplicitIteration(geometry, solvers, config);
 
-  if (preconditioner) preconditioner->Build();
+  if (preconditioner) {
+    preconditioner->Build();
+    /*--- The Jacobian is also used in the products of the inner iterations of the preconditioner. ---*/
+    solvers[FLOW_SOL]->Jacobian.BuildSlicedEllMatrix();
+  }
 
   SU2_OMP_FOR_STAT(omp_chunk_size)
   for (auto i = 0ul; i < LinSysRes.GetNElmDomain(); ++i)
@@ -231,7 +260,8 @@ void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver **
   auto& linSysSol = GetSolutionVec(solvers[FLOW_SOL]->LinSysSol);
 
   if (startupPeriod) {
-    iter = Preconditioner_impl(LinSysRes, linSysSol, iter, eps);
+    if (refinement) iter = RefinedSolve(LinSysRes, linSysSol, iter, eps);
+    else iter = Preconditioner_impl(LinSysRes, linSysSol, iter, eps);
   }
   else {
     ComputeFinDiffStep();
@@ -346,3 +376,25 @@ void CNewtonIntegration::Preconditioner(const CSysVector<Scalar>& u, CSysVector<
     CSysMatrixComms::Complete(v, geometry, config);
   }
 }
+
+void CNewtonIntegration::ApproxJacobianProduct(const CSysVector<Scalar>& u, CSysVector<Scalar>& v) const {
+  solvers[FLOW_SOL]->Jacobian.MatrixVectorProduct(u, v, geometry, config);
+}
+
+unsigned long CNewtonIntegration::RefinedSolve(const CSysVector<Scalar>& b, CSysVector<Scalar>& x,
+                                               unsigned long maxIter, Scalar& eps) {
+  auto product = [this](const CSysVector<Scalar>& u, CSysVector<Scalar>& v) { ApproxJacobianProduct(u, v); };
+
+  /*--- Single precision FGMRES (or the weak preconditioner) for the corrections. ---*/
+  auto correction = [this](const CSysVector<Scalar>& r, CSysVector<Scalar>& c, unsigned long iters, Scalar& tol) {
+    return Preconditioner_impl(r, c, iters, tol);
+  };
+
+  /*--- Double precision FGMRES on the same matrix, with the single precision preconditioner. ---*/
+  auto fallback = [this](const CSysVector<Scalar>& r, CSysVector<Scalar>& c, unsigned long iters, Scalar& tol) {
+    return LinSolver.FGMRES_LinSolver(r, c, CApproxProductWrapper(this), CPreconditionerWrapper(this), tol, iters,
+                                      tol, false, config);
+  };
+
+  return IterativeRefinement(b, x, product, correction, fallback, maxIter, eps, refineRes, refineCorr);
+}
@@ -176,6 +176,8 @@ void CUpwAUSMPLUS_SLAU_Base_Flow::AccurateJacobian(const CConfig* config, su2dou
     /*--- Initialize the gradient arrays with the negative of the quantity,
      then for forward finite differences we add to it and divide. ---*/
 
+    const su2double MassFlux_0 = MassFlux, Pressure_0 = Pressure;
+
     for (iVar = 0; iVar < 6; ++iVar) {
       dmdot_dVi[iVar] = -MassFlux;  dpres_dVi[iVar] = -Pressure;
       dmdot_dVj[iVar] = -MassFlux;  dpres_dVj[iVar] = -Pressure;
@@ -198,6 +200,10 @@ void CUpwAUSMPLUS_SLAU_Base_Flow::AccurateJacobian(const CConfig* config, su2dou
       dmdot_dVj[iVar] /= epsilon;   dpres_dVj[iVar] /= epsilon;
       *primitives_j[iVar] -= epsilon;
     }
+
+    /*--- Restore the unperturbed fluxes, they are used below. ---*/
+    MassFlux = MassFlux_0;
+    Pressure = Pressure_0;
   }
 
   /*--- Differentiation of fluxes wrt conservatives assuming ideal gas ---*/
@@ -27,15 +27,23 @@
 
 #include "../../../include/output/filewriter/CSU2MeshFileWriter.hpp"
 #include "../../../../Common/include/toolboxes/printing_toolbox.hpp"
+#include "../../../../Common/include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
 
 const string CSU2MeshFileWriter::fileExt = ".su2";
+const string CSU2MeshFileWriter::fileExtBinary = ".su2b";
 
 CSU2MeshFileWriter::CSU2MeshFileWriter(CParallelDataSorter *valDataSorter,
-                                       unsigned short valiZone, unsigned short valnZone) :
-   CFileWriter(valDataSorter, fileExt), iZone(valiZone), nZone(valnZone) {}
+                                       unsigned short valiZone, unsigned short valnZone, bool valBinary) :
+   CFileWriter(valDataSorter, valBinary ? fileExtBinary : fileExt), iZone(valiZone), nZone(valnZone),
+   binary(valBinary) {}
 
 void CSU2MeshFileWriter::WriteData(string val_filename) {
 
+  if (binary) {
+    WriteDataBinary(val_filename);
+    return;
+  }
+
   ofstream output_file;
 
   /*--- We append the pre-defined suffix (extension) to the filename (prefix) ---*/
@@ -253,3 +261,138 @@ void CSU2MeshFileWriter::WriteData(string val_filename) {
 
   SU2_MPI::Barrier(SU2_MPI::GetComm());
 }
+
+void CSU2MeshFileWriter::WriteDataBinary(const string& val_filename) {
+
+  using FileInt = CSU2BinaryMeshReaderFVM::FileInt;
+  constexpr auto elemRecordSize = CSU2BinaryMeshReaderFVM::elemRecordSize;
+  constexpr auto boundRecordSize = CSU2BinaryMeshReaderFVM::boundRecordSize;
+
+  if (nZone > 1) {
+    SU2_MPI::Error("SU2 binary mesh files contain a single zone, use the MESH output for multizone problems.",
+                   CURRENT_FUNCTION);
+  }
+
+  const unsigned long nDim = dataSorter->GetnDim();
+
+  /*--- Pack the local volume elements into fixed-size records, in the same order as the ASCII format. ---*/
+
+  vector<FileInt> elemData;
+  for (auto type : {TRIANGLE, QUADRILATERAL, TETRAHEDRON, HEXAHEDRON, PRISM, PYRAMID}) {
+    const auto nPointsElem = nPointsOfElementType(type);
+    for (auto iElem = 0ul; iElem < dataSorter->GetnElem(type); iElem++) {
+      elemData.push_back(type);
+      for (auto iNode = 0u; iNode < N_POINTS_HEXAHEDRON; ++iNode) {
+        elemData.push_back(iNode < nPointsElem ? dataSorter->GetElemConnectivity(type, iElem, iNode) - 1 : 0);
+      }
+    }
+  }
+
+  /*--- The elements of each rank follow those of the previous ranks. ---*/
+
+  const unsigned long nElemLocal = elemData.size() / elemRecordSize;
+  vector<unsigned long> nElemRank(size);
+  SU2_MPI::Allgather(&nElemLocal, 1, MPI_UNSIGNED_LONG, nElemRank.data(), 1, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+  unsigned long nElemGlobal = 0, nElemBefore = 0;
+  for (int iRank = 0; iRank < size; ++iRank) {
+    if (iRank < rank) nElemBefore += nElemRank[iRank];
+    nElemGlobal += nElemRank[iRank];
+  }
+
+  /*--- The data sorter may hold more fields than the coordinates. ---*/
+
+  const unsigned long nPointLocal = dataSorter->GetnPoints();
+  vector<passivedouble> coordData(nPointLocal * nDim);
+  for (auto iPoint = 0ul; iPoint < nPointLocal; iPoint++)
+    for (auto iDim = 0ul; iDim < nDim; iDim++)
+      coordData[iPoint * nDim + iDim] = dataSorter->GetData(iDim, iPoint);
+
+  /*--- The master converts the boundary information into the binary marker block. ---*/
+
+  vector<FileInt> markerData;
+  FileInt nMarker = 0;
+
+  if (rank == MASTER_NODE) {
+
+    const string str = "boundary.dat";
+    ifstream input_file(str);
+    if (!input_file.is_open()) {
+      SU2_MPI::Error(string("Cannot find ") + str, CURRENT_FUNCTION);
+    }
+
+    string text_line;
+    while (getline(input_file, text_line)) {
+      if (text_line.find("NMARK=",0) == string::npos) continue;
+
+      text_line.erase(0,6);
+      nMarker = atoi(text_line.c_str());
+
+      for (FileInt iMarker = 0; iMarker < nMarker; iMarker++) {
+
+        /*--- Tag, without white space. ---*/
+
+        getline(input_file, text_line);
+        text_line.erase(0,11);
+        string Marker_Tag;
+        for (auto c : text_line) if (!isspace(c)) Marker_Tag += c;
+
+        getline(input_file, text_line);
+        text_line.erase(0,13);
+        const FileInt nElem_Bound_ = atol(text_line.c_str());
+
+        /*--- Skip SEND_TO. ---*/
+        getline(input_file, text_line);
+
+        /*--- Name length, number of elements, and name padded to a multiple of 8 characters. ---*/
+
+        markerData.push_back(Marker_Tag.size());
+        markerData.push_back(nElem_Bound_);
+        const auto nameBegin = markerData.size();
+        markerData.resize(nameBegin + (Marker_Tag.size() + sizeof(FileInt) - 1) / sizeof(FileInt), 0);
+        memcpy(&markerData[nameBegin], Marker_Tag.data(), Marker_Tag.size());
+
+        for (FileInt iElem_Bound = 0; iElem_Bound < nElem_Bound_; iElem_Bound++) {
+          getline(input_file, text_line);
+          istringstream bound_line(text_line);
+
+          FileInt record[boundRecordSize] = {0};
+          bound_line >> record[0];
+          const auto nPointsElem = nPointsOfElementType(record[0]);
+          for (auto iNode = 0u; iNode < nPointsElem; iNode++) bound_line >> record[1 + iNode];
+
+          markerData.insert(markerData.end(), record, record + boundRecordSize);
+        }
+      }
+      break;
+    }
+  }
+
+  /*--- Header. ---*/
+
+  char header[CSU2BinaryMeshReaderFVM::headerSize] = {};
+  const FileInt counts[] = {FileInt(nDim), FileInt(nElemGlobal), FileInt(dataSorter->GetnPointsGlobal()), nMarker};
+  memcpy(header, CSU2BinaryMeshReaderFVM::magic, CSU2BinaryMeshReaderFVM::magicSize);
+  memcpy(header + CSU2BinaryMeshReaderFVM::magicSize, counts, sizeof(counts));
+
+  /*--- Write the blocks collectively, the volume data in the linear partition of each rank. ---*/
+
+  OpenMPIFile(val_filename);
+
+  WriteMPIBinaryData(header, sizeof(header), MASTER_NODE);
+
+  const unsigned long bytesPerElem = elemRecordSize * sizeof(FileInt);
+  WriteMPIBinaryDataAll(elemData.data(), elemData.size() * sizeof(FileInt), nElemGlobal * bytesPerElem,
+                        nElemBefore * bytesPerElem);
+
+  const unsigned long bytesPerPoint = nDim * sizeof(passivedouble);
+  WriteMPIBinaryDataAll(coordData.data(), coordData.size() * sizeof(passivedouble),
+                        dataSorter->GetnPointsGlobal() * bytesPerPoint,
+                        dataSorter->GetnPointCumulative(rank) * bytesPerPoint);
+
+  unsigned long markerBytes = markerData.size() * sizeof(FileInt);
+  SU2_MPI::Bcast(&markerBytes, 1, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
+  WriteMPIBinaryData(markerData.data(), markerBytes, MASTER_NODE);
+
+  CloseMPIFile();
+}
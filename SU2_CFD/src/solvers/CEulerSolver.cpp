@@ -1685,17 +1685,20 @@ unsigned long CEulerSolver::SetPrimitive_Variables(CSolver **solver_container, c
 
   AD::StartNoSharedReading();
 
-  SU2_OMP_FOR_STAT(omp_chunk_size)
-  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint ++) {
+  /*--- The fluid model is evaluated in batches of contiguous points (work space local to the thread). ---*/
 
-    /*--- Compressible flow, primitive variables nDim+9, (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp) ---*/
+  CFluidStateBatch batch;
+  constexpr unsigned long batchSize = CFluidStateBatch::MaxSize;
+  const unsigned long nBatch = roundUpDiv(nPoint, batchSize);
 
-    bool physical = nodes->SetPrimVar(iPoint, GetFluidModel());
-    nodes->SetSecondaryVar(iPoint, GetFluidModel());
+  SU2_OMP_FOR_STAT(roundUpDiv(omp_chunk_size, batchSize))
+  for (unsigned long iBatch = 0; iBatch < nBatch; iBatch++) {
 
-    /* Check for non-realizable states for reporting. */
+    /*--- Compressible flow, primitive variables nDim+9, (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp),
+     *    the number of non-realizable states is returned for reporting. ---*/
 
-    if (!physical) nonPhysicalPoints++;
+    const auto iPoint = iBatch * batchSize;
+    nonPhysicalPoints += nodes->SetPrimVarBatch(iPoint, min(batchSize, nPoint - iPoint), GetFluidModel(), batch);
   }
   END_SU2_OMP_FOR
 
@@ -1768,7 +1771,13 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
   const bool low_mach_corr = config->Low_Mach_Correction();
 
   /*--- Use vectorization if the scheme supports it. ---*/
-  if (config->GetKind_Upwind_Flow() == UPWIND::ROE && ideal_gas && !low_mach_corr) {
+  const auto kind_upwind = config->GetKind_Upwind_Flow();
+  const bool simd_scheme = (kind_upwind == UPWIND::ROE) || (kind_upwind == UPWIND::HLLC) ||
+                           (kind_upwind == UPWIND::AUSM) || (kind_upwind == UPWIND::AUSMPLUSUP) ||
+                           (kind_upwind == UPWIND::AUSMPLUSUP2) || (kind_upwind == UPWIND::SLAU) ||
+                           (kind_upwind == UPWIND::SLAU2);
+
+  if (simd_scheme && ideal_gas && !low_mach_corr) {
     EdgeFluxResidual(geometry, solver_container, config);
     return;
   }
@@ -1802,8 +1811,12 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
   else AD::StartNoSharedReading();
 
   /*--- Loop over edge colors. ---*/
-  for (auto color : EdgeColoring)
+  for (auto iColor = 0ul; iColor < EdgeColoring.size(); ++iColor)
   {
+  /*--- The remaining colors have edges with halo points, their data must have arrived. ---*/
+  if (iColor == nDomainEdgeColors) geometry->CompletePendingComms();
+  const auto& color = EdgeColoring[iColor];
+
   /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
   SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
   for(auto k = 0ul; k < color.size; ++k) {
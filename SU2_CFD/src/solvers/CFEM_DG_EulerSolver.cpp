@@ -34,6 +34,8 @@
 #include "../../include/fluid/CCoolProp.hpp"
 #include "../../include/fluid/CDataDrivenFluid.hpp"
 
+#include <set>
+
 enum {
 SIZE_ARR_NORM = 8
 };
@@ -42,8 +44,6 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver() : CSolver() {
 
   /*--- Basic array initialization ---*/
 
-  FluidModel = nullptr;
-
   CD_Inv = nullptr; CL_Inv = nullptr; CSF_Inv = nullptr;  CEff_Inv = nullptr;
   CMx_Inv = nullptr; CMy_Inv = nullptr; CMz_Inv = nullptr;
   CFx_Inv = nullptr; CFy_Inv = nullptr; CFz_Inv = nullptr;
@@ -76,8 +76,6 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CConfig *config, unsigned short val_nDi
 
   /*--- Basic array initialization ---*/
 
-  FluidModel = nullptr;
-
   CD_Inv = nullptr; CL_Inv = nullptr; CSF_Inv = nullptr;  CEff_Inv = nullptr;
   CMx_Inv = nullptr; CMy_Inv = nullptr; CMz_Inv = nullptr;
   CFx_Inv = nullptr; CFy_Inv = nullptr; CFz_Inv = nullptr;
@@ -121,8 +119,6 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CConfig *config, unsigned short val_nDi
 CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh) : CSolver() {
 
   /*--- Array initialization ---*/
-  FluidModel = nullptr;
-
   CD_Inv = nullptr; CL_Inv = nullptr; CSF_Inv = nullptr; CEff_Inv = nullptr;
   CMx_Inv = nullptr;   CMy_Inv = nullptr;   CMz_Inv = nullptr;
   CFx_Inv = nullptr;   CFy_Inv = nullptr;   CFz_Inv = nullptr;
@@ -409,9 +405,11 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
   nEntriesResFaces.assign(nDOFsLocTot+1, 0);
   nEntriesResAdjFaces.assign(nDOFsLocTot+1, 0);
   startLocResFacesMarkers.resize(nMarker);
+  startLocResSurfElemMarkers.resize(nMarker);
 
   startLocResInternalFacesLocalElem.assign(nTimeLevels+1, 0);
   startLocResInternalFacesWithHaloElem.assign(nTimeLevels+1, 0);
+  startLocResMatchingFaces.resize(nMatchingInternalFacesWithHaloElem[nTimeLevels]+1);
 
   /*--- Determine the size of the vector to store residuals that come from the
         integral over the faces and determine the number of entries in this
@@ -424,6 +422,10 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
   unsigned long sizeVecResFaces = 0;
   for(unsigned long i=0; i<nMatchingInternalFacesWithHaloElem[nTimeLevels]; ++i) {
 
+    /* Store the starting position of the residual of this face, such that
+       ranges of faces can be treated independently, e.g. by different threads. */
+    startLocResMatchingFaces[i] = sizeVecResFaces;
+
     /* Determine the time level of the face. */
     const unsigned long  elem0     = matchingInternalFaces[i].elemID0;
     const unsigned long  elem1     = matchingInternalFaces[i].elemID1;
@@ -490,6 +492,8 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
       startLocResInternalFacesWithHaloElem[timeLevel+1] = sizeVecResFaces;
   }
 
+  startLocResMatchingFaces.back() = sizeVecResFaces;
+
   /* Set the uninitialized values of startLocResInternalFacesLocalElem. */
   for(unsigned short i=1; i<=nTimeLevels; ++i) {
     if(startLocResInternalFacesLocalElem[i] == 0)
@@ -517,10 +521,14 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
       const CSurfaceElementFEM *surfElem = boundaries[iMarker].surfElem.data();
 
       /*--- Loop over the surface elements and update the required data. ---*/
+      startLocResSurfElemMarkers[iMarker].resize(nSurfElem+1);
       for(unsigned long i=0; i<nSurfElem; ++i) {
         const unsigned short ind       = surfElem[i].indStandardElement;
         const unsigned short nDOFsFace = standardBoundaryFacesSol[ind].GetNDOFsFace();
 
+        /* Store the starting position of the residual of this surface element. */
+        startLocResSurfElemMarkers[iMarker][i] = sizeVecResFaces;
+
         /* The terms that only contribute to the DOFs located on the face. */
         sizeVecResFaces += nDOFsFace;
         for(unsigned short j=0; j<nDOFsFace; ++j)
@@ -541,6 +549,8 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
         const unsigned short timeLevel = volElem[surfElem[i].volElemID].timeLevel;
         startLocResFacesMarkers[iMarker][timeLevel+1] = sizeVecResFaces;
       }
+
+      startLocResSurfElemMarkers[iMarker][nSurfElem] = sizeVecResFaces;
     }
 
     /* Set the unitialized values of startLocResFacesMarkers[iMarker]. */
@@ -732,7 +742,7 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
 
 CFEM_DG_EulerSolver::~CFEM_DG_EulerSolver() {
 
-  delete FluidModel;
+  for(auto& model : FluidModel) delete model;
   delete blasFunctions;
 
   /*--- Array deallocation ---*/
@@ -816,6 +826,8 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
   config->SetViscosity_Ref(1.0);
   config->SetConductivity_Ref(1.0);
 
+  CFluidModel* auxFluidModel = nullptr;
+
   switch (config->GetKind_FluidModel()) {
 
     case STANDARD_AIR:
@@ -823,98 +835,98 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
       if (config->GetSystemMeasurements() == SI) config->SetGas_Constant(287.058);
       else if (config->GetSystemMeasurements() == US) config->SetGas_Constant(1716.49);
 
-      FluidModel = new CIdealGas(1.4, config->GetGas_Constant(), config->GetCompute_Entropy());
+      auxFluidModel = new CIdealGas(1.4, config->GetGas_Constant(), config->GetCompute_Entropy());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
     case IDEAL_GAS:
 
-      FluidModel = new CIdealGas(Gamma, config->GetGas_Constant(), config->GetCompute_Entropy());
+      auxFluidModel = new CIdealGas(Gamma, config->GetGas_Constant(), config->GetCompute_Entropy());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
     case VW_GAS:
 
-      FluidModel = new CVanDerWaalsGas(Gamma, config->GetGas_Constant(),
+      auxFluidModel = new CVanDerWaalsGas(Gamma, config->GetGas_Constant(),
                                        config->GetPressure_Critical(), config->GetTemperature_Critical());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
     case PR_GAS:
 
-      FluidModel = new CPengRobinson(Gamma, config->GetGas_Constant(), config->GetPressure_Critical(),
+      auxFluidModel = new CPengRobinson(Gamma, config->GetGas_Constant(), config->GetPressure_Critical(),
                                      config->GetTemperature_Critical(), config->GetAcentric_Factor());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
     case COOLPROP:
 
-      FluidModel = new CCoolProp(config->GetFluid_Name());
+      auxFluidModel = new CCoolProp(config->GetFluid_Name());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
     case DATADRIVEN_FLUID:
-      FluidModel = new CDataDrivenFluid(config, false);
+      auxFluidModel = new CDataDrivenFluid(config, false);
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
 
       break;
   }
 
-  Mach2Vel_FreeStream = FluidModel->GetSoundSpeed();
+  Mach2Vel_FreeStream = auxFluidModel->GetSoundSpeed();
 
   /*--- Compute the Free Stream velocity, using the Mach number ---*/
 
@@ -954,17 +966,17 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
             from the dimensional version of Sutherland's law or the constant
             viscosity, depending on the input option.---*/
 
-      FluidModel->SetLaminarViscosityModel(config);
+      auxFluidModel->SetLaminarViscosityModel(config);
 
-      Viscosity_FreeStream = FluidModel->GetLaminarViscosity();
+      Viscosity_FreeStream = auxFluidModel->GetLaminarViscosity();
       config->SetViscosity_FreeStream(Viscosity_FreeStream);
 
       Density_FreeStream = Reynolds*Viscosity_FreeStream/(Velocity_Reynolds*config->GetLength_Reynolds());
       config->SetDensity_FreeStream(Density_FreeStream);
-      FluidModel->SetTDState_rhoT(Density_FreeStream, Temperature_FreeStream);
-      Pressure_FreeStream = FluidModel->GetPressure();
+      auxFluidModel->SetTDState_rhoT(Density_FreeStream, Temperature_FreeStream);
+      Pressure_FreeStream = auxFluidModel->GetPressure();
       config->SetPressure_FreeStream(Pressure_FreeStream);
-      Energy_FreeStream = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
+      Energy_FreeStream = auxFluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
 
     }
 
@@ -972,10 +984,10 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
 
     else {
 
-      FluidModel->SetLaminarViscosityModel(config);
-      Viscosity_FreeStream = FluidModel->GetLaminarViscosity();
+      auxFluidModel->SetLaminarViscosityModel(config);
+      Viscosity_FreeStream = auxFluidModel->GetLaminarViscosity();
       config->SetViscosity_FreeStream(Viscosity_FreeStream);
-      Energy_FreeStream = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
+      Energy_FreeStream = auxFluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
 
     }
 
@@ -989,7 +1001,7 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
     /*--- For inviscid flow, energy is calculated from the specified
      FreeStream quantities using the proper gas law. ---*/
 
-    Energy_FreeStream = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
+    Energy_FreeStream = auxFluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
 
   }
 
@@ -1068,52 +1080,60 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
 
   /*--- Initialize the dimensionless Fluid Model that will be used to solve the dimensionless problem ---*/
 
-  /*--- Delete the original (dimensional) FluidModel object before replacing. ---*/
+  /*--- Auxilary (dimensional) FluidModel no longer needed. ---*/
 
-  delete FluidModel;
+  delete auxFluidModel;
 
-  switch (config->GetKind_FluidModel()) {
+  /*--- Create one final fluid model object per OpenMP thread to be able to use them in parallel.
+   *    GetFluidModel() should be used to automatically access the "right" object of each thread. ---*/
 
-    case STANDARD_AIR:
-      FluidModel = new CIdealGas(1.4, Gas_ConstantND, config->GetCompute_Entropy());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+  assert(FluidModel.empty() && "Potential memory leak!");
+  FluidModel.resize(omp_get_max_threads());
 
-    case IDEAL_GAS:
-      FluidModel = new CIdealGas(Gamma, Gas_ConstantND, config->GetCompute_Entropy());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+  SU2_OMP_PARALLEL
+  {
+    const int thread = omp_get_thread_num();
 
-    case VW_GAS:
-      FluidModel = new CVanDerWaalsGas(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
-                                       config->GetTemperature_Critical()/config->GetTemperature_Ref());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+    switch (config->GetKind_FluidModel()) {
 
-    case PR_GAS:
-      FluidModel = new CPengRobinson(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
-                                     config->GetTemperature_Critical()/config->GetTemperature_Ref(), config->GetAcentric_Factor());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+      case STANDARD_AIR:
+        FluidModel[thread] = new CIdealGas(1.4, Gas_ConstantND, config->GetCompute_Entropy());
+        break;
 
-    case COOLPROP:
-      FluidModel = new CCoolProp(config->GetFluid_Name());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+      case IDEAL_GAS:
+        FluidModel[thread] = new CIdealGas(Gamma, Gas_ConstantND, config->GetCompute_Entropy());
+        break;
 
-    case DATADRIVEN_FLUID:
-      FluidModel = new CDataDrivenFluid(config);
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
-  }
+      case VW_GAS:
+        FluidModel[thread] = new CVanDerWaalsGas(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
+                                                 config->GetTemperature_Critical()/config->GetTemperature_Ref());
+        break;
 
-  Energy_FreeStreamND = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStreamND*ModVel_FreeStreamND;
+      case PR_GAS:
+        FluidModel[thread] = new CPengRobinson(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
+                                               config->GetTemperature_Critical()/config->GetTemperature_Ref(), config->GetAcentric_Factor());
+        break;
 
-  if (viscous) {
-    FluidModel->SetLaminarViscosityModel(config);
-    FluidModel->SetThermalConductivityModel(config);
-    FluidModel->SetMassDiffusivityModel(config); // nijso: TODO, needs to be tested
+      case COOLPROP:
+        FluidModel[thread] = new CCoolProp(config->GetFluid_Name());
+        break;
+
+      case DATADRIVEN_FLUID:
+        FluidModel[thread] = new CDataDrivenFluid(config);
+        break;
+    }
+
+    GetFluidModel()->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
+
+    if (viscous) {
+      GetFluidModel()->SetLaminarViscosityModel(config);
+      GetFluidModel()->SetThermalConductivityModel(config);
+      GetFluidModel()->SetMassDiffusivityModel(config); // nijso: TODO, needs to be tested
+    }
   }
+  END_SU2_OMP_PARALLEL
+
+  Energy_FreeStreamND = GetFluidModel()->GetStaticEnergy() + 0.5*ModVel_FreeStreamND*ModVel_FreeStreamND;
 
   if (tkeNeeded) { Energy_FreeStreamND += Tke_FreeStreamND; };  config->SetEnergy_FreeStreamND(Energy_FreeStreamND);
 
@@ -1974,7 +1994,7 @@ void CFEM_DG_EulerSolver::SetUpTaskList(CConfig *config) {
 
       /* Definition of the variable to store previous indices of
          tasks that must have been completed. */
-      int prevInd[5];
+      int prevInd[7];
 
       /* Carry out the predictor step of the communication elements of level 0
          if these elements are present on this rank. */
@@ -2264,14 +2284,22 @@ void CFEM_DG_EulerSolver::SetUpTaskList(CConfig *config) {
           /* Check whether there are boundary conditions that involve halo elements. */
           if( BCDependOnHalos[level] ) {
 
-            /* Create the dependency list for this task. */
+            /* Create the dependency list for this task. For all but the first
+               integration point, make sure that the previous residual of the
+               owned elements is already accumulated, because this task will
+               overwrite that residual. */
             prevInd[0] = indexInList[CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS][level];
             prevInd[1] = indexInList[CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS][level];
 
+            if(intPoint == 0)
+              prevInd[2] = -1;
+            else
+              prevInd[2] = indexInList[CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS][level];
+
             /* Create the task for the boundary conditions that involve halo elements. */
             indexInList[CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO][level] = (int)tasksList.size();
             tasksList.emplace_back(CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO,
-                                                level, prevInd[0], prevInd[1]);
+                                                level, prevInd[0], prevInd[1], prevInd[2]);
           }
 
           /* Compute the surface residuals for this time level that involve
@@ -2282,27 +2310,44 @@ void CFEM_DG_EulerSolver::SetUpTaskList(CConfig *config) {
 
             /* Create the dependencies for the surface residual part that involve
                halo elements. For all but the first integration point, make sure
-               that the previous residual is already accumulated, because this
-               task will overwrite that residual. */
+               that the previous residuals of the halo and owned elements are
+               already accumulated, because this task will overwrite that residual. */
             prevInd[0] = indexInList[CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS][level];
             prevInd[1] = indexInList[CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS][level];
 
             if(intPoint == 0)
-              prevInd[2] = -1;
-            else
+              prevInd[2] = prevInd[3] = -1;
+            else {
               prevInd[2] = indexInList[CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS][level];
+              prevInd[3] = indexInList[CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS][level];
+            }
 
             /* Create the task for the surface residual. */
             indexInList[CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS][level] = (int)tasksList.size();
             tasksList.emplace_back(CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS,
-                                                level, prevInd[0], prevInd[1], prevInd[2]);
+                                                level, prevInd[0], prevInd[1], prevInd[2], prevInd[3]);
 
             /* Create the task to accumulate the surface residuals of the halo
-               elements. Make sure to set the integration point for this task. */
+               elements. Make sure to set the integration point for this task.
+               The accumulation for the halo elements adjacent to a lower time
+               level is also carried out by the accumulation task of that time
+               level, hence the tasks of neighboring time levels are carried
+               out in the order of the list. */
             prevInd[0] = indexInList[CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS][level];
+
+            if( !haloElemAdjLowTimeLevel[level].empty() )
+              prevInd[1] = indexInList[CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS][level-1];
+            else
+              prevInd[1] = -1;
+
+            if((level < (nTimeLevels-1)) && !haloElemAdjLowTimeLevel[level+1].empty())
+              prevInd[2] = indexInList[CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS][level+1];
+            else
+              prevInd[2] = -1;
+
             indexInList[CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS][level] = (int)tasksList.size();
             tasksList.emplace_back(CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS,
-                                                level, prevInd[0]);
+                                                level, prevInd[0], prevInd[1], prevInd[2]);
             tasksList.back().intPointADER = intPoint;
           }
 
@@ -2375,17 +2420,31 @@ void CFEM_DG_EulerSolver::SetUpTaskList(CConfig *config) {
              level, if these elements are present. */
           if(nAdjOwnedElem || nOwnedElem) {
 
-            /* Create the dependencies for this task. */
+            /* Create the dependencies for this task. The owned elements adjacent
+               to a lower time level are also updated by the accumulation task of
+               that time level, hence the tasks of neighboring time levels are
+               carried out in the order of the list. */
             prevInd[0] = indexInList[CTaskDefinition::VOLUME_RESIDUAL][level];
             prevInd[1] = indexInList[CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED][level];
-            prevInd[1] = indexInList[CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO][level];
+            prevInd[2] = indexInList[CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO][level];
             prevInd[3] = indexInList[CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS][level];
             prevInd[4] = indexInList[CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS][level];
 
+            if( !ownedElemAdjLowTimeLevel[level].empty() )
+              prevInd[5] = indexInList[CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS][level-1];
+            else
+              prevInd[5] = -1;
+
+            if( nAdjOwnedElem )
+              prevInd[6] = indexInList[CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS][level+1];
+            else
+              prevInd[6] = -1;
+
             /* Create the task. */
             indexInList[CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS][level] = (int)tasksList.size();
             tasksList.emplace_back(CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS,
-                                                level, prevInd[0], prevInd[1], prevInd[2], prevInd[3], prevInd[4]);
+                                                level, prevInd[0], prevInd[1], prevInd[2], prevInd[3],
+                                                prevInd[4], prevInd[5], prevInd[6]);
             tasksList.back().intPointADER = intPoint;
           }
 
@@ -3227,9 +3286,9 @@ void CFEM_DG_EulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_co
           const su2double Mom2         = solDOF[1]*solDOF[1] + solDOF[2]*solDOF[2];
           const su2double StaticEnergy = DensityInv*(solDOF[3] - 0.5*DensityInv*Mom2);
 
-          FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-          const su2double Pressure    = FluidModel->GetPressure();
-          const su2double Temperature = FluidModel->GetTemperature();
+          GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+          const su2double Pressure    = GetFluidModel()->GetPressure();
+          const su2double Temperature = GetFluidModel()->GetTemperature();
 
           if((Pressure < 0.0) || (solDOF[0] < 0.0) || (Temperature < 0.0)) {
             ++ErrorCounter;
@@ -3253,9 +3312,9 @@ void CFEM_DG_EulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_co
                                        + solDOF[3]*solDOF[3];
           const su2double StaticEnergy = DensityInv*(solDOF[4] - 0.5*DensityInv*Mom2);
 
-          FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-          const su2double Pressure    = FluidModel->GetPressure();
-          const su2double Temperature = FluidModel->GetTemperature();
+          GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+          const su2double Pressure    = GetFluidModel()->GetPressure();
+          const su2double Temperature = GetFluidModel()->GetTemperature();
 
           if((Pressure < 0.0) || (solDOF[0] < 0.0) || (Temperature < 0.0)) {
             ++ErrorCounter;
@@ -3713,8 +3772,8 @@ void CFEM_DG_EulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_con
 
               /*--- Compute the maximum value of the wave speed. This is a rather
                     conservative estimate. ---*/
-              FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-              const su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
+              GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+              const su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
               const su2double SoundSpeed  = sqrt(fabs(SoundSpeed2));
 
               const su2double radx     = fabs(u-gridVel[0]) + SoundSpeed;
@@ -3745,8 +3804,8 @@ void CFEM_DG_EulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_con
 
               /*--- Compute the maximum value of the wave speed. This is a rather
                     conservative estimate. ---*/
-              FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-              const su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
+              GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+              const su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
               const su2double SoundSpeed  = sqrt(fabs(SoundSpeed2));
 
               const su2double radx     = fabs(u-gridVel[0]) + SoundSpeed;
@@ -3854,314 +3913,395 @@ void CFEM_DG_EulerSolver::CheckTimeSynchronization(CConfig         *config,
 void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **solver_container,
                                              CNumerics **numerics, CConfig *config,
                                              unsigned short iMesh) {
-  /* Easier storage of the number of time levels.. */
+  /* Easier storage of the number of time levels and the number of tasks. */
   const unsigned short nTimeLevels = config->GetnLevels_TimeAccurateLTS();
+  const unsigned long  nTasks      = tasksList.size();
 
-  /* Define and initialize the bool vector, that indicates whether or
-     not the tasks from the list have been completed. */
-  vector<bool> taskCompleted(tasksList.size(), false);
-
-  /* Allocate the memory for the work array and initialize it to zero to avoid
-     warnings in debug mode  about uninitialized memory when padding is applied. */
-  vector<su2double> workArrayVec(sizeWorkArray, 0.0);
-  su2double *workArray = workArrayVec.data();
+  /*--------------------------------------------------------------------------*/
+  /*--- The tasks are carried out by a dependency driven scheduler. All    ---*/
+  /*--- OpenMP threads take work from the tasks whose prerequisites, i.e.  ---*/
+  /*--- the tasks stored in indMustBeCompleted, have been completed. The   ---*/
+  /*--- work of the computational tasks is split into chunks, such that    ---*/
+  /*--- several threads can work on the same task. The MPI communication   ---*/
+  /*--- is carried out by the master thread only.                          ---*/
+  /*--------------------------------------------------------------------------*/
 
-  /* While loop to carry out all the tasks in tasksList. */
-  unsigned long lowestIndexInList = 0;
-  while(lowestIndexInList < tasksList.size()) {
-
-    /* Find the next task that can be carried out. The outer loop is there
-       to make sure that a communication is completed in case there are no
-       other tasks */
-    for(unsigned short j=0; j<2; ++j) {
-      bool taskCarriedOut = false;
-      for(unsigned long i=lowestIndexInList; i<tasksList.size(); ++i) {
-
-        /* Determine whether or not it can be attempted to carry out
-           this task. */
-        bool taskCanBeCarriedOut = !taskCompleted[i];
-        for(unsigned short ind=0; ind<tasksList[i].nIndMustBeCompleted; ++ind) {
-          if( !taskCompleted[tasksList[i].indMustBeCompleted[ind]] )
-            taskCanBeCarriedOut = false;
-        }
+  /* The element and face ranges are split into chunks of at most nElemSimul
+     entities with the same standard element, which are the chunks treated
+     simultaneously in the residual computations. The ADER predictor step treats
+     every element individually, hence its chunks consist of a single element.
+     The other tasks are carried out as a whole, i.e. consist of a single chunk. */
+  const unsigned short nElemSimul = config->GetSizeMatMulPadding()/nVar;
+
+  vector<vector<unsigned long> > chunksTask(nTasks);
+  for(unsigned long i=0; i<nTasks; ++i) {
+    const unsigned short level = tasksList[i].timeLevel;
+
+    switch( tasksList[i].task ) {
+      case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS:
+        DetermineChunksOfElem(volElem, nVolElemOwnedPerTimeLevel[level]
+                                     + nVolElemInternalPerTimeLevel[level],
+                              nVolElemOwnedPerTimeLevel[level+1], 1, chunksTask[i]);
+        break;
 
-        if( taskCanBeCarriedOut ) {
+      case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS:
+        DetermineChunksOfElem(volElem, nVolElemOwnedPerTimeLevel[level],
+                              nVolElemOwnedPerTimeLevel[level]
+                            + nVolElemInternalPerTimeLevel[level], 1, chunksTask[i]);
+        break;
 
-          /*--- Determine the actual task to be carried out and do so. The
-                only tasks that may fail are the completion of the non-blocking
-                communication. If that is the case the next task needs to be
-                found. ---*/
-          switch( tasksList[i].task ) {
+      case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS:
+      case CTaskDefinition::VOLUME_RESIDUAL:
+      case CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX:
+      case CTaskDefinition::ADER_UPDATE_SOLUTION:
+        DetermineChunksOfElem(volElem, nVolElemOwnedPerTimeLevel[level],
+                              nVolElemOwnedPerTimeLevel[level+1], nElemSimul, chunksTask[i]);
+        break;
 
-            case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS: {
+      case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS:
+        DetermineChunksOfElem(volElem, nVolElemHaloPerTimeLevel[level],
+                              nVolElemHaloPerTimeLevel[level+1], nElemSimul, chunksTask[i]);
+        break;
 
-              /* Carry out the ADER predictor step for the elements whose
-                 solution must be communicated for this time level. */
-              const unsigned short level   = tasksList[i].timeLevel;
-              const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level]
-                                           + nVolElemInternalPerTimeLevel[level];
-              const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level+1];
+      case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS:
+        DetermineChunksOfElem(matchingInternalFaces, nMatchingInternalFacesLocalElem[level],
+                              nMatchingInternalFacesLocalElem[level+1], nElemSimul, chunksTask[i]);
+        break;
 
-              ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      case CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS:
+        DetermineChunksOfElem(matchingInternalFaces, nMatchingInternalFacesWithHaloElem[level],
+                              nMatchingInternalFacesWithHaloElem[level+1], nElemSimul, chunksTask[i]);
+        break;
 
-            case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS: {
+      default:
+        chunksTask[i] = {0, 1};
+    }
+  }
+
+  /* Lambda to determine whether or not a task is an MPI task. */
+  auto isMPITask = [&](const unsigned long i) {
+    return tasksList[i].task == CTaskDefinition::INITIATE_MPI_COMMUNICATION         ||
+           tasksList[i].task == CTaskDefinition::COMPLETE_MPI_COMMUNICATION         ||
+           tasksList[i].task == CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION ||
+           tasksList[i].task == CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION;
+  };
+
+  /* Lambda to carry out an MPI task. The only tasks that may fail are the
+     completion of the non-blocking communication. If commMustBeCompleted is
+     false, SU2_MPI::Testall is used, which returns false if not all requests
+     can be completed. Otherwise MPI_Waitall is used. */
+  auto executeMPITask = [&](const unsigned long i, const bool commMustBeCompleted) {
+    const unsigned short level = tasksList[i].timeLevel;
+    switch( tasksList[i].task ) {
+      case CTaskDefinition::INITIATE_MPI_COMMUNICATION:
+        Initiate_MPI_Communication(config, level);
+        return true;
+      case CTaskDefinition::COMPLETE_MPI_COMMUNICATION:
+        return Complete_MPI_Communication(config, level, commMustBeCompleted);
+      case CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION:
+        Initiate_MPI_ReverseCommunication(config, level);
+        return true;
+      case CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION:
+        return Complete_MPI_ReverseCommunication(config, level, commMustBeCompleted);
+      default:
+        return false;
+    }
+  };
 
-              /* Carry out the ADER predictor step for the elements whose
-                 solution must not be communicated for this time level. */
-              const unsigned short level   = tasksList[i].timeLevel;
-              const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level];
-              const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level]
-                                           + nVolElemInternalPerTimeLevel[level];
-              ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+  /* Lambda to carry out the chunk beg to end of a computational task. */
+  auto executeChunk = [&](const unsigned long i, const unsigned long beg,
+                          const unsigned long end, su2double *workArray) {
+    const unsigned short level = tasksList[i].timeLevel;
 
-            case CTaskDefinition::INITIATE_MPI_COMMUNICATION: {
+    switch( tasksList[i].task ) {
 
-              /* Start the MPI communication of the solution in the halo elements. */
-              Initiate_MPI_Communication(config, tasksList[i].timeLevel);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS:
+      case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS: {
 
-            case CTaskDefinition::COMPLETE_MPI_COMMUNICATION: {
-
-              /* Attempt to complete the MPI communication of the solution data.
-                 For j==0, SU2_MPI::Testall will be used, which returns false if
-                 not all requests can be completed. In that case the next task on
-                 the list is carried out. If j==1, this means that the next
-                 tasks are waiting for this communication to be completed and
-                 hence MPI_Waitall is used. */
-              if( Complete_MPI_Communication(config, tasksList[i].timeLevel,
-                                             j==1) )
-                taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+        /* Carry out the ADER predictor step for the elements of this chunk. */
+        ADER_DG_PredictorStep(config, beg, end, workArray);
+        break;
+      }
 
-            case CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION: {
+      case CTaskDefinition::ADER_TIME_INTERPOLATE_OWNED_ELEMENTS: {
 
-              /* Start the communication of the residuals, for which the
-                 reverse communication must be used. */
-              Initiate_MPI_ReverseCommunication(config, tasksList[i].timeLevel);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+        /* Interpolate the predictor solution of the owned elements
+           in time to the given time integration point for the
+           given time level. */
+        unsigned long nAdjElem = 0, *adjElem = nullptr;
+        if(level < (nTimeLevels-1)) {
+          nAdjElem = ownedElemAdjLowTimeLevel[level+1].size();
+          adjElem  = ownedElemAdjLowTimeLevel[level+1].data();
+        }
 
-            case CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION: {
-
-              /* Attempt to complete the MPI communication of the residual data.
-                 For j==0, SU2_MPI::Testall will be used, which returns false if
-                 not all requests can be completed. In that case the next task on
-                 the list is carried out. If j==1, this means that the next
-                 tasks are waiting for this communication to be completed and
-                 hence MPI_Waitall is used. */
-              if( Complete_MPI_ReverseCommunication(config, tasksList[i].timeLevel,
-                                                    j==1) )
-                taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+        ADER_DG_TimeInterpolatePredictorSol(config, tasksList[i].intPointADER,
+                                            nVolElemOwnedPerTimeLevel[level],
+                                            nVolElemOwnedPerTimeLevel[level+1],
+                                            nAdjElem, adjElem,
+                                            tasksList[i].secondPartTimeIntADER,
+                                            VecWorkSolDOFs[level].data());
+        break;
+      }
 
-            case CTaskDefinition::ADER_TIME_INTERPOLATE_OWNED_ELEMENTS: {
+      case CTaskDefinition::ADER_TIME_INTERPOLATE_HALO_ELEMENTS: {
 
-              /* Interpolate the predictor solution of the owned elements
-                 in time to the given time integration point for the
-                 given time level. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long nAdjElem = 0, *adjElem = nullptr;
-              if(level < (nTimeLevels-1)) {
-                nAdjElem = ownedElemAdjLowTimeLevel[level+1].size();
-                adjElem  = ownedElemAdjLowTimeLevel[level+1].data();
-              }
+        /* Interpolate the predictor solution of the halo elements
+           in time to the given time integration point for the
+           given time level. */
+        unsigned long nAdjElem = 0, *adjElem = nullptr;
+        if(level < (nTimeLevels-1)) {
+          nAdjElem = haloElemAdjLowTimeLevel[level+1].size();
+          adjElem  = haloElemAdjLowTimeLevel[level+1].data();
+        }
 
-              ADER_DG_TimeInterpolatePredictorSol(config, tasksList[i].intPointADER,
-                                                  nVolElemOwnedPerTimeLevel[level],
-                                                  nVolElemOwnedPerTimeLevel[level+1],
-                                                  nAdjElem, adjElem,
-                                                  tasksList[i].secondPartTimeIntADER,
-                                                  VecWorkSolDOFs[level].data());
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+        ADER_DG_TimeInterpolatePredictorSol(config, tasksList[i].intPointADER,
+                                            nVolElemHaloPerTimeLevel[level],
+                                            nVolElemHaloPerTimeLevel[level+1],
+                                            nAdjElem, adjElem,
+                                            tasksList[i].secondPartTimeIntADER,
+                                            VecWorkSolDOFs[level].data());
+        break;
+      }
 
-            case CTaskDefinition::ADER_TIME_INTERPOLATE_HALO_ELEMENTS: {
+      case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS:
+      case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS: {
 
-              /* Interpolate the predictor solution of the halo elements
-                 in time to the given time integration point for the
-                 given time level. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long nAdjElem = 0, *adjElem = nullptr;
-              if(level < (nTimeLevels-1)) {
-                nAdjElem = haloElemAdjLowTimeLevel[level+1].size();
-                adjElem  = haloElemAdjLowTimeLevel[level+1].data();
-              }
+        /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
+        Shock_Capturing_DG(config, beg, end, workArray);
+        break;
+      }
 
-              ADER_DG_TimeInterpolatePredictorSol(config, tasksList[i].intPointADER,
-                                                  nVolElemHaloPerTimeLevel[level],
-                                                  nVolElemHaloPerTimeLevel[level+1],
-                                                  nAdjElem, adjElem,
-                                                  tasksList[i].secondPartTimeIntADER,
-                                                  VecWorkSolDOFs[level].data());
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      case CTaskDefinition::VOLUME_RESIDUAL: {
 
-            case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS: {
+        /*--- Compute the volume portion of the residual. ---*/
+        Volume_Residual(config, beg, end, workArray);
+        break;
+      }
 
-              /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Shock_Capturing_DG(config, nVolElemOwnedPerTimeLevel[level],
-                                 nVolElemOwnedPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS:
+      case CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS: {
 
-            case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS: {
+        /* Compute the residual of the faces of this chunk. */
+        unsigned long indResFaces = startLocResMatchingFaces[beg];
+        ResidualFaces(config, beg, end, indResFaces,
+                      numerics[CONV_TERM + omp_get_thread_num()*MAX_TERMS], workArray);
+        break;
+      }
 
-              /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Shock_Capturing_DG(config, nVolElemHaloPerTimeLevel[level],
-                                 nVolElemHaloPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED: {
 
-            case CTaskDefinition::VOLUME_RESIDUAL: {
+        /*--- Apply the boundary conditions that only depend on data
+              of owned elements. ---*/
+        Boundary_Conditions(level, config, numerics, false);
+        break;
+      }
 
-              /*--- Compute the volume portion of the residual. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Volume_Residual(config, nVolElemOwnedPerTimeLevel[level],
-                              nVolElemOwnedPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO: {
 
-            case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS: {
+        /*--- Apply the boundary conditions that also depend on data
+              of halo elements. ---*/
+        Boundary_Conditions(level, config, numerics, true);
+        break;
+      }
 
-              /* Compute the residual of the faces that only involve owned elements. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long indResFaces = startLocResInternalFacesLocalElem[level];
-              ResidualFaces(config, nMatchingInternalFacesLocalElem[level],
-                            nMatchingInternalFacesLocalElem[level+1],
-                            indResFaces, numerics[CONV_TERM], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_OWNED_ELEMENTS: {
 
-            case CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS: {
+        /* Create the final residual by summing up all contributions. */
+        CreateFinalResidual(level, true);
+        break;
+      }
 
-              /* Compute the residual of the faces that involve a halo element. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long indResFaces = startLocResInternalFacesWithHaloElem[level];
-              ResidualFaces(config, nMatchingInternalFacesWithHaloElem[level],
-                            nMatchingInternalFacesWithHaloElem[level+1],
-                            indResFaces, numerics[CONV_TERM], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_HALO_ELEMENTS: {
 
-            case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED: {
+        /* Create the final residual by summing up all contributions. */
+        CreateFinalResidual(level, false);
+        break;
+      }
 
-              /*--- Apply the boundary conditions that only depend on data
-                    of owned elements. ---*/
-              Boundary_Conditions(tasksList[i].timeLevel, config, numerics, false,
-                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS: {
 
-            case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO: {
+        /* Accumulate the space time residuals for the owned elements
+           for ADER-DG. */
+        AccumulateSpaceTimeResidualADEROwnedElem(config, level, tasksList[i].intPointADER);
+        break;
+      }
 
-              /*--- Apply the boundary conditions that also depend on data
-                    of halo elements. ---*/
-              Boundary_Conditions(tasksList[i].timeLevel, config, numerics, true,
-                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS: {
 
-            case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_OWNED_ELEMENTS: {
+        /* Accumulate the space time residuals for the halo elements
+           for ADER-DG. */
+        AccumulateSpaceTimeResidualADERHaloElem(config, level, tasksList[i].intPointADER);
+        break;
+      }
 
-              /* Create the final residual by summing up all contributions. */
-              CreateFinalResidual(tasksList[i].timeLevel, true);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      case CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX: {
 
-            case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_HALO_ELEMENTS: {
+        /*--- Multiply the residual by the (lumped) mass matrix, to obtain the final value. ---*/
+        const bool useADER = config->GetKind_TimeIntScheme() == ADER_DG;
+        MultiplyResidualByInverseMassMatrix(config, useADER, beg, end, workArray);
+        break;
+      }
 
-              /* Create the final residual by summing up all contributions. */
-              CreateFinalResidual(tasksList[i].timeLevel, false);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      case CTaskDefinition::ADER_UPDATE_SOLUTION: {
 
-            case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS: {
+        /*--- Perform the update step for ADER-DG. ---*/
+        ADER_DG_Iteration(beg, end);
+        break;
+      }
 
-              /* Accumulate the space time residuals for the owned elements
-                 for ADER-DG. */
-              AccumulateSpaceTimeResidualADEROwnedElem(config, tasksList[i].timeLevel,
-                                                       tasksList[i].intPointADER);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
+      default:
+        SU2_MPI::Error("Task not defined. This should not happen.", CURRENT_FUNCTION);
+    }
+  };
+
+  /*--- Determine for every task the number of tasks it still depends on and
+        the tasks that depend on it. ---*/
+  vector<unsigned short> nIndNotCompleted(nTasks);
+  vector<vector<unsigned long> > tasksDependOnTask(nTasks);
+  for(unsigned long i=0; i<nTasks; ++i) {
+    nIndNotCompleted[i] = tasksList[i].nIndMustBeCompleted;
+    for(unsigned short ind=0; ind<tasksList[i].nIndMustBeCompleted; ++ind)
+      tasksDependOnTask[tasksList[i].indMustBeCompleted[ind]].push_back(i);
+  }
+
+  /*--- The state of the scheduler, which may only be accessed in a critical
+        section once the threads are running. The tasks that can be carried
+        out are stored in readyTasks, which is sorted, such that the work is
+        taken in the order of the list. A computational task is removed from
+        readyTasks when its last chunk is started, an MPI task when it has
+        been completed. ---*/
+  set<unsigned long> readyTasks;
+  vector<unsigned long> nChunksStarted(nTasks, 0), nChunksCompleted(nTasks, 0);
+  unsigned long nTasksCompleted = 0, nChunksInProgress = 0;
+
+  /* Lambda to administrate that task i has been completed. Tasks that become
+     ready are added to readyTasks, unless there is nothing to be done for them,
+     e.g. an empty element range. Such tasks are completed immediately. */
+  auto taskCompleted = [&](const unsigned long i) {
+    readyTasks.erase(i);
+
+    vector<unsigned long> tasksCompleted(1, i);
+    while( !tasksCompleted.empty() ) {
+      const unsigned long j = tasksCompleted.back();
+      tasksCompleted.pop_back();
+      ++nTasksCompleted;
+
+      for(const unsigned long k : tasksDependOnTask[j]) {
+        if(--nIndNotCompleted[k] == 0) {
+          if(chunksTask[k].size() > 1) readyTasks.insert(k);
+          else                         tasksCompleted.push_back(k);
+        }
+      }
+    }
+  };
+
+  /* Determine the tasks that can be carried out from the start. */
+  for(unsigned long i=0; i<nTasks; ++i) {
+    if(tasksList[i].nIndMustBeCompleted == 0) {
+      if(chunksTask[i].size() > 1) readyTasks.insert(i);
+      else                         taskCompleted(i);
+    }
+  }
+
+  /* Make sure that every thread has a work array. The allocation is done by the
+     thread itself, such that the memory is placed close to it (first touch). */
+  if(workArrayThreads.size() < static_cast<size_t>(omp_get_max_threads()))
+    workArrayThreads.resize(omp_get_max_threads());
+
+  SU2_OMP_PARALLEL
+  {
+    const int thread = omp_get_thread_num();
+    vector<su2double> &workArray = workArrayThreads[thread];
+    if(workArray.size() != sizeWorkArray) workArray.assign(sizeWorkArray, 0.0);
+
+    /* Loop until all tasks have been completed. */
+    vector<unsigned long> tasksMPI;
+    bool allTasksCompleted = false;
+    while( !allTasksCompleted ) {
+
+      /*--- The master thread carries out the MPI tasks that can be carried
+            out. The completion of the communication is only tested, such
+            that the master thread does not block when other work is
+            available. ---*/
+      bool tasksMPICompleted = false;
+      if(thread == 0) {
+        tasksMPI.clear();
+        SU2_OMP_CRITICAL
+        {
+          for(const unsigned long i : readyTasks)
+            if( isMPITask(i) ) tasksMPI.push_back(i);
+        }
+        END_SU2_OMP_CRITICAL
+
+        for(const unsigned long i : tasksMPI) {
+          if( executeMPITask(i, false) ) {
+            tasksMPICompleted = true;
+            SU2_OMP_CRITICAL
+            {
+              taskCompleted(i);
             }
+            END_SU2_OMP_CRITICAL
+          }
+        }
+      }
 
-            case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS: {
+      /*--- Take the next chunk of work. If there is none, the master thread
+            completes the first outstanding communication with a blocking
+            call, because the next tasks are waiting for it. ---*/
+      long iTask = -1, iTaskWait = -1;
+      unsigned long iChunk = 0;
+
+      SU2_OMP_CRITICAL
+      {
+        allTasksCompleted = nTasksCompleted == nTasks;
+
+        for(auto it=readyTasks.begin(); it!=readyTasks.end(); ++it) {
+          if( !isMPITask(*it) ) {
+            iTask  = *it;
+            iChunk = nChunksStarted[iTask]++;
+            ++nChunksInProgress;
+            if(nChunksStarted[iTask] == chunksTask[iTask].size()-1) readyTasks.erase(it);
+            break;
+          }
+        }
 
-              /* Accumulate the space time residuals for the halo elements
-                 for ADER-DG. */
-              AccumulateSpaceTimeResidualADERHaloElem(config, tasksList[i].timeLevel,
-                                                      tasksList[i].intPointADER);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+        if((iTask < 0) && !allTasksCompleted) {
+          if((thread == 0) && !tasksMPICompleted && !readyTasks.empty())
+            iTaskWait = *readyTasks.begin();
 
-            case CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX: {
+          if(readyTasks.empty() && (nChunksInProgress == 0))
+            SU2_MPI::Error("No task can be carried out. This should not happen.", CURRENT_FUNCTION);
+        }
+      }
+      END_SU2_OMP_CRITICAL
 
-              /*--- Multiply the residual by the (lumped) mass matrix, to obtain the final value. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              const bool useADER = config->GetKind_TimeIntScheme() == ADER_DG;
-              MultiplyResidualByInverseMassMatrix(config, useADER,
-                                                  nVolElemOwnedPerTimeLevel[level],
-                                                  nVolElemOwnedPerTimeLevel[level+1],
-                                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      if(iTask >= 0) {
 
-            case CTaskDefinition::ADER_UPDATE_SOLUTION: {
+        /* Carry out the chunk and administrate its completion. */
+        executeChunk(iTask, chunksTask[iTask][iChunk], chunksTask[iTask][iChunk+1],
+                     workArray.data());
 
-              /*--- Perform the update step for ADER-DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              ADER_DG_Iteration(nVolElemOwnedPerTimeLevel[level],
-                                nVolElemOwnedPerTimeLevel[level+1]);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+        SU2_OMP_CRITICAL
+        {
+          --nChunksInProgress;
+          if(++nChunksCompleted[iTask] == chunksTask[iTask].size()-1) taskCompleted(iTask);
+        }
+        END_SU2_OMP_CRITICAL
+      }
+      else if(iTaskWait >= 0) {
 
-            default: {
+        /* Complete the communication with a blocking call. */
+        executeMPITask(iTaskWait, true);
 
-              cout << "Task not defined. This should not happen." << endl;
-              exit(1);
-            }
-          }
+        SU2_OMP_CRITICAL
+        {
+          taskCompleted(iTaskWait);
         }
-
-        /* Break the inner loop if a task has been carried out. */
-        if( taskCarriedOut ) break;
+        END_SU2_OMP_CRITICAL
       }
-
-      /* Break the outer loop if a task has been carried out. */
-      if( taskCarriedOut ) break;
     }
-
-    /* Update the value of lowestIndexInList. */
-    for(; lowestIndexInList < tasksList.size(); ++lowestIndexInList)
-      if( !taskCompleted[lowestIndexInList] ) break;
   }
+  END_SU2_OMP_PARALLEL
 }
 
 void CFEM_DG_EulerSolver::ADER_SpaceTimeIntegration(CGeometry *geometry,  CSolver **solver_container,
@@ -4767,9 +4907,6 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
   const unsigned short ind                = elem->indStandardElement;
   const unsigned short nInt               = standardElementsSol[ind].GetNIntegration();
   const unsigned short nDOFs              = elem->nDOFsSol;
-  const su2double *matBasisInt            = standardElementsSol[ind].GetMatBasisFunctionsIntegration();
-  const su2double *matDerBasisInt         = matBasisInt + nDOFs*nInt;
-  const su2double *basisFunctionsIntTrans = standardElementsSol[ind].GetBasisFunctionsIntegrationTrans();
   const su2double *weights                = standardElementsSol[ind].GetWeightsIntegration();
 
   /* Set the pointers for fluxes in the DOFs, the gradient of the fluxes in
@@ -4818,8 +4955,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
       const su2double v            = DensityInv*solDOF[2];
       const su2double StaticEnergy = DensityInv*solDOF[3] - 0.5*(u*u + v*v);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
 
       /* The Cartesian fluxes in the x-direction. */
       const su2double uRel = u - gridVel[0];
@@ -4842,8 +4979,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
   /*--- parametric coordinates in the integration points.                  ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxXDOF, gradFluxXInt, config);
-  blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxYDOF, gradFluxYInt, config);
+  standardElementsSol[ind].InterpolateDOFsToIntPoints(false, true, NPad, fluxXDOF, gradFluxXInt, blasFunctions, config);
+  standardElementsSol[ind].InterpolateDOFsToIntPoints(false, true, NPad, fluxYDOF, gradFluxYInt, blasFunctions, config);
 
   /*--------------------------------------------------------------------------*/
   /*--- Compute the divergence of the fluxes in the integration points,    ---*/
@@ -4905,7 +5042,7 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
        Use gradFluxYInt to store this solution. */
     su2double *solInt = gradFluxYInt;
 
-    blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, sol, solInt, config);
+    standardElementsSol[ind].InterpolateDOFsToIntPoints(true, false, NPad, sol, solInt, blasFunctions, config);
 
     /*--- Loop over the number of entities that are treated simultaneously. */
     for(unsigned short simul=0; simul<nSimul; ++simul) {
@@ -4997,7 +5134,7 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
   /*--- basisFunctionsIntTrans and divFlux.                                ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
+  standardElementsSol[ind].IntegrateIntPointsToDOFs(false, NPad, divFlux, res, blasFunctions, config);
 }
 
 void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig              *config,
@@ -5012,9 +5149,6 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
   const unsigned short ind                = elem->indStandardElement;
   const unsigned short nInt               = standardElementsSol[ind].GetNIntegration();
   const unsigned short nDOFs              = elem->nDOFsSol;
-  const su2double *matBasisInt            = standardElementsSol[ind].GetMatBasisFunctionsIntegration();
-  const su2double *matDerBasisInt         = matBasisInt + nDOFs*nInt;
-  const su2double *basisFunctionsIntTrans = standardElementsSol[ind].GetBasisFunctionsIntegrationTrans();
   const su2double *weights                = standardElementsSol[ind].GetWeightsIntegration();
 
   /* Set the pointers for fluxes in the DOFs, the gradient of the fluxes in
@@ -5067,8 +5201,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
       const su2double w            = DensityInv*solDOF[3];
       const su2double StaticEnergy = DensityInv*solDOF[4] - 0.5*(u*u + v*v + w*w);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
 
       /* The Cartesian fluxes in the x-direction. */
       const su2double uRel = u - gridVel[0];
@@ -5101,9 +5235,9 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
   /*--- parametric coordinates in the integration points.                  ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxXDOF, gradFluxXInt, config);
-  blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxYDOF, gradFluxYInt, config);
-  blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxZDOF, gradFluxZInt, config);
+  standardElementsSol[ind].InterpolateDOFsToIntPoints(false, true, NPad, fluxXDOF, gradFluxXInt, blasFunctions, config);
+  standardElementsSol[ind].InterpolateDOFsToIntPoints(false, true, NPad, fluxYDOF, gradFluxYInt, blasFunctions, config);
+  standardElementsSol[ind].InterpolateDOFsToIntPoints(false, true, NPad, fluxZDOF, gradFluxZInt, blasFunctions, config);
 
   /*--------------------------------------------------------------------------*/
   /*--- Compute the divergence of the fluxes in the integration points,    ---*/
@@ -5182,7 +5316,7 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
        Use gradFluxYInt to store this solution. */
     su2double *solInt = gradFluxYInt;
 
-    blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, sol, solInt, config);
+    standardElementsSol[ind].InterpolateDOFsToIntPoints(true, false, NPad, sol, solInt, blasFunctions, config);
 
     /*--- Loop over the number of entities that are treated simultaneously. */
     for(unsigned short simul=0; simul<nSimul; ++simul) {
@@ -5278,7 +5412,7 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
   /*--- basisFunctionsIntTrans and divFlux.                                ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
+  standardElementsSol[ind].IntegrateIntPointsToDOFs(false, NPad, divFlux, res, blasFunctions, config);
 }
 
 void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig              *config,
@@ -5297,9 +5431,6 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
   /* Get the necessary information from the standard element. */
   const unsigned short ind                = elem->indStandardElement;
   const unsigned short nInt               = standardElementsSol[ind].GetNIntegration();
-  const unsigned short nDOFs              = elem->nDOFsSol;
-  const su2double *matBasisInt            = standardElementsSol[ind].GetMatBasisFunctionsIntegration();
-  const su2double *basisFunctionsIntTrans = standardElementsSol[ind].GetBasisFunctionsIntegrationTrans();
   const su2double *weights                = standardElementsSol[ind].GetWeightsIntegration();
 
   /* Check if a body force is present and set it accordingly. */
@@ -5323,7 +5454,7 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
   /*--- the call to blasFunctions->gemm is nInt*(nDim+1).                  ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nInt*3, NPad, nDOFs, matBasisInt, sol, solAndGradInt, config);
+  standardElementsSol[ind].InterpolateDOFsToIntPoints(true, true, NPad, sol, solAndGradInt, blasFunctions, config);
 
   /*--------------------------------------------------------------------------*/
   /*--- Compute the divergence of the inviscid fluxes, multiplied by the   ---*/
@@ -5357,8 +5488,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
       const su2double kinEnergy    = 0.5*(u*u + v*v);
       const su2double StaticEnergy = rhoInv*rE - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Set the pointer to the grid velocities in this integration point.
@@ -5487,7 +5618,7 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
   /*--- basisFunctionsIntTrans and divFlux.                                ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
+  standardElementsSol[ind].IntegrateIntPointsToDOFs(false, NPad, divFlux, res, blasFunctions, config);
 }
 
 void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig              *config,
@@ -5506,9 +5637,6 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
   /*--- Get the necessary information from the standard element. ---*/
   const unsigned short ind                = elem->indStandardElement;
   const unsigned short nInt               = standardElementsSol[ind].GetNIntegration();
-  const unsigned short nDOFs              = elem->nDOFsSol;
-  const su2double *matBasisInt            = standardElementsSol[ind].GetMatBasisFunctionsIntegration();
-  const su2double *basisFunctionsIntTrans = standardElementsSol[ind].GetBasisFunctionsIntegrationTrans();
   const su2double *weights                = standardElementsSol[ind].GetWeightsIntegration();
 
   /* Check if a body force is present and set it accordingly. */
@@ -5534,7 +5662,7 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
   /*--- the call to blasFunctions->gemm is nInt*(nDim+1).                  ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nInt*4, NPad, nDOFs, matBasisInt, sol, solAndGradInt, config);
+  standardElementsSol[ind].InterpolateDOFsToIntPoints(true, true, NPad, sol, solAndGradInt, blasFunctions, config);
 
   /*--- Loop over the number of entities that are treated simultaneously. */
   for(unsigned short simul=0; simul<nSimul; ++simul) {
@@ -5572,8 +5700,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
       const su2double kinEnergy    = 0.5*(u*u + v*v + w*w);
       const su2double StaticEnergy = rhoInv*rE - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Set the pointer to the grid velocities in this integration point.
@@ -5723,7 +5851,7 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
   /*--- basisFunctionsIntTrans and divFlux.                                ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
+  standardElementsSol[ind].IntegrateIntPointsToDOFs(false, NPad, divFlux, res, blasFunctions, config);
 }
 
 void CFEM_DG_EulerSolver::ADER_DG_TimeInterpolatePredictorSol(CConfig             *config,
@@ -5749,70 +5877,79 @@ void CFEM_DG_EulerSolver::ADER_DG_TimeInterpolatePredictorSol(CConfig
   const su2double *DOFToThisTimeInt = timeInterpolDOFToIntegrationADER_DG
                                     + iTime*nTimeDOFs;
 
-  /* Loop over the element range of this time level. */
-  for(unsigned long l=elemBeg; l<elemEnd; ++l) {
-
-    /* Determine the number of solution variables for this element and
-       set the pointer where the solution variables for this element must be
-       stored in solTimeLevel. */
-    const unsigned short nSolVar = nVar*volElem[l].nDOFsSol;
-    su2double           *solDOFs = solTimeLevel + nVar*volElem[l].offsetDOFsSolThisTimeLevel;
-
-    /* Initialize the solution to zero. */
-    for(unsigned short i=0; i<nSolVar; ++i) solDOFs[i] = 0.0;
-
-    /* Loop over the time DOFs, for which the predictor solution is present. */
-    for(unsigned short j=0; j<nTimeDOFs; ++j) {
-
-      /* Add the contribution of this predictor solution to the interpolated solution. */
-      const su2double *solPred = VecSolDOFsPredictorADER.data()
-                               + nVar*(j*nDOFsLocTot + volElem[l].offsetDOFsSolLocal);
-      for(unsigned short i=0; i<nSolVar; ++i)
-        solDOFs[i] += DOFToThisTimeInt[j]*solPred[i];
+  /* Loop over the element range of this time level. The elements are
+     independent of each other and are distributed over the threads. */
+  SU2_OMP_PARALLEL
+  {
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for(unsigned long l=elemBeg; l<elemEnd; ++l) {
+
+      /* Determine the number of solution variables for this element and
+         set the pointer where the solution variables for this element must be
+         stored in solTimeLevel. */
+      const unsigned short nSolVar = nVar*volElem[l].nDOFsSol;
+      su2double           *solDOFs = solTimeLevel + nVar*volElem[l].offsetDOFsSolThisTimeLevel;
+
+      /* Initialize the solution to zero. */
+      for(unsigned short i=0; i<nSolVar; ++i) solDOFs[i] = 0.0;
+
+      /* Loop over the time DOFs, for which the predictor solution is present. */
+      for(unsigned short j=0; j<nTimeDOFs; ++j) {
+
+        /* Add the contribution of this predictor solution to the interpolated solution. */
+        const su2double *solPred = VecSolDOFsPredictorADER.data()
+                                 + nVar*(j*nDOFsLocTot + volElem[l].offsetDOFsSolLocal);
+        for(unsigned short i=0; i<nSolVar; ++i)
+          solDOFs[i] += DOFToThisTimeInt[j]*solPred[i];
+      }
     }
-  }
-
-  /*--------------------------------------------------------------------------*/
-  /*--- Step 2: Interpolate the solution to the given integration point    ---*/
-  /*---         for the elements of the next time level, which are         ---*/
-  /*---         adjacent to elements of the current time level. Note that  ---*/
-  /*---         these elements are not contiguous in memory.               ---*/
-  /*--------------------------------------------------------------------------*/
-
-  /* For the faces with adjacent elements of a higher time level, the time
-     integration takes place with twice the number of time integration points
-     from the perspective of the higher time level. Hence the integration points
-     iTime must be corrected if the state to be interpolated corresponds to the
-     second part of the time integration interval. Perform this correction and
-     determine the corresponding interpolation coefficients. */
-  unsigned short iiTime = iTime;
-  if( secondPartTimeInt ) iiTime += config->GetnTimeIntegrationADER_DG();
-
-  DOFToThisTimeInt = timeInterpolAdjDOFToIntegrationADER_DG + iiTime*nTimeDOFs;
-
-  /* Loop over the adjacent elements. */
-  for(unsigned long l=0; l<nAdjElem; ++l) {
-    const unsigned long ll = adjElem[l];
+    END_SU2_OMP_FOR
+
+    /*--------------------------------------------------------------------------*/
+    /*--- Step 2: Interpolate the solution to the given integration point    ---*/
+    /*---         for the elements of the next time level, which are         ---*/
+    /*---         adjacent to elements of the current time level. Note that  ---*/
+    /*---         these elements are not contiguous in memory.               ---*/
+    /*--------------------------------------------------------------------------*/
+
+    /* For the faces with adjacent elements of a higher time level, the time
+       integration takes place with twice the number of time integration points
+       from the perspective of the higher time level. Hence the integration points
+       iTime must be corrected if the state to be interpolated corresponds to the
+       second part of the time integration interval. Perform this correction and
+       determine the corresponding interpolation coefficients. */
+    unsigned short iiTime = iTime;
+    if( secondPartTimeInt ) iiTime += config->GetnTimeIntegrationADER_DG();
+
+    const su2double *DOFToAdjTimeInt = timeInterpolAdjDOFToIntegrationADER_DG + iiTime*nTimeDOFs;
+
+    /* Loop over the adjacent elements. */
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for(unsigned long l=0; l<nAdjElem; ++l) {
+      const unsigned long ll = adjElem[l];
 
-    /* Determine the number of solution variables for this element and
-       set the pointer where the solution variables for this element must be
-       stored in solTimeLevel. */
-    const unsigned short nSolVar = nVar*volElem[ll].nDOFsSol;
-    su2double           *solDOFs = solTimeLevel + nVar*volElem[ll].offsetDOFsSolPrevTimeLevel;
+      /* Determine the number of solution variables for this element and
+         set the pointer where the solution variables for this element must be
+         stored in solTimeLevel. */
+      const unsigned short nSolVar = nVar*volElem[ll].nDOFsSol;
+      su2double           *solDOFs = solTimeLevel + nVar*volElem[ll].offsetDOFsSolPrevTimeLevel;
 
-    /* Initialize the solution to zero. */
-    for(unsigned short i=0; i<nSolVar; ++i) solDOFs[i] = 0.0;
+      /* Initialize the solution to zero. */
+      for(unsigned short i=0; i<nSolVar; ++i) solDOFs[i] = 0.0;
 
-    /* Loop over the time DOFs, for which the predictor solution is present. */
-    for(unsigned short j=0; j<nTimeDOFs; ++j) {
+      /* Loop over the time DOFs, for which the predictor solution is present. */
+      for(unsigned short j=0; j<nTimeDOFs; ++j) {
 
-      /* Add the contribution of this predictor solution to the interpolated solution. */
-      const su2double *solPred = VecSolDOFsPredictorADER.data()
-                               + nVar*(j*nDOFsLocTot + volElem[ll].offsetDOFsSolLocal);
-      for(unsigned short i=0; i<nSolVar; ++i)
-        solDOFs[i] += DOFToThisTimeInt[j]*solPred[i];
+        /* Add the contribution of this predictor solution to the interpolated solution. */
+        const su2double *solPred = VecSolDOFsPredictorADER.data()
+                                 + nVar*(j*nDOFsLocTot + volElem[ll].offsetDOFsSolLocal);
+        for(unsigned short i=0; i<nSolVar; ++i)
+          solDOFs[i] += DOFToAdjTimeInt[j]*solPred[i];
+      }
     }
+    END_SU2_OMP_FOR
   }
+  END_SU2_OMP_PARALLEL
 }
 
 void CFEM_DG_EulerSolver::Shock_Capturing_DG(CConfig             *config,
@@ -5874,9 +6011,6 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
     /* Get the required data from the corresponding standard element. */
     const unsigned short nInt            = standardElementsSol[ind].GetNIntegration();
     const unsigned short nDOFs           = volElem[l].nDOFsSol;
-    const su2double *matBasisInt         = standardElementsSol[ind].GetMatBasisFunctionsIntegration();
-    const su2double *matBasisIntTrans    = standardElementsSol[ind].GetBasisFunctionsIntegrationTrans();
-    const su2double *matDerBasisIntTrans = standardElementsSol[ind].GetDerMatBasisFunctionsIntTrans();
     const su2double *weights             = standardElementsSol[ind].GetWeightsIntegration();
 
     /*--- Set the pointers for the local arrays. ---*/
@@ -5906,9 +6040,10 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
           solDOFs[i*NPad+llNVar+mm] = solDOFsElem[i*nVar+mm];
     }
 
-    /* Call the general function to carry out the matrix product to determine
-       the solution in the integration points of the chunk of elements. */
-    blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, solDOFs, solInt, config);
+    /* Call the general function of the standard element to determine the
+       solution in the integration points of the chunk of elements. For
+       quadrilaterals and hexahedra sum factorization is used. */
+    standardElementsSol[ind].InterpolateDOFsToIntPoints(true, false, NPad, solDOFs, solInt, blasFunctions, config);
 
     /*------------------------------------------------------------------------*/
     /*--- Step 2: Compute the inviscid fluxes, multiplied by minus the     ---*/
@@ -5959,8 +6094,8 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v);
 
             /*--- Compute the pressure. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure = FluidModel->GetPressure();
+            GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure = GetFluidModel()->GetPressure();
 
             /* Compute the relative velocities w.r.t. the grid. */
             const su2double uRel = u - gridVel[0];
@@ -6054,8 +6189,8 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v + w*w);
 
             /*--- Compute the pressure. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure = FluidModel->GetPressure();
+            GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure = GetFluidModel()->GetPressure();
 
             /* Compute the relative velocities w.r.t. the grid. */
             const su2double uRel = u - gridVel[0];
@@ -6173,16 +6308,16 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
     /*---         integration over the volume element.                     ---*/
     /*------------------------------------------------------------------------*/
 
-    /* Call the general function to carry out the matrix product.
-       Use solDOFs as a temporary storage for the matrix product. */
-    blasFunctions->gemm(nDOFs, NPad, nInt*nDim, matDerBasisIntTrans, fluxes, solDOFs, config);
+    /* Call the general function of the standard element to integrate the
+       fluxes. Use solDOFs as a temporary storage for the result. */
+    standardElementsSol[ind].IntegrateIntPointsToDOFs(true, NPad, fluxes, solDOFs, blasFunctions, config);
 
     /* Add the contribution from the source terms, if needed. Use solInt
-       as temporary storage for the matrix product. */
+       as temporary storage for the result. */
     if( addSourceTerms ) {
 
-      /* Call the general function to carry out the matrix product. */
-      blasFunctions->gemm(nDOFs, NPad, nInt, matBasisIntTrans, sources, solInt, config);
+      /* Call the general function of the standard element. */
+      standardElementsSol[ind].IntegrateIntPointsToDOFs(false, NPad, sources, solInt, blasFunctions, config);
 
       /* Add the residuals due to source terms to the volume residuals */
       for(unsigned short i=0; i<(nDOFs*NPad); ++i)
@@ -6213,14 +6348,19 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
 void CFEM_DG_EulerSolver::Boundary_Conditions(const unsigned short timeLevel,
                                               CConfig              *config,
                                               CNumerics            **numerics,
-                                              const bool           haloInfoNeededForBC,
-                                              su2double            *workArray){
+                                              const bool           haloInfoNeededForBC){
+
+  /* Determine the number of faces that are treated simultaneously
+     in the matrix products to obtain good gemm performance. */
+  const unsigned short nFaceSimul = config->GetSizeMatMulPadding()/nVar;
 
   /* Loop over all boundaries. */
   for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
 
-    /* Check if this boundary marker must be treated at all. */
-    if(boundaries[iMarker].haloInfoNeededForBC == haloInfoNeededForBC) {
+    /* Check if this boundary marker must be treated at all. Nothing
+       needs to be done for a periodic boundary. */
+    if(boundaries[iMarker].haloInfoNeededForBC == haloInfoNeededForBC &&
+       config->GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY) {
 
       /* Determine the range of faces for this time level and test if any
          surface element for this marker must be treated at all. */
@@ -6229,66 +6369,70 @@ void CFEM_DG_EulerSolver::Boundary_Conditions(const unsigned short timeLevel,
 
       if(surfElemEnd > surfElemBeg) {
 
-        /* Set the starting position in the vector for the face residuals for
-           this boundary marker and time level and set the pointer to the boundary
-           faces for this boundary marker. */
-        su2double *resFaces = VecResFaces.data()
-                            + nVar*startLocResFacesMarkers[iMarker][timeLevel];
-
+        /* Set the pointer to the boundary faces for this boundary marker. */
         const CSurfaceElementFEM *surfElem = boundaries[iMarker].surfElem.data();
 
-        /* Apply the appropriate boundary condition. */
-        switch (config->GetMarker_All_KindBC(iMarker)) {
-          case EULER_WALL:
-            BC_Euler_Wall(config, surfElemBeg, surfElemEnd, surfElem, resFaces,
-                          numerics[CONV_BOUND_TERM], workArray);
-            break;
-          case FAR_FIELD:
-            BC_Far_Field(config, surfElemBeg, surfElemEnd, surfElem, resFaces,
-                         numerics[CONV_BOUND_TERM], workArray);
-            break;
-          case SYMMETRY_PLANE:
-            BC_Sym_Plane(config, surfElemBeg, surfElemEnd, surfElem, resFaces,
-                         numerics[CONV_BOUND_TERM], workArray);
-            break;
-          case SUPERSONIC_INLET: /* Use far field for this. When a more detailed state
-                                    needs to be specified, use a Riemann boundary. */
-            BC_Far_Field(config, surfElemBeg, surfElemEnd, surfElem, resFaces,
-                         numerics[CONV_BOUND_TERM], workArray);
-            break;
-          case SUPERSONIC_OUTLET:
-            BC_Supersonic_Outlet(config, surfElemBeg, surfElemEnd, surfElem, resFaces,
-                                 numerics[CONV_BOUND_TERM], workArray);
-            break;
-          case INLET_FLOW:
-            BC_Inlet(config, surfElemBeg, surfElemEnd, surfElem, resFaces,
-                     numerics[CONV_BOUND_TERM], iMarker, workArray);
-            break;
-          case OUTLET_FLOW:
-            BC_Outlet(config, surfElemBeg, surfElemEnd, surfElem, resFaces,
-                      numerics[CONV_BOUND_TERM], iMarker, workArray);
-            break;
-          case ISOTHERMAL:
-            BC_Isothermal_Wall(config, surfElemBeg, surfElemEnd, surfElem, resFaces,
-                               numerics[CONV_BOUND_TERM], iMarker, workArray);
-            break;
-          case HEAT_FLUX:
-            BC_HeatFlux_Wall(config, surfElemBeg, surfElemEnd, surfElem, resFaces,
-                             numerics[CONV_BOUND_TERM], iMarker, workArray);
-            break;
-          case RIEMANN_BOUNDARY:
-            BC_Riemann(config, surfElemBeg, surfElemEnd, surfElem, resFaces,
-                       numerics[CONV_BOUND_TERM], iMarker, workArray);
-            break;
-          case CUSTOM_BOUNDARY:
-            BC_Custom(config, surfElemBeg, surfElemEnd, surfElem, resFaces,
-                      numerics[CONV_BOUND_TERM], workArray);
-            break;
-          case PERIODIC_BOUNDARY:  // Nothing to be done for a periodic boundary.
-            break;
-          default:
-            SU2_MPI::Error("BC not implemented.", CURRENT_FUNCTION);
-        }
+        /* The surface elements are treated in parallel by chunks. Every chunk
+           starts at its own position in the vector of the face residuals
+           and uses the numerics object of its thread. */
+        ParallelLoopChunksOfElem(surfElem, surfElemBeg, surfElemEnd, nFaceSimul,
+          [&](const unsigned long beg, const unsigned long end, su2double *workArray) {
+
+          su2double *resFaces = VecResFaces.data()
+                              + nVar*startLocResSurfElemMarkers[iMarker][beg];
+          CNumerics *conv_numerics = numerics[CONV_BOUND_TERM + omp_get_thread_num()*MAX_TERMS];
+
+          /* Apply the appropriate boundary condition. */
+          switch (config->GetMarker_All_KindBC(iMarker)) {
+            case EULER_WALL:
+              BC_Euler_Wall(config, beg, end, surfElem, resFaces,
+                            conv_numerics, workArray);
+              break;
+            case FAR_FIELD:
+              BC_Far_Field(config, beg, end, surfElem, resFaces,
+                           conv_numerics, workArray);
+              break;
+            case SYMMETRY_PLANE:
+              BC_Sym_Plane(config, beg, end, surfElem, resFaces,
+                           conv_numerics, workArray);
+              break;
+            case SUPERSONIC_INLET: /* Use far field for this. When a more detailed state
+                                      needs to be specified, use a Riemann boundary. */
+              BC_Far_Field(config, beg, end, surfElem, resFaces,
+                           conv_numerics, workArray);
+              break;
+            case SUPERSONIC_OUTLET:
+              BC_Supersonic_Outlet(config, beg, end, surfElem, resFaces,
+                                   conv_numerics, workArray);
+              break;
+            case INLET_FLOW:
+              BC_Inlet(config, beg, end, surfElem, resFaces,
+                       conv_numerics, iMarker, workArray);
+              break;
+            case OUTLET_FLOW:
+              BC_Outlet(config, beg, end, surfElem, resFaces,
+                        conv_numerics, iMarker, workArray);
+              break;
+            case ISOTHERMAL:
+              BC_Isothermal_Wall(config, beg, end, surfElem, resFaces,
+                                 conv_numerics, iMarker, workArray);
+              break;
+            case HEAT_FLUX:
+              BC_HeatFlux_Wall(config, beg, end, surfElem, resFaces,
+                               conv_numerics, iMarker, workArray);
+              break;
+            case RIEMANN_BOUNDARY:
+              BC_Riemann(config, beg, end, surfElem, resFaces,
+                         conv_numerics, iMarker, workArray);
+              break;
+            case CUSTOM_BOUNDARY:
+              BC_Custom(config, beg, end, surfElem, resFaces,
+                        conv_numerics, workArray);
+              break;
+            default:
+              SU2_MPI::Error("BC not implemented.", CURRENT_FUNCTION);
+          }
+        });
       }
     }
   }
@@ -6575,58 +6719,68 @@ void CFEM_DG_EulerSolver::AccumulateSpaceTimeResidualADEROwnedElem(
   const unsigned long elemBegOwned = nVolElemOwnedPerTimeLevel[timeLevel];
   const unsigned long elemEndOwned = nVolElemOwnedPerTimeLevel[timeLevel+1];
 
-  /* Add the residuals coming from the volume integral to VecTotResDOFsADER. */
-  for(unsigned long l=elemBegOwned; l<elemEndOwned; ++l) {
-    const unsigned long offset  = nVar*volElem[l].offsetDOFsSolLocal;
-    const su2double    *res     = VecResDOFs.data() + offset;
-    su2double          *resADER = VecTotResDOFsADER.data() + offset;
-
-    for(unsigned short i=0; i<(nVar*volElem[l].nDOFsSol); ++i)
-      resADER[i] += halfWeight*res[i];
-  }
-
-  /* Add the residuals coming from the surface integral to VecTotResDOFsADER.
-     This part is from faces with the same time level as the element. */
-  for(unsigned long l=elemBegOwned; l<elemEndOwned; ++l) {
-    for(unsigned short i=0; i<volElem[l].nDOFsSol; ++i) {
-      const unsigned long ii = volElem[l].offsetDOFsSolLocal + i;
-      su2double *resADER = VecTotResDOFsADER.data() + nVar*ii;
+  SU2_OMP_PARALLEL
+  {
+    /* Add the residuals coming from the volume integral to VecTotResDOFsADER. */
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for(unsigned long l=elemBegOwned; l<elemEndOwned; ++l) {
+      const unsigned long offset  = nVar*volElem[l].offsetDOFsSolLocal;
+      const su2double    *res     = VecResDOFs.data() + offset;
+      su2double          *resADER = VecTotResDOFsADER.data() + offset;
 
-      for(unsigned long j=nEntriesResFaces[ii]; j<nEntriesResFaces[ii+1]; ++j) {
-        const su2double *resFace = VecResFaces.data() + nVar*entriesResFaces[j];
-        for(unsigned short k=0; k<nVar; ++k)
-          resADER[k] += halfWeight*resFace[k];
-      }
+      for(unsigned short i=0; i<(nVar*volElem[l].nDOFsSol); ++i)
+        resADER[i] += halfWeight*res[i];
     }
-  }
+    END_SU2_OMP_FOR
 
-  /* Check if this is not the last time level. */
-  const unsigned short nTimeLevels = config->GetnLevels_TimeAccurateLTS();
-  if(timeLevel < (nTimeLevels-1)) {
-
-    /* There may exist faces of this time level, which have a neighboring
-       element of the next time level. The residuals of the DOFs of such
-       elements must be updated with the face residuals of the current
-       time level. However, on these elements the time step is twice as
-       large. This is taken into account by multiplying the face residual
-       with quartWeight when accumulating. */
-    const unsigned long nAdjElem = ownedElemAdjLowTimeLevel[timeLevel+1].size();
-    const unsigned long *adjElem = ownedElemAdjLowTimeLevel[timeLevel+1].data();
-
-    for(unsigned l=0; l<nAdjElem; ++l) {
-      const unsigned long ll = adjElem[l];
-      for(unsigned short i=0; i<volElem[ll].nDOFsSol; ++i) {
-        const unsigned long ii = volElem[ll].offsetDOFsSolLocal + i;
+    /* Add the residuals coming from the surface integral to VecTotResDOFsADER.
+       This part is from faces with the same time level as the element. */
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for(unsigned long l=elemBegOwned; l<elemEndOwned; ++l) {
+      for(unsigned short i=0; i<volElem[l].nDOFsSol; ++i) {
+        const unsigned long ii = volElem[l].offsetDOFsSolLocal + i;
         su2double *resADER = VecTotResDOFsADER.data() + nVar*ii;
 
-        for(unsigned long j=nEntriesResAdjFaces[ii]; j<nEntriesResAdjFaces[ii+1]; ++j) {
-          const su2double *resFace = VecResFaces.data() + nVar*entriesResAdjFaces[j];
+        for(unsigned long j=nEntriesResFaces[ii]; j<nEntriesResFaces[ii+1]; ++j) {
+          const su2double *resFace = VecResFaces.data() + nVar*entriesResFaces[j];
           for(unsigned short k=0; k<nVar; ++k)
-            resADER[k] += quartWeight*resFace[k];
+            resADER[k] += halfWeight*resFace[k];
         }
       }
     }
+    END_SU2_OMP_FOR
+
+    /* Check if this is not the last time level. */
+    const unsigned short nTimeLevels = config->GetnLevels_TimeAccurateLTS();
+    if(timeLevel < (nTimeLevels-1)) {
+
+      /* There may exist faces of this time level, which have a neighboring
+         element of the next time level. The residuals of the DOFs of such
+         elements must be updated with the face residuals of the current
+         time level. However, on these elements the time step is twice as
+         large. This is taken into account by multiplying the face residual
+         with quartWeight when accumulating. */
+      const unsigned long nAdjElem = ownedElemAdjLowTimeLevel[timeLevel+1].size();
+      const unsigned long *adjElem = ownedElemAdjLowTimeLevel[timeLevel+1].data();
+
+      SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+      for(unsigned l=0; l<nAdjElem; ++l) {
+        const unsigned long ll = adjElem[l];
+        for(unsigned short i=0; i<volElem[ll].nDOFsSol; ++i) {
+          const unsigned long ii = volElem[ll].offsetDOFsSolLocal + i;
+          su2double *resADER = VecTotResDOFsADER.data() + nVar*ii;
+
+          for(unsigned long j=nEntriesResAdjFaces[ii]; j<nEntriesResAdjFaces[ii+1]; ++j) {
+            const su2double *resFace = VecResFaces.data() + nVar*entriesResAdjFaces[j];
+            for(unsigned short k=0; k<nVar; ++k)
+              resADER[k] += quartWeight*resFace[k];
+          }
+        }
+      }
+      END_SU2_OMP_FOR
+    }
   }
+  END_SU2_OMP_PARALLEL
 }
 
 void CFEM_DG_EulerSolver::AccumulateSpaceTimeResidualADERHaloElem(
@@ -6648,48 +6802,56 @@ void CFEM_DG_EulerSolver::AccumulateSpaceTimeResidualADERHaloElem(
   const unsigned long elemBegHalo = nVolElemHaloPerTimeLevel[timeLevel];
   const unsigned long elemEndHalo = nVolElemHaloPerTimeLevel[timeLevel+1];
 
-  /* Add the residuals coming from the surface integral to VecTotResDOFsADER.
-     This part is from faces with the same time level as the element. */
-  for(unsigned long l=elemBegHalo; l<elemEndHalo; ++l) {
-    for(unsigned short i=0; i<volElem[l].nDOFsSol; ++i) {
-      const unsigned long ii = volElem[l].offsetDOFsSolLocal + i;
-      su2double *resADER = VecTotResDOFsADER.data() + nVar*ii;
+  SU2_OMP_PARALLEL
+  {
+    /* Add the residuals coming from the surface integral to VecTotResDOFsADER.
+       This part is from faces with the same time level as the element. */
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for(unsigned long l=elemBegHalo; l<elemEndHalo; ++l) {
+      for(unsigned short i=0; i<volElem[l].nDOFsSol; ++i) {
+        const unsigned long ii = volElem[l].offsetDOFsSolLocal + i;
+        su2double *resADER = VecTotResDOFsADER.data() + nVar*ii;
 
-      for(unsigned long j=nEntriesResFaces[ii]; j<nEntriesResFaces[ii+1]; ++j) {
-        const su2double *resFace = VecResFaces.data() + nVar*entriesResFaces[j];
-        for(unsigned short k=0; k<nVar; ++k)
-          resADER[k] += halfWeight*resFace[k];
+        for(unsigned long j=nEntriesResFaces[ii]; j<nEntriesResFaces[ii+1]; ++j) {
+          const su2double *resFace = VecResFaces.data() + nVar*entriesResFaces[j];
+          for(unsigned short k=0; k<nVar; ++k)
+            resADER[k] += halfWeight*resFace[k];
+        }
       }
     }
-  }
-
-  /* Check if this is not the last time level. */
-  const unsigned short nTimeLevels = config->GetnLevels_TimeAccurateLTS();
-  if(timeLevel < (nTimeLevels-1)) {
-
-    /* There may exist faces of this time level, which have a neighboring
-       element of the next time level. The residuals of the DOFs of such
-       elements must be updated with the face residuals of the current
-       time level. However, on these elements the time step is twice as
-       large. This is taken into account by multiplying the face residual
-       with quartWeight when accumulating. */
-    const unsigned long nAdjElem = haloElemAdjLowTimeLevel[timeLevel+1].size();
-    const unsigned long *adjElem = haloElemAdjLowTimeLevel[timeLevel+1].data();
-
-    for(unsigned l=0; l<nAdjElem; ++l) {
-      const unsigned long ll = adjElem[l];
-      for(unsigned short i=0; i<volElem[ll].nDOFsSol; ++i) {
-        const unsigned long ii = volElem[ll].offsetDOFsSolLocal + i;
-        su2double *resADER = VecTotResDOFsADER.data() + nVar*ii;
+    END_SU2_OMP_FOR
 
-        for(unsigned long j=nEntriesResAdjFaces[ii]; j<nEntriesResAdjFaces[ii+1]; ++j) {
-          const su2double *resFace = VecResFaces.data() + nVar*entriesResAdjFaces[j];
-          for(unsigned short k=0; k<nVar; ++k)
-            resADER[k] += quartWeight*resFace[k];
+    /* Check if this is not the last time level. */
+    const unsigned short nTimeLevels = config->GetnLevels_TimeAccurateLTS();
+    if(timeLevel < (nTimeLevels-1)) {
+
+      /* There may exist faces of this time level, which have a neighboring
+         element of the next time level. The residuals of the DOFs of such
+         elements must be updated with the face residuals of the current
+         time level. However, on these elements the time step is twice as
+         large. This is taken into account by multiplying the face residual
+         with quartWeight when accumulating. */
+      const unsigned long nAdjElem = haloElemAdjLowTimeLevel[timeLevel+1].size();
+      const unsigned long *adjElem = haloElemAdjLowTimeLevel[timeLevel+1].data();
+
+      SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+      for(unsigned l=0; l<nAdjElem; ++l) {
+        const unsigned long ll = adjElem[l];
+        for(unsigned short i=0; i<volElem[ll].nDOFsSol; ++i) {
+          const unsigned long ii = volElem[ll].offsetDOFsSolLocal + i;
+          su2double *resADER = VecTotResDOFsADER.data() + nVar*ii;
+
+          for(unsigned long j=nEntriesResAdjFaces[ii]; j<nEntriesResAdjFaces[ii+1]; ++j) {
+            const su2double *resFace = VecResFaces.data() + nVar*entriesResAdjFaces[j];
+            for(unsigned short k=0; k<nVar; ++k)
+              resADER[k] += quartWeight*resFace[k];
+          }
         }
       }
+      END_SU2_OMP_FOR
     }
   }
+  END_SU2_OMP_PARALLEL
 }
 
 void CFEM_DG_EulerSolver::CreateFinalResidual(const unsigned short timeLevel,
@@ -6707,32 +6869,40 @@ void CFEM_DG_EulerSolver::CreateFinalResidual(const unsigned short timeLevel,
     elemEnd   = nVolElemHaloPerTimeLevel[timeLevel+1];
   }
 
-  /* For the halo elements the residual is initialized to zero. */
-  if( !ownedElements ) {
+  SU2_OMP_PARALLEL
+  {
+    /* For the halo elements the residual is initialized to zero. */
+    if( !ownedElements ) {
 
-    for(unsigned long l=elemStart; l<elemEnd; ++l) {
-      su2double *resDOFsElem = VecResDOFs.data() + nVar*volElem[l].offsetDOFsSolLocal;
-      for(unsigned short i=0; i<(nVar*volElem[l].nDOFsSol); ++i)
-        resDOFsElem[i] = 0.0;
+      SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+      for(unsigned long l=elemStart; l<elemEnd; ++l) {
+        su2double *resDOFsElem = VecResDOFs.data() + nVar*volElem[l].offsetDOFsSolLocal;
+        for(unsigned short i=0; i<(nVar*volElem[l].nDOFsSol); ++i)
+          resDOFsElem[i] = 0.0;
+      }
+      END_SU2_OMP_FOR
     }
-  }
 
-  /* Loop over the required element range. */
-  for(unsigned long l=elemStart; l<elemEnd; ++l) {
+    /* Loop over the required element range. */
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for(unsigned long l=elemStart; l<elemEnd; ++l) {
 
-    /* Loop over the DOFs of this element. */
-    for(unsigned long i=volElem[l].offsetDOFsSolLocal;
-                      i<(volElem[l].offsetDOFsSolLocal+volElem[l].nDOFsSol); ++i) {
+      /* Loop over the DOFs of this element. */
+      for(unsigned long i=volElem[l].offsetDOFsSolLocal;
+                        i<(volElem[l].offsetDOFsSolLocal+volElem[l].nDOFsSol); ++i) {
 
-      /* Create the final residual by summing up all contributions. */
-      su2double *resDOF = VecResDOFs.data() + nVar*i;
-      for(unsigned long j=nEntriesResFaces[i]; j<nEntriesResFaces[i+1]; ++j) {
-        const su2double *resFace = VecResFaces.data() + nVar*entriesResFaces[j];
-        for(unsigned short k=0; k<nVar; ++k)
-          resDOF[k] += resFace[k];
+        /* Create the final residual by summing up all contributions. */
+        su2double *resDOF = VecResDOFs.data() + nVar*i;
+        for(unsigned long j=nEntriesResFaces[i]; j<nEntriesResFaces[i+1]; ++j) {
+          const su2double *resFace = VecResFaces.data() + nVar*entriesResFaces[j];
+          for(unsigned short k=0; k<nVar; ++k)
+            resDOF[k] += resFace[k];
+        }
       }
     }
+    END_SU2_OMP_FOR
   }
+  END_SU2_OMP_PARALLEL
 }
 
 void CFEM_DG_EulerSolver::MultiplyResidualByInverseMassMatrix(
@@ -6960,8 +7130,8 @@ void CFEM_DG_EulerSolver::Pressure_Forces(const CGeometry* geometry, const CConf
                   const su2double v            = sol[2]*DensityInv;
                   const su2double StaticEnergy = sol[3]*DensityInv - 0.5*(u*u + v*v);
 
-                  FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-                  const su2double Pressure = FluidModel->GetPressure();
+                  GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+                  const su2double Pressure = GetFluidModel()->GetPressure();
 
                   /*-- Compute the vector from the reference point to the integration
                        point and update the inviscid force. Note that the normal points
@@ -7013,8 +7183,8 @@ void CFEM_DG_EulerSolver::Pressure_Forces(const CGeometry* geometry, const CConf
                   const su2double w            = sol[3]*DensityInv;
                   const su2double StaticEnergy = sol[4]*DensityInv - 0.5*(u*u + v*v + w*w);
 
-                  FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-                  const su2double Pressure = FluidModel->GetPressure();
+                  GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+                  const su2double Pressure = GetFluidModel()->GetPressure();
 
                   /*-- Compute the vector from the reference point to the integration
                        point and update the inviscid force. Note that the normal points
@@ -7619,9 +7789,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Inlet(CConfig                  *config,
 
       su2double StaticEnergy = UL[nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(UL[0], StaticEnergy);
-      su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
-      su2double Pressure    = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(UL[0], StaticEnergy);
+      su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
+      su2double Pressure    = GetFluidModel()->GetPressure();
 
       /*--- Compute the Riemann invariant to be extrapolated. ---*/
       const su2double Riemann = 2.0*sqrt(SoundSpeed2)/Gamma_Minus_One + VelocityNormal;
@@ -7727,9 +7897,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Outlet(CConfig                  *config
 
       su2double StaticEnergy = UL[nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(UL[0], StaticEnergy);
-      su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
-      su2double Pressure    = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(UL[0], StaticEnergy);
+      su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
+      su2double Pressure    = GetFluidModel()->GetPressure();
 
       /*--- Subsonic exit flow: there is one incoming characteristic,
             therefore one variable can be specified (back pressure) and is used
@@ -7791,11 +7961,11 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
       T_Total /= config->GetTemperature_Ref();
 
       /* Compute the total enthalpy and entropy from these values. */
-      FluidModel->SetTDState_PT(P_Total, T_Total);
+      GetFluidModel()->SetTDState_PT(P_Total, T_Total);
 
-      const su2double Enthalpy_e = FluidModel->GetStaticEnergy()
-                                 + FluidModel->GetPressure()/FluidModel->GetDensity();
-      const su2double Entropy_e  = FluidModel->GetEntropy();
+      const su2double Enthalpy_e = GetFluidModel()->GetStaticEnergy()
+                                 + GetFluidModel()->GetPressure()/GetFluidModel()->GetDensity();
+      const su2double Entropy_e  = GetFluidModel()->GetEntropy();
 
       /* Loop over the faces that are treated simultaneously. */
       for(unsigned short l=0; l<nFaceSimul; ++l) {
@@ -7822,9 +7992,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
              and total energy per unit mass for the right state. */
           const su2double StaticEnthalpy_e = Enthalpy_e - 0.5*Velocity2_e;
 
-          FluidModel->SetTDState_hs(StaticEnthalpy_e, Entropy_e);
-          const su2double Density_e = FluidModel->GetDensity();
-          const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
+          GetFluidModel()->SetTDState_hs(StaticEnthalpy_e, Entropy_e);
+          const su2double Density_e = GetFluidModel()->GetDensity();
+          const su2double StaticEnergy_e = GetFluidModel()->GetStaticEnergy();
           const su2double Energy_e       = StaticEnergy_e + 0.5*Velocity2_e;
 
           /* Set the conservative variables of the right state. */
@@ -7854,10 +8024,10 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
       /* Compute the prescribed density, static energy per unit mass
          and speed of sound. */
-      FluidModel->SetTDState_PT(P_static, T_static);
-      const su2double Density_e      = FluidModel->GetDensity();
-      const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
-      const su2double SoundSpeed     = FluidModel->GetSoundSpeed();
+      GetFluidModel()->SetTDState_PT(P_static, T_static);
+      const su2double Density_e      = GetFluidModel()->GetDensity();
+      const su2double StaticEnergy_e = GetFluidModel()->GetStaticEnergy();
+      const su2double SoundSpeed     = GetFluidModel()->GetSoundSpeed();
 
       /* Determine the magnitude of the Mach number. */
       su2double MachMag = 0.0;
@@ -7905,10 +8075,10 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
       /* Compute the prescribed pressure, static energy per unit mass
          and speed of sound. */
-      FluidModel->SetTDState_Prho(P_static, Rho_static);
-      const su2double Density_e      = FluidModel->GetDensity();
-      const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
-      const su2double SoundSpeed     = FluidModel->GetSoundSpeed();
+      GetFluidModel()->SetTDState_Prho(P_static, Rho_static);
+      const su2double Density_e      = GetFluidModel()->GetDensity();
+      const su2double StaticEnergy_e = GetFluidModel()->GetStaticEnergy();
+      const su2double SoundSpeed     = GetFluidModel()->GetSoundSpeed();
 
       /* Determine the magnitude of the Mach number. */
       su2double MachMag = 0.0;
@@ -8002,7 +8172,7 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
           /* Extrapolate the density and set the thermodynamic state. */
           UR[0] = UL[0];
-          FluidModel->SetTDState_Prho(Pressure_e, UR[0]);
+          GetFluidModel()->SetTDState_Prho(Pressure_e, UR[0]);
 
           /* Extrapolate the velocity. As the density is also extrapolated,
              this means that the momentum variables are identical for UL and UR.
@@ -8017,7 +8187,7 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           }
 
           /* Compute the total energy per unit volume. */
-          UR[nDim+1] = UR[0]*(FluidModel->GetStaticEnergy() + 0.5*Velocity2_e);
+          UR[nDim+1] = UR[0]*(GetFluidModel()->GetStaticEnergy() + 0.5*Velocity2_e);
         }
       }
 
@@ -8068,11 +8238,11 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           const su2double ny  = normals[1];
           const su2double vnL = vxL*nx + vyL*ny;
 
-          FluidModel->SetTDState_rhoe(UL[0], eL);
+          GetFluidModel()->SetTDState_rhoe(UL[0], eL);
 
-          const su2double aL  = FluidModel->GetSoundSpeed();
+          const su2double aL  = GetFluidModel()->GetSoundSpeed();
           const su2double a2L = aL*aL;
-          const su2double pL  = FluidModel->GetPressure();
+          const su2double pL  = GetFluidModel()->GetPressure();
           const su2double HL  = (UL[3] + pL)*tmp;
 
           const su2double ovaL  = 1.0/aL;
@@ -8147,11 +8317,11 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           const su2double nz  = normals[2];
           const su2double vnL = vxL*nx + vyL*ny + vzL*nz;
 
-          FluidModel->SetTDState_rhoe(UL[0], eL);
+          GetFluidModel()->SetTDState_rhoe(UL[0], eL);
 
-          const su2double aL  = FluidModel->GetSoundSpeed();
+          const su2double aL  = GetFluidModel()->GetSoundSpeed();
           const su2double a2L = aL*aL;
-          const su2double pL  = FluidModel->GetPressure();
+          const su2double pL  = GetFluidModel()->GetPressure();
           const su2double HL  = (UL[4] + pL)*tmp;
 
           const su2double ovaL  = 1.0/aL;
@@ -9368,11 +9538,13 @@ void CFEM_DG_EulerSolver::ComputeInviscidFluxesFace(CConfig              *config
       su2double Prim_L[8];
       su2double Prim_R[8];
 
-      Jacobian_i = new su2double*[nVar];
-      Jacobian_j = new su2double*[nVar];
+      /*--- Local (dummy) Jacobians, such that this function can be called
+       by several threads simultaneously. ---*/
+      su2double JacData_i[25], JacData_j[25];
+      su2double *Jac_i[5], *Jac_j[5];
       for (unsigned short iVar = 0; iVar < nVar; ++iVar) {
-        Jacobian_i[iVar] = new su2double[nVar];
-        Jacobian_j[iVar] = new su2double[nVar];
+        Jac_i[iVar] = JacData_i + iVar*nVar;
+        Jac_j[iVar] = JacData_j + iVar*nVar;
       }
 
       /* Loop over the number of faces treated simultaneously. */
@@ -9438,19 +9610,9 @@ void CFEM_DG_EulerSolver::ComputeInviscidFluxesFace(CConfig              *config
           /*--- Now simply call the ComputeResidual() function to calculate
            the flux using the chosen approximate Riemann solver. Note that
            the Jacobian arrays here are just dummies for now (no implicit). ---*/
-          numerics->ComputeResidual(flux, Jacobian_i, Jacobian_j, config);
+          numerics->ComputeResidual(flux, Jac_i, Jac_j, config);
         }
       }
-
-      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-        delete [] Jacobian_i[iVar];
-        delete [] Jacobian_j[iVar];
-      }
-      delete [] Jacobian_i;
-      delete [] Jacobian_j;
-
-      Jacobian_i = nullptr;
-      Jacobian_j = nullptr;
     }
   }
 }
@@ -9544,9 +9706,9 @@ void CFEM_DG_EulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, C
 
       su2double StaticEnergy = VecSolDOFs[ii+nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(VecSolDOFs[ii], StaticEnergy);
-      su2double Pressure = FluidModel->GetPressure();
-      su2double Temperature = FluidModel->GetTemperature();
+      GetFluidModel()->SetTDState_rhoe(VecSolDOFs[ii], StaticEnergy);
+      su2double Pressure = GetFluidModel()->GetPressure();
+      su2double Temperature = GetFluidModel()->GetTemperature();
 
       /*--- Use the values at the infinity if the state is not physical. ---*/
       if((Pressure < 0.0) || (VecSolDOFs[ii] < 0.0) || (Temperature < 0.0)) {
@@ -482,11 +482,8 @@ void CMeshSolver::DeformMesh(CGeometry **geometry, CNumerics **numerics, CConfig
   geometry[MESH_0]->InitiateComms(geometry[MESH_0], config, MPI_QUANTITIES::COORDINATES);
   geometry[MESH_0]->CompleteComms(geometry[MESH_0], config, MPI_QUANTITIES::COORDINATES);
 
-  InitiateComms(geometry[MESH_0], config, MPI_QUANTITIES::SOLUTION);
-  CompleteComms(geometry[MESH_0], config, MPI_QUANTITIES::SOLUTION);
-
-  InitiateComms(geometry[MESH_0], config, MPI_QUANTITIES::MESH_DISPLACEMENTS);
-  CompleteComms(geometry[MESH_0], config, MPI_QUANTITIES::MESH_DISPLACEMENTS);
+  InitiateComms(geometry[MESH_0], config, {MPI_QUANTITIES::SOLUTION, MPI_QUANTITIES::MESH_DISPLACEMENTS});
+  CompleteComms(geometry[MESH_0], config, {MPI_QUANTITIES::SOLUTION, MPI_QUANTITIES::MESH_DISPLACEMENTS});
 
   /*--- Compute the stiffness matrix, no point recording because we clear the residual. ---*/
 
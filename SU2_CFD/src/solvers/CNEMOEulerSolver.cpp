@@ -488,6 +488,9 @@ void CNEMOEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_con
   su2double  Project_Grad_i[MAXNVAR] = {0.0}, Project_Grad_j[MAXNVAR] = {0.0};
   su2double Gamma_i = 0.0, Gamma_j = 0.0;
 
+  /*--- The halo limiters must have arrived (see CSolver::InitiateOverlappedComms). ---*/
+  geometry->CompletePendingComms();
+
   /*--- Loop over edges and calculate convective fluxes ---*/
   for(auto iEdge = 0ul; iEdge < geometry->GetnEdge(); iEdge++) {
 
@@ -137,32 +137,40 @@ unsigned long CNSSolver::SetPrimitive_Variables(CSolver **solver_container, cons
 
   AD::StartNoSharedReading();
 
-  SU2_OMP_FOR_STAT(omp_chunk_size)
-  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint ++) {
+  /*--- The fluid model is evaluated in batches of contiguous points (work space local to the thread). ---*/
+
+  CFluidStateBatch batch;
+  constexpr unsigned long batchSize = CFluidStateBatch::MaxSize;
+  const unsigned long nBatch = roundUpDiv(nPoint, batchSize);
+
+  SU2_OMP_FOR_STAT(roundUpDiv(omp_chunk_size, batchSize))
+  for (unsigned long iBatch = 0; iBatch < nBatch; iBatch++) {
+
+    const auto iPointBegin = iBatch * batchSize;
+    const auto nPointBatch = min(batchSize, nPoint - iPointBegin);
 
     /*--- Retrieve the value of the kinetic energy (if needed). ---*/
 
-    su2double eddy_visc = 0.0, turb_ke = 0.0;
+    su2double eddy_visc[batchSize] = {0.0}, turb_ke[batchSize] = {0.0};
 
     if (turb_model != TURB_MODEL::NONE && solver_container[TURB_SOL] != nullptr) {
-      eddy_visc = solver_container[TURB_SOL]->GetNodes()->GetmuT(iPoint);
-      if (tkeNeeded) turb_ke = solver_container[TURB_SOL]->GetNodes()->GetSolution(iPoint,0);
-
-      if (config->GetKind_HybridRANSLES() != NO_HYBRIDRANSLES) {
-        su2double DES_LengthScale = solver_container[TURB_SOL]->GetNodes()->GetDES_LengthScale(iPoint);
-        nodes->SetDES_LengthScale(iPoint, DES_LengthScale);
+      for (unsigned long k = 0; k < nPointBatch; k++) {
+        const auto iPoint = iPointBegin + k;
+        eddy_visc[k] = solver_container[TURB_SOL]->GetNodes()->GetmuT(iPoint);
+        if (tkeNeeded) turb_ke[k] = solver_container[TURB_SOL]->GetNodes()->GetSolution(iPoint,0);
+
+        if (config->GetKind_HybridRANSLES() != NO_HYBRIDRANSLES) {
+          su2double DES_LengthScale = solver_container[TURB_SOL]->GetNodes()->GetDES_LengthScale(iPoint);
+          nodes->SetDES_LengthScale(iPoint, DES_LengthScale);
+        }
       }
     }
 
-    /*--- Compressible flow, primitive variables nDim+5, (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp) ---*/
-
-    bool physical = static_cast<CNSVariable*>(nodes)->SetPrimVar(iPoint, eddy_visc, turb_ke, GetFluidModel());
-    nodes->SetSecondaryVar(iPoint, GetFluidModel());
-
-    /*--- Check for non-realizable states for reporting. ---*/
-
-    nonPhysicalPoints += !physical;
+    /*--- Compressible flow, primitive variables nDim+5, (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp),
+     *    the number of non-realizable states is returned for reporting. ---*/
 
+    nonPhysicalPoints += static_cast<CNSVariable*>(nodes)->SetPrimVarBatch(iPointBegin, nPointBatch, eddy_visc,
+                                                                           turb_ke, GetFluidModel(), batch);
   }
   END_SU2_OMP_FOR
 
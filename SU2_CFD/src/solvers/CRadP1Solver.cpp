@@ -35,7 +35,6 @@ CRadP1Solver::CRadP1Solver() : CRadSolver() {
 
 CRadP1Solver::CRadP1Solver(CGeometry* geometry, CConfig *config) : CRadSolver(geometry, config) {
 
-  unsigned short iVar;
   unsigned short direct_diff = config->GetDirectDiff();
   bool multizone = config->GetMultizone_Problem();
 
@@ -48,10 +47,30 @@ CRadP1Solver::CRadP1Solver(CGeometry* geometry, CConfig *config) : CRadSolver(ge
 
   nVarGrad = nVar;
 
-  Residual = new su2double[nVar];
   Solution = new su2double[nVar];
 
-  Res_Visc = new su2double[nVar];
+#ifdef HAVE_OMP
+  /*--- Get the edge coloring, see notes in CEulerSolver's constructor. ---*/
+  su2double parallelEff = 1.0;
+#ifdef CODI_REVERSE_TYPE
+  const bool relax = config->GetEdgeColoringRelaxDiscAdj();
+  const auto& coloring = geometry->GetEdgeColoring(&parallelEff, relax);
+#else
+  const auto& coloring = geometry->GetEdgeColoring(&parallelEff);
+#endif
+
+  ReducerStrategy = parallelEff < COLORING_EFF_THRESH;
+
+  if (ReducerStrategy && (coloring.getOuterSize() > 1)) geometry->SetNaturalEdgeColoring();
+
+  if (!coloring.empty()) {
+    auto groupSize = ReducerStrategy ? 1ul : geometry->GetEdgeColorGroupSize();
+    splitColoring(coloring, groupSize, geometry->GetnEdge(), EdgeColoring);
+  }
+#else
+  EdgeColoring[0] = DummyGridColor<>(geometry->GetnEdge());
+#endif
+  omp_chunk_size = computeStaticChunkSize(nPoint, omp_get_max_threads(), OMP_MAX_SIZE);
 
   /*--- Define some structures for locating max residuals ---*/
 
@@ -64,15 +83,8 @@ CRadP1Solver::CRadP1Solver(CGeometry* geometry, CConfig *config) : CRadSolver(ge
 
   if (config->GetKind_TimeIntScheme_Radiation() == EULER_IMPLICIT) {
 
-    Jacobian_i = new su2double* [nVar];
-    Jacobian_j = new su2double* [nVar];
-    for (iVar = 0; iVar < nVar; iVar++) {
-      Jacobian_i[iVar] = new su2double [nVar];
-      Jacobian_j[iVar] = new su2double [nVar];
-    }
-
     if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (P1 radiation equation)." << endl;
-    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
 
   }
 
@@ -80,6 +92,7 @@ CRadP1Solver::CRadP1Solver(CGeometry* geometry, CConfig *config) : CRadSolver(ge
 
   LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
   LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
+  if (ReducerStrategy) EdgeFluxes.Initialize(geometry->GetnEdge(), geometry->GetnEdge(), nVar, nullptr);
 
   /*--- Read farfield conditions from config ---*/
   Temperature_Inf = config->GetTemperature_FreeStreamND();
@@ -138,12 +151,9 @@ CRadP1Solver::~CRadP1Solver() {
 
 void CRadP1Solver::Preprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) {
 
-  unsigned long iPoint;
-
   /*--- Initialize the residual vector ---*/
-  for (iPoint = 0; iPoint < nPoint; iPoint ++) {
-    LinSysRes.SetBlock_Zero(iPoint);
-  }
+  LinSysRes.SetValZero();
+  if (ReducerStrategy) EdgeFluxes.SetValZero();
 
   /*--- Initialize the Jacobian matrix ---*/
   Jacobian.SetValZero();
@@ -161,81 +171,141 @@ void CRadP1Solver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
 void CRadP1Solver::Postprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh) {
 
-  unsigned long iPoint;
-  su2double Energy, Temperature;
-  su2double SourceTerm, SourceTerm_Derivative;
+  const auto flowNodes = solver_container[FLOW_SOL]->GetNodes();
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
     /*--- Retrieve the radiative energy ---*/
-    Energy = nodes->GetSolution(iPoint, 0);
+    const su2double Energy = nodes->GetSolution(iPoint, 0);
 
     /*--- Retrieve temperature from the flow solver ---*/
-    Temperature = solver_container[FLOW_SOL]->GetNodes()->GetTemperature(iPoint);
+    const su2double Temperature = flowNodes->GetTemperature(iPoint);
 
     /*--- Compute the divergence of the radiative flux ---*/
-    SourceTerm = Absorption_Coeff*(Energy - 4.0*STEFAN_BOLTZMANN*pow(Temperature,4.0));
+    const su2double SourceTerm = Absorption_Coeff*(Energy - 4.0*STEFAN_BOLTZMANN*pow(Temperature,4.0));
 
     /*--- Compute the derivative of the source term with respect to the temperature ---*/
-    SourceTerm_Derivative =  - 16.0*Absorption_Coeff*STEFAN_BOLTZMANN*pow(Temperature,3.0);
+    const su2double SourceTerm_Derivative =  - 16.0*Absorption_Coeff*STEFAN_BOLTZMANN*pow(Temperature,3.0);
 
     /*--- Store the source term and its derivative ---*/
     nodes->SetRadiative_SourceTerm(iPoint, 0, SourceTerm);
     nodes->SetRadiative_SourceTerm(iPoint, 1, SourceTerm_Derivative);
 
   }
+  END_SU2_OMP_FOR
 
 }
 
 void CRadP1Solver::Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                     CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
 
-  CNumerics* numerics = numerics_container[VISC_TERM];
+  /*--- Pick one numerics object per thread. ---*/
+  CNumerics* numerics = numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS];
 
-  unsigned long iEdge, iPoint, jPoint;
+  /*--- Residual and Jacobians of the edge, local to each thread (the P1 model has one variable). ---*/
+  su2double Residual_ij[1] = {0.0}, Jac_i[1] = {0.0}, Jac_j[1] = {0.0};
+  su2double *Jacobian_ij_i[] = {Jac_i}, *Jacobian_ij_j[] = {Jac_j};
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  /*--- For hybrid parallel AD, pause preaccumulation if there is shared reading of
+   * variables, otherwise switch to the faster adjoint evaluation mode. ---*/
+  bool pausePreacc = false;
+  if (ReducerStrategy)
+    pausePreacc = AD::PausePreaccumulation();
+  else
+    AD::StartNoSharedReading();
 
-    /*--- Points in edge ---*/
+  /*--- Loop over edge colors, the edges of a color do not share points. ---*/
+  for (const auto& color : EdgeColoring) {
 
-    iPoint = geometry->edges->GetNode(iEdge,0);
-    jPoint = geometry->edges->GetNode(iEdge,1);
+    /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+    for (auto k = 0ul; k < color.size; ++k) {
 
-    /*--- Points coordinates, and normal vector ---*/
+      const auto iEdge = color.indices[k];
 
-    numerics->SetCoord(geometry->nodes->GetCoord(iPoint),
-                       geometry->nodes->GetCoord(jPoint));
-    numerics->SetNormal(geometry->edges->GetNormal(iEdge));
+      /*--- Points in edge ---*/
 
-    /*--- Radiation variables w/o reconstruction, and its gradients ---*/
+      const auto iPoint = geometry->edges->GetNode(iEdge,0);
+      const auto jPoint = geometry->edges->GetNode(iEdge,1);
+
+      /*--- Points coordinates, and normal vector ---*/
+
+      numerics->SetCoord(geometry->nodes->GetCoord(iPoint),
+                         geometry->nodes->GetCoord(jPoint));
+      numerics->SetNormal(geometry->edges->GetNormal(iEdge));
+
+      /*--- Radiation variables w/o reconstruction, and its gradients ---*/
+
+      numerics->SetRadVar(nodes->GetSolution(iPoint), nodes->GetSolution(jPoint));
+      numerics->SetRadVarGradient(nodes->GetGradient(iPoint), nodes->GetGradient(jPoint));
+
+      /*--- Compute residual, and Jacobians ---*/
+
+      numerics->ComputeResidual(Residual_ij, Jacobian_ij_i, Jacobian_ij_j, config);
+
+      /*--- Add and subtract residual, and update Jacobian ---*/
+
+      if (ReducerStrategy) {
+        EdgeFluxes.SubtractBlock(iEdge, Residual_ij);
+        Jacobian.UpdateBlocksSub(iEdge, Jacobian_ij_i, Jacobian_ij_j);
+      } else {
+        LinSysRes.SubtractBlock(iPoint, Residual_ij);
+        LinSysRes.AddBlock(jPoint, Residual_ij);
+        Jacobian.UpdateBlocksSub(iEdge, iPoint, jPoint, Jacobian_ij_i, Jacobian_ij_j);
+      }
+    }
+    END_SU2_OMP_FOR
+  }
 
-    numerics->SetRadVar(nodes->GetSolution(iPoint), nodes->GetSolution(jPoint));
-    numerics->SetRadVarGradient(nodes->GetGradient(iPoint), nodes->GetGradient(jPoint));
+  /*--- Restore preaccumulation and adjoint evaluation state. ---*/
+  AD::ResumePreaccumulation(pausePreacc);
+  if (!ReducerStrategy) AD::EndNoSharedReading();
 
-    /*--- Compute residual, and Jacobians ---*/
+  if (ReducerStrategy) {
+    SumEdgeFluxes(geometry);
+    Jacobian.SetDiagonalAsColumnSum();
+  }
 
-    numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
+}
 
-    /*--- Add and subtract residual, and update Jacobian ---*/
+void CRadP1Solver::SumEdgeFluxes(const CGeometry* geometry) {
 
-    LinSysRes.SubtractBlock(iPoint, Residual);
-    LinSysRes.AddBlock(jPoint, Residual);
-    Jacobian.UpdateBlocksSub(iEdge, iPoint, jPoint, Jacobian_i, Jacobian_j);
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+    LinSysRes.SetBlock_Zero(iPoint);
 
+    for (auto iEdge : geometry->nodes->GetEdges(iPoint)) {
+      if (iPoint == geometry->edges->GetNode(iEdge,0))
+        LinSysRes.AddBlock(iPoint, EdgeFluxes.GetBlock(iEdge));
+      else
+        LinSysRes.SubtractBlock(iPoint, EdgeFluxes.GetBlock(iEdge));
+    }
   }
+  END_SU2_OMP_FOR
 
 }
 
 void CRadP1Solver::Source_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                   CConfig *config, unsigned short iMesh) {
 
-  CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM];
+  /*--- Pick one numerics object per thread. ---*/
+  CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM + omp_get_thread_num()*MAX_TERMS];
 
+  const auto flowNodes = solver_container[FLOW_SOL]->GetNodes();
+
+  /*--- Residual and Jacobian of the point, local to each thread. ---*/
+  su2double Residual_i[1] = {0.0}, Jac_i[1] = {0.0};
+  su2double *Jacobian_ii[] = {Jac_i};
+
+  AD::StartNoSharedReading();
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
   for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
     /*--- Conservative variables w/o reconstruction ---*/
 
-    numerics->SetPrimitive(solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(iPoint), nullptr);
+    numerics->SetPrimitive(flowNodes->GetPrimitive(iPoint), nullptr);
 
     /*--- Radiation variables w/o reconstruction ---*/
 
@@ -247,14 +317,17 @@ void CRadP1Solver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
 
     /*--- Compute the source term ---*/
 
-    numerics->ComputeResidual(Residual, Jacobian_i, config);
+    numerics->ComputeResidual(Residual_i, Jacobian_ii, config);
 
     /*--- Subtract residual and the Jacobian ---*/
 
-    LinSysRes.SubtractBlock(iPoint, Residual);
-    Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
+    LinSysRes.SubtractBlock(iPoint, Residual_i);
+    Jacobian.SubtractBlock2Diag(iPoint, Jacobian_ii);
 
   }
+  END_SU2_OMP_FOR
+
+  AD::EndNoSharedReading();
 
  /*--- Custom user defined source term (from the python wrapper) ---*/
   if (config->GetPyCustomSource()) {
@@ -266,400 +339,354 @@ void CRadP1Solver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
 void CRadP1Solver::BC_Isothermal_Wall(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics, CNumerics *visc_numerics, CConfig *config,
                                        unsigned short val_marker) {
 
-  unsigned short iVar, jVar;
-  unsigned long iVertex, iPoint;
-
-  su2double Theta, Ib_w, Radiative_Energy;
-  su2double *Normal, Area, Wall_Emissivity;
-  su2double Radiative_Heat_Flux;
-  su2double Twall;
-
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  const bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
 
   /*--- Identify the boundary by string name ---*/
-  string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
+  const string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
 
   /*--- Get the specified wall emissivity from config ---*/
-  Wall_Emissivity = config->GetWall_Emissivity(Marker_Tag);
+  const su2double Wall_Emissivity = config->GetWall_Emissivity(Marker_Tag);
 
   /*--- Compute the constant for the wall theta ---*/
-  Theta = Wall_Emissivity / (2.0*(2.0 - Wall_Emissivity));
+  const su2double Theta = Wall_Emissivity / (2.0*(2.0 - Wall_Emissivity));
 
     /*--- Retrieve the specified wall temperature ---*/
-  Twall = config->GetIsothermal_Temperature(Marker_Tag)/config->GetTemperature_Ref();
+  const su2double Twall = config->GetIsothermal_Temperature(Marker_Tag)/config->GetTemperature_Ref();
+
+  /*--- Compute the blackbody intensity at the wall. ---*/
+  const su2double Ib_w = 4.0*STEFAN_BOLTZMANN*pow(Twall,4.0);
 
   /*--- Loop over all of the vertices on this boundary marker ---*/
 
-  for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (unsigned long iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
+    const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
 
     /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
 
     if (geometry->nodes->GetDomain(iPoint)) {
 
       /*--- Compute dual-grid area and boundary normal ---*/
-      Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
+      const auto Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
 
-      Area = GeometryToolbox::Norm(nDim, Normal);
+      const su2double Area = GeometryToolbox::Norm(nDim, Normal);
 
       // Weak application of the boundary condition
 
-      /*--- Initialize the viscous residuals to zero ---*/
-      for (iVar = 0; iVar < nVar; iVar++) {
-        Res_Visc[iVar] = 0.0;
-        if (implicit) {
-          for (jVar = 0; jVar < nVar; jVar++)
-            Jacobian_i[iVar][jVar] = 0.0;
-        }
-      }
-
       /*--- Apply a weak boundary condition for the radiative transfer equation. ---*/
 
-      /*--- Compute the blackbody intensity at the wall. ---*/
-      Ib_w = 4.0*STEFAN_BOLTZMANN*pow(Twall,4.0);
-
       /*--- Compute the radiative heat flux. ---*/
-      Radiative_Energy = nodes->GetSolution(iPoint, 0);
-      Radiative_Heat_Flux = 1.0*Theta*(Ib_w - Radiative_Energy);
+      const su2double Radiative_Energy = nodes->GetSolution(iPoint, 0);
+      const su2double Radiative_Heat_Flux = 1.0*Theta*(Ib_w - Radiative_Energy);
 
       /*--- Compute the Viscous contribution to the residual ---*/
-      Res_Visc[0] = Radiative_Heat_Flux*Area;
-
-      /*--- Apply to the residual vector ---*/
-      LinSysRes.SubtractBlock(iPoint, Res_Visc);
+      LinSysRes(iPoint, 0) -= Radiative_Heat_Flux*Area;
 
       /*--- Compute the Jacobian contribution. ---*/
-      if (implicit) {
-        Jacobian_i[0][0] = - Theta;
-        Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
-      }
+      if (implicit) Jacobian.AddVal2Diag(iPoint, Theta);
     }
   }
+  END_SU2_OMP_FOR
 
 }
 
 void CRadP1Solver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics, CNumerics *visc_numerics, CConfig *config, unsigned short val_marker) {
 
-  unsigned short iVar, jVar;
-  unsigned long iVertex, iPoint;
-
-  su2double Theta, Ib_w, Radiative_Energy;
-  su2double *Normal, Area, Wall_Emissivity;
-  su2double Radiative_Heat_Flux;
-  su2double Twall;
-
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  const bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
 
   /*--- Identify the boundary by string name ---*/
-  string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
+  const string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
 
   /*--- Get the specified wall emissivity from config ---*/
-  Wall_Emissivity = config->GetWall_Emissivity(Marker_Tag);
+  const su2double Wall_Emissivity = config->GetWall_Emissivity(Marker_Tag);
 
   /*--- Compute the constant for the wall theta ---*/
-  Theta = Wall_Emissivity / (2.0*(2.0 - Wall_Emissivity));
+  const su2double Theta = Wall_Emissivity / (2.0*(2.0 - Wall_Emissivity));
 
   /*--- Retrieve the specified wall temperature ---*/
-  Twall = GetTemperature_Inf();
+  const su2double Twall = GetTemperature_Inf();
+
+  /*--- Compute the blackbody intensity at the wall. ---*/
+  const su2double Ib_w = 4.0*STEFAN_BOLTZMANN*pow(Twall,4.0);
 
   /*--- Loop over all of the vertices on this boundary marker ---*/
 
-  for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (unsigned long iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
+    const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
 
     /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
 
     if (geometry->nodes->GetDomain(iPoint)) {
 
       /*--- Compute dual-grid area and boundary normal ---*/
-      Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
+      const auto Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
 
-      Area = GeometryToolbox::Norm(nDim, Normal);
+      const su2double Area = GeometryToolbox::Norm(nDim, Normal);
 
       // Weak application of the boundary condition
 
-      /*--- Initialize the viscous residuals to zero ---*/
-      for (iVar = 0; iVar < nVar; iVar++) {
-        Res_Visc[iVar] = 0.0;
-        if (implicit) {
-          for (jVar = 0; jVar < nVar; jVar++)
-            Jacobian_i[iVar][jVar] = 0.0;
-        }
-      }
-
       /*--- Apply a weak boundary condition for the radiative transfer equation. ---*/
 
-      /*--- Compute the blackbody intensity at the wall. ---*/
-      Ib_w = 4.0*STEFAN_BOLTZMANN*pow(Twall,4.0);
-
       /*--- Compute the radiative heat flux. ---*/
-      Radiative_Energy = nodes->GetSolution(iPoint, 0);
-      Radiative_Heat_Flux = 1.0*Theta*(Ib_w - Radiative_Energy);
+      const su2double Radiative_Energy = nodes->GetSolution(iPoint, 0);
+      const su2double Radiative_Heat_Flux = 1.0*Theta*(Ib_w - Radiative_Energy);
 
       /*--- Compute the Viscous contribution to the residual ---*/
-      Res_Visc[0] = Radiative_Heat_Flux*Area;
-
-      /*--- Apply to the residual vector ---*/
-      LinSysRes.SubtractBlock(iPoint, Res_Visc);
+      LinSysRes(iPoint, 0) -= Radiative_Heat_Flux*Area;
 
       /*--- Compute the Jacobian contribution. ---*/
-      if (implicit) {
-        Jacobian_i[0][0] = - Theta;
-        Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
-      }
+      if (implicit) Jacobian.AddVal2Diag(iPoint, Theta);
     }
   }
+  END_SU2_OMP_FOR
 
 }
 
 void CRadP1Solver::BC_Marshak(CGeometry *geometry, CSolver **solver_container, CConfig *config,
                               unsigned short val_marker) {
 
-  unsigned short iVar, jVar;
-  unsigned long iVertex, iPoint;
-
-  su2double Theta, Ib_w, Temperature, Radiative_Energy;
-  su2double *Normal, Area, Wall_Emissivity;
-  su2double Radiative_Heat_Flux;
+  const bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
 
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  const auto flowNodes = solver_container[FLOW_SOL]->GetNodes();
 
   /*--- Identify the boundary by string name ---*/
-  string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
+  const string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
 
   /*--- Get the specified wall emissivity from config ---*/
-  Wall_Emissivity = config->GetWall_Emissivity(Marker_Tag);
+  const su2double Wall_Emissivity = config->GetWall_Emissivity(Marker_Tag);
 
   /*--- Compute the constant for the wall theta ---*/
-  Theta = Wall_Emissivity / (2.0*(2.0 - Wall_Emissivity));
+  const su2double Theta = Wall_Emissivity / (2.0*(2.0 - Wall_Emissivity));
 
   /*--- Loop over all of the vertices on this boundary marker ---*/
 
-  for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (unsigned long iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
+    const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
 
     /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
 
     if (geometry->nodes->GetDomain(iPoint)) {
 
       /*--- Compute dual-grid area and boundary normal ---*/
-      Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
+      const auto Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
 
-      Area = GeometryToolbox::Norm(nDim, Normal);
+      const su2double Area = GeometryToolbox::Norm(nDim, Normal);
 
       // Weak application of the boundary condition
 
-      /*--- Initialize the viscous residuals to zero ---*/
-      for (iVar = 0; iVar < nVar; iVar++) {
-        Res_Visc[iVar] = 0.0;
-        if (implicit) {
-          for (jVar = 0; jVar < nVar; jVar++)
-            Jacobian_i[iVar][jVar] = 0.0;
-        }
-      }
-
       /*--- Apply a weak boundary condition for the radiative transfer equation. ---*/
 
       /*--- Retrieve temperature from the flow solver ---*/
-      Temperature = solver_container[FLOW_SOL]->GetNodes()->GetTemperature(iPoint);
+      const su2double Temperature = flowNodes->GetTemperature(iPoint);
 
       /*--- Compute the blackbody intensity at the wall. ---*/
-      Ib_w = 4.0*STEFAN_BOLTZMANN*pow(Temperature,4.0);
+      const su2double Ib_w = 4.0*STEFAN_BOLTZMANN*pow(Temperature,4.0);
 
       /*--- Compute the radiative heat flux. ---*/
-      Radiative_Energy = nodes->GetSolution(iPoint, 0);
-      Radiative_Heat_Flux = Theta*(Ib_w - Radiative_Energy);
+      const su2double Radiative_Energy = nodes->GetSolution(iPoint, 0);
+      const su2double Radiative_Heat_Flux = Theta*(Ib_w - Radiative_Energy);
 
       /*--- Compute the Viscous contribution to the residual ---*/
-      Res_Visc[0] = Radiative_Heat_Flux*Area;
-
-      /*--- Apply to the residual vector ---*/
-      LinSysRes.SubtractBlock(iPoint, Res_Visc);
+      LinSysRes(iPoint, 0) -= Radiative_Heat_Flux*Area;
 
       /*--- Compute the Jacobian contribution. ---*/
-      if (implicit) {
-        Jacobian_i[0][0] = - Theta;
-        Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
-      }
+      if (implicit) Jacobian.AddVal2Diag(iPoint, Theta);
 
     }
   }
+  END_SU2_OMP_FOR
 
 }
 
 
 void CRadP1Solver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
-  unsigned short iVar;
-  unsigned long iPoint, total_index, IterLinSol = 0;
-  su2double Vol;
-  su2double Delta;
-
-  /*--- Set maximum residual to zero ---*/
+  /*--- Set shared residual variables to 0 and declare
+   *    local ones for current thread to work on. ---*/
 
   SetResToZero();
 
+  su2double resMax[1] = {0.0}, resRMS[1] = {0.0};
+  unsigned long idxMax[1] = {0};
+
   /*--- Build implicit system ---*/
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+  SU2_OMP_FOR_(schedule(static, omp_chunk_size) SU2_NOWAIT)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
     /*--- Read the volume ---*/
 
-    Vol = geometry->nodes->GetVolume(iPoint);
+    const su2double Vol = geometry->nodes->GetVolume(iPoint);
 
     /*--- Modify matrix diagonal to assure diagonal dominance ---*/
 
     if (nodes->GetDelta_Time(iPoint) != 0.0) {
-      Delta = Vol / nodes->GetDelta_Time(iPoint);
+      const su2double Delta = Vol / nodes->GetDelta_Time(iPoint);
       Jacobian.AddVal2Diag(iPoint, Delta);
     }
     else {
       Jacobian.SetVal2Diag(iPoint, 1.0);
-      for (iVar = 0; iVar < nVar; iVar++) {
-        total_index = iPoint*nVar + iVar;
-        LinSysRes[total_index] = 0.0;
-      }
+      LinSysRes.SetBlock_Zero(iPoint);
     }
 
     /*--- Right hand side of the system (-Residual) and initial guess (x = 0) ---*/
 
-    for (iVar = 0; iVar < nVar; iVar++) {
-      total_index = iPoint*nVar+iVar;
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      const unsigned long total_index = iPoint*nVar+iVar;
       LinSysRes[total_index] = - (LinSysRes[total_index]);
       LinSysSol[total_index] = 0.0;
-      Residual_RMS[iVar] += LinSysRes[total_index]*LinSysRes[total_index];
-      AddRes_Max(iVar, fabs(LinSysRes[total_index]), geometry->nodes->GetGlobalIndex(iPoint), geometry->nodes->GetCoord(iPoint));
+
+      /*--- "Add" residual at (iPoint,iVar) to local residual variables. ---*/
+      ResidualReductions_PerThread(iPoint, iVar, LinSysRes[total_index], resRMS, resMax, idxMax);
     }
   }
+  END_SU2_OMP_FOR
 
   /*--- Initialize residual and solution at the ghost points ---*/
 
-  for (iPoint = nPointDomain; iPoint < nPoint; iPoint++) {
-    for (iVar = 0; iVar < nVar; iVar++) {
-      total_index = iPoint*nVar + iVar;
-      LinSysRes[total_index] = 0.0;
-      LinSysSol[total_index] = 0.0;
-    }
+  SU2_OMP_FOR_(schedule(static, OMP_MIN_SIZE) SU2_NOWAIT)
+  for (unsigned long iPoint = nPointDomain; iPoint < nPoint; iPoint++) {
+    LinSysRes.SetBlock_Zero(iPoint);
+    LinSysSol.SetBlock_Zero(iPoint);
   }
+  END_SU2_OMP_FOR
+
+  /*--- "Add" residuals from all threads to global residual variables,
+   *    this also computes the root mean square residual. ---*/
+
+  ResidualReductions_FromAllThreads(geometry, config, resRMS, resMax, idxMax);
 
   /*--- Solve or smooth the linear system ---*/
 
-  IterLinSol = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  const auto IterLinSol = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    for (iVar = 0; iVar < nVar; iVar++) {
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
       nodes->AddSolution(iPoint, iVar, LinSysSol[iPoint*nVar+iVar]);
     }
   }
+  END_SU2_OMP_FOR
 
   /*--- The the number of iterations of the linear solver ---*/
 
-  SetIterLinSolver(IterLinSol);
+  SU2_OMP_SAFE_GLOBAL_ACCESS(SetIterLinSolver(IterLinSol);)
 
   /*--- MPI solution ---*/
 
   InitiateComms(geometry, config, MPI_QUANTITIES::SOLUTION);
   CompleteComms(geometry, config, MPI_QUANTITIES::SOLUTION);
 
-  /*--- Compute the root mean square residual ---*/
-
-  SetResidual_RMS(geometry, config);
-
 }
 
 void CRadP1Solver::SetTime_Step(CGeometry *geometry, CSolver **solver_container, CConfig *config,
                                unsigned short iMesh, unsigned long Iteration) {
 
-  unsigned short iMarker;
-  unsigned long iEdge, iVertex, iPoint = 0, jPoint = 0;
-  su2double Area, Vol, Lambda;
-  su2double Global_Delta_Time = 1E6, Local_Delta_Time = 0.0, K_v = 0.25;
-  su2double CFL = config->GetCFL_Rad();
-  su2double GammaP1 = 1.0 / (3.0*(Absorption_Coeff + Scattering_Coeff));
-  const su2double* Normal;
+  const su2double K_v = 0.25;
+  const su2double CFL = config->GetCFL_Rad();
+  const su2double GammaP1 = 1.0 / (3.0*(Absorption_Coeff + Scattering_Coeff));
 
-  /*--- Compute spectral radius based on thermal conductivity ---*/
+  /*--- Init thread-shared variables to compute min/max values. ---*/
 
-  Min_Delta_Time = 1.E6; Max_Delta_Time = 0.0;
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    Min_Delta_Time = 1.E6; Max_Delta_Time = 0.0;
+  } END_SU2_OMP_SAFE_GLOBAL_ACCESS
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    nodes->SetMax_Lambda_Visc(iPoint, 0.0);
-  }
-
-  /*--- Loop interior edges ---*/
+  /*--- Compute spectral radius based on thermal conductivity, looping over the
+   *    edges of each point instead of over edges to avoid race conditions. ---*/
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  SU2_OMP_FOR_DYN(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
-    iPoint = geometry->edges->GetNode(iEdge,0);
-    jPoint = geometry->edges->GetNode(iEdge,1);
+    nodes->SetMax_Lambda_Visc(iPoint, 0.0);
 
-    /*--- Get the edge's normal vector to compute the edge's area ---*/
-    Normal = geometry->edges->GetNormal(iEdge);
-    Area = GeometryToolbox::Norm(nDim, Normal);
+    for (auto iEdge : geometry->nodes->GetEdges(iPoint)) {
 
-    /*--- Viscous contribution ---*/
+      /*--- Get the edge's normal vector to compute the edge's area ---*/
+      const auto Normal = geometry->edges->GetNormal(iEdge);
+      const su2double Area = GeometryToolbox::Norm(nDim, Normal);
 
-    Lambda = GammaP1*Area*Area;
-    if (geometry->nodes->GetDomain(iPoint)) nodes->AddMax_Lambda_Visc(iPoint, Lambda);
-    if (geometry->nodes->GetDomain(jPoint)) nodes->AddMax_Lambda_Visc(jPoint, Lambda);
+      /*--- Viscous contribution ---*/
 
+      nodes->AddMax_Lambda_Visc(iPoint, GammaP1*Area*Area);
+    }
   }
+  END_SU2_OMP_FOR
 
   /*--- Loop boundary edges ---*/
 
-  for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
-    for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+  for (unsigned short iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
+
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for (unsigned long iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
 
       /*--- Point identification, Normal vector and area ---*/
 
-      iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-      Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
-      Area = GeometryToolbox::Norm(nDim, Normal);
+      const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      const auto Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+      const su2double Area = GeometryToolbox::Norm(nDim, Normal);
 
       /*--- Viscous contribution ---*/
 
-      Lambda = GammaP1*Area*Area;
-      if (geometry->nodes->GetDomain(iPoint)) nodes->AddMax_Lambda_Visc(iPoint, Lambda);
+      if (geometry->nodes->GetDomain(iPoint)) nodes->AddMax_Lambda_Visc(iPoint, GammaP1*Area*Area);
 
     }
+    END_SU2_OMP_FOR
   }
 
   /*--- Each element uses their own speed, steady state simulation ---*/
+  {
+    /*--- Thread-local variables for min/max reduction. ---*/
+    su2double minDt = 1.E6, maxDt = 0.0;
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    SU2_OMP_FOR_(schedule(static,omp_chunk_size) SU2_NOWAIT)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
-    Vol = geometry->nodes->GetVolume(iPoint);
+      const su2double Vol = geometry->nodes->GetVolume(iPoint);
 
-    if (Vol != 0.0) {
+      if (Vol != 0.0) {
 
-      /*--- Time step setting method ---*/
+        /*--- Time step setting method ---*/
 
-       Local_Delta_Time = CFL*K_v*Vol*Vol/ nodes->GetMax_Lambda_Visc(iPoint);
+        su2double Local_Delta_Time = CFL*K_v*Vol*Vol/ nodes->GetMax_Lambda_Visc(iPoint);
 
-      /*--- Min-Max-Logic ---*/
+        /*--- Min-Max-Logic ---*/
 
-      Global_Delta_Time = min(Global_Delta_Time, Local_Delta_Time);
-      Min_Delta_Time = min(Min_Delta_Time, Local_Delta_Time);
-      Max_Delta_Time = max(Max_Delta_Time, Local_Delta_Time);
-      if (Local_Delta_Time > config->GetMax_DeltaTime())
-        Local_Delta_Time = config->GetMax_DeltaTime();
+        minDt = min(minDt, Local_Delta_Time);
+        maxDt = max(maxDt, Local_Delta_Time);
+        if (Local_Delta_Time > config->GetMax_DeltaTime())
+          Local_Delta_Time = config->GetMax_DeltaTime();
 
-      nodes->SetDelta_Time(iPoint, Local_Delta_Time);
+        nodes->SetDelta_Time(iPoint, Local_Delta_Time);
+      }
+      else {
+        nodes->SetDelta_Time(iPoint, 0.0);
+      }
     }
-    else {
-      nodes->SetDelta_Time(iPoint, 0.0);
+    END_SU2_OMP_FOR
+    /*--- Min/max over threads. ---*/
+    SU2_OMP_CRITICAL
+    {
+      Min_Delta_Time = min(Min_Delta_Time, minDt);
+      Max_Delta_Time = max(Max_Delta_Time, maxDt);
     }
+    END_SU2_OMP_CRITICAL
   }
 
   /*--- Compute the max and the min dt (in parallel) ---*/
-  if (config->GetComm_Level() == COMM_FULL) {
 
-    su2double sbuf_time;
-    sbuf_time = Min_Delta_Time;
-    SU2_MPI::Allreduce(&sbuf_time, &Min_Delta_Time, 1, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    if (config->GetComm_Level() == COMM_FULL) {
 
-    sbuf_time = Max_Delta_Time;
-    SU2_MPI::Allreduce(&sbuf_time, &Max_Delta_Time, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
-  }
+      su2double sbuf_time;
+      sbuf_time = Min_Delta_Time;
+      SU2_MPI::Allreduce(&sbuf_time, &Min_Delta_Time, 1, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
+
+      sbuf_time = Max_Delta_Time;
+      SU2_MPI::Allreduce(&sbuf_time, &Max_Delta_Time, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+    }
+  } END_SU2_OMP_SAFE_GLOBAL_ACCESS
 
 }
@@ -75,6 +75,8 @@ void CRadSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *c
 
   /*--- Restart the solution from file information ---*/
 
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+
   unsigned short iVar;
   unsigned long index;
 
@@ -150,6 +152,9 @@ void CRadSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *c
                    string("It could be empty lines at the end of the file."), CURRENT_FUNCTION);
   }
 
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
   /*--- MPI communication ---*/
   solver[MESH_0][RAD_SOL]->InitiateComms(geometry[MESH_0], config, MPI_QUANTITIES::SOLUTION);
   solver[MESH_0][RAD_SOL]->CompleteComms(geometry[MESH_0], config, MPI_QUANTITIES::SOLUTION);
@@ -162,6 +167,9 @@ void CRadSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *c
 
   /*--- Delete the class memory that is used to load the restart. ---*/
 
-  Restart_Vars = decltype(Restart_Vars){};
-  Restart_Data = decltype(Restart_Data){};
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    Restart_Vars = decltype(Restart_Vars){};
+    Restart_Data = decltype(Restart_Data){};
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
 }
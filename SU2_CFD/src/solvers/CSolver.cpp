@@ -1401,11 +1401,30 @@ namespace CommHelpers {
     if (commType == MPI_QUANTITIES::PRIMITIVE_LIMITER) return nodes->GetLimiter_Primitive();
     return nodes->GetLimiter();
   }
+
+  /*--- Count per point of each quantity packed in one message, and their sum. ---*/
+  vector<unsigned short> countPerQuantity(const CSolver* solver, const CConfig* config,
+                                          std::initializer_list<MPI_QUANTITIES> commTypes,
+                                          unsigned short& totalCount, unsigned short& mpiType) {
+    vector<unsigned short> counts;
+    counts.reserve(commTypes.size());
+    totalCount = 0;
+    for (auto commType : commTypes) {
+      unsigned short count = 0, type = 0;
+      solver->GetCommCountAndType(config, commType, count, type);
+      if (!counts.empty() && type != mpiType)
+        SU2_MPI::Error("Quantities packed in one message must have the same data type.", CURRENT_FUNCTION);
+      counts.push_back(count);
+      totalCount += count;
+      mpiType = type;
+    }
+    return counts;
+  }
 }
 
 void CSolver::InitiateComms(CGeometry *geometry,
                             const CConfig *config,
-                            MPI_QUANTITIES commType) {
+                            std::initializer_list<MPI_QUANTITIES> commTypes) {
 
   /*--- Local variables ---*/
 
@@ -1417,9 +1436,10 @@ void CSolver::InitiateComms(CGeometry *geometry,
 
   int iMessage, iSend, nSend;
 
-  /*--- Set the size of the data packet and type depending on quantity. ---*/
+  /*--- Set the size of the data packet and type depending on quantities,
+   these are stored one after the other for each point. ---*/
 
-  GetCommCountAndType(config, commType, COUNT_PER_POINT, MPI_TYPE);
+  const auto counts = CommHelpers::countPerQuantity(this, config, commTypes, COUNT_PER_POINT, MPI_TYPE);
 
   /*--- Check to make sure we have created a large enough buffer
    for these comms during preprocessing. This is only for the su2double
@@ -1432,12 +1452,6 @@ void CSolver::InitiateComms(CGeometry *geometry,
 
   su2double *bufDSend = geometry->bufD_P2PSend;
 
-  /*--- Handle the different types of gradient and limiter. ---*/
-
-  const auto nVarGrad = COUNT_PER_POINT / nDim;
-  auto& gradient = CommHelpers::selectGradient(base_nodes, commType);
-  auto& limiter = CommHelpers::selectLimiter(base_nodes, commType);
-
   /*--- Load the specified quantity from the solver into the generic
    communication buffer in the geometry class. ---*/
 
@@ -1469,69 +1483,80 @@ void CSolver::InitiateComms(CGeometry *geometry,
 
         buf_offset = (msg_offset + iSend)*COUNT_PER_POINT;
 
-        switch (commType) {
-          case MPI_QUANTITIES::SOLUTION:
-            for (iVar = 0; iVar < nVar; iVar++)
-              bufDSend[buf_offset+iVar] = base_nodes->GetSolution(iPoint, iVar);
-            break;
-          case MPI_QUANTITIES::SOLUTION_OLD:
-            for (iVar = 0; iVar < nVar; iVar++)
-              bufDSend[buf_offset+iVar] = base_nodes->GetSolution_Old(iPoint, iVar);
-            break;
-          case MPI_QUANTITIES::SOLUTION_EDDY:
-            for (iVar = 0; iVar < nVar; iVar++)
-              bufDSend[buf_offset+iVar] = base_nodes->GetSolution(iPoint, iVar);
-            bufDSend[buf_offset+nVar]   = base_nodes->GetmuT(iPoint);
-            break;
-          case MPI_QUANTITIES::UNDIVIDED_LAPLACIAN:
-            for (iVar = 0; iVar < nVar; iVar++)
-              bufDSend[buf_offset+iVar] = base_nodes->GetUndivided_Laplacian(iPoint, iVar);
-            break;
-          case MPI_QUANTITIES::SOLUTION_LIMITER:
-          case MPI_QUANTITIES::PRIMITIVE_LIMITER:
-            for (iVar = 0; iVar < COUNT_PER_POINT; iVar++)
-              bufDSend[buf_offset+iVar] = limiter(iPoint, iVar);
-            break;
-          case MPI_QUANTITIES::MAX_EIGENVALUE:
-            bufDSend[buf_offset] = base_nodes->GetLambda(iPoint);
-            break;
-          case MPI_QUANTITIES::SENSOR:
-            bufDSend[buf_offset] = base_nodes->GetSensor(iPoint);
-            break;
-          case MPI_QUANTITIES::SOLUTION_GRADIENT:
-          case MPI_QUANTITIES::PRIMITIVE_GRADIENT:
-          case MPI_QUANTITIES::SOLUTION_GRAD_REC:
-          case MPI_QUANTITIES::PRIMITIVE_GRAD_REC:
-          case MPI_QUANTITIES::AUXVAR_GRADIENT:
-            for (iVar = 0; iVar < nVarGrad; iVar++)
-              for (iDim = 0; iDim < nDim; iDim++)
-                bufDSend[buf_offset+iVar*nDim+iDim] = gradient(iPoint, iVar, iDim);
-            break;
-          case MPI_QUANTITIES::SOLUTION_FEA:
-            for (iVar = 0; iVar < nVar; iVar++) {
-              bufDSend[buf_offset+iVar] = base_nodes->GetSolution(iPoint, iVar);
-              if (config->GetTime_Domain()) {
-                bufDSend[buf_offset+nVar+iVar]   = base_nodes->GetSolution_Vel(iPoint, iVar);
-                bufDSend[buf_offset+nVar*2+iVar] = base_nodes->GetSolution_Accel(iPoint, iVar);
+        for (auto iComm = 0ul; iComm < commTypes.size(); buf_offset += counts[iComm++]) {
+
+          const auto commType = commTypes.begin()[iComm];
+
+          /*--- Handle the different types of gradient and limiter. ---*/
+
+          const auto nVarGrad = counts[iComm] / nDim;
+          const auto& gradient = CommHelpers::selectGradient(base_nodes, commType);
+          const auto& limiter = CommHelpers::selectLimiter(base_nodes, commType);
+
+          switch (commType) {
+            case MPI_QUANTITIES::SOLUTION:
+              for (iVar = 0; iVar < nVar; iVar++)
+                bufDSend[buf_offset+iVar] = base_nodes->GetSolution(iPoint, iVar);
+              break;
+            case MPI_QUANTITIES::SOLUTION_OLD:
+              for (iVar = 0; iVar < nVar; iVar++)
+                bufDSend[buf_offset+iVar] = base_nodes->GetSolution_Old(iPoint, iVar);
+              break;
+            case MPI_QUANTITIES::SOLUTION_EDDY:
+              for (iVar = 0; iVar < nVar; iVar++)
+                bufDSend[buf_offset+iVar] = base_nodes->GetSolution(iPoint, iVar);
+              bufDSend[buf_offset+nVar]   = base_nodes->GetmuT(iPoint);
+              break;
+            case MPI_QUANTITIES::UNDIVIDED_LAPLACIAN:
+              for (iVar = 0; iVar < nVar; iVar++)
+                bufDSend[buf_offset+iVar] = base_nodes->GetUndivided_Laplacian(iPoint, iVar);
+              break;
+            case MPI_QUANTITIES::SOLUTION_LIMITER:
+            case MPI_QUANTITIES::PRIMITIVE_LIMITER:
+              for (iVar = 0; iVar < counts[iComm]; iVar++)
+                bufDSend[buf_offset+iVar] = limiter(iPoint, iVar);
+              break;
+            case MPI_QUANTITIES::MAX_EIGENVALUE:
+              bufDSend[buf_offset] = base_nodes->GetLambda(iPoint);
+              break;
+            case MPI_QUANTITIES::SENSOR:
+              bufDSend[buf_offset] = base_nodes->GetSensor(iPoint);
+              break;
+            case MPI_QUANTITIES::SOLUTION_GRADIENT:
+            case MPI_QUANTITIES::PRIMITIVE_GRADIENT:
+            case MPI_QUANTITIES::SOLUTION_GRAD_REC:
+            case MPI_QUANTITIES::PRIMITIVE_GRAD_REC:
+            case MPI_QUANTITIES::AUXVAR_GRADIENT:
+              for (iVar = 0; iVar < nVarGrad; iVar++)
+                for (iDim = 0; iDim < nDim; iDim++)
+                  bufDSend[buf_offset+iVar*nDim+iDim] = gradient(iPoint, iVar, iDim);
+              break;
+            case MPI_QUANTITIES::SOLUTION_FEA:
+              for (iVar = 0; iVar < nVar; iVar++) {
+                bufDSend[buf_offset+iVar] = base_nodes->GetSolution(iPoint, iVar);
+                if (config->GetTime_Domain()) {
+                  bufDSend[buf_offset+nVar+iVar]   = base_nodes->GetSolution_Vel(iPoint, iVar);
+                  bufDSend[buf_offset+nVar*2+iVar] = base_nodes->GetSolution_Accel(iPoint, iVar);
+                }
               }
-            }
-            break;
-          case MPI_QUANTITIES::MESH_DISPLACEMENTS:
-            for (iDim = 0; iDim < nDim; iDim++)
-              bufDSend[buf_offset+iDim] = base_nodes->GetBound_Disp(iPoint, iDim);
-            break;
-          case MPI_QUANTITIES::SOLUTION_TIME_N:
-            for (iVar = 0; iVar < nVar; iVar++)
-              bufDSend[buf_offset+iVar] = base_nodes->GetSolution_time_n(iPoint, iVar);
-            break;
-          case MPI_QUANTITIES::SOLUTION_TIME_N1:
-            for (iVar = 0; iVar < nVar; iVar++)
-              bufDSend[buf_offset+iVar] = base_nodes->GetSolution_time_n1(iPoint, iVar);
-            break;
-          default:
-            SU2_MPI::Error("Unrecognized quantity for point-to-point MPI comms.",
-                           CURRENT_FUNCTION);
-            break;
+              break;
+            case MPI_QUANTITIES::MESH_DISPLACEMENTS:
+              for (iDim = 0; iDim < nDim; iDim++)
+                bufDSend[buf_offset+iDim] = base_nodes->GetBound_Disp(iPoint, iDim);
+              break;
+            case MPI_QUANTITIES::SOLUTION_TIME_N:
+              for (iVar = 0; iVar < nVar; iVar++)
+                bufDSend[buf_offset+iVar] = base_nodes->GetSolution_time_n(iPoint, iVar);
+              break;
+            case MPI_QUANTITIES::SOLUTION_TIME_N1:
+              for (iVar = 0; iVar < nVar; iVar++)
+                bufDSend[buf_offset+iVar] = base_nodes->GetSolution_time_n1(iPoint, iVar);
+              break;
+            default:
+              SU2_MPI::Error("Unrecognized quantity for point-to-point MPI comms.",
+                             CURRENT_FUNCTION);
+              break;
+          }
         }
       }
       END_SU2_OMP_FOR
@@ -1547,7 +1572,7 @@ void CSolver::InitiateComms(CGeometry *geometry,
 
 void CSolver::CompleteComms(CGeometry *geometry,
                             const CConfig *config,
-                            MPI_QUANTITIES commType) {
+                            std::initializer_list<MPI_QUANTITIES> commTypes) {
 
   /*--- Local variables ---*/
 
@@ -1561,20 +1586,14 @@ void CSolver::CompleteComms(CGeometry *geometry,
   /*--- Global status so all threads can see the result of Waitany. ---*/
   static SU2_MPI::Status status;
 
-  /*--- Set the size of the data packet and type depending on quantity. ---*/
+  /*--- Set the size of the data packet and type depending on quantities. ---*/
 
-  GetCommCountAndType(config, commType, COUNT_PER_POINT, MPI_TYPE);
+  const auto counts = CommHelpers::countPerQuantity(this, config, commTypes, COUNT_PER_POINT, MPI_TYPE);
 
   /*--- Set some local pointers to make access simpler. ---*/
 
   const su2double *bufDRecv = geometry->bufD_P2PRecv;
 
-  /*--- Handle the different types of gradient and limiter. ---*/
-
-  const auto nVarGrad = COUNT_PER_POINT / nDim;
-  auto& gradient = CommHelpers::selectGradient(base_nodes, commType);
-  auto& limiter = CommHelpers::selectLimiter(base_nodes, commType);
-
   /*--- Store the data that was communicated into the appropriate
    location within the local class data structures. ---*/
 
@@ -1615,71 +1634,82 @@ void CSolver::CompleteComms(CGeometry *geometry,
 
         buf_offset = (msg_offset + iRecv)*COUNT_PER_POINT;
 
-        /*--- Store the data correctly depending on the quantity. ---*/
+        for (auto iComm = 0ul; iComm < commTypes.size(); buf_offset += counts[iComm++]) {
 
-        switch (commType) {
-          case MPI_QUANTITIES::SOLUTION:
-            for (iVar = 0; iVar < nVar; iVar++)
-              base_nodes->SetSolution(iPoint, iVar, bufDRecv[buf_offset+iVar]);
-            break;
-          case MPI_QUANTITIES::SOLUTION_OLD:
-            for (iVar = 0; iVar < nVar; iVar++)
-              base_nodes->SetSolution_Old(iPoint, iVar, bufDRecv[buf_offset+iVar]);
-            break;
-          case MPI_QUANTITIES::SOLUTION_EDDY:
-            for (iVar = 0; iVar < nVar; iVar++)
-              base_nodes->SetSolution(iPoint, iVar, bufDRecv[buf_offset+iVar]);
-            base_nodes->SetmuT(iPoint,bufDRecv[buf_offset+nVar]);
-            break;
-          case MPI_QUANTITIES::UNDIVIDED_LAPLACIAN:
-            for (iVar = 0; iVar < nVar; iVar++)
-              base_nodes->SetUnd_Lapl(iPoint, iVar, bufDRecv[buf_offset+iVar]);
-            break;
-          case MPI_QUANTITIES::SOLUTION_LIMITER:
-          case MPI_QUANTITIES::PRIMITIVE_LIMITER:
-            for (iVar = 0; iVar < COUNT_PER_POINT; iVar++)
-              limiter(iPoint,iVar) = bufDRecv[buf_offset+iVar];
-            break;
-          case MPI_QUANTITIES::MAX_EIGENVALUE:
-            base_nodes->SetLambda(iPoint,bufDRecv[buf_offset]);
-            break;
-          case MPI_QUANTITIES::SENSOR:
-            base_nodes->SetSensor(iPoint,bufDRecv[buf_offset]);
-            break;
-          case MPI_QUANTITIES::SOLUTION_GRADIENT:
-          case MPI_QUANTITIES::PRIMITIVE_GRADIENT:
-          case MPI_QUANTITIES::SOLUTION_GRAD_REC:
-          case MPI_QUANTITIES::PRIMITIVE_GRAD_REC:
-          case MPI_QUANTITIES::AUXVAR_GRADIENT:
-            for (iVar = 0; iVar < nVarGrad; iVar++)
-              for (iDim = 0; iDim < nDim; iDim++)
-                gradient(iPoint,iVar,iDim) = bufDRecv[buf_offset+iVar*nDim+iDim];
-            break;
-          case MPI_QUANTITIES::SOLUTION_FEA:
-            for (iVar = 0; iVar < nVar; iVar++) {
-              base_nodes->SetSolution(iPoint, iVar, bufDRecv[buf_offset+iVar]);
-              if (config->GetTime_Domain()) {
-                base_nodes->SetSolution_Vel(iPoint, iVar, bufDRecv[buf_offset+nVar+iVar]);
-                base_nodes->SetSolution_Accel(iPoint, iVar, bufDRecv[buf_offset+nVar*2+iVar]);
+          const auto commType = commTypes.begin()[iComm];
+
+          /*--- Handle the different types of gradient and limiter. ---*/
+
+          const auto nVarGrad = counts[iComm] / nDim;
+          auto& gradient = CommHelpers::selectGradient(base_nodes, commType);
+          auto& limiter = CommHelpers::selectLimiter(base_nodes, commType);
+
+          /*--- Store the data correctly depending on the quantity. ---*/
+
+          switch (commType) {
+            case MPI_QUANTITIES::SOLUTION:
+              for (iVar = 0; iVar < nVar; iVar++)
+                base_nodes->SetSolution(iPoint, iVar, bufDRecv[buf_offset+iVar]);
+              break;
+            case MPI_QUANTITIES::SOLUTION_OLD:
+              for (iVar = 0; iVar < nVar; iVar++)
+                base_nodes->SetSolution_Old(iPoint, iVar, bufDRecv[buf_offset+iVar]);
+              break;
+            case MPI_QUANTITIES::SOLUTION_EDDY:
+              for (iVar = 0; iVar < nVar; iVar++)
+                base_nodes->SetSolution(iPoint, iVar, bufDRecv[buf_offset+iVar]);
+              base_nodes->SetmuT(iPoint,bufDRecv[buf_offset+nVar]);
+              break;
+            case MPI_QUANTITIES::UNDIVIDED_LAPLACIAN:
+              for (iVar = 0; iVar < nVar; iVar++)
+                base_nodes->SetUnd_Lapl(iPoint, iVar, bufDRecv[buf_offset+iVar]);
+              break;
+            case MPI_QUANTITIES::SOLUTION_LIMITER:
+            case MPI_QUANTITIES::PRIMITIVE_LIMITER:
+              for (iVar = 0; iVar < counts[iComm]; iVar++)
+                limiter(iPoint,iVar) = bufDRecv[buf_offset+iVar];
+              break;
+            case MPI_QUANTITIES::MAX_EIGENVALUE:
+              base_nodes->SetLambda(iPoint,bufDRecv[buf_offset]);
+              break;
+            case MPI_QUANTITIES::SENSOR:
+              base_nodes->SetSensor(iPoint,bufDRecv[buf_offset]);
+              break;
+            case MPI_QUANTITIES::SOLUTION_GRADIENT:
+            case MPI_QUANTITIES::PRIMITIVE_GRADIENT:
+            case MPI_QUANTITIES::SOLUTION_GRAD_REC:
+            case MPI_QUANTITIES::PRIMITIVE_GRAD_REC:
+            case MPI_QUANTITIES::AUXVAR_GRADIENT:
+              for (iVar = 0; iVar < nVarGrad; iVar++)
+                for (iDim = 0; iDim < nDim; iDim++)
+                  gradient(iPoint,iVar,iDim) = bufDRecv[buf_offset+iVar*nDim+iDim];
+              break;
+            case MPI_QUANTITIES::SOLUTION_FEA:
+              for (iVar = 0; iVar < nVar; iVar++) {
+                base_nodes->SetSolution(iPoint, iVar, bufDRecv[buf_offset+iVar]);
+                if (config->GetTime_Domain()) {
+                  base_nodes->SetSolution_Vel(iPoint, iVar, bufDRecv[buf_offset+nVar+iVar]);
+                  base_nodes->SetSolution_Accel(iPoint, iVar, bufDRecv[buf_offset+nVar*2+iVar]);
+                }
               }
-            }
-            break;
-          case MPI_QUANTITIES::MESH_DISPLACEMENTS:
-            for (iDim = 0; iDim < nDim; iDim++)
-              base_nodes->SetBound_Disp(iPoint, iDim, bufDRecv[buf_offset+iDim]);
-            break;
-          case MPI_QUANTITIES::SOLUTION_TIME_N:
-            for (iVar = 0; iVar < nVar; iVar++)
-              base_nodes->Set_Solution_time_n(iPoint, iVar, bufDRecv[buf_offset+iVar]);
-            break;
-          case MPI_QUANTITIES::SOLUTION_TIME_N1:
-            for (iVar = 0; iVar < nVar; iVar++)
-              base_nodes->Set_Solution_time_n1(iPoint, iVar, bufDRecv[buf_offset+iVar]);
-            break;
-          default:
-            SU2_MPI::Error("Unrecognized quantity for point-to-point MPI comms.",
-                           CURRENT_FUNCTION);
-            break;
+              break;
+            case MPI_QUANTITIES::MESH_DISPLACEMENTS:
+              for (iDim = 0; iDim < nDim; iDim++)
+                base_nodes->SetBound_Disp(iPoint, iDim, bufDRecv[buf_offset+iDim]);
+              break;
+            case MPI_QUANTITIES::SOLUTION_TIME_N:
+              for (iVar = 0; iVar < nVar; iVar++)
+                base_nodes->Set_Solution_time_n(iPoint, iVar, bufDRecv[buf_offset+iVar]);
+              break;
+            case MPI_QUANTITIES::SOLUTION_TIME_N1:
+              for (iVar = 0; iVar < nVar; iVar++)
+                base_nodes->Set_Solution_time_n1(iPoint, iVar, bufDRecv[buf_offset+iVar]);
+              break;
+            default:
+              SU2_MPI::Error("Unrecognized quantity for point-to-point MPI comms.",
+                             CURRENT_FUNCTION);
+              break;
+          }
         }
       }
       END_SU2_OMP_FOR
@@ -1696,6 +1726,16 @@ void CSolver::CompleteComms(CGeometry *geometry,
 
 }
 
+void CSolver::InitiateOverlappedComms(CGeometry *geometry,
+                                      const CConfig *config,
+                                      MPI_QUANTITIES commType) {
+
+  InitiateComms(geometry, config, commType);
+
+  geometry->SetPendingComms([=]() { CompleteComms(geometry, config, commType); });
+
+}
+
 void CSolver::ResetCFLAdapt() {
   NonLinRes_Series.clear();
   Old_Func = 0;
@@ -2249,17 +2289,19 @@ void CSolver::Update_Cross_Term(CConfig *config, su2passivematrix &cross_term) {
 
 void CSolver::SetGridVel_Gradient(CGeometry *geometry, const CConfig *config) const {
 
-  /// TODO: No comms needed for this gradient? The Rmatrix should be allocated somewhere.
+  /// TODO: No comms needed for this gradient?
 
   const auto& gridVel = geometry->nodes->GetGridVel();
   auto& gridVelGrad = geometry->nodes->GetGridVel_Grad();
-  auto rmatrix = CVectorOfMatrix(nPoint,nDim,nDim);
+
+  /*--- Without periodic comms the R matrix is not used, the geometric coefficients are cached. ---*/
+  CVectorOfMatrix rmatrix;
 
   computeGradientsLeastSquares(nullptr, MPI_QUANTITIES::GRID_VELOCITY, PERIODIC_NONE, *geometry, *config,
                                true, gridVel, 0, nDim, 0, gridVelGrad, rmatrix);
 }
 
-void CSolver::SetSolution_Limiter(CGeometry *geometry, const CConfig *config) {
+void CSolver::SetSolution_Limiter(CGeometry *geometry, const CConfig *config, bool overlapComms) {
 
   const auto kindLimiter = config->GetKind_SlopeLimit();
   const auto& solution = base_nodes->GetSolution();
@@ -2269,7 +2311,7 @@ void CSolver::SetSolution_Limiter(CGeometry *geometry, const CConfig *config) {
   auto& limiter = base_nodes->GetLimiter();
 
   computeLimiters(kindLimiter, this, MPI_QUANTITIES::SOLUTION_LIMITER, PERIODIC_LIM_SOL_1, PERIODIC_LIM_SOL_2,
-                  *geometry, *config, 0, nVar, solution, gradient, solMin, solMax, limiter);
+                  *geometry, *config, 0, nVar, solution, gradient, solMin, solMax, limiter, overlapComms);
 }
 
 void CSolver::Gauss_Elimination(su2double** A, su2double* rhs, unsigned short nVar) {
@@ -33,6 +33,7 @@
 #include "../../include/solvers/CSpeciesSolver.hpp"
 #include "../../include/variables/CFlowVariable.hpp"
 #include "../../include/variables/CSpeciesFlameletVariable.hpp"
+#include "../../include/numerics_simd/CNumericsSIMD.hpp"
 
 CSpeciesFlameletSolver::CSpeciesFlameletSolver(CGeometry* geometry, CConfig* config, unsigned short iMesh)
     : CSpeciesSolver(geometry, config, true) {
@@ -573,6 +574,13 @@ unsigned long CSpeciesFlameletSolver::SetPreferentialDiffusionScalars(CFluidMode
   return misses;
 }
 
+void CSpeciesFlameletSolver::InstantiateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) {
+  /*--- Preferential diffusion is only implemented by the scalar numerics. ---*/
+  if (flamelet_config_options.preferential_diffusion) return;
+
+  CSpeciesSolver::InstantiateEdgeNumerics(solvers, config);
+}
+
 void CSpeciesFlameletSolver::Viscous_Residual(const unsigned long iEdge, const CGeometry* geometry, CSolver** solver_container,
                                               CNumerics* numerics, const CConfig* config) {
   /*--- Overloaded viscous residual method which accounts for preferential diffusion.  ---*/
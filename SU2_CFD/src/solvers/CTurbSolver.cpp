@@ -204,6 +204,13 @@ void CTurbSolver::LoadRestart(CGeometry** geometry, CSolver*** solver, CConfig*
   END_SU2_OMP_SAFE_GLOBAL_ACCESS
 }
 
+void CTurbSolver::InstantiateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) {
+  /*--- The SA and SST diffusion are not conservative, which the reducer strategy cannot handle. ---*/
+  if (ReducerStrategy) return;
+
+  edgeNumerics = CNumericsSIMD::CreateScalarNumerics(*config, nDim, TURB_SOL, solvers);
+}
+
 void CTurbSolver::Impose_Fixed_Values(const CGeometry *geometry, const CConfig *config){
   const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
 
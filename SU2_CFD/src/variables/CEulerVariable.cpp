@@ -141,6 +141,78 @@ bool CEulerVariable::SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel) {
   return RightVol;
 }
 
+unsigned long CEulerVariable::SetThermodynamicStateBatch(unsigned long iPoint, const su2double* turb_ke,
+                                                         CFluidModel *FluidModel, CFluidStateBatch& batch) {
+
+  auto staticEnergy = [&](unsigned long k) {
+    const auto jPoint = iPoint + k;
+    SetVelocity(jPoint);   // Computes velocity and velocity^2
+    return GetEnergy(jPoint) - 0.5*Velocity2(jPoint) - (turb_ke ? turb_ke[k] : 0.0);
+  };
+
+  for (unsigned long k = 0; k < batch.size; k++) {
+    batch.StaticEnergy[k] = staticEnergy(k);
+    batch.Density[k] = GetDensity(iPoint + k);
+  }
+
+  FluidModel->SetTDStateBatch_rhoe(batch);
+
+  unsigned long nonPhysicalPoints = 0;
+
+  for (unsigned long k = 0; k < batch.size; k++) {
+    const auto jPoint = iPoint + k;
+
+    bool check_dens  = SetDensity(jPoint);
+    bool check_press = SetPressure(jPoint, batch.Pressure[k]);
+    bool check_sos   = SetSoundSpeed(jPoint, batch.SoundSpeed2[k]);
+    bool check_temp  = SetTemperature(jPoint, batch.Temperature[k]);
+
+    /*--- Non-physical points are reset to the old solution and evaluated individually,
+     *    the batch is updated since it is also used for the secondary variables. ---*/
+
+    if (check_dens || check_press || check_sos || check_temp) {
+
+      for (unsigned long iVar = 0; iVar < nVar; iVar++)
+        Solution(jPoint, iVar) = Solution_Old(jPoint, iVar);
+
+      const su2double energy = staticEnergy(k);
+      FluidModel->SetTDState_rhoe(GetDensity(jPoint), energy);
+      FluidModel->CopyTDStateToBatch(k, batch);
+
+      SetDensity(jPoint);
+      SetPressure(jPoint, batch.Pressure[k]);
+      SetSoundSpeed(jPoint, batch.SoundSpeed2[k]);
+      SetTemperature(jPoint, batch.Temperature[k]);
+
+      nonPhysicalPoints++;
+    }
+
+    SetEnthalpy(jPoint); // Requires pressure computation.
+
+    /*--- Set look-up variables in case of data-driven fluid model ---*/
+    if (DataDrivenFluid) {
+      SetDataExtrapolation(jPoint, batch.Extrapolation[k]);
+      SetEntropy(jPoint, batch.Entropy[k]);
+    }
+  }
+
+  return nonPhysicalPoints;
+}
+
+unsigned long CEulerVariable::SetPrimVarBatch(unsigned long iPoint, unsigned long nPointBatch,
+                                              CFluidModel *FluidModel, CFluidStateBatch& batch) {
+
+  batch.size = nPointBatch;
+  const auto nonPhysicalPoints = SetThermodynamicStateBatch(iPoint, nullptr, FluidModel, batch);
+
+  for (unsigned long k = 0; k < nPointBatch; k++) {
+    SetdPdrho_e(iPoint + k, batch.dPdrho_e[k]);
+    SetdPde_rho(iPoint + k, batch.dPde_rho[k]);
+  }
+
+  return nonPhysicalPoints;
+}
+
 void CEulerVariable::SetSecondaryVar(unsigned long iPoint, CFluidModel *FluidModel) {
 
    /*--- Compute secondary thermo-physical properties (partial derivatives...) ---*/
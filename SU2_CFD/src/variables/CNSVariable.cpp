@@ -209,6 +209,37 @@ bool CNSVariable::SetPrimVar(unsigned long iPoint, su2double eddy_visc, su2doubl
   return RightVol;
 }
 
+unsigned long CNSVariable::SetPrimVarBatch(unsigned long iPoint, unsigned long nPointBatch, const su2double* eddy_visc,
+                                           const su2double* turb_ke, CFluidModel *FluidModel, CFluidStateBatch& batch) {
+
+  batch.size = nPointBatch;
+  const auto nonPhysicalPoints = SetThermodynamicStateBatch(iPoint, turb_ke, FluidModel, batch);
+
+  /*--- Transport properties, after the correction of non-physical points. ---*/
+
+  FluidModel->SetTransportPropertiesBatch(batch);
+
+  for (unsigned long k = 0; k < nPointBatch; k++) {
+    const auto jPoint = iPoint + k;
+
+    SetLaminarViscosity(jPoint, batch.Mu[k]);
+    SetEddyViscosity(jPoint, eddy_visc[k]);
+    SetThermalConductivity(jPoint, batch.Kt[k]);
+    SetSpecificHeatCp(jPoint, batch.Cp[k]);
+
+    SetdPdrho_e(jPoint, batch.dPdrho_e[k]);
+    SetdPde_rho(jPoint, batch.dPde_rho[k]);
+    SetdTdrho_e(jPoint, batch.dTdrho_e[k]);
+    SetdTde_rho(jPoint, batch.dTde_rho[k]);
+    Setdmudrho_T(jPoint, batch.dmudrho_T[k]);
+    SetdmudT_rho(jPoint, batch.dmudT_rho[k]);
+    Setdktdrho_T(jPoint, batch.dktdrho_T[k]);
+    SetdktdT_rho(jPoint, batch.dktdT_rho[k]);
+  }
+
+  return nonPhysicalPoints;
+}
+
 void CNSVariable::SetSecondaryVar(unsigned long iPoint, CFluidModel *FluidModel) {
 
     /*--- Compute secondary thermodynamic properties (partial derivatives...) ---*/
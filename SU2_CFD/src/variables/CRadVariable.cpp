@@ -38,7 +38,7 @@ CRadVariable::CRadVariable(unsigned long npoint, unsigned long ndim, unsigned lo
   /*--- Gradient related fields ---*/
   Gradient.resize(nPoint,nVar,nDim,0.0);
 
-  if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
+  if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES && config->GetnMarker_Periodic() > 0) {
     Rmatrix.resize(nPoint,nDim,nDim,0.0);
   }
 
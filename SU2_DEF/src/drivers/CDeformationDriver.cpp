@@ -499,8 +499,13 @@ void CDeformationDriver::OutputFiles() {
 
     output_container[iZone]->LoadData(geometry_container[iZone][INST_0][MESH_0], config_container[iZone], nullptr);
 
+    /*--- The deformed mesh is written in the format of the input mesh (ASCII or binary SU2). ---*/
+
+    const auto meshOutput =
+        (driver_config->GetMesh_FileFormat() == SU2_BINARY) ? OUTPUT_TYPE::MESH_BINARY : OUTPUT_TYPE::MESH;
+
     output_container[iZone]->WriteToFile(config_container[iZone], geometry_container[iZone][INST_0][MESH_0],
-                                         OUTPUT_TYPE::MESH, driver_config->GetMesh_Out_FileName());
+                                         meshOutput, driver_config->GetMesh_Out_FileName());
 
     /*--- Set the file names for the visualization files. ---*/
 
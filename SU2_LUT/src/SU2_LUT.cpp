@@ -0,0 +1,66 @@
+/*!
+ * \file SU2_LUT.cpp
+ * \brief Main file of the look-up table converter (SU2_LUT), writes tables in the binary format.
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../Common/include/containers/CLookUpTable.hpp"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  /*--- MPI initialization ---*/
+
+  SU2_MPI::Init(&argc, &argv);
+
+  const int rank = SU2_MPI::GetRank();
+
+  if (argc < 4 || argc > 5) {
+    if (rank == MASTER_NODE) {
+      cout << "Usage: SU2_LUT <table file (.drg)> <controlling variable 1> <controlling variable 2> [output file]\n"
+              "The controlling variables are those used by the fluid model, e.g. ProgressVariable and\n"
+              "EnthalpyTot for flamelets, or Density and Energy for data-driven fluids." << endl;
+    }
+    SU2_MPI::Finalize();
+    return EXIT_FAILURE;
+  }
+
+  const string file_name = argv[1];
+  const string output_name = (argc == 5) ? string(argv[4]) : file_name.substr(0, file_name.rfind('.')) + ".lutb";
+
+  /*--- Build the table and its search structures, then write everything (the table
+   *    is destroyed before finalizing MPI as it may own MPI resources). ---*/
+  {
+    const CLookUpTable table(file_name, argv[2], argv[3]);
+
+    if (rank == MASTER_NODE) {
+      cout << "Writing binary look-up table, filename = " << output_name << " ..." << endl;
+      table.WriteBinaryTable(output_name);
+      cout << " done." << endl;
+    }
+  }
+
+  SU2_MPI::Finalize();
+
+  return EXIT_SUCCESS;
+}
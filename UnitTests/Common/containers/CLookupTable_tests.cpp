@@ -136,3 +136,86 @@ TEST_CASE("LUTreader_3D", "[tabulated chemistry]") {
   look_up_table.LookUp_XYZ(idx_tag, &look_up_dat, prog, enth, mfrac);
   CHECK(look_up_dat == Approx(1.1738796125));
 }
+
+TEST_CASE("LUTreader_search_hint", "[tabulated chemistry]") {
+  /*--- The result of a look-up must not depend on the previous queries (i.e. on the
+   *    triangle from which the search starts), sweep the table in opposite directions. ---*/
+
+  CLookUpTable look_up_table_fwd("src/SU2/UnitTests/Common/containers/lookuptable.drg", "ProgressVariable",
+                                 "EnthalpyTot");
+  CLookUpTable look_up_table_bwd("src/SU2/UnitTests/Common/containers/lookuptable.drg", "ProgressVariable",
+                                 "EnthalpyTot");
+
+  const vector<unsigned long> idx_vars = {look_up_table_fwd.GetIndexOfVar("Density"),
+                                          look_up_table_fwd.GetIndexOfVar("Viscosity"),
+                                          look_up_table_fwd.GetNullIndex()};
+  const unsigned long nSample = 25;
+  vector<su2double> fwd(idx_vars.size() * nSample * nSample), bwd(fwd.size()), vals(idx_vars.size());
+
+  for (auto i = 0ul; i < nSample * nSample; ++i) {
+    const auto j = nSample * nSample - 1 - i;
+    const su2double prog_i = 0.99 * (i % nSample) / (nSample - 1);
+    const su2double enth_i = -0.99 + 1.98 * (i / nSample) / (nSample - 1);
+    const su2double prog_j = 0.99 * (j % nSample) / (nSample - 1);
+    const su2double enth_j = -0.99 + 1.98 * (j / nSample) / (nSample - 1);
+
+    CHECK(look_up_table_fwd.LookUp_XY(idx_vars, vals, prog_i, enth_i));
+    for (auto iVar = 0ul; iVar < idx_vars.size(); ++iVar) fwd[i * idx_vars.size() + iVar] = vals[iVar];
+
+    /*--- Pointer version, looking up all variables at once. ---*/
+    vector<su2double*> refs(idx_vars.size());
+    for (auto iVar = 0ul; iVar < idx_vars.size(); ++iVar) refs[iVar] = &bwd[j * idx_vars.size() + iVar];
+    CHECK(look_up_table_bwd.LookUp_XY(idx_vars, refs, prog_j, enth_j));
+  }
+  for (auto i = 0ul; i < fwd.size(); ++i) {
+    CHECK(SU2_TYPE::GetValue(fwd[i]) == Approx(SU2_TYPE::GetValue(bwd[i])));
+  }
+
+  /*--- Repeated queries at the same point, alternating with a point outside the table. ---*/
+  su2double density;
+  look_up_table_fwd.LookUp_XY(idx_vars[0], &density, 0.55, -0.5);
+  CHECK(density == Approx(1.02));
+  look_up_table_fwd.LookUp_XY(idx_vars[0], &density, 1.1, 1.1);
+  CHECK(density == Approx(1.1738796125));
+  look_up_table_fwd.LookUp_XY(idx_vars[0], &density, 0.55, -0.5);
+  CHECK(density == Approx(1.02));
+}
+
+TEST_CASE("LUTreader_binary", "[tabulated chemistry]") {
+  /*--- write the 3D table in binary format and read it back, the search structures are
+   *    loaded instead of built, so the results must be identical ---*/
+
+  const string binary_file = "lookuptable_3D_tests.lutb";
+
+  CLookUpTable look_up_table_ascii("src/SU2/UnitTests/Common/containers/lookuptable_3D.drg", "ProgressVariable",
+                                   "EnthalpyTot");
+  look_up_table_ascii.WriteBinaryTable(binary_file);
+
+  CHECK(CBinaryFileLUT::IsBinary(binary_file));
+  CHECK_FALSE(CBinaryFileLUT::IsBinary("src/SU2/UnitTests/Common/containers/lookuptable_3D.drg"));
+
+  CLookUpTable look_up_table_binary(binary_file, "ProgressVariable", "EnthalpyTot");
+
+  vector<unsigned long> idx_vars = {look_up_table_ascii.GetIndexOfVar("Density"),
+                                    look_up_table_ascii.GetIndexOfVar("Viscosity")};
+  CHECK(idx_vars[0] == look_up_table_binary.GetIndexOfVar("Density"));
+  CHECK(idx_vars[1] == look_up_table_binary.GetIndexOfVar("Viscosity"));
+
+  /*--- the grid includes points outside the table (nearest neighbor interpolation) ---*/
+
+  vector<su2double> vals_ascii(2), vals_binary(2);
+  for (int i = 0; i <= 6; ++i) {
+    for (int j = 0; j <= 6; ++j) {
+      for (int k = 0; k <= 4; ++k) {
+        const su2double prog = -0.1 + 0.2 * i, enth = -1.2 + 0.4 * j, mfrac = -0.1 + 0.3 * k;
+        const bool inside_ascii = look_up_table_ascii.LookUp_XYZ(idx_vars, vals_ascii, prog, enth, mfrac);
+        const bool inside_binary = look_up_table_binary.LookUp_XYZ(idx_vars, vals_binary, prog, enth, mfrac);
+        CHECK(inside_ascii == inside_binary);
+        CHECK(SU2_TYPE::GetValue(vals_ascii[0]) == SU2_TYPE::GetValue(vals_binary[0]));
+        CHECK(SU2_TYPE::GetValue(vals_ascii[1]) == SU2_TYPE::GetValue(vals_binary[1]));
+      }
+    }
+  }
+
+  remove(binary_file.c_str());
+}
@@ -0,0 +1,75 @@
+/*!
+ * \file CFEMStandardElement_tests.cpp
+ * \brief Unit tests for the sum factorization of the FEM standard elements.
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../../Common/include/fem/fem_standard_element.hpp"
+#include "../../../Common/include/linear_algebra/blas_structure.hpp"
+
+TEST_CASE("Sum factorization of quadrilaterals and hexahedra", "[FEMStandardElement]") {
+  CBlasStructure blas;
+
+  /*--- Number of columns, not a multiple of the block size of the kernels. ---*/
+  const unsigned short N = 13;
+
+  for (const auto VTK_Type : {QUADRILATERAL, HEXAHEDRON}) {
+    const unsigned short nDim = (VTK_Type == QUADRILATERAL) ? 2 : 3;
+
+    for (unsigned short nPoly = 1; nPoly <= 6; ++nPoly) {
+      /*--- Over-integration as used for curved elements. ---*/
+      CFEMStandardElement elem(VTK_Type, nPoly, false, nullptr, 3 * nPoly);
+      REQUIRE(elem.GetSumFactorization());
+
+      const unsigned short nDOFs = elem.GetNDOFs();
+      const unsigned short nInt = elem.GetNIntegration();
+
+      vector<su2double> dataDOFs(nDOFs * N), dataInt(nInt * nDim * N);
+      for (size_t i = 0; i < dataDOFs.size(); ++i) dataDOFs[i] = sin(0.1 * i + nPoly);
+      for (size_t i = 0; i < dataInt.size(); ++i) dataInt[i] = cos(0.2 * i + nPoly);
+
+      /*--- Values and derivatives in the integration points. ---*/
+      vector<su2double> ref(nInt * (nDim + 1) * N), res(ref.size());
+      blas.gemm(nInt * (nDim + 1), N, nDOFs, elem.GetMatBasisFunctionsIntegration(), dataDOFs.data(), ref.data(),
+                nullptr);
+      elem.InterpolateDOFsToIntPoints(true, true, N, dataDOFs.data(), res.data(), &blas, nullptr);
+      for (size_t i = 0; i < ref.size(); ++i) CHECK(res[i] == Approx(ref[i]).margin(1e-10));
+
+      /*--- Only the derivatives. ---*/
+      elem.InterpolateDOFsToIntPoints(false, true, N, dataDOFs.data(), res.data(), &blas, nullptr);
+      for (size_t i = 0; i < nInt * nDim * N; ++i) CHECK(res[i] == Approx(ref[nInt * N + i]).margin(1e-10));
+
+      /*--- Integration of the fluxes and of the source terms. ---*/
+      ref.resize(nDOFs * N);
+      res.resize(nDOFs * N);
+      blas.gemm(nDOFs, N, nInt * nDim, elem.GetDerMatBasisFunctionsIntTrans(), dataInt.data(), ref.data(), nullptr);
+      elem.IntegrateIntPointsToDOFs(true, N, dataInt.data(), res.data(), &blas, nullptr);
+      for (size_t i = 0; i < ref.size(); ++i) CHECK(res[i] == Approx(ref[i]).margin(1e-10));
+
+      blas.gemm(nDOFs, N, nInt, elem.GetBasisFunctionsIntegrationTrans(), dataInt.data(), ref.data(), nullptr);
+      elem.IntegrateIntPointsToDOFs(false, N, dataInt.data(), res.data(), &blas, nullptr);
+      for (size_t i = 0; i < ref.size(); ++i) CHECK(res[i] == Approx(ref[i]).margin(1e-10));
+    }
+  }
+}
@@ -102,6 +102,28 @@ TEST_CASE("Set Edges", "[Geometry]") {
   CHECK(TestCase->geometry->edges->GetnNodes() == 2);
   CHECK(TestCase->geometry->edges->GetNode(42, 0) == 15);
   CHECK(TestCase->geometry->edges->GetNode(87, 1) == 57);
+
+  /*--- In serial there are no halo points, all edges are domain edges. ---*/
+  CHECK(TestCase->geometry->GetnEdgeDomain() == TestCase->geometry->GetnEdge());
+}
+
+TEST_CASE("Split edge coloring", "[Geometry]") {
+  /*--- Two colors with groups of 2 edges, split at edge 5 (rounded down to 4). ---*/
+  const std::vector<unsigned long> outerPtr = {0, 6, 10};
+  const std::vector<unsigned long> innerIdx = {0, 1, 4, 5, 8, 9, 2, 3, 6, 7};
+  const CCompressedSparsePatternUL coloring(outerPtr, innerIdx);
+
+  std::vector<GridColor<> > colors;
+  const auto nLower = splitColoring(coloring, 2ul, 5ul, colors);
+
+  REQUIRE(nLower == 2);
+  REQUIRE(colors.size() == 4);
+  CHECK(colors[0].size == 2);
+  CHECK(colors[1].size == 2);
+  CHECK(colors[2].size == 4);
+  CHECK(colors[2].indices[0] == 4);
+  CHECK(colors[3].size == 2);
+  CHECK(colors[3].indices[1] == 7);
 }
 
 TEST_CASE("Set vertex", "[Geometry]") {
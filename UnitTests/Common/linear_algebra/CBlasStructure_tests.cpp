@@ -0,0 +1,56 @@
+/*!
+ * \file CBlasStructure_tests.cpp
+ * \brief Unit tests for the dense matrix products of CBlasStructure.
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../../Common/include/CConfig.hpp"
+#include "../../../Common/include/linear_algebra/blas_structure.hpp"
+
+TEST_CASE("Dense matrix product", "[BLAS]") {
+  CBlasStructure blas;
+
+  /*--- Sizes as they appear in the DG solver, ragged sizes with respect to
+   the SIMD length and the register blocking, and a K larger than the block
+   size of the native implementation. ---*/
+  const int sizes[][3] = {{16, 8, 9}, {27, 40, 64}, {1, 1, 1}, {7, 13, 5}, {25, 31, 125}, {3, 200, 300}};
+
+  for (const auto& size : sizes) {
+    const int M = size[0], N = size[1], K = size[2];
+
+    vector<su2double> A(M * K), B(K * N), C(M * N, 1e6);
+    for (int i = 0; i < M * K; ++i) A[i] = sin(0.3 * i);
+    for (int i = 0; i < K * N; ++i) B[i] = cos(0.7 * i);
+
+    blas.gemm(M, N, K, A.data(), B.data(), C.data(), nullptr);
+
+    for (int i = 0; i < M; ++i) {
+      for (int j = 0; j < N; ++j) {
+        su2double ref = 0.0;
+        for (int p = 0; p < K; ++p) ref += A[i * K + p] * B[p * N + j];
+        CHECK(C[i * N + j] == Approx(ref).margin(1e-12));
+      }
+    }
+  }
+}
@@ -0,0 +1,518 @@
+/*!
+ * \file CSysMatrix_tests.cpp
+ * \brief Unit tests and micro-benchmarks for the block kernels and storage formats of CSysMatrix.
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <chrono>
+#include <iomanip>
+#include "../../../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../../../Common/include/linear_algebra/CSysMatrix.hpp"
+#include "../../../Common/include/linear_algebra/CSysSolve.hpp"
+#include "../../../Common/include/linear_algebra/CMatrixVectorProduct.hpp"
+#include "../../../Common/include/linear_algebra/CPreconditioner.hpp"
+
+/*!
+ * \brief Unit cube geometry on which the FVM sparse pattern of the matrices is built.
+ */
+struct MatrixTestCase {
+  std::unique_ptr<CConfig> config;
+  std::unique_ptr<CGeometry> geometry;
+
+  explicit MatrixTestCase(const string& boxSize, const string& extraOptions = "") {
+    string configOptions =
+        "SOLVER= EULER\n"
+        "MESH_FORMAT= BOX\n"
+        "MARKER_FAR= (x_minus, x_plus, y_minus, y_plus, z_plus, z_minus)\n"
+        "LINEAR_SOLVER_PREC= ILU\n"
+        "MESH_BOX_LENGTH= 1,1,1\n"
+        "MESH_BOX_OFFSET= 0,0,0\n";
+    configOptions += "MESH_BOX_SIZE= " + boxSize + "\n" + extraOptions;
+
+    auto origBuf = cout.rdbuf();
+    cout.rdbuf(nullptr);
+
+    stringstream ss(configOptions);
+    config = std::unique_ptr<CConfig>(new CConfig(ss, SU2_COMPONENT::SU2_CFD, false));
+    {
+      auto aux_geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(config.get(), 0, 1));
+      geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(aux_geometry.get(), config.get()));
+    }
+    geometry->SetSendReceive(config.get());
+    geometry->SetBoundaries(config.get());
+    geometry->SetPoint_Connectivity();
+    geometry->SetElement_Connectivity();
+    geometry->SetEdges();
+    geometry->SetGlobal_to_Local_Point();
+    geometry->PreprocessP2PComms(geometry.get(), config.get());
+
+    cout.rdbuf(origBuf);
+  }
+
+  /*!
+   * \brief Initialize a diagonally dominant matrix with nVar x nVar blocks.
+   */
+  template <class T>
+  void InitMatrix(unsigned long nVar, CSysMatrix<T>& mat) const {
+    const auto nPoint = geometry->GetnPoint();
+    mat.Initialize(nPoint, geometry->GetnPointDomain(), nVar, nVar, true, geometry.get(), config.get());
+
+    vector<T> block(nVar * nVar);
+
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      for (const auto jPoint : geometry->nodes->GetPoints(iPoint)) {
+        for (auto k = 0ul; k < nVar * nVar; ++k) block[k] = -0.1 * T(1 + (iPoint + jPoint + k) % 3) / nVar;
+        mat.SetBlock(iPoint, jPoint, block.data());
+      }
+      for (auto k = 0ul; k < nVar * nVar; ++k) block[k] = T(k % (nVar + 1) == 0 ? 10 : (k % 5) * 0.1);
+      mat.SetBlock(iPoint, iPoint, block.data());
+    }
+  }
+
+  /*!
+   * \brief Initialize a shifted graph Laplacian (SPD) with weakly coupled variables, which is hard for Jacobi.
+   */
+  template <class T>
+  void InitLaplacian(unsigned long nVar, CSysMatrix<T>& mat) const {
+    const auto nPoint = geometry->GetnPoint();
+    mat.Initialize(nPoint, geometry->GetnPointDomain(), nVar, nVar, true, geometry.get(), config.get());
+
+    vector<T> block(nVar * nVar);
+
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      for (auto k = 0ul; k < nVar * nVar; ++k) block[k] = k % (nVar + 1) == 0 ? -1.0 : 0.0;
+      for (const auto jPoint : geometry->nodes->GetPoints(iPoint)) mat.SetBlock(iPoint, jPoint, block.data());
+      const T diag = geometry->nodes->GetnPoint(iPoint) + 0.01;
+      for (auto k = 0ul; k < nVar * nVar; ++k) block[k] = k % (nVar + 1) == 0 ? diag : T(0.004);
+      mat.SetBlock(iPoint, iPoint, block.data());
+    }
+  }
+};
+
+template <class T>
+void InitVector(unsigned long nVar, unsigned long nPoint, CSysVector<T>& vec) {
+  vec.Initialize(nPoint, nPoint, nVar, 0.0);
+  for (auto i = 0ul; i < nPoint * nVar; ++i) vec[i] = 1 + T(i % 7) / 7;
+}
+
+TEST_CASE("Block kernels", "[CSysMatrix]") {
+  using Scalar = su2mixedfloat;
+  const MatrixTestCase test("5,5,5");
+  const auto& geometry = *test.geometry;
+  const auto nPoint = geometry.GetnPoint();
+
+  /*--- 1 to 7 use the specialized kernels, 8 the generic ones. ---*/
+  for (auto nVar = 1ul; nVar <= 8; ++nVar) {
+    CSysMatrix<Scalar> mat;
+    test.InitMatrix(nVar, mat);
+
+    CSysVector<Scalar> x, y, z;
+    InitVector(nVar, nPoint, x);
+    InitVector(nVar, nPoint, y);
+    InitVector(nVar, nPoint, z);
+
+    /*--- Product against a reference computed entry by entry. ---*/
+    mat.MatrixVectorProduct(x, y, test.geometry.get(), test.config.get());
+
+    passivedouble err = 0;
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+        Scalar ref = 0;
+        for (auto jVar = 0ul; jVar < nVar; ++jVar) {
+          ref += mat.GetBlock(iPoint, iPoint, iVar, jVar) * x(iPoint, jVar);
+          for (const auto jPoint : geometry.nodes->GetPoints(iPoint))
+            ref += mat.GetBlock(iPoint, jPoint, iVar, jVar) * x(jPoint, jVar);
+        }
+        err = max(err, fabs(SU2_TYPE::GetValue(y(iPoint, iVar) - ref) / SU2_TYPE::GetValue(ref)));
+      }
+    }
+    CHECK(err < 1e-5);
+
+    /*--- The Jacobi preconditioner inverts the diagonal blocks, D * (D^-1 * y) = y. ---*/
+    mat.BuildJacobiPreconditioner();
+    mat.ComputeJacobiPreconditioner(y, z, test.geometry.get(), test.config.get());
+
+    err = 0;
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+        Scalar prod = 0;
+        for (auto jVar = 0ul; jVar < nVar; ++jVar) prod += mat.GetBlock(iPoint, iPoint, iVar, jVar) * z(iPoint, jVar);
+        err = max(err, fabs(SU2_TYPE::GetValue(prod - y(iPoint, iVar)) / SU2_TYPE::GetValue(y(iPoint, iVar))));
+      }
+    }
+    CHECK(err < 1e-5);
+  }
+}
+
+TEST_CASE("SELL-C-sigma product", "[CSysMatrix]") {
+  using Scalar = su2mixedfloat;
+  const MatrixTestCase test("7,6,5", "LINEAR_SOLVER_MATRIX_FORMAT= SELL_C_SIGMA\n");
+  const auto nPoint = test.geometry->GetnPoint();
+
+  for (auto nVar = 1ul; nVar <= 8; ++nVar) {
+    CSysMatrix<Scalar> mat;
+    test.InitMatrix(nVar, mat);
+
+    CSysVector<Scalar> x, y, z;
+    InitVector(nVar, nPoint, x);
+    InitVector(nVar, nPoint, y);
+    InitVector(nVar, nPoint, z);
+
+    /*--- Block-CSR product before the SELL copy is built, and SELL product after. ---*/
+    mat.MatrixVectorProduct(x, y, test.geometry.get(), test.config.get());
+    mat.BuildSlicedEllMatrix();
+    mat.MatrixVectorProduct(x, z, test.geometry.get(), test.config.get());
+
+    passivedouble err = 0;
+    for (auto i = 0ul; i < nPoint * nVar; ++i)
+      err = max(err, fabs(SU2_TYPE::GetValue(y[i] - z[i]) / SU2_TYPE::GetValue(y[i])));
+    CHECK(err < 1e-5);
+
+    /*--- Modifying a single block also invalidates the copy. ---*/
+    mat.AddVal2Diag(0, 1.0);
+    mat.MatrixVectorProduct(x, z, test.geometry.get(), test.config.get());
+
+    err = 0;
+    for (auto iVar = 0ul; iVar < nVar; ++iVar)
+      err = max(err, fabs(SU2_TYPE::GetValue(y(0, iVar) + x(0, iVar) - z(0, iVar)) / SU2_TYPE::GetValue(y(0, iVar))));
+    CHECK(err < 1e-5);
+
+    /*--- Modifying the whole matrix invalidates the copy. ---*/
+    mat.SetValZero();
+    mat.MatrixVectorProduct(x, z, test.geometry.get(), test.config.get());
+    CHECK(z.norm() == 0);
+  }
+}
+
+TEST_CASE("ILU level scheduling", "[CSysMatrix]") {
+  using Scalar = su2mixedfloat;
+  /*--- A single partition gives the exact ILU of the rank, level scheduling must match it with any number of
+   *    threads. The two geometries are identical. ---*/
+  const MatrixTestCase serial("7,6,5", "LINEAR_SOLVER_ILU_FILL_IN= 1\nLINEAR_SOLVER_PREC_THREADS= 1\n");
+  const MatrixTestCase levels("7,6,5", "LINEAR_SOLVER_ILU_FILL_IN= 1\nLINEAR_SOLVER_ILU_LEVEL_SCHEDULING= YES\n");
+  const auto nPoint = serial.geometry->GetnPoint();
+
+  for (const auto nVar : {1ul, 4ul}) {
+    CSysMatrix<Scalar> serialMat, levelsMat;
+    serial.InitMatrix(nVar, serialMat);
+    levels.InitMatrix(nVar, levelsMat);
+
+    CSysVector<Scalar> x, y, z;
+    InitVector(nVar, nPoint, x);
+    InitVector(nVar, nPoint, y);
+    InitVector(nVar, nPoint, z);
+
+    serialMat.BuildILUPreconditioner();
+    serialMat.ComputeILUPreconditioner(x, y, serial.geometry.get(), serial.config.get());
+
+    SU2_OMP_PARALLEL {
+      levelsMat.BuildILUPreconditioner();
+      levelsMat.ComputeILUPreconditioner(x, z, levels.geometry.get(), levels.config.get());
+    }
+    END_SU2_OMP_PARALLEL
+
+    passivedouble err = 0;
+    for (auto i = 0ul; i < nPoint * nVar; ++i)
+      err = max(err, fabs(SU2_TYPE::GetValue(y[i] - z[i]) / SU2_TYPE::GetValue(y[i])));
+    CHECK(err < 1e-5);
+  }
+}
+
+TEST_CASE("AMG preconditioner", "[CSysMatrix]") {
+  using Scalar = su2mixedfloat;
+  const MatrixTestCase test("12,12,12");
+  const auto& geometry = *test.geometry;
+  const auto nPoint = geometry.GetnPoint();
+
+  for (const auto nVar : {1ul, 3ul}) {
+    CSysMatrix<Scalar> mat;
+    test.InitLaplacian(nVar, mat);
+
+    CSysVector<Scalar> b, x, r, z;
+    InitVector(nVar, nPoint, b);
+    InitVector(nVar, nPoint, x);
+    InitVector(nVar, nPoint, r);
+    InitVector(nVar, nPoint, z);
+
+    /*--- Residual reduction of a stationary iteration x += M^-1 (b - A x). ---*/
+    auto reduction = [&](auto&& precond) {
+      x = Scalar(0);
+      SU2_OMP_PARALLEL {
+        for (int iter = 0; iter < 10; ++iter) {
+          mat.ComputeResidual(x, b, r);
+          precond(r, z);
+          x -= z;
+        }
+        mat.ComputeResidual(x, b, r);
+      }
+      END_SU2_OMP_PARALLEL
+      return SU2_TYPE::GetValue(r.norm() / b.norm());
+    };
+
+    mat.BuildJacobiPreconditioner();
+    const auto jacobi = reduction([&](const CSysVector<Scalar>& u, CSysVector<Scalar>& v) {
+      mat.ComputeJacobiPreconditioner(u, v, test.geometry.get(), test.config.get());
+    });
+
+    SU2_OMP_PARALLEL { mat.BuildAMGPreconditioner(); }
+    END_SU2_OMP_PARALLEL
+    const auto amg = reduction([&](const CSysVector<Scalar>& u, CSysVector<Scalar>& v) {
+      mat.ComputeAMGPreconditioner(u, v, test.geometry.get(), test.config.get());
+    });
+
+    CHECK(mat.GetAMGNumLevels() > 1);
+    CHECK(amg < 1e-3);
+    CHECK(amg < 0.01 * jacobi);
+  }
+}
+
+TEST_CASE("Pipelined Krylov solvers", "[CSysMatrix]") {
+  using Scalar = su2mixedfloat;
+  const MatrixTestCase test("9,8,7");
+  const auto nPoint = test.geometry->GetnPoint();
+  const Scalar tol = 1e-8;
+
+  for (const auto nVar : {1ul, 3ul}) {
+    CSysMatrix<Scalar> mat;
+    test.InitLaplacian(nVar, mat);
+
+    CSysVector<Scalar> b, x, r;
+    InitVector(nVar, nPoint, b);
+    InitVector(nVar, nPoint, x);
+    InitVector(nVar, nPoint, r);
+
+    const CSysMatrixVectorProduct<Scalar> product(mat, test.geometry.get(), test.config.get());
+    CILUPreconditioner<Scalar> precond(mat, test.geometry.get(), test.config.get());
+    CSysSolve<Scalar> solver;
+
+    /*--- Iterations and true relative residual of each method. ---*/
+    using Method = decltype(&CSysSolve<Scalar>::CG_LinSolver);
+    auto solve = [&](Method method) {
+      unsigned long iter = 0;
+      x = Scalar(0);
+      SU2_OMP_PARALLEL {
+        precond.Build();
+        Scalar res = 0;
+        const auto it = (solver.*method)(b, x, product, precond, tol, 200, res, false, test.config.get());
+        mat.ComputeResidual(x, b, r);
+        SU2_OMP_MASTER
+        iter = it;
+        END_SU2_OMP_MASTER
+      }
+      END_SU2_OMP_PARALLEL
+      return std::make_pair(iter, SU2_TYPE::GetValue(r.norm() / b.norm()));
+    };
+
+    const auto cg = solve(&CSysSolve<Scalar>::CG_LinSolver);
+    const auto pcg = solve(&CSysSolve<Scalar>::PipelinedCG_LinSolver);
+    const auto gmres = solve(&CSysSolve<Scalar>::FGMRES_LinSolver);
+    const auto pgmres = solve(&CSysSolve<Scalar>::PipelinedGMRES_LinSolver);
+
+    /*--- Same convergence in exact arithmetic, allow some drift due to the recurrences. ---*/
+    CHECK(pcg.second < 10 * tol);
+    CHECK(pcg.first <= cg.first + 2);
+    CHECK(pgmres.second < 10 * tol);
+    CHECK(pgmres.first <= gmres.first + 2);
+  }
+}
+
+TEST_CASE("Krylov subspace recycling", "[CSysMatrix]") {
+  using Scalar = su2mixedfloat;
+  const MatrixTestCase test("9,8,7", "LINEAR_SOLVER_RESTART_FREQUENCY= 20\nLINEAR_SOLVER_RECYCLE_SIZE= 8\n");
+  const auto nPoint = test.geometry->GetnPoint();
+  const Scalar tol = 1e-8;
+  const unsigned long nVar = 2;
+
+  CSysMatrix<Scalar> mat;
+  test.InitLaplacian(nVar, mat);
+
+  CSysVector<Scalar> b, x, r;
+  InitVector(nVar, nPoint, b);
+  InitVector(nVar, nPoint, x);
+  InitVector(nVar, nPoint, r);
+
+  const CSysMatrixVectorProduct<Scalar> product(mat, test.geometry.get(), test.config.get());
+  CJacobiPreconditioner<Scalar> precond(mat, test.geometry.get(), test.config.get());
+  CSysSolve<Scalar> reference, recycling;
+
+  /*--- Sequence of slowly varying systems, as in pseudo-time or design iterations. ---*/
+  unsigned long refIter = 0, recIter = 0;
+
+  for (int iSystem = 0; iSystem < 4; ++iSystem) {
+    if (iSystem > 0) {
+      for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) mat.AddVal2Diag(iPoint, Scalar(0.002));
+    }
+    for (auto i = 0ul; i < nPoint * nVar; ++i) b[i] = 1 + Scalar((i + iSystem) % 7) / 7;
+
+    unsigned long iter[2] = {0, 0};
+    passivedouble res[2] = {0, 0};
+
+    for (int iSolver = 0; iSolver < 2; ++iSolver) {
+      x = Scalar(0);
+      SU2_OMP_PARALLEL {
+        precond.Build();
+        Scalar residual = 0;
+        const auto it =
+            iSolver == 0 ? reference.RFGMRES_LinSolver(b, x, product, precond, tol, 500, residual, false,
+                                                       test.config.get())
+                         : recycling.GCRODR_LinSolver(b, x, product, precond, tol, 500, residual, false,
+                                                      test.config.get());
+        mat.ComputeResidual(x, b, r);
+        SU2_OMP_MASTER
+        iter[iSolver] = it;
+        END_SU2_OMP_MASTER
+      }
+      END_SU2_OMP_PARALLEL
+      res[iSolver] = SU2_TYPE::GetValue(r.norm() / b.norm());
+    }
+
+    /*--- The first system has nothing to recycle yet. ---*/
+    CHECK(res[1] < 10 * tol);
+    if (iSystem > 0) {
+      refIter += iter[0];
+      recIter += iter[1];
+    }
+  }
+  CHECK(recycling.GetRecycledSize() == 8);
+  CHECK(recIter < 0.8 * refIter);
+}
+
+TEST_CASE("Multiple right hand sides", "[CSysMatrix]") {
+  using Scalar = su2mixedfloat;
+  const MatrixTestCase test("7,6,5", "LINEAR_SOLVER_ITER= 100\nLINEAR_SOLVER_ERROR= 1e-10\n");
+  const auto nPoint = test.geometry->GetnPoint();
+  const unsigned long nVar = 3, nRhs = 4;
+
+  CSysMatrix<Scalar> mat;
+  test.InitMatrix(nVar, mat);
+  mat.BuildILUPreconditioner();
+
+  /*--- Multi-vector with different columns, and the results of applying the matrix and ILU to it. ---*/
+  vector<CSysVector<Scalar>> cols(nRhs);
+  CSysVector<Scalar> multi(nPoint, nPoint, nVar * nRhs, 0.0), prod(multi), prec(multi), y, z;
+  InitVector(nVar, nPoint, y);
+  InitVector(nVar, nPoint, z);
+
+  SU2_OMP_PARALLEL {
+    for (auto iRhs = 0ul; iRhs < nRhs; ++iRhs) {
+      SU2_OMP_MASTER {
+        cols[iRhs].Initialize(nPoint, nPoint, nVar, 0.0);
+        for (auto i = 0ul; i < nPoint * nVar; ++i) cols[iRhs][i] = 1 + Scalar((i + 2 * iRhs) % 7) / 7;
+      }
+      END_SU2_OMP_MASTER
+      SU2_OMP_BARRIER
+      multi.SetColumn(iRhs, nRhs, cols[iRhs]);
+    }
+    mat.MatrixVectorProduct(multi, prod, test.geometry.get(), test.config.get());
+    mat.ComputeILUPreconditioner(multi, prec, test.geometry.get(), test.config.get());
+  }
+  END_SU2_OMP_PARALLEL
+
+  passivedouble errProd = 0, errPrec = 0;
+  for (auto iRhs = 0ul; iRhs < nRhs; ++iRhs) {
+    mat.MatrixVectorProduct(cols[iRhs], y, test.geometry.get(), test.config.get());
+    prod.GetColumn(iRhs, nRhs, z);
+    for (auto i = 0ul; i < nPoint * nVar; ++i) errProd = max(errProd, fabs(SU2_TYPE::GetValue(y[i] - z[i])));
+
+    mat.ComputeILUPreconditioner(cols[iRhs], y, test.geometry.get(), test.config.get());
+    prec.GetColumn(iRhs, nRhs, z);
+    for (auto i = 0ul; i < nPoint * nVar; ++i) errPrec = max(errPrec, fabs(SU2_TYPE::GetValue(y[i] - z[i])));
+  }
+  CHECK(errProd < 1e-12);
+  CHECK(errPrec < 1e-12);
+
+  /*--- Adjoint solves, the residual of each column with the transposed matrix. ---*/
+  CSysVector<su2double> rhs(nPoint, nPoint, nVar * nRhs, 0.0), sol(rhs);
+  for (auto i = 0ul; i < nPoint * nVar * nRhs; ++i) rhs[i] = SU2_TYPE::GetValue(multi[i]);
+
+  CSysSolve<Scalar> solver;
+  unsigned long iter = 0;
+  SU2_OMP_PARALLEL {
+    const auto it = solver.SolveMultiRHS_b(mat, rhs, sol, nRhs, test.geometry.get(), test.config.get());
+    SU2_OMP_MASTER
+    iter = it;
+    END_SU2_OMP_MASTER
+  }
+  END_SU2_OMP_PARALLEL
+  CHECK(iter > 0);
+  CHECK(iter < 100);
+
+  for (auto i = 0ul; i < nPoint * nVar * nRhs; ++i) multi[i] = SU2_TYPE::GetValue(sol[i]);
+  mat.TransposeInPlace();
+
+  passivedouble res = 0;
+  for (auto iRhs = 0ul; iRhs < nRhs; ++iRhs) {
+    multi.GetColumn(iRhs, nRhs, z);
+    mat.ComputeResidual(z, cols[iRhs], y);
+    res = max(res, SU2_TYPE::GetValue(y.norm() / cols[iRhs].norm()));
+  }
+  CHECK(res < 1e-9);
+}
+
+TEST_CASE("Block kernels benchmark", "[.][CSysMatrix][Benchmark]") {
+  /*--- Hidden test, run with "test_driver [Benchmark]". ---*/
+  using Scalar = su2mixedfloat;
+  using Clock = std::chrono::steady_clock;
+  const MatrixTestCase test("48,48,48", "LINEAR_SOLVER_MATRIX_FORMAT= SELL_C_SIGMA\n");
+  const auto nPoint = test.geometry->GetnPoint();
+  const int nRepeat = 20;
+
+  std::cout << "\n  nVar | SpMV [Gblock/s] | SELL SpMV [Gblock/s] | ILU apply [Gblock/s] | 4-RHS SpMV [Gblock/s]\n";
+
+  for (auto nVar = 1ul; nVar <= 8; ++nVar) {
+    CSysMatrix<Scalar> mat;
+    test.InitMatrix(nVar, mat);
+    mat.BuildILUPreconditioner();
+
+    CSysVector<Scalar> x, y, x4, y4;
+    InitVector(nVar, nPoint, x);
+    InitVector(nVar, nPoint, y);
+    InitVector(4 * nVar, nPoint, x4);
+    InitVector(4 * nVar, nPoint, y4);
+
+    /*--- Each block of the matrix is visited once per application. ---*/
+    const passivedouble nBlocks = test.geometry->GetSparsePattern(ConnectivityType::FiniteVolume).getNumNonZeros();
+
+    auto time = [&](auto&& fun) {
+      fun();
+      const auto start = Clock::now();
+      for (int i = 0; i < nRepeat; ++i) fun();
+      const std::chrono::duration<passivedouble> elapsed = Clock::now() - start;
+      return nRepeat * nBlocks / elapsed.count() * 1e-9;
+    };
+
+    const auto spmv = time([&]() { mat.MatrixVectorProduct(x, y, test.geometry.get(), test.config.get()); });
+    const auto ilu = time([&]() { mat.ComputeILUPreconditioner(x, y, test.geometry.get(), test.config.get()); });
+
+    /*--- Rate per right hand side (each block is applied to 4 vectors). ---*/
+    const auto multi = 4 * time([&]() { mat.MatrixVectorProduct(x4, y4, test.geometry.get(), test.config.get()); });
+
+    mat.BuildSlicedEllMatrix();
+    const auto sell = time([&]() { mat.MatrixVectorProduct(x, y, test.geometry.get(), test.config.get()); });
+
+    std::cout << std::setw(6) << nVar << " | " << std::setw(15) << spmv << " | " << std::setw(20) << sell << " | "
+              << std::setw(20) << ilu << " | " << std::setw(21) << multi << "\n";
+  }
+  std::cout << std::endl;
+}
@@ -29,6 +29,10 @@
 #include <sstream>
 #include "../../../SU2_CFD/include/fluid/CFluidModel.hpp"
 #include "../../../SU2_CFD/include/fluid/CIdealGas.hpp"
+#include "../../../SU2_CFD/include/fluid/CVanDerWaalsGas.hpp"
+#include "../../../SU2_CFD/include/fluid/CPengRobinson.hpp"
+#include "../../../SU2_CFD/include/fluid/CSutherland.hpp"
+#include "../../../SU2_CFD/include/fluid/CConstantPrandtl.hpp"
 #include "../../../SU2_CFD/include/fluid/CDataDrivenFluid.hpp"
 
 void FluidModelChecks(CFluidModel* fluid_model, const su2double val_p, const su2double val_T) {
@@ -93,6 +97,65 @@ TEST_CASE("Test case for ideal gas fluid model") {
   delete fluid_model;
 }
 
+void FluidModelBatchChecks(CFluidModel* fluid_model, const su2double val_p, const su2double val_T) {
+  /*--- The batched evaluation must match the point-wise one. ---*/
+  CFluidStateBatch batch;
+  batch.size = 37;
+  for (size_t i = 0; i < batch.size; ++i) {
+    fluid_model->SetTDState_PT(val_p * (1 + 0.01 * i), val_T + 0.5 * i);
+    batch.Density[i] = fluid_model->GetDensity();
+    batch.StaticEnergy[i] = fluid_model->GetStaticEnergy();
+  }
+  fluid_model->SetTDStateBatch_rhoe(batch);
+
+  for (size_t i = 0; i < batch.size; ++i) {
+    fluid_model->SetTDState_rhoe(batch.Density[i], batch.StaticEnergy[i]);
+    CHECK(batch.Pressure[i] == Approx(fluid_model->GetPressure()));
+    CHECK(batch.Temperature[i] == Approx(fluid_model->GetTemperature()));
+    CHECK(batch.SoundSpeed2[i] == Approx(fluid_model->GetSoundSpeed2()));
+    CHECK(batch.dPdrho_e[i] == Approx(fluid_model->GetdPdrho_e()));
+    CHECK(batch.dPde_rho[i] == Approx(fluid_model->GetdPde_rho()));
+    CHECK(batch.dTdrho_e[i] == Approx(fluid_model->GetdTdrho_e()));
+    CHECK(batch.dTde_rho[i] == Approx(fluid_model->GetdTde_rho()));
+    CHECK(batch.Cp[i] == Approx(fluid_model->GetCp()));
+  }
+}
+
+TEST_CASE("Batched evaluation of fluid models") {
+  CIdealGas ideal_gas(1.4, 287.0);
+  FluidModelBatchChecks(&ideal_gas, 101325, 300.0);
+
+  CVanDerWaalsGas vdw_gas(1.4, 287.0, 3.39e6, 126.2);
+  FluidModelBatchChecks(&vdw_gas, 101325, 300.0);
+
+  CPengRobinson pr_gas(1.4, 287.0, 3.39e6, 126.2, 0.039);
+  FluidModelBatchChecks(&pr_gas, 101325, 300.0);
+
+  /*--- Transport properties. ---*/
+  CFluidStateBatch batch;
+  batch.size = 11;
+  for (size_t i = 0; i < batch.size; ++i) {
+    batch.Temperature[i] = 250.0 + 20.0 * i;
+    batch.Density[i] = 1.0;
+    batch.Cp[i] = 1004.5;
+  }
+  CSutherland sutherland(1.716e-5, 273.15, 110.4);
+  CConstantPrandtl prandtl(0.72);
+  sutherland.SetViscosityBatch(batch);
+  prandtl.SetConductivityBatch(batch);
+
+  for (size_t i = 0; i < batch.size; ++i) {
+    sutherland.SetViscosity(batch.Temperature[i], batch.Density[i]);
+    CHECK(batch.Mu[i] == Approx(sutherland.GetViscosity()));
+    CHECK(batch.dmudT_rho[i] == Approx(sutherland.GetdmudT_rho()));
+
+    prandtl.SetConductivity(batch.Temperature[i], batch.Density[i], batch.Mu[i], 0.0, batch.Cp[i],
+                            batch.dmudrho_T[i], batch.dmudT_rho[i]);
+    CHECK(batch.Kt[i] == Approx(prandtl.GetConductivity()));
+    CHECK(batch.dktdT_rho[i] == Approx(prandtl.GetdktdT_rho()));
+  }
+}
+
 TEST_CASE("Test case for data-driven fluid model") {
   std::stringstream config_options;
 
@@ -116,6 +179,7 @@ TEST_CASE("Test case for data-driven fluid model") {
   /*--- Check fluid model consistency for several combinations of pressure-temperature. ---*/
   FluidModelChecks(fluid_model, 1.83e6, 523.0);
   FluidModelChecks(fluid_model, 2e5, 520.0);
+  FluidModelBatchChecks(fluid_model, 2e5, 520.0);
 
   delete config;
   delete fluid_model;
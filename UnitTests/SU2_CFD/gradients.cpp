@@ -154,3 +154,26 @@ TEST_CASE("GG", "[Gradients]") { testGreenGauss<LinearFunction>(); }
 TEST_CASE("LS", "[Gradients]") { testLeastSquares<LinearFunction>(false); }
 
 TEST_CASE("WLS", "[Gradients]") { testLeastSquares<LinearFunction>(true); }
+
+TEST_CASE("Cached LS coefficients", "[Gradients]") {
+  LinearFunction field;
+  auto& geometry = *field.geometry.get();
+  const auto nDim = geometry.GetnDim();
+  C3DDoubleMatrix R, gradient(geometry.GetnPoint(), field.nVar, nDim);
+
+  /*--- The coefficients are computed on first use and reused afterwards. ---*/
+  computeGradientsLeastSquares(nullptr, MPI_QUANTITIES::SOLUTION, PERIODIC_NONE, geometry, *field.config.get(), true,
+                               field, 0, field.nVar, -1, gradient, R);
+  const auto& coeffs = geometry.GetLeastSquaresCoefficients(true);
+  CHECK(coeffs.rows() == geometry.nodes->GetPoints().getNumNonZeros());
+  CHECK(geometry.GetLeastSquaresCoefficients(false).empty());
+  check(field, gradient);
+
+  /*--- Updating the control volumes invalidates them. ---*/
+  geometry.SetControlVolume(field.config.get(), UPDATE);
+  CHECK(geometry.GetLeastSquaresCoefficients(true).empty());
+
+  computeGradientsLeastSquares(nullptr, MPI_QUANTITIES::SOLUTION, PERIODIC_NONE, geometry, *field.config.get(), true,
+                               field, 0, field.nVar, -1, gradient, R);
+  check(field, gradient);
+}
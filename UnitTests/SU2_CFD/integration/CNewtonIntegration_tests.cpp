@@ -0,0 +1,150 @@
+/*!
+ * \file CNewtonIntegration_tests.cpp
+ * \brief Unit tests for the iterative refinement of the Newton-Krylov startup solves.
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../../SU2_CFD/include/integration/CNewtonIntegration.hpp"
+
+namespace {
+
+using Scalar = CNewtonIntegration::Scalar;
+using Vector = CSysVector<Scalar>;
+
+/*!
+ * \brief Product with a tridiagonal, diagonally dominant, matrix (4 on the diagonal, -1 off-diagonal).
+ */
+template <class In, class Out>
+void TridiagProduct(unsigned long n, const In& u, Out& v) {
+  for (auto i = 0ul; i < n; ++i) {
+    v[i] = 4 * u[i];
+    if (i > 0) v[i] -= u[i - 1];
+    if (i + 1 < n) v[i] -= u[i + 1];
+  }
+}
+
+/*!
+ * \brief Approximate solve of the tridiagonal system by Jacobi iterations, in the precision of T.
+ */
+template <class T>
+unsigned long Jacobi(const Vector& r, Vector& c, unsigned long maxIter, Scalar& eps) {
+  const auto n = r.GetLocSize();
+  std::vector<T> x(n, 0), ax(n);
+
+  auto norm = [](const std::vector<T>& v) {
+    T sum = 0;
+    for (const auto vi : v) sum += vi * vi;
+    return std::sqrt(sum);
+  };
+  std::vector<T> rhs(n);
+  for (auto i = 0ul; i < n; ++i) rhs[i] = r[i];
+  const T norm0 = norm(rhs);
+
+  T res = 1;
+  unsigned long iter = 0;
+  while (res > eps && iter < maxIter) {
+    TridiagProduct(n, x, ax);
+    for (auto i = 0ul; i < n; ++i) ax[i] = rhs[i] - ax[i];
+    res = norm(ax) / norm0;
+    for (auto i = 0ul; i < n; ++i) x[i] += ax[i] / 4;
+    ++iter;
+  }
+  for (auto i = 0ul; i < n; ++i) c[i] = x[i];
+  eps = res;
+  return iter;
+}
+
+struct RefinementTestCase {
+  const unsigned long n = 200;
+  Vector b, x, res, corr, r;
+
+  RefinementTestCase() {
+    for (auto* vec : {&b, &x, &res, &corr, &r}) vec->Initialize(n, n, 1, 0.0);
+    for (auto i = 0ul; i < n; ++i) b[i] = 1 + Scalar(i % 7) / 7;
+  }
+
+  /*!
+   * \brief Relative residual of the solution, in double precision.
+   */
+  Scalar TrueResidual() {
+    TridiagProduct(n, x, r);
+    r = b - r;
+    return r.norm() / b.norm();
+  }
+};
+
+}  // namespace
+
+TEST_CASE("Iterative refinement", "[CNewtonIntegration]") {
+  RefinementTestCase test;
+  auto product = [](const Vector& u, Vector& v) { TridiagProduct(u.GetLocSize(), u, v); };
+
+  /*--- Single precision corrections reach a double precision tolerance without the fallback. ---*/
+  unsigned long fallbackCalls = 0;
+  auto fallback = [&](const Vector&, Vector& c, unsigned long, Scalar&) {
+    ++fallbackCalls;
+    c = Scalar(0.0);
+    return 0ul;
+  };
+
+  Scalar eps = 1e-12;
+  const auto iters = CNewtonIntegration::IterativeRefinement(test.b, test.x, product, Jacobi<float>, fallback,
+                                                             1000, eps, test.res, test.corr);
+  CHECK(fallbackCalls == 0);
+  CHECK(iters < 1000);
+  CHECK(eps <= 1e-12);
+  CHECK(test.TrueResidual() == Approx(eps).epsilon(1e-6));
+}
+
+TEST_CASE("Iterative refinement fallback", "[CNewtonIntegration]") {
+  RefinementTestCase test;
+  auto product = [](const Vector& u, Vector& v) { TridiagProduct(u.GetLocSize(), u, v); };
+
+  /*--- Under-relaxed corrections, c = r / 8, do not reduce the residual enough and the solve stalls. ---*/
+  auto poorCorrection = [](const Vector& r, Vector& c, unsigned long, Scalar&) {
+    for (auto i = 0ul; i < r.GetLocSize(); ++i) c[i] = r[i] / 8;
+    return 1ul;
+  };
+
+  /*--- Double precision Jacobi iterations. ---*/
+  unsigned long fallbackCalls = 0;
+  auto fallback = [&](const Vector& r, Vector& c, unsigned long maxIter, Scalar& eps) {
+    ++fallbackCalls;
+    return Jacobi<double>(r, c, maxIter, eps);
+  };
+
+  Scalar eps = 1e-12;
+  CNewtonIntegration::IterativeRefinement(test.b, test.x, product, poorCorrection, fallback, 1000, eps, test.res,
+                                          test.corr);
+  CHECK(fallbackCalls == 1);
+  CHECK(eps <= 1e-12);
+  CHECK(test.TrueResidual() < 1e-11);
+
+  /*--- A stall only affects the solve where it happened. ---*/
+  eps = 1e-12;
+  CNewtonIntegration::IterativeRefinement(test.b, test.x, product, Jacobi<float>, fallback, 1000, eps,
+                                          test.res, test.corr);
+  CHECK(fallbackCalls == 1);
+  CHECK(eps <= 1e-12);
+}
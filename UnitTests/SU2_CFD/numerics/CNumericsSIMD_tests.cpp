@@ -0,0 +1,674 @@
+/*!
+ * \file CNumericsSIMD_tests.cpp
+ * \brief Consistency of the vectorized edge numerics with the scalar ones.
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../../../Common/include/linear_algebra/CSysMatrix.hpp"
+#include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+#include "../../../SU2_CFD/include/numerics_simd/CNumericsSIMD.hpp"
+#include "../../../SU2_CFD/include/numerics/flow/convection/hllc.hpp"
+#include "../../../SU2_CFD/include/numerics/flow/convection/ausm_slau.hpp"
+#include "../../../SU2_CFD/include/numerics/flow/convection/fds.hpp"
+#include "../../../SU2_CFD/include/numerics/flow/convection/centered.hpp"
+#include "../../../SU2_CFD/include/numerics/flow/flow_diffusion.hpp"
+#include "../../../SU2_CFD/include/numerics/species/species_convection.hpp"
+#include "../../../SU2_CFD/include/numerics/species/species_diffusion.hpp"
+#include "../../../SU2_CFD/include/numerics/turbulent/turb_convection.hpp"
+#include "../../../SU2_CFD/include/numerics/turbulent/turb_diffusion.hpp"
+#include "../../../SU2_CFD/include/numerics/turbulent/transition/trans_convection.hpp"
+#include "../../../SU2_CFD/include/numerics/turbulent/transition/trans_diffusion.hpp"
+#include "../../../SU2_CFD/include/solvers/CSolver.hpp"
+#include "../../../SU2_CFD/include/variables/CEulerVariable.hpp"
+#include "../../../SU2_CFD/include/variables/CIncNSVariable.hpp"
+#include "../../../SU2_CFD/include/variables/CSpeciesVariable.hpp"
+#include "../../../SU2_CFD/include/variables/CTurbSAVariable.hpp"
+#include "../../../SU2_CFD/include/variables/CTurbSSTVariable.hpp"
+#include "../../../SU2_CFD/include/variables/CTransLMVariable.hpp"
+#include "../../../SU2_CFD/include/fluid/CIdealGas.hpp"
+#include "../../../SU2_CFD/include/fluid/CConstantDensity.hpp"
+
+/*!
+ * \brief Euler problem on a unit cube with a non-uniform state, with regions of
+ * subsonic and supersonic flow in different directions (or an incompressible
+ * state with variable temperature and density if solver is INC_EULER).
+ */
+struct EdgeNumericsTestCase {
+  std::unique_ptr<CConfig> config;
+  std::unique_ptr<CGeometry> geometry;
+  std::unique_ptr<CFlowVariable> nodes;
+  static constexpr unsigned short nVar = 5;
+
+  explicit EdgeNumericsTestCase(const string& scheme, const string& extraOptions = "",
+                                const string& solver = "EULER") {
+    string configOptions =
+        "SOLVER= " + solver + "\n"
+        "MESH_FORMAT= BOX\n"
+        "MARKER_FAR= (x_minus, x_plus, y_minus, y_plus, z_plus, z_minus)\n"
+        "MESH_BOX_SIZE= 4,4,4\n"
+        "MESH_BOX_LENGTH= 1,1,1\n"
+        "MESH_BOX_OFFSET= 0,0,0\n"
+        "MACH_NUMBER= 0.8\n"
+        "MUSCL_FLOW= NO\n"
+        "TIME_DISCRE_FLOW= EULER_IMPLICIT\n";
+    configOptions += "CONV_NUM_METHOD_FLOW= " + scheme + "\n" + extraOptions;
+
+    auto origBuf = cout.rdbuf();
+    cout.rdbuf(nullptr);
+
+    stringstream ss(configOptions);
+    config = std::unique_ptr<CConfig>(new CConfig(ss, SU2_COMPONENT::SU2_CFD, false));
+    {
+      auto aux_geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(config.get(), 0, 1));
+      geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(aux_geometry.get(), config.get()));
+    }
+    geometry->SetSendReceive(config.get());
+    geometry->SetBoundaries(config.get());
+    geometry->SetPoint_Connectivity();
+    geometry->SetElement_Connectivity();
+    geometry->SetBoundVolume();
+    geometry->Check_IntElem_Orientation(config.get());
+    geometry->Check_BoundElem_Orientation(config.get());
+    geometry->SetEdges();
+    geometry->SetVertex(config.get());
+    geometry->SetControlVolume(config.get(), ALLOCATE);
+    geometry->SetBoundControlVolume(config.get(), ALLOCATE);
+    geometry->SetGlobal_to_Local_Point();
+    geometry->PreprocessP2PComms(geometry.get(), config.get());
+
+    /*--- Flow state. ---*/
+
+    const auto nPoint = geometry->GetnPoint();
+    const su2double gamma = config->GetGamma();
+    const su2double velocity[3] = {1.0, 0.0, 0.0};
+
+    if (config->GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE) {
+      if (config->GetViscous())
+        nodes = std::unique_ptr<CFlowVariable>(new CIncNSVariable(0.0, velocity, 1.0, nPoint, 3, nVar, config.get()));
+      else
+        nodes = std::unique_ptr<CFlowVariable>(new CIncEulerVariable(0.0, velocity, 1.0, nPoint, 3, nVar, config.get()));
+
+      CConstantDensity fluidModel(1.0, 2.5);
+      const CIncEulerVariable::CIndices<unsigned short> idx(3, 0);
+
+      for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+        nodes->SetSolution(iPoint, 0, 0.3 * cos(0.7 * iPoint));
+        for (auto iDim = 0u; iDim < 3; ++iDim) {
+          nodes->SetSolution(iPoint, iDim + 1, 1.5 * sin(1.7 * iPoint + iDim));
+        }
+        nodes->SetSolution(iPoint, 4, 1 + 0.2 * sin(0.9 * iPoint));
+        nodes->SetPrimVar(iPoint, &fluidModel);
+        nodes->SetDensity(iPoint, 1 + 0.3 * sin(1.3 * iPoint));
+        nodes->SetBetaInc2(iPoint, 4 + cos(1.1 * iPoint));
+
+        auto* primitive = nodes->GetPrimitive(iPoint);
+        primitive[idx.LaminarViscosity()] = 1e-3 * (1 + 0.2 * sin(0.8 * iPoint));
+        primitive[idx.EddyViscosity()] = 1e-2 * (1 + 0.5 * cos(0.6 * iPoint));
+        primitive[idx.ThermalConductivity()] = 2e-2 * (1 + 0.3 * sin(0.5 * iPoint));
+      }
+    } else {
+      nodes = std::unique_ptr<CFlowVariable>(new CEulerVariable(1.0, velocity, 2.5, nPoint, 3, nVar, config.get()));
+
+      CIdealGas fluidModel(gamma, config->GetGas_Constant());
+      const CEulerVariable::CIndices<unsigned short> idx(3, 0);
+
+      for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+        const su2double density = 1 + 0.3 * sin(1.3 * iPoint);
+        const su2double pressure = 1 + 0.3 * cos(0.7 * iPoint);
+        su2double sqVel = 0.0;
+        for (auto iDim = 0u; iDim < 3; ++iDim) {
+          const su2double vel = 1.5 * sin(1.7 * iPoint + iDim);
+          nodes->SetSolution(iPoint, iDim + 1, density * vel);
+          sqVel += vel * vel;
+        }
+        nodes->SetSolution(iPoint, 0, density);
+        nodes->SetSolution(iPoint, 4, pressure / (gamma - 1) + 0.5 * density * sqVel);
+        nodes->SetPrimVar(iPoint, &fluidModel);
+
+        /*--- Arbitrary viscosities, for the diffusion of scalars. ---*/
+        auto* primitive = nodes->GetPrimitive(iPoint);
+        primitive[idx.LaminarViscosity()] = 1e-3 * (1 + 0.2 * sin(0.8 * iPoint));
+        primitive[idx.EddyViscosity()] = 1e-2 * (1 + 0.5 * cos(0.6 * iPoint));
+      }
+    }
+
+    /*--- Inputs of centered and viscous schemes, and grid velocities. ---*/
+
+    const bool centered = config->GetKind_ConvNumScheme_Flow() == SPACE_CENTERED;
+
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      nodes->SetLambda(iPoint, 20 + 5 * sin(0.4 * iPoint));
+      nodes->SetSensor(iPoint, 0.05 * (1 + sin(1.9 * iPoint)));
+      if (centered) {
+        for (auto iVar = 0u; iVar < nVar; ++iVar) nodes->SetUnd_Lapl(iPoint, iVar, 0.1 * cos(0.7 * iPoint + iVar));
+      }
+      if (config->GetViscous()) {
+        auto& gradient = nodes->GetGradient_Primitive();
+        for (auto iVar = 0ul; iVar < gradient.rows(); ++iVar) {
+          for (auto iDim = 0u; iDim < 3; ++iDim) {
+            gradient(iPoint, iVar, iDim) = cos(0.3 * iPoint + iVar + 1.7 * iDim);
+          }
+        }
+      }
+      if (config->GetDynamic_Grid()) {
+        for (auto iDim = 0u; iDim < 3; ++iDim) {
+          geometry->nodes->SetGridVel(iPoint, iDim, 0.5 * sin(0.6 * iPoint + iDim));
+        }
+      }
+    }
+
+    cout.rdbuf(origBuf);
+  }
+
+  /*!
+   * \brief Compare the residual and Jacobian of the vectorized numerics with the scalar ones,
+   * assembled as in CFVMFlowSolverBase (centered or upwind residual, and viscous residual).
+   * \param[in] viscNumerics - Scalar viscous numerics, for viscous problems.
+   */
+  void Compare(CNumerics& numerics, passivedouble tol, CNumerics* viscNumerics = nullptr) const {
+    const auto nPoint = geometry->GetnPoint();
+    const auto nEdge = geometry->GetnEdge();
+    const bool centered = config->GetKind_ConvNumScheme_Flow() == SPACE_CENTERED;
+    const bool dynamicGrid = config->GetDynamic_Grid();
+    const bool incompressible = config->GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE;
+
+    CSysVector<su2double> res, resRef;
+    res.Initialize(nPoint, nPoint, nVar, 0.0);
+    resRef.Initialize(nPoint, nPoint, nVar, 0.0);
+
+    CSysMatrix<su2mixedfloat> jac, jacRef;
+    jac.Initialize(nPoint, nPoint, nVar, nVar, true, geometry.get(), config.get());
+    jacRef.Initialize(nPoint, nPoint, nVar, nVar, true, geometry.get(), config.get());
+
+    /*--- Vectorized, batches of edges as in CFVMFlowSolverBase::EdgeFluxResidual. ---*/
+
+    std::unique_ptr<CNumericsSIMD> simdNumerics(CNumericsSIMD::CreateNumerics(*config, 3, MESH_0));
+    REQUIRE(simdNumerics != nullptr);
+
+    for (auto k = 0ul; k < nEdge; k += Double::Size) {
+      Int iEdge;
+      Double mask;
+      for (auto j = 0ul; j < Double::Size; ++j) {
+        bool in = (k + j < nEdge);
+        mask[j] = in;
+        iEdge[j] = k + j * in;
+      }
+      simdNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::COLORING, mask, res, jac);
+    }
+
+    /*--- Scalar. ---*/
+
+    su2double jacobian_i[nVar][nVar], jacobian_j[nVar][nVar];
+    su2double *jacPtr_i[nVar], *jacPtr_j[nVar];
+    for (auto iVar = 0u; iVar < nVar; ++iVar) {
+      jacPtr_i[iVar] = jacobian_i[iVar];
+      jacPtr_j[iVar] = jacobian_j[iVar];
+    }
+
+    for (auto iEdge = 0ul; iEdge < nEdge; ++iEdge) {
+      const auto iPoint = geometry->edges->GetNode(iEdge, 0);
+      const auto jPoint = geometry->edges->GetNode(iEdge, 1);
+      const auto* normal = geometry->edges->GetNormal(iEdge);
+
+      numerics.SetNormal(normal);
+      numerics.SetPrimitive(nodes->GetPrimitive(iPoint), nodes->GetPrimitive(jPoint));
+      if (centered) {
+        numerics.SetNeighbor(geometry->nodes->GetnNeighbor(iPoint), geometry->nodes->GetnNeighbor(jPoint));
+        numerics.SetLambda(nodes->GetLambda(iPoint), nodes->GetLambda(jPoint));
+        numerics.SetUndivided_Laplacian(nodes->GetUndivided_Laplacian(iPoint), nodes->GetUndivided_Laplacian(jPoint));
+        numerics.SetSensor(nodes->GetSensor(iPoint), nodes->GetSensor(jPoint));
+      }
+      if (dynamicGrid) {
+        numerics.SetGridVel(geometry->nodes->GetGridVel(iPoint), geometry->nodes->GetGridVel(jPoint));
+      }
+      auto residual = numerics.ComputeResidual(config.get());
+
+      for (auto iVar = 0u; iVar < nVar; ++iVar) {
+        for (auto jVar = 0u; jVar < nVar; ++jVar) {
+          jacobian_i[iVar][jVar] = residual.jacobian_i[iVar][jVar];
+          jacobian_j[iVar][jVar] = residual.jacobian_j[iVar][jVar];
+        }
+      }
+
+      /*--- The scalar incompressible schemes apply the grid motion correction of the Jacobians
+       *    once per variable (it is inside their loop over variables), the vectorized schemes
+       *    apply it once (see incGridMotionCorrection), remove the extra contributions. ---*/
+
+      if (incompressible && dynamicGrid) {
+        const CIncEulerVariable::CIndices<unsigned short> idx(3, 0);
+        const auto* V_i = nodes->GetPrimitive(iPoint);
+        const auto* V_j = nodes->GetPrimitive(jPoint);
+        const su2double projGridVel = 0.5 * (GeometryToolbox::DotProduct(3, geometry->nodes->GetGridVel(iPoint), normal) +
+                                             GeometryToolbox::DotProduct(3, geometry->nodes->GetGridVel(jPoint), normal));
+        const su2double extra = (nVar - 1) * 0.5 * projGridVel;
+        for (auto iDim = 0u; iDim < 3; ++iDim) {
+          jacobian_i[iDim + 1][iDim + 1] += extra * V_i[idx.Density()];
+          jacobian_j[iDim + 1][iDim + 1] += extra * V_j[idx.Density()];
+        }
+        if (config->GetEnergy_Equation()) {
+          jacobian_i[4][4] += extra * V_i[idx.Density()] * V_i[idx.CpTotal()];
+          jacobian_j[4][4] += extra * V_j[idx.Density()] * V_j[idx.CpTotal()];
+        }
+      }
+
+      resRef.AddBlock(iPoint, residual);
+      resRef.SubtractBlock(jPoint, residual);
+      jacRef.UpdateBlocks(iEdge, iPoint, jPoint, jacPtr_i, jacPtr_j);
+
+      if (viscNumerics == nullptr) continue;
+
+      viscNumerics->SetCoord(geometry->nodes->GetCoord(iPoint), geometry->nodes->GetCoord(jPoint));
+      viscNumerics->SetNormal(normal);
+      viscNumerics->SetPrimitive(nodes->GetPrimitive(iPoint), nodes->GetPrimitive(jPoint));
+      viscNumerics->SetPrimVarGradient(nodes->GetGradient_Primitive(iPoint), nodes->GetGradient_Primitive(jPoint));
+      auto visc = viscNumerics->ComputeResidual(config.get());
+
+      resRef.SubtractBlock(iPoint, visc);
+      resRef.AddBlock(jPoint, visc);
+      jacRef.UpdateBlocksSub(iEdge, iPoint, jPoint, visc.jacobian_i, visc.jacobian_j);
+    }
+
+    for (auto i = 0ul; i < nPoint * nVar; ++i) {
+      REQUIRE(res[i] == Approx(resRef[i]).epsilon(tol).margin(tol));
+    }
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      for (const auto jPoint : geometry->nodes->GetPoints(iPoint)) {
+        const auto* blk = jac.GetBlock(iPoint, jPoint);
+        const auto* blkRef = jacRef.GetBlock(iPoint, jPoint);
+        for (auto k = 0ul; k < nVar * nVar; ++k) REQUIRE(blk[k] == Approx(blkRef[k]).epsilon(tol).margin(tol));
+      }
+    }
+  }
+};
+
+TEST_CASE("HLLC", "[CNumericsSIMD]") {
+  const EdgeNumericsTestCase test("HLLC");
+  CUpwHLLC_Flow numerics(3, 5, test.config.get());
+  test.Compare(numerics, 1e-10);
+}
+
+TEST_CASE("AUSM", "[CNumericsSIMD]") {
+  const EdgeNumericsTestCase test("AUSM");
+  CUpwAUSM_Flow numerics(3, 5, test.config.get());
+  test.Compare(numerics, 1e-10);
+}
+
+TEST_CASE("AUSM+up", "[CNumericsSIMD]") {
+  /*--- The scalar implementation has analytical Jacobians, hence only the approximate ones are compared. ---*/
+  const EdgeNumericsTestCase test("AUSMPLUSUP");
+  CUpwAUSMPLUSUP_Flow numerics(3, 5, test.config.get());
+  test.Compare(numerics, 1e-10);
+
+  const EdgeNumericsTestCase test2("AUSMPLUSUP2", "USE_ACCURATE_FLUX_JACOBIANS= YES\n");
+  CUpwAUSMPLUSUP2_Flow numerics2(3, 5, test2.config.get());
+  test2.Compare(numerics2, 1e-10);
+}
+
+TEST_CASE("SLAU", "[CNumericsSIMD]") {
+  const EdgeNumericsTestCase test("SLAU", "USE_ACCURATE_FLUX_JACOBIANS= YES\n");
+  CUpwSLAU_Flow numerics(3, 5, test.config.get(), false);
+  test.Compare(numerics, 1e-10);
+
+  const EdgeNumericsTestCase test2("SLAU2");
+  CUpwSLAU2_Flow numerics2(3, 5, test2.config.get(), false);
+  test2.Compare(numerics2, 1e-10);
+}
+
+TEST_CASE("FDS incompressible", "[CNumericsSIMD]") {
+  const EdgeNumericsTestCase test("FDS", "", "INC_EULER");
+  CUpwFDSInc_Flow numerics(3, 5, test.config.get());
+  test.Compare(numerics, 1e-10);
+}
+
+TEST_CASE("Centered incompressible", "[CNumericsSIMD]") {
+  const EdgeNumericsTestCase test("JST", "", "INC_EULER");
+  CCentJSTInc_Flow numerics(3, 5, test.config.get());
+  test.Compare(numerics, 1e-10);
+
+  const EdgeNumericsTestCase test2("LAX-FRIEDRICH", "", "INC_EULER");
+  CCentLaxInc_Flow numerics2(3, 5, test2.config.get());
+  test2.Compare(numerics2, 1e-10);
+}
+
+TEST_CASE("Viscous incompressible", "[CNumericsSIMD]") {
+  for (const string scheme : {"JST", "FDS"}) {
+    const EdgeNumericsTestCase test(scheme, "INC_ENERGY_EQUATION= YES\nVISCOSITY_MODEL= CONSTANT_VISCOSITY\n",
+                                    "INC_NAVIER_STOKES");
+    CAvgGradInc_Flow viscNumerics(3, 5, true, test.config.get());
+    if (scheme == "JST") {
+      CCentJSTInc_Flow numerics(3, 5, test.config.get());
+      test.Compare(numerics, 1e-10, &viscNumerics);
+    } else {
+      CUpwFDSInc_Flow numerics(3, 5, test.config.get());
+      test.Compare(numerics, 1e-10, &viscNumerics);
+    }
+  }
+}
+
+TEST_CASE("Incompressible grid motion", "[CNumericsSIMD]") {
+  /*--- The Jacobians differ by design, see the note in EdgeNumericsTestCase::Compare. ---*/
+  const string motion =
+      "TIME_DOMAIN= YES\n"
+      "TIME_MARCHING= DUAL_TIME_STEPPING-2ND_ORDER\n"
+      "TIME_STEP= 0.01\n"
+      "GRID_MOVEMENT= RIGID_MOTION\n"
+      "INC_ENERGY_EQUATION= YES\n"
+      "VISCOSITY_MODEL= CONSTANT_VISCOSITY\n";
+
+  const EdgeNumericsTestCase test("JST", motion, "INC_NAVIER_STOKES");
+  CCentJSTInc_Flow numerics(3, 5, test.config.get());
+  CAvgGradInc_Flow viscNumerics(3, 5, true, test.config.get());
+  test.Compare(numerics, 1e-10, &viscNumerics);
+
+  const EdgeNumericsTestCase test2("FDS", motion, "INC_NAVIER_STOKES");
+  CUpwFDSInc_Flow numerics2(3, 5, test2.config.get());
+  CAvgGradInc_Flow viscNumerics2(3, 5, true, test2.config.get());
+  test2.Compare(numerics2, 1e-10, &viscNumerics2);
+}
+
+/*!
+ * \brief Minimal solver to pass variables to CNumericsSIMD::CreateScalarNumerics.
+ */
+class CNodesOnlySolver final : public CSolver {
+  CVariable* nodes;
+  const su2double* constants;
+  CVariable* GetBaseClassPointerToNodes() override { return nodes; }
+
+ public:
+  CNodesOnlySolver(CVariable* nodes_, unsigned short nVar_, unsigned short nPrimVarGrad_,
+                   const su2double* constants_ = nullptr) : nodes(nodes_), constants(constants_) {
+    nVar = nVar_;
+    nPrimVarGrad = nPrimVarGrad_;
+    SetBaseClassPointerToNodes();
+  }
+  const su2double* GetConstants() const override { return constants; }
+};
+
+/*!
+ * \brief Compare the vectorized scalar numerics (upwind convection and diffusion) with the scalar ones,
+ * assembled as in CScalarSolver::Upwind_Residual and CScalarSolver::Viscous_Residual_impl (or _NonCons).
+ * \param[in] setSolverSpecific - Sets the solver specific inputs of the viscous numerics, (numerics, iPoint, jPoint).
+ */
+template <class SolverSpecificFunc>
+void CompareScalarNumerics(const EdgeNumericsTestCase& test, unsigned short iSol, const CSolver* const* solvers,
+                           CVariable& scalar, CNumerics& convNumerics, CNumerics& viscNumerics, bool conservative,
+                           const SolverSpecificFunc& setSolverSpecific, passivedouble tolJac) {
+  const auto& config = *test.config;
+  const auto& geometry = *test.geometry;
+  const auto nPoint = geometry.GetnPoint();
+  const auto nEdge = geometry.GetnEdge();
+  const auto nVar = solvers[iSol]->GetnVar();
+
+  std::unique_ptr<CNumericsSIMD> simdNumerics(CNumericsSIMD::CreateScalarNumerics(config, 3, iSol, solvers));
+  REQUIRE(simdNumerics != nullptr);
+
+  CSysVector<su2double> res, resRef;
+  res.Initialize(nPoint, nPoint, nVar, 0.0);
+  resRef.Initialize(nPoint, nPoint, nVar, 0.0);
+
+  CSysMatrix<su2mixedfloat> jac, jacRef;
+  jac.Initialize(nPoint, nPoint, nVar, nVar, true, test.geometry.get(), test.config.get());
+  jacRef.Initialize(nPoint, nPoint, nVar, nVar, true, test.geometry.get(), test.config.get());
+
+  for (auto k = 0ul; k < nEdge; k += Double::Size) {
+    Int iEdge;
+    Double mask;
+    for (auto j = 0ul; j < Double::Size; ++j) {
+      bool in = (k + j < nEdge);
+      mask[j] = in;
+      iEdge[j] = k + j * in;
+    }
+    simdNumerics->ComputeFlux(iEdge, config, geometry, scalar, UpdateType::COLORING, mask, res, jac);
+  }
+
+  /*--- Scalar. ---*/
+
+  auto viscousFlux = [&](unsigned long iPoint, unsigned long jPoint, const su2double* normal) {
+    viscNumerics.SetCoord(geometry.nodes->GetCoord(iPoint), geometry.nodes->GetCoord(jPoint));
+    viscNumerics.SetNormal(normal);
+    viscNumerics.SetPrimitive(test.nodes->GetPrimitive(iPoint), test.nodes->GetPrimitive(jPoint));
+    viscNumerics.SetScalarVar(scalar.GetSolution(iPoint), scalar.GetSolution(jPoint));
+    viscNumerics.SetScalarVarGradient(scalar.GetGradient(iPoint), scalar.GetGradient(jPoint));
+    setSolverSpecific(viscNumerics, iPoint, jPoint);
+    return viscNumerics.ComputeResidual(&config);
+  };
+
+  for (auto iEdge = 0ul; iEdge < nEdge; ++iEdge) {
+    const auto iPoint = geometry.edges->GetNode(iEdge, 0);
+    const auto jPoint = geometry.edges->GetNode(iEdge, 1);
+    const auto* normal = geometry.edges->GetNormal(iEdge);
+
+    convNumerics.SetNormal(normal);
+    convNumerics.SetPrimitive(test.nodes->GetPrimitive(iPoint), test.nodes->GetPrimitive(jPoint));
+    convNumerics.SetScalarVar(scalar.GetSolution(iPoint), scalar.GetSolution(jPoint));
+    auto conv = convNumerics.ComputeResidual(&config);
+
+    resRef.AddBlock(iPoint, conv);
+    resRef.SubtractBlock(jPoint, conv);
+    jacRef.UpdateBlocks(iEdge, iPoint, jPoint, conv.jacobian_i, conv.jacobian_j);
+
+    if (conservative) {
+      auto visc = viscousFlux(iPoint, jPoint, normal);
+      resRef.SubtractBlock(iPoint, visc);
+      resRef.AddBlock(jPoint, visc);
+      jacRef.UpdateBlocksSub(iEdge, iPoint, jPoint, visc.jacobian_i, visc.jacobian_j);
+      continue;
+    }
+
+    /*--- Each side of the edge sees a different flux. ---*/
+
+    auto visc_ij = viscousFlux(iPoint, jPoint, normal);
+    resRef.SubtractBlock(iPoint, visc_ij);
+    jacRef.SubtractBlock(iPoint, iPoint, visc_ij.jacobian_i);
+    jacRef.SubtractBlock(iPoint, jPoint, visc_ij.jacobian_j);
+
+    su2double flipped[3];
+    for (auto iDim = 0u; iDim < 3; ++iDim) flipped[iDim] = -normal[iDim];
+
+    auto visc_ji = viscousFlux(jPoint, iPoint, flipped);
+    resRef.SubtractBlock(jPoint, visc_ji);
+    jacRef.SubtractBlock(jPoint, iPoint, visc_ji.jacobian_j);
+    jacRef.SubtractBlock(jPoint, jPoint, visc_ji.jacobian_i);
+  }
+
+  for (auto i = 0ul; i < nPoint * nVar; ++i) {
+    REQUIRE(res[i] == Approx(resRef[i]).epsilon(1e-10).margin(1e-10));
+  }
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    for (const auto jPoint : geometry.nodes->GetPoints(iPoint)) {
+      const auto* blk = jac.GetBlock(iPoint, jPoint);
+      const auto* blkRef = jacRef.GetBlock(iPoint, jPoint);
+      for (auto k = 0ul; k < nVar * nVar; ++k) REQUIRE(blk[k] == Approx(blkRef[k]).epsilon(tolJac).margin(tolJac));
+    }
+  }
+}
+
+using FlowIndices = CEulerVariable::CIndices<unsigned short>;
+
+TEST_CASE("Species upwind and diffusion", "[CNumericsSIMD]") {
+  const EdgeNumericsTestCase test("ROE",
+                                  "KIND_SCALAR_MODEL= SPECIES_TRANSPORT\n"
+                                  "CONV_NUM_METHOD_SPECIES= SCALAR_UPWIND\n"
+                                  "MUSCL_SPECIES= NO\n"
+                                  "DIFFUSIVITY_CONSTANT= 0.01\n"
+                                  "REYNOLDS_NUMBER= 1e6\n",
+                                  "NAVIER_STOKES");
+  /*--- As in CFluidIteration, the generic MUSCL and limiter options are set for the species. ---*/
+  test.config->SetGlobalParam(MAIN_SOLVER::NAVIER_STOKES, RUNTIME_SPECIES_SYS);
+  const auto& config = *test.config;
+  const auto nPoint = test.geometry->GetnPoint();
+  constexpr unsigned short nVar = 2;
+
+  /*--- Species state, with arbitrary gradients and diffusivities. ---*/
+
+  const su2double speciesInf[nVar] = {0.2, 0.3};
+  CSpeciesVariable species(speciesInf, nPoint, 3, nVar, &config);
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    for (auto iVar = 0u; iVar < nVar; ++iVar) {
+      species.SetSolution(iPoint, iVar, 0.5 + 0.4 * sin(0.9 * iPoint + iVar));
+      species.SetDiffusivity(iPoint, 0.01 * (2 + cos(1.1 * iPoint + iVar)), iVar);
+      for (auto iDim = 0u; iDim < 3; ++iDim) {
+        species.GetGradient()(iPoint, iVar, iDim) = cos(0.3 * iPoint + iVar + 1.7 * iDim);
+      }
+    }
+  }
+
+  CNodesOnlySolver flowSolver(test.nodes.get(), 5, 5);
+  CNodesOnlySolver speciesSolver(&species, nVar, 0);
+  const CSolver* solvers[MAX_SOLS] = {nullptr};
+  solvers[FLOW_SOL] = &flowSolver;
+  solvers[SPECIES_SOL] = &speciesSolver;
+
+  CUpwSca_Species<FlowIndices> convNumerics(3, nVar, &config);
+  CAvgGrad_Species<FlowIndices> viscNumerics(3, nVar, true, &config);
+
+  auto setDiffusivity = [&](CNumerics& numerics, unsigned long iPoint, unsigned long jPoint) {
+    numerics.SetDiffusionCoeff(species.GetDiffusivity(iPoint), species.GetDiffusivity(jPoint));
+  };
+  CompareScalarNumerics(test, SPECIES_SOL, solvers, species, convNumerics, viscNumerics, true, setDiffusivity, 1e-6);
+}
+
+/*!
+ * \brief Arbitrary turbulence (or transition) variables and gradients.
+ */
+void SetScalarState(CVariable& vars, unsigned long nPoint, unsigned short nVar, const su2double* mean,
+                    const su2double* amplitude) {
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    for (auto iVar = 0u; iVar < nVar; ++iVar) {
+      vars.SetSolution(iPoint, iVar, mean[iVar] + amplitude[iVar] * sin(0.9 * iPoint + iVar));
+      for (auto iDim = 0u; iDim < 3; ++iDim) {
+        vars.GetGradient()(iPoint, iVar, iDim) = amplitude[iVar] * cos(0.3 * iPoint + iVar + 1.7 * iDim);
+      }
+    }
+  }
+}
+
+TEST_CASE("SA upwind and diffusion", "[CNumericsSIMD]") {
+  auto noSpecificInputs = [](CNumerics&, unsigned long, unsigned long) {};
+
+  for (const bool negative : {false, true}) {
+    /*--- The accurate Jacobians only affect the standard model. ---*/
+    const EdgeNumericsTestCase test("ROE",
+                                    "KIND_TURB_MODEL= SA\n"
+                                    "CONV_NUM_METHOD_TURB= SCALAR_UPWIND\n"
+                                    "MUSCL_TURB= NO\n"
+                                    "USE_ACCURATE_TURB_JACOBIANS= YES\n"
+                                    "REYNOLDS_NUMBER= 1e6\n" +
+                                    string(negative ? "SA_OPTIONS= NEGATIVE, WITHFT2\n" : ""),
+                                    "RANS");
+    test.config->SetGlobalParam(MAIN_SOLVER::RANS, RUNTIME_TURB_SYS);
+    auto& config = *test.config;
+    const auto nPoint = test.geometry->GetnPoint();
+
+    /*--- Nu tilde changes sign for the negative model. ---*/
+    CTurbSAVariable turb(0.0, 0.0, nPoint, 3, 1, &config);
+    const su2double mean = negative ? 0.0 : 2e-3, amplitude = 1e-3;
+    SetScalarState(turb, nPoint, 1, &mean, &amplitude);
+
+    CNodesOnlySolver flowSolver(test.nodes.get(), 5, 5);
+    CNodesOnlySolver turbSolver(&turb, 1, 0);
+    const CSolver* solvers[MAX_SOLS] = {nullptr};
+    solvers[FLOW_SOL] = &flowSolver;
+    solvers[TURB_SOL] = &turbSolver;
+
+    CUpwSca_TurbSA<FlowIndices> convNumerics(3, 1, &config);
+    std::unique_ptr<CNumerics> viscNumerics;
+    if (negative) viscNumerics.reset(new CAvgGrad_TurbSA_Neg<FlowIndices>(3, 1, true, &config));
+    else viscNumerics.reset(new CAvgGrad_TurbSA<FlowIndices>(3, 1, true, &config));
+
+    CompareScalarNumerics(test, TURB_SOL, solvers, turb, convNumerics, *viscNumerics, false, noSpecificInputs, 1e-6);
+  }
+}
+
+TEST_CASE("SST upwind and diffusion", "[CNumericsSIMD]") {
+  const EdgeNumericsTestCase test("ROE",
+                                  "KIND_TURB_MODEL= SST\n"
+                                  "CONV_NUM_METHOD_TURB= SCALAR_UPWIND\n"
+                                  "MUSCL_TURB= NO\n"
+                                  "USE_ACCURATE_TURB_JACOBIANS= YES\n"
+                                  "REYNOLDS_NUMBER= 1e6\n",
+                                  "RANS");
+  test.config->SetGlobalParam(MAIN_SOLVER::RANS, RUNTIME_TURB_SYS);
+  auto& config = *test.config;
+  const auto nPoint = test.geometry->GetnPoint();
+
+  /*--- As in CTurbSSTSolver. ---*/
+  const su2double constants[] = {0.85, 1.0, 0.5, 0.856, 0.075, 0.0828, 0.09, 0.31, 0.0, 0.0, 20.0};
+
+  CTurbSSTVariable turb(0.0, 0.0, 0.0, nPoint, 3, 2, constants, &config);
+  const su2double mean[] = {1e-3, 100.0}, amplitude[] = {5e-4, 50.0};
+  SetScalarState(turb, nPoint, 2, mean, amplitude);
+
+  /*--- Blending functions between 0 and 1. ---*/
+  FlowIndices idx(3, 0);
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    const auto* prim = test.nodes->GetPrimitive(iPoint);
+    turb.SetBlendingFunc(iPoint, prim[idx.LaminarViscosity()], 0.01 * (1 + iPoint % 5), prim[idx.Density()],
+                         TURB_TRANS_MODEL::NONE);
+  }
+
+  CNodesOnlySolver turbSolver(&turb, 2, 0, constants);
+  CNodesOnlySolver flowSolver(test.nodes.get(), 5, 5);
+  const CSolver* solvers[MAX_SOLS] = {nullptr};
+  solvers[FLOW_SOL] = &flowSolver;
+  solvers[TURB_SOL] = &turbSolver;
+
+  CUpwSca_TurbSST<FlowIndices> convNumerics(3, 2, &config);
+  CAvgGrad_TurbSST<FlowIndices> viscNumerics(3, 2, constants, true, &config);
+
+  auto setF1 = [&](CNumerics& numerics, unsigned long iPoint, unsigned long jPoint) {
+    numerics.SetF1blending(turb.GetF1blending(iPoint), turb.GetF1blending(jPoint));
+  };
+  CompareScalarNumerics(test, TURB_SOL, solvers, turb, convNumerics, viscNumerics, false, setF1, 1e-6);
+}
+
+TEST_CASE("LM upwind and diffusion", "[CNumericsSIMD]") {
+  const EdgeNumericsTestCase test("ROE",
+                                  "KIND_TURB_MODEL= SST\n"
+                                  "KIND_TRANS_MODEL= LM\n"
+                                  "CONV_NUM_METHOD_TURB= SCALAR_UPWIND\n"
+                                  "MUSCL_TURB= NO\n"
+                                  "REYNOLDS_NUMBER= 1e6\n",
+                                  "RANS");
+  test.config->SetGlobalParam(MAIN_SOLVER::RANS, RUNTIME_TRANS_SYS);
+  auto& config = *test.config;
+  const auto nPoint = test.geometry->GetnPoint();
+
+  CTransLMVariable trans(1.0, 100.0, 1.0, 1.0, nPoint, 3, 2, &config);
+  const su2double mean[] = {0.5, 200.0}, amplitude[] = {0.4, 100.0};
+  SetScalarState(trans, nPoint, 2, mean, amplitude);
+
+  CNodesOnlySolver flowSolver(test.nodes.get(), 5, 5);
+  CNodesOnlySolver transSolver(&trans, 2, 0);
+  const CSolver* solvers[MAX_SOLS] = {nullptr};
+  solvers[FLOW_SOL] = &flowSolver;
+  solvers[TRANS_SOL] = &transSolver;
+
+  CUpwSca_TransLM<FlowIndices> convNumerics(3, 2, &config);
+  CAvgGrad_TransLM<FlowIndices> viscNumerics(3, 2, true, &config);
+
+  auto noSpecificInputs = [](CNumerics&, unsigned long, unsigned long) {};
+  CompareScalarNumerics(test, TRANS_SOL, solvers, trans, convNumerics, viscNumerics, true, noSpecificInputs, 1e-6);
+}
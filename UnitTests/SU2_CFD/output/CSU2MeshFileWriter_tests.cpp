@@ -0,0 +1,121 @@
+/*!
+ * \file CSU2MeshFileWriter_tests.cpp
+ * \brief Unit tests for the SU2 mesh writer and the binary mesh reader.
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cstdio>
+#include "../../UnitQuadTestCase.hpp"
+#include "../../../SU2_CFD/include/output/filewriter/CFVMDataSorter.hpp"
+#include "../../../SU2_CFD/include/output/filewriter/CSU2MeshFileWriter.hpp"
+
+TEST_CASE("SU2 binary mesh round trip", "[SU2MeshWriter]") {
+  /*--- Reference mesh. ---*/
+
+  UnitQuadTestCase box;
+  box.InitConfig();
+  box.InitGeometry();
+  auto* geometry = box.geometry.get();
+  auto* config = box.config.get();
+
+  cout.rdbuf(nullptr);
+  const auto reference = std::unique_ptr<CGeometry>(new CPhysicalGeometry(config, 0, 1));
+
+  /*--- The writer takes the markers from the boundary file written by SU2_DEF
+   (from the geometry as it was read, i.e. with global indices). ---*/
+
+  {
+    ofstream boundary_file("boundary.dat");
+    boundary_file << "NMARK= " << reference->GetnMarker() << "\n";
+    for (auto iMarker = 0u; iMarker < reference->GetnMarker(); iMarker++) {
+      boundary_file << "MARKER_TAG= " << config->GetMarker_All_TagBound(iMarker) << "\n";
+      boundary_file << "MARKER_ELEMS= " << reference->GetnElem_Bound(iMarker) << "\n";
+      boundary_file << "SEND_TO= 0\n";
+      for (auto iElem = 0ul; iElem < reference->GetnElem_Bound(iMarker); iElem++) {
+        const auto* bound = reference->bound[iMarker][iElem];
+        boundary_file << bound->GetVTK_Type();
+        for (auto iNode = 0u; iNode < bound->GetnNodes(); iNode++) boundary_file << "\t" << bound->GetNode(iNode);
+        boundary_file << "\n";
+      }
+    }
+  }
+
+  /*--- Write the mesh in binary format. ---*/
+
+  {
+    CFVMDataSorter sorter(config, geometry, {"x", "y", "z"});
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); iPoint++)
+      for (auto iDim = 0u; iDim < geometry->GetnDim(); iDim++)
+        sorter.SetUnsortedData(iPoint, iDim, geometry->nodes->GetCoord(iPoint, iDim));
+    sorter.SortOutputData();
+    sorter.SortConnectivity(config, geometry, true);
+
+    CSU2MeshFileWriter writer(&sorter, 0, 1, true);
+    writer.WriteData("binary_mesh_test");
+  }
+
+  /*--- Read it back. ---*/
+
+  UnitQuadTestCase binary;
+  const string boxFormat = "MESH_FORMAT= BOX\n";
+  binary.config_options.replace(binary.config_options.find(boxFormat), boxFormat.size(),
+                                "MESH_FORMAT= SU2_BINARY\nMESH_FILENAME= binary_mesh_test.su2b\n");
+  binary.InitConfig();
+  cout.rdbuf(nullptr);
+  const auto result = std::unique_ptr<CGeometry>(new CPhysicalGeometry(binary.config.get(), 0, 1));
+  cout.rdbuf(box.orig_buf);
+
+  remove("boundary.dat");
+  remove("binary_mesh_test.su2b");
+
+  REQUIRE(result->GetnDim() == reference->GetnDim());
+  REQUIRE(result->GetnPoint() == reference->GetnPoint());
+  REQUIRE(result->GetnElem() == reference->GetnElem());
+  REQUIRE(result->GetnMarker() == reference->GetnMarker());
+
+  CHECK(result->GetnElemHexa() == 64);
+
+  for (auto iPoint = 0ul; iPoint < reference->GetnPoint(); iPoint++) {
+    for (auto iDim = 0u; iDim < reference->GetnDim(); iDim++) {
+      CHECK(result->nodes->GetCoord(iPoint, iDim) == reference->nodes->GetCoord(iPoint, iDim));
+    }
+  }
+
+  for (auto iElem = 0ul; iElem < reference->GetnElem(); iElem++) {
+    REQUIRE(result->elem[iElem]->GetVTK_Type() == reference->elem[iElem]->GetVTK_Type());
+    for (auto iNode = 0u; iNode < reference->elem[iElem]->GetnNodes(); iNode++) {
+      CHECK(result->elem[iElem]->GetNode(iNode) == reference->elem[iElem]->GetNode(iNode));
+    }
+  }
+
+  for (auto iMarker = 0u; iMarker < reference->GetnMarker(); iMarker++) {
+    CHECK(binary.config->GetMarker_All_TagBound(iMarker) == config->GetMarker_All_TagBound(iMarker));
+    REQUIRE(result->GetnElem_Bound(iMarker) == reference->GetnElem_Bound(iMarker));
+    for (auto iElem = 0ul; iElem < reference->GetnElem_Bound(iMarker); iElem++) {
+      for (auto iNode = 0u; iNode < reference->bound[iMarker][iElem]->GetnNodes(); iNode++) {
+        CHECK(result->bound[iMarker][iElem]->GetNode(iNode) == reference->bound[iMarker][iElem]->GetNode(iNode));
+      }
+    }
+  }
+}